@@ -29,9 +29,14 @@
 #include "mfx_enctools_utils.h"
 
 #include <vector>
+#include <deque>
+#include <map>
 #include <memory>
 #include <assert.h>
 #include <algorithm>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
 
 using namespace EncToolsUtils;
 using namespace EncToolsBRC;
@@ -59,6 +64,33 @@ private:
     mfxFrameAllocResponse m_VppResponse;
     std::vector<mfxFrameSurface1> m_pIntSurfaces; // internal surfaces
 
+    // asynchronous analysis (mfxEncToolsCtrlExtAsync), the worker runs the tasks in submission order
+    struct AsyncTask
+    {
+        bool                       bFrame;     // frame to analyze or encode result to report
+        bool                       bDiscard;   // frame to drop after the encode results queued before
+        mfxU32                     dispOrder;
+        mfxFrameSurface1           surface;
+        mfxEncToolsBRCEncodeResult encRes;
+    };
+
+    bool m_bAsync;
+    bool m_bAsyncStop;
+    bool m_bAsyncBusy;
+    mfxStatus m_asyncSts;              // first error of the worker
+    std::deque<AsyncTask> m_asyncTasks;
+    std::condition_variable m_asyncTaskReady;
+    std::condition_variable m_asyncTaskDone;
+    std::thread m_asyncWorker;
+
+    // shared analysis (mfxEncToolsCtrlExtShared)
+    EncTools *m_pShared;               // instance analyzing the frames for this one
+    std::vector<EncTools const *> m_sharedUsers;  // instances using the analysis of this one
+    std::map<mfxU32, std::vector<EncTools const *>> m_sharedDiscards; // instances which discarded the frames not yet completed
+    std::condition_variable m_sharedFrameReady;
+
+    std::mutex m_scdMutex;             // guards m_scd and the state above, the worker and the users of the analysis reach m_scd too
+
 public:
     EncTools() :
 
@@ -68,7 +100,12 @@ public:
         m_device(0),
         m_pAllocator(0),
         m_mfxVppParams(),
-        m_VppResponse()
+        m_VppResponse(),
+        m_bAsync(false),
+        m_bAsyncStop(false),
+        m_bAsyncBusy(false),
+        m_asyncSts(MFX_ERR_NONE),
+        m_pShared(nullptr)
     {}
 
     virtual ~EncTools() { Close(); }
@@ -89,6 +126,21 @@ protected:
     mfxStatus InitVPP(mfxEncToolsCtrl const & ctrl);
     mfxStatus CloseVPP();
     mfxStatus VPPDownScaleSurface(mfxFrameSurface1 *pInSurface, mfxFrameSurface1 *pOutSurface);
+    mfxStatus AnalyzeFrame(mfxFrameSurface1 *pSurface, AEncFrame &res);
+
+    mfxStatus StartAsync();
+    void StopAsync(bool bDrain);
+    mfxStatus SubmitAsync(AsyncTask const & task);
+    mfxStatus WaitAsync(std::unique_lock<std::mutex> &lock, mfxU32 displayOrder, mfxU32 timeOut);
+    void AsyncRoutine();
+
+    mfxStatus AttachShared(EncTools const *pUser, mfxEncToolsCtrl const & ctrl, mfxExtEncToolsConfig *config);
+    mfxStatus CheckShared(mfxEncToolsCtrl const & ctrl);
+    void DetachShared(EncTools const *pUser);
+    mfxStatus QueryAnalysis(mfxU32 displayOrder, mfxEncToolsHintPreEncodeSceneChange *pPreEncSC,
+        mfxEncToolsHintPreEncodeGOP *pPreEncGOP, mfxEncToolsHintPreEncodeARefFrames *pPreEncARef, mfxU32 timeOut, bool bUser);
+    mfxStatus CompleteFrame(mfxU32 displayOrder, EncTools const *pInstance);
+    mfxStatus DropFrame(mfxU32 displayOrder);
 };
 
 namespace EncToolsFuncs
@@ -224,12 +276,5 @@ inline bool isFieldMode(mfxEncToolsCtrl const & ctrl)
     return ((ctrl.CodecId == MFX_CODEC_HEVC) && !(ctrl.FrameInfo.PicStruct & MFX_PICSTRUCT_PROGRESSIVE));
 }
 
-struct CompareByDisplayOrder
-{
-    mfxU32 m_DispOrder;
-    CompareByDisplayOrder(mfxU32 frameOrder) : m_DispOrder(frameOrder) {}
-    bool operator ()(BRC_FrameStruct const & frameStruct) const { return frameStruct.dispOrder == m_DispOrder; }
-};
-
 
 #endif
@@ -45,6 +45,10 @@ public:
     mfxStatus GetInputFrameInfo(mfxFrameInfo &frameInfo);
     void Close();
     mfxStatus SubmitFrame(mfxFrameSurface1 *surface);
+    // SubmitFrame split in two, AnalyzeFrame doesn't touch the output frames
+    mfxStatus AnalyzeFrame(mfxFrameSurface1 *surface, AEncFrame &res);
+    void AddOutFrame(AEncFrame const & res) { m_outframes.push_back(res); }
+    bool IsOutFrameReady(mfxU32 displayOrder) const;
     mfxStatus ReportEncResult(mfxU32 dispOrder, mfxEncToolsBRCEncodeResult const & pEncRes);
     mfxStatus GetSCDecision(mfxU32 displayOrder, mfxEncToolsHintPreEncodeSceneChange *pPreEncSC);
     mfxStatus GetGOPDecision(mfxU32 displayOrder, mfxEncToolsHintPreEncodeGOP *pPreEncGOP);
@@ -79,6 +79,106 @@ struct BRC_FrameStruct
 };
 
 
+// Per frame BRC state indexed by display order. A newer frame takes the slot of the frame Size()
+// display orders before it once that frame is released, the ring grows while the frame is in flight.
+class BRC_FrameStructRing
+{
+public:
+    BRC_FrameStructRing() : m_mask(0) {}
+
+    void Init(mfxU32 minSize)
+    {
+        mfxU32 size = 1;
+        while (size < minSize)
+            size <<= 1;
+
+        m_frames.assign(size, BRC_FrameStruct());
+        m_used.assign(size, false);
+        m_done.assign(size, false);
+        m_mask = size - 1;
+    }
+    // grows the ring to minSize at least, the frames in flight are kept
+    void Reserve(mfxU32 minSize)
+    {
+        if (!m_frames.empty() && Size() < minSize)
+            Rehash(minSize);
+    }
+    void Close()
+    {
+        m_frames.clear();
+        m_used.clear();
+        m_done.clear();
+        m_mask = 0;
+    }
+    mfxU32 Size() const { return (mfxU32)m_frames.size(); }
+
+    BRC_FrameStruct* Find(mfxU32 dispOrder)
+    {
+        if (m_frames.empty())
+            return nullptr;
+        mfxU32 i = dispOrder & m_mask;
+        return (m_used[i] && m_frames[i].dispOrder == dispOrder) ? &m_frames[i] : nullptr;
+    }
+    BRC_FrameStruct* Add(BRC_FrameStruct const & frameStruct)
+    {
+        if (m_frames.empty())
+            return nullptr;
+        mfxU32 i = frameStruct.dispOrder & m_mask;
+        // the grown ring may still map an older frame in flight to the same slot
+        while (m_used[i] && !m_done[i] && m_frames[i].dispOrder != frameStruct.dispOrder)
+        {
+            Rehash(2 * Size());
+            i = frameStruct.dispOrder & m_mask;
+        }
+        m_frames[i] = frameStruct;
+        m_used[i] = true;
+        m_done[i] = false;
+        return &m_frames[i];
+    }
+    // the frame is encoded or dropped, its slot may be taken by a newer frame
+    void Release(mfxU32 dispOrder)
+    {
+        if (Find(dispOrder))
+            m_done[dispOrder & m_mask] = true;
+    }
+
+protected:
+    std::vector<BRC_FrameStruct> m_frames;
+    std::vector<bool>            m_used;
+    std::vector<bool>            m_done;
+    mfxU32                       m_mask;
+
+    void Rehash(mfxU32 minSize)
+    {
+        std::vector<BRC_FrameStruct> frames;
+        std::vector<bool> used, done;
+        frames.swap(m_frames);
+        used.swap(m_used);
+        done.swap(m_done);
+
+        // the size doubles until no two frames in flight share a slot
+        for (mfxU32 size = minSize;; size = 2 * Size())
+        {
+            Init(size);
+
+            bool bFits = true;
+            for (size_t j = 0; j < frames.size() && bFits; j++)
+            {
+                if (!used[j] || done[j])
+                    continue;
+                mfxU32 i = frames[j].dispOrder & m_mask;
+                bFits = !m_used[i];
+                m_frames[i] = frames[j];
+                m_used[i] = true;
+            }
+            if (bFits)
+                break;
+        }
+    }
+};
+
+// frames in flight besides the lookahead and the reordering, covers the encoder's async depth
+#define BRC_FRAME_STRUCT_RING_MARGIN 64
 
 class BRC_EncTool
 {
@@ -98,6 +198,7 @@ public:
     mfxStatus Reset(mfxEncToolsCtrl const & ctrl);
     void Close()
     {
+        m_FrameStruct.Close();
         m_bInit = false;
     }
 
@@ -107,6 +208,8 @@ public:
     mfxStatus ReportGopHints(mfxU32 dispOrder, mfxEncToolsHintPreEncodeGOP const & pGopHints);
     mfxStatus ProcessFrame(mfxU32 dispOrder, mfxEncToolsBRCQuantControl *pFrameQp);
     mfxStatus UpdateFrame(mfxU32 dispOrder, mfxEncToolsBRCStatus *pFrameSts);
+    // the encoder is done with the frame, also for frames with hints only which were never encoded
+    void Discard(mfxU32 dispOrder) { m_FrameStruct.Release(dispOrder); }
 
 
 protected:
@@ -118,7 +221,7 @@ protected:
     std::unique_ptr<AVGBitrate> m_avg;
     mfxU32     m_SkipCount;
     mfxU32     m_ReEncodeCount;
-    std::vector<BRC_FrameStruct> m_FrameStruct;
+    BRC_FrameStructRing m_FrameStruct;
 
     mfxI32 GetCurQP(mfxU32 type, mfxI32 layer, mfxU16 isRef, mfxU16 qpMod) const;
     mfxI32 GetSeqQP(mfxI32 qp, mfxU32 type, mfxI32 layer, mfxU16 isRef, mfxU16 qpMod) const;
@@ -110,6 +110,80 @@ struct BRC_Ctx
     mfxF64 eRateSH;             // eRate of last encoded scene change frame, this parameter is used for scene change calculation
 };
 
+// Sizes of the last 'capacity' frames kept as a ring of running (prefix)
+// sums, so the bits of any number of the last frames are one subtraction.
+// Every sum is kept twice: of the real sizes and of the sizes raised to a
+// minimum (skipped frames counted as minBits). The size of the last frame
+// can be replaced (recode).
+class FrameBitsHistory
+{
+public:
+    FrameBitsHistory(mfxU32 capacity = 1, mfxU32 initBits = 0, mfxU32 minBits = 0)
+    {
+        Init(capacity, initBits, minBits);
+    }
+
+    // the history starts with 'capacity' frames of initBits
+    void Init(mfxU32 capacity, mfxU32 initBits, mfxU32 minBits)
+    {
+        m_capacity = capacity > 0 ? capacity : 1;
+        m_minBits  = minBits;
+        m_count    = 0;
+        m_prefix.assign(m_capacity + 1, Sums());
+
+        for (mfxU32 i = 0; i < m_capacity; i++)
+            Add(initBits);
+    }
+
+    void Add(mfxU32 bits)
+    {
+        Sums const & prev = m_prefix[m_count % m_prefix.size()];
+        m_count++;
+        m_prefix[m_count % m_prefix.size()] = prev + Sums(bits, std::max(bits, m_minBits));
+    }
+
+    void ReplaceLast(mfxU32 bits)
+    {
+        Sums const & prev = m_prefix[(m_count - 1) % m_prefix.size()];
+        m_prefix[m_count % m_prefix.size()] = prev + Sums(bits, std::max(bits, m_minBits));
+    }
+
+    // bits of the last numFrames frames (at most capacity)
+    mfxU64 GetSum(mfxU32 numFrames, bool bMinBits) const
+    {
+        numFrames = std::min(numFrames, m_capacity);
+        return Get(m_prefix[m_count % m_prefix.size()], bMinBits) -
+               Get(m_prefix[(m_count - numFrames) % m_prefix.size()], bMinBits);
+    }
+
+    // bits of all frames added so far, the difference of two totals is the
+    // size of the frames between them
+    mfxU64 GetTotal(bool bMinBits) const
+    {
+        return Get(m_prefix[m_count % m_prefix.size()], bMinBits);
+    }
+
+    mfxU32 GetCapacity() const { return m_capacity; }
+    mfxU64 GetCount()    const { return m_count; }
+
+protected:
+    struct Sums
+    {
+        Sums(mfxU64 b = 0, mfxU64 m = 0) : bits(b), minBits(m) {}
+        Sums operator+(Sums const & other) const { return Sums(bits + other.bits, minBits + other.minBits); }
+
+        mfxU64 bits;
+        mfxU64 minBits;
+    };
+
+    static mfxU64 Get(Sums const & sums, bool bMinBits) { return bMinBits ? sums.minBits : sums.bits; }
+
+    mfxU32            m_capacity;
+    mfxU32            m_minBits;
+    mfxU64            m_count;   // frames added, including the initial ones
+    std::vector<Sums> m_prefix;  // prefix sums of the last capacity + 1 frames
+};
+
 class AVGBitrate
 {
 public:
@@ -117,17 +191,13 @@ public:
         m_maxWinBits(maxBitPerFrame*windowSize),
         m_maxWinBitsLim(0),
         m_avgBitPerFrame(std::min(avgBitPerFrame, maxBitPerFrame)),
-        m_currPosInWindow(windowSize - 1),
         m_lastFrameOrder(mfxU32(-1)),
         m_bLA(bLA)
 
     {
         windowSize = windowSize > 0 ? windowSize : 1; // kw
-        m_slidingWindow.resize(windowSize);
-        for (mfxU32 i = 0; i < windowSize; i++)
-        {
-            m_slidingWindow[i] = maxBitPerFrame / 3; //initial value to prevent big first frames
-        }
+        //initial value to prevent big first frames
+        m_slidingWindow.Init(windowSize, maxBitPerFrame / 3, m_avgBitPerFrame / 3);
         m_maxWinBitsLim = GetMaxWinBitsLim();
     }
     virtual ~AVGBitrate()
@@ -136,15 +206,16 @@ public:
     }
     void UpdateSlidingWindow(mfxU32  sizeInBits, mfxU32  FrameOrder, bool bPanic, bool bSH, mfxU32 recode, mfxU32 /* qp */)
     {
-        mfxU32 windowSize = (mfxU32)m_slidingWindow.size();
+        mfxU32 windowSize = GetWindowSize();
         bool   bNextFrame = FrameOrder != m_lastFrameOrder;
 
         if (bNextFrame)
         {
             m_lastFrameOrder = FrameOrder;
-            m_currPosInWindow = (m_currPosInWindow + 1) % windowSize;
+            m_slidingWindow.Add(sizeInBits);
         }
-        m_slidingWindow[m_currPosInWindow] = sizeInBits;
+        else
+            m_slidingWindow.ReplaceLast(sizeInBits);
 
         if (bNextFrame)
         {
@@ -175,22 +246,18 @@ public:
             maxWinBitsLim = m_maxWinBits;
         maxWinBitsLim = std::min(maxWinBitsLim + recode * GetStep() / 2, m_maxWinBits);
 
-        mfxU32 maxFrameSize = winBits >= m_maxWinBitsLim ?
-            mfxU32(std::max((mfxI32)m_maxWinBits - (mfxI32)winBits, 1)) :
-            maxWinBitsLim - winBits;
-
-        return maxFrameSize;
+        return GetMaxFrameSize(winBits, maxWinBitsLim);
     }
 
     mfxU32 GetWindowSize() const
     {
-        return (mfxU32)m_slidingWindow.size();
+        return m_slidingWindow.GetCapacity();
     }
 
     mfxI32 GetBudget(mfxU32 numFrames) const
     {
-        numFrames = std::min(mfxU32(m_slidingWindow.size()), numFrames);
-        return ((mfxI32)m_maxWinBitsLim - (mfxI32)GetLastFrameBits((mfxU32)m_slidingWindow.size() - numFrames, true));
+        numFrames = std::min(GetWindowSize(), numFrames);
+        return ((mfxI32)m_maxWinBitsLim - (mfxI32)GetLastFrameBits(GetWindowSize() - numFrames, true));
     }
 
 protected:
@@ -199,25 +266,20 @@ protected:
     mfxU32                      m_maxWinBitsLim;
     mfxU32                      m_avgBitPerFrame;
 
-    mfxU32                      m_currPosInWindow;
     mfxU32                      m_lastFrameOrder;
     bool                        m_bLA;
-    std::vector<mfxU32>         m_slidingWindow;
+    FrameBitsHistory            m_slidingWindow;  // skipped frames count as m_avgBitPerFrame / 3
 
 
     mfxU32 GetLastFrameBits(mfxU32 numFrames, bool bCheckSkip) const
     {
-        mfxU32 size = 0;
-        numFrames = numFrames < m_slidingWindow.size() ? numFrames : (mfxU32)m_slidingWindow.size();
-        for (mfxU32 i = 0; i < numFrames; i++)
-        {
-            mfxU32 frame_size = m_slidingWindow[(m_currPosInWindow + m_slidingWindow.size() - i) % m_slidingWindow.size()];
-            if (bCheckSkip && (frame_size < m_avgBitPerFrame / 3))
-                frame_size = m_avgBitPerFrame / 3;
-            size += frame_size;
-            //printf("GetLastFrames: %d) %d sum %d\n",i,m_slidingWindow[(m_currPosInWindow + m_slidingWindow.size() - i) % m_slidingWindow.size() ], size);
-        }
-        return size;
+        return (mfxU32)m_slidingWindow.GetSum(numFrames, bCheckSkip);
+    }
+    mfxU32 GetMaxFrameSize(mfxU32 winBits, mfxU32 maxWinBitsLim) const
+    {
+        return winBits >= m_maxWinBitsLim ?
+            mfxU32(std::max((mfxI32)m_maxWinBits - (mfxI32)winBits, 1)) :
+            maxWinBitsLim - winBits;
     }
     mfxU32 GetStep() const
     {
@@ -230,6 +292,124 @@ protected:
     }
 };
 
+// Bitrate caps over several sliding windows at once (e.g. 1 and 2 seconds)
+// and per fixed segment (e.g. ABR segments of N frames), all checked against
+// one frame history with a subtraction per window.
+class MultiWindowBitrate
+{
+public:
+    MultiWindowBitrate() :
+        m_lastFrameOrder(mfxU32(-1))
+    {}
+
+    // windows are added before the first frame
+    void AddWindow(mfxU32 windowSize, mfxU64 maxWinBits)
+    {
+        m_windows.push_back({ std::max(windowSize, 1u), maxWinBits, false });
+        m_history.Init(GetMaxWindowSize(), 0, 0);
+    }
+
+    void AddSegment(mfxU32 segmentSize, mfxU64 maxSegmentBits)
+    {
+        m_windows.push_back({ std::max(segmentSize, 1u), maxSegmentBits, true });
+        m_history.Init(GetMaxWindowSize(), 0, 0);
+    }
+
+    mfxU32 GetNumWindows() const { return (mfxU32)m_windows.size(); }
+
+    // the same FrameOrder again replaces the size of the last frame (recode)
+    void UpdateFrame(mfxU32 sizeInBits, mfxU32 FrameOrder)
+    {
+        if (FrameOrder == m_lastFrameOrder)
+        {
+            m_history.ReplaceLast(sizeInBits);
+            return;
+        }
+
+        m_lastFrameOrder = FrameOrder;
+        m_history.Add(sizeInBits);
+    }
+
+    // bits of window i including the last frame
+    mfxU64 GetWindowBits(mfxU32 i) const
+    {
+        Window const & win = m_windows[i];
+
+        if (!win.bSegment)
+            return m_history.GetSum(win.size, false);
+        if (GetNumFrames() == 0)
+            return 0;
+        return m_history.GetSum((mfxU32)((GetNumFrames() - 1) % win.size + 1), false);
+    }
+
+    mfxU64 GetWindowLimit(mfxU32 i) const { return m_windows[i].maxBits; }
+
+    // the largest next frame all windows accept, 0 if one is already full
+    mfxU32 GetMaxFrameSize() const
+    {
+        return GetMaxFrameSizeAt(0, 0);
+    }
+
+    // GetMaxFrameSize() of every frame of a minigop in encoding order,
+    // assuming the frames before it get their plannedBits
+    void GetMaxFrameSizes(const mfxU32 *plannedBits, mfxU32 numFrames, mfxU32 *maxFrameSize) const
+    {
+        std::vector<mfxU64> plannedPrefix(numFrames + 1, 0);
+
+        for (mfxU32 i = 0; i < numFrames; i++)
+            plannedPrefix[i + 1] = plannedPrefix[i] + plannedBits[i];
+
+        for (mfxU32 i = 0; i < numFrames; i++)
+            maxFrameSize[i] = GetMaxFrameSizeAt(i, &plannedPrefix[0]);
+    }
+
+protected:
+    struct Window
+    {
+        mfxU32 size;     // in frames
+        mfxU64 maxBits;
+        bool   bSegment; // windows restart every 'size' frames
+    };
+
+    // frames passed to UpdateFrame, the history starts with empty frames
+    mfxU64 GetNumFrames() const { return m_history.GetCount() - m_history.GetCapacity(); }
+
+    mfxU32 GetMaxWindowSize() const
+    {
+        mfxU32 size = 1;
+        for (Window const & win : m_windows)
+            size = std::max(size, win.size);
+        return size;
+    }
+
+    // max size of the frame numPlanned frames after the next one, plannedPrefix
+    // holds the prefix sums of the planned sizes
+    mfxU32 GetMaxFrameSizeAt(mfxU32 numPlanned, const mfxU64 *plannedPrefix) const
+    {
+        mfxU64 frame = GetNumFrames() + numPlanned; // index of the frame
+        mfxU64 maxFrameSize = UINT_MAX;
+
+        for (Window const & win : m_windows)
+        {
+            // frames of the window before this one
+            mfxU64 numBefore = win.bSegment ? frame % win.size : win.size - 1;
+            mfxU64 numPlannedBefore = std::min<mfxU64>(numBefore, numPlanned);
+            mfxU64 bits = m_history.GetSum((mfxU32)(numBefore - numPlannedBefore), false);
+
+            if (numPlannedBefore)
+                bits += plannedPrefix[numPlanned] - plannedPrefix[numPlanned - numPlannedBefore];
+
+            maxFrameSize = std::min(maxFrameSize, bits < win.maxBits ? win.maxBits - bits : 0);
+        }
+
+        return (mfxU32)maxFrameSize;
+    }
+
+    std::vector<Window> m_windows;
+    FrameBitsHistory    m_history;
+    mfxU32              m_lastFrameOrder;
+};
+
 class cBRCParams
 {
 public:
@@ -107,6 +107,17 @@ bool AEnc_EncTool::DoDownScaling(mfxFrameInfo const & frameInfo)
 using namespace EncToolsUtils;
 
 mfxStatus AEnc_EncTool::SubmitFrame(mfxFrameSurface1 *surface)
+{
+    AEncFrame res;
+    mfxStatus sts = AnalyzeFrame(surface, res);
+    MFX_CHECK_STS(sts);
+
+    m_outframes.push_back(res);
+
+    return sts;
+}
+
+mfxStatus AEnc_EncTool::AnalyzeFrame(mfxFrameSurface1 *surface, AEncFrame &res)
 {
     MFX_CHECK_NULL_PTR1(surface);
     MFX_CHECK(m_bInit, MFX_ERR_NOT_INITIALIZED);
@@ -139,18 +150,21 @@ mfxStatus AEnc_EncTool::SubmitFrame(mfxFrameSurface1 *surface)
         MFX_CHECK_STS(sts);
     }
 
-    AEncFrame res;
     sts = AEncProcessFrame(m_aenc, surface->Data.FrameOrder, pS, pitch, &res);
     if (MFX_ERR_NONE != sts)
         return MFX_ERR_MORE_DATA;
     //else
     //    res.print();
 
-    m_outframes.push_back(res);
-
     return sts;
 }
 
+bool AEnc_EncTool::IsOutFrameReady(mfxU32 displayOrder) const
+{
+    return std::any_of(m_outframes.begin(), m_outframes.end(),
+        [displayOrder](AEncFrame const & extframe) { return extframe.POC == displayOrder; });
+}
+
 
  mfxStatus AEnc_EncTool::FindOutFrame(mfxU32 displayOrder)
 {
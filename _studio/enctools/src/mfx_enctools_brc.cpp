@@ -358,6 +358,12 @@ mfxI32 BRC_EncTool::GetPicQP(mfxI32 pqp, mfxU32 type, mfxI32 layer, mfxU16 isRef
 }
 
 
+static mfxU32 GetFrameStructRingSize(mfxEncToolsCtrl const & ctrl)
+{
+    mfxU32 framesInFlight = ctrl.MaxDelayInFrames + ctrl.MaxGopRefDist + BRC_FRAME_STRUCT_RING_MARGIN;
+    return isFieldMode(ctrl) ? 2 * framesInFlight : framesInFlight;
+}
+
 mfxStatus BRC_EncTool::Init(mfxEncToolsCtrl const & ctrl)
 {
     MFX_CHECK(!m_bInit, MFX_ERR_UNDEFINED_BEHAVIOR);
@@ -377,6 +383,8 @@ mfxStatus BRC_EncTool::Init(mfxEncToolsCtrl const & ctrl)
     }
     m_ctx = {};
 
+    m_FrameStruct.Init(GetFrameStructRingSize(ctrl));
+
     m_ctx.fAbLong = m_par.inputBitsPerFrame;
     m_ctx.fAbShort = m_par.inputBitsPerFrame;
 
@@ -416,6 +424,9 @@ mfxStatus BRC_EncTool::Reset(mfxEncToolsCtrl const & ctrl)
         sts = m_par.GetBRCResetType(ctrl, false, brcReset, slidingWindowReset);
         MFX_CHECK_STS(sts);
 
+        // the frames in flight of the previous parameters are kept
+        m_FrameStruct.Reserve(GetFrameStructRingSize(ctrl));
+
         if (brcReset)
         {
             sts = m_par.Init(ctrl, isFieldMode(ctrl));
@@ -447,11 +458,11 @@ mfxStatus BRC_EncTool::UpdateFrame(mfxU32 dispOrder, mfxEncToolsBRCStatus *pFram
     MFX_CHECK(m_bInit, MFX_ERR_NOT_INITIALIZED);
     MFX_CHECK_NULL_PTR1(pFrameSts);
 
-    auto frameStructItr = std::find_if(m_FrameStruct.begin(), m_FrameStruct.end(), CompareByDisplayOrder(dispOrder));
-    if (frameStructItr == m_FrameStruct.end())
+    BRC_FrameStruct const *pFrameStruct = m_FrameStruct.Find(dispOrder);
+    if (!pFrameStruct)
         return MFX_ERR_UNDEFINED_BEHAVIOR; // BRC hasn't processed the frame
 
-    BRC_FrameStruct frameStruct = *frameStructItr;
+    BRC_FrameStruct frameStruct = *pFrameStruct;
 
     mfxI32 bitsEncoded = frameStruct.frameSize * 8;
     mfxI32 qpY = frameStruct.qp + m_par.quantOffset;
@@ -889,6 +900,9 @@ mfxStatus BRC_EncTool::UpdateFrame(mfxU32 dispOrder, mfxEncToolsBRCStatus *pFram
         {
             m_hrdSpec->Update(bitsEncoded, frameStruct.encOrder, bIdr);
         }
+
+        // no recode, the frame is done
+        m_FrameStruct.Release(dispOrder);
     }
 
     return sts;
@@ -900,10 +914,10 @@ mfxStatus BRC_EncTool::ProcessFrame(mfxU32 dispOrder, mfxEncToolsBRCQuantControl
     MFX_CHECK(m_bInit, MFX_ERR_NOT_INITIALIZED);
     MFX_CHECK_NULL_PTR1(pFrameQp);
 
-    auto frameStructItr = std::find_if(m_FrameStruct.begin(), m_FrameStruct.end(), CompareByDisplayOrder(dispOrder));
-    if (frameStructItr == m_FrameStruct.end())
+    BRC_FrameStruct const *pFrameStruct = m_FrameStruct.Find(dispOrder);
+    if (!pFrameStruct)
         return MFX_ERR_UNDEFINED_BEHAVIOR; // BRC hasn't processed the frame
-    BRC_FrameStruct frameStruct = *frameStructItr;
+    BRC_FrameStruct frameStruct = *pFrameStruct;
 
 #if (MFX_VERSION >= 1026)
     mfxU16 ParSceneChange = frameStruct.sceneChange;
@@ -1124,8 +1138,8 @@ mfxStatus BRC_EncTool::ProcessFrame(mfxU32 dispOrder, mfxEncToolsBRCQuantControl
 
 mfxStatus BRC_EncTool::ReportEncResult(mfxU32 dispOrder, mfxEncToolsBRCEncodeResult const & pEncRes)
 {
-    auto frameStruct = std::find_if(m_FrameStruct.begin(), m_FrameStruct.end(), CompareByDisplayOrder(dispOrder));
-    if (frameStruct == m_FrameStruct.end())
+    BRC_FrameStruct *frameStruct = m_FrameStruct.Find(dispOrder);
+    if (!frameStruct)
     {
         return MFX_ERR_UNDEFINED_BEHAVIOR; // BRC gets encoding results for the frame it hasn't set QP for
     }
@@ -1138,16 +1152,15 @@ mfxStatus BRC_EncTool::ReportEncResult(mfxU32 dispOrder, mfxEncToolsBRCEncodeRes
 
 mfxStatus BRC_EncTool::SetFrameStruct(mfxU32 dispOrder, mfxEncToolsBRCFrameParams  const & pFrameStruct)
 {
-    auto frameStruct = std::find_if(m_FrameStruct.begin(), m_FrameStruct.end(), CompareByDisplayOrder(dispOrder));
-    if (frameStruct == m_FrameStruct.end())
+    BRC_FrameStruct *frameStruct = m_FrameStruct.Find(dispOrder);
+    if (!frameStruct)
     {
         BRC_FrameStruct frStruct;
         frStruct.dispOrder = dispOrder;
         frStruct.frameType = pFrameStruct.FrameType;
         frStruct.pyrLayer = pFrameStruct.PyramidLayer;
         frStruct.encOrder = pFrameStruct.EncodeOrder;
-        m_FrameStruct.push_back(frStruct);
-        frameStruct = m_FrameStruct.end() - 1;
+        m_FrameStruct.Add(frStruct);
     }
     else
     {
@@ -1161,15 +1174,14 @@ mfxStatus BRC_EncTool::SetFrameStruct(mfxU32 dispOrder, mfxEncToolsBRCFrameParam
 
 mfxStatus BRC_EncTool::ReportBufferHints(mfxU32 dispOrder, mfxEncToolsBRCBufferHint const & pBufHints)
 {
-    auto frameStruct = std::find_if(m_FrameStruct.begin(), m_FrameStruct.end(), CompareByDisplayOrder(dispOrder));
-    if (frameStruct == m_FrameStruct.end())
+    BRC_FrameStruct *frameStruct = m_FrameStruct.Find(dispOrder);
+    if (!frameStruct)
     {
         BRC_FrameStruct frStruct;
         frStruct.dispOrder = dispOrder;
         frStruct.OptimalFrameSizeInBytes = pBufHints.OptimalFrameSizeInBytes;
         //frStruct.optimalBufferFullness = pBufHints.OptimalBufferFullness;
-        m_FrameStruct.push_back(frStruct);
-        frameStruct = m_FrameStruct.end() - 1;
+        m_FrameStruct.Add(frStruct);
     }
     else
     {
@@ -1181,15 +1193,14 @@ mfxStatus BRC_EncTool::ReportBufferHints(mfxU32 dispOrder, mfxEncToolsBRCBufferH
 
 mfxStatus BRC_EncTool::ReportGopHints(mfxU32 dispOrder, mfxEncToolsHintPreEncodeGOP const & pGopHints)
 {
-    auto frameStruct = std::find_if(m_FrameStruct.begin(), m_FrameStruct.end(), CompareByDisplayOrder(dispOrder));
-    if (frameStruct == m_FrameStruct.end())
+    BRC_FrameStruct *frameStruct = m_FrameStruct.Find(dispOrder);
+    if (!frameStruct)
     {
         BRC_FrameStruct frStruct;
         frStruct.dispOrder = dispOrder;
         frStruct.qpDelta = pGopHints.QPDelta;
         frStruct.qpModulation = pGopHints.QPModulation;
-        m_FrameStruct.push_back(frStruct);
-        frameStruct = m_FrameStruct.end() - 1;
+        m_FrameStruct.Add(frStruct);
     }
     else
     {
@@ -21,6 +21,7 @@
 #include "mfx_enctools.h"
 #include <algorithm>
 #include <math.h>
+#include <limits.h>
 
 mfxExtBuffer* Et_GetExtBuffer(mfxExtBuffer** extBuf, mfxU32 numExtBuf, mfxU32 id)
 {
@@ -189,6 +190,15 @@ inline bool isPreEncLA(mfxExtEncToolsConfig const & conf, mfxEncToolsCtrl const
          IsOn(conf.AdaptivePyramidQuantP)));
 }
 
+// the hints of the shared analysis are valid for instances with the same GOP structure
+inline bool isSameAnalysis(mfxEncToolsCtrl const & ctrl1, mfxEncToolsCtrl const & ctrl2)
+{
+    return ctrl1.MaxGopSize == ctrl2.MaxGopSize
+        && ctrl1.MaxGopRefDist == ctrl2.MaxGopRefDist
+        && ctrl1.MaxIDRDist == ctrl2.MaxIDRDist
+        && ctrl1.ScenarioInfo == ctrl2.ScenarioInfo;
+}
+
 mfxStatus EncTools::GetSupportedConfig(mfxExtEncToolsConfig* config, mfxEncToolsCtrl const * ctrl)
 {
     MFX_CHECK_NULL_PTR2(config, ctrl);
@@ -406,7 +416,19 @@ mfxStatus EncTools::Init(mfxExtEncToolsConfig const * pConfig, mfxEncToolsCtrl c
         MFX_CHECK_STS(sts);
         m_config.BRC = MFX_CODINGOPTION_ON;
     }
-    if (isPreEncSCD(*pConfig, *ctrl))
+
+    mfxEncToolsCtrlExtShared *extShared = (mfxEncToolsCtrlExtShared *)Et_GetExtBuffer(ctrl->ExtParam, ctrl->NumExtParam, MFX_EXTBUFF_ENCTOOLS_SHARED);
+    if (isPreEncSCD(*pConfig, *ctrl) && extShared && extShared->SharedAnalysis)
+    {
+        // no analysis of its own, the tools are the ones of the shared instance
+        mfxEncTools *pShared = (mfxEncTools *)extShared->SharedAnalysis;
+        MFX_CHECK(pShared->Context && pShared->Context != this, MFX_ERR_UNDEFINED_BEHAVIOR);
+
+        sts = ((EncTools *)pShared->Context)->AttachShared(this, *ctrl, &m_config);
+        MFX_CHECK_STS(sts);
+        m_pShared = (EncTools *)pShared->Context;
+    }
+    else if (isPreEncSCD(*pConfig, *ctrl))
     {
         sts = m_scd.Init(*ctrl, *pConfig);
         MFX_CHECK_STS(sts);
@@ -415,7 +437,7 @@ mfxStatus EncTools::Init(mfxExtEncToolsConfig const * pConfig, mfxEncToolsCtrl c
     }
 
     mfxU16 crW = ctrl->FrameInfo.CropW ? ctrl->FrameInfo.CropW : ctrl->FrameInfo.Width;
-    if ((isPreEncSCD(m_config, *ctrl) || (isPreEncLA(m_config, *ctrl) && crW >= 720)) && (ctrl->IOPattern & MFX_IOPATTERN_IN_VIDEO_MEMORY))
+    if (((isPreEncSCD(m_config, *ctrl) && !m_pShared) || (isPreEncLA(m_config, *ctrl) && crW >= 720)) && (ctrl->IOPattern & MFX_IOPATTERN_IN_VIDEO_MEMORY))
     {
         mfxEncToolsCtrlExtDevice *extDevice = (mfxEncToolsCtrlExtDevice *)Et_GetExtBuffer(ctrl->ExtParam, ctrl->NumExtParam, MFX_EXTBUFF_ENCTOOLS_DEVICE);
         if (extDevice)
@@ -438,6 +460,13 @@ mfxStatus EncTools::Init(mfxExtEncToolsConfig const * pConfig, mfxEncToolsCtrl c
         MFX_CHECK_STS(sts);
     }
 
+    mfxEncToolsCtrlExtAsync *extAsync = (mfxEncToolsCtrlExtAsync *)Et_GetExtBuffer(ctrl->ExtParam, ctrl->NumExtParam, MFX_EXTBUFF_ENCTOOLS_ASYNC);
+    if (extAsync && IsOn(extAsync->AsyncAnalysis) && isPreEncSCD(m_config, *ctrl) && !m_pShared)
+    {
+        sts = StartAsync();
+        MFX_CHECK_STS(sts);
+    }
+
     m_bInit = true;
     return sts;
 }
@@ -447,6 +476,17 @@ mfxStatus EncTools::Close()
     mfxStatus sts = MFX_ERR_NONE;
     MFX_CHECK(m_bInit, MFX_ERR_NOT_INITIALIZED);
 
+    if (!m_pShared)
+    {
+        // the users of the shared analysis are closed first, they still read it
+        std::lock_guard<std::mutex> lock(m_scdMutex);
+        MFX_CHECK(m_sharedUsers.empty(), MFX_ERR_UNDEFINED_BEHAVIOR);
+    }
+
+    // frames still in the queue are dropped, their surfaces may be already released
+    if (m_bAsync)
+        StopAsync(false);
+
     if (IsOn(m_config.BRC))
     {
         m_brc.Close();
@@ -454,7 +494,16 @@ mfxStatus EncTools::Close()
     }
     if (isPreEncSCD(m_config, m_ctrl))
     {
-        m_scd.Close();
+        if (m_pShared)
+        {
+            m_pShared->DetachShared(this);
+            m_pShared = nullptr;
+        }
+        else
+        {
+            m_scd.Close();
+            m_sharedDiscards.clear();
+        }
         OffPreEncSCDTools(&m_config);
     }
 
@@ -472,12 +521,25 @@ mfxStatus EncTools::Reset(mfxExtEncToolsConfig const * config, mfxEncToolsCtrl c
     MFX_CHECK_NULL_PTR2(config,ctrl);
     MFX_CHECK(m_bInit, MFX_ERR_NOT_INITIALIZED);
 
+    bool bAsync = m_bAsync;
+    if (bAsync)
+        StopAsync(true);
+
     if (IsOn(config->BRC))
     {
         MFX_CHECK(m_config.BRC, MFX_ERR_UNSUPPORTED);
         sts = m_brc.Reset(*ctrl);
     }
-    if (isPreEncSCD(*config, *ctrl))
+    if (isPreEncSCD(*config, *ctrl) && m_pShared)
+    {
+        sts = m_pShared->CheckShared(*ctrl);
+    }
+    else if (isPreEncSCD(*config, *ctrl) && !m_sharedUsers.empty())
+    {
+        // the users read the frames analyzed so far, the analysis goes on as is
+        sts = CheckShared(*ctrl);
+    }
+    else if (isPreEncSCD(*config, *ctrl))
     {
         // to add check if Close/Init is real needed
         if (isPreEncSCD(m_config, m_ctrl))
@@ -485,6 +547,9 @@ mfxStatus EncTools::Reset(mfxExtEncToolsConfig const * config, mfxEncToolsCtrl c
         sts = m_scd.Init(*ctrl, *config);
     }
 
+    if (bAsync && sts == MFX_ERR_NONE)
+        sts = StartAsync();
+
     return sts;
 }
 
@@ -504,6 +569,267 @@ mfxStatus EncTools::VPPDownScaleSurface(mfxFrameSurface1 *pInSurface, mfxFrameSu
     return MFX_ERR_NONE;
 }
 
+mfxStatus EncTools::AnalyzeFrame(mfxFrameSurface1 *pSurface, AEncFrame &res)
+{
+    if (!m_bVPPInit || !(m_ctrl.IOPattern & MFX_IOPATTERN_IN_VIDEO_MEMORY))
+        return m_scd.AnalyzeFrame(pSurface, res);
+
+    mfxStatus sts = VPPDownScaleSurface(pSurface, m_pIntSurfaces.data());
+    MFX_CHECK_STS(sts);
+    m_pIntSurfaces[0].Data.FrameOrder = pSurface->Data.FrameOrder;
+
+    m_pAllocator->Lock(m_pAllocator->pthis, m_pIntSurfaces[0].Data.MemId, &m_pIntSurfaces[0].Data);
+    sts = m_scd.AnalyzeFrame(m_pIntSurfaces.data(), res);
+    m_pAllocator->Unlock(m_pAllocator->pthis, m_pIntSurfaces[0].Data.MemId, &m_pIntSurfaces[0].Data);
+
+    return sts;
+}
+
+mfxStatus EncTools::StartAsync()
+{
+    m_bAsyncStop = false;
+    m_bAsyncBusy = false;
+    m_asyncSts = MFX_ERR_NONE;
+    m_asyncTasks.clear();
+
+    try
+    {
+        m_asyncWorker = std::thread(&EncTools::AsyncRoutine, this);
+    }
+    catch (std::system_error &)
+    {
+        return MFX_ERR_MEMORY_ALLOC;
+    }
+
+    m_bAsync = true;
+    return MFX_ERR_NONE;
+}
+
+void EncTools::StopAsync(bool bDrain)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_scdMutex);
+        if (!bDrain)
+            m_asyncTasks.clear();
+        m_bAsyncStop = true;
+    }
+    m_asyncTaskReady.notify_one();
+    m_asyncWorker.join();
+
+    m_bAsync = false;
+}
+
+mfxStatus EncTools::SubmitAsync(AsyncTask const & task)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_scdMutex);
+        MFX_CHECK_STS(m_asyncSts);
+        m_asyncTasks.push_back(task);
+    }
+    m_asyncTaskReady.notify_one();
+
+    return MFX_ERR_NONE;
+}
+
+// Waits until the frame is analyzed or nothing is left in the queue, in the latter case the caller
+// sees the same state as in the synchronous mode (e.g. it flushes the lookahead at the end of stream).
+mfxStatus EncTools::WaitAsync(std::unique_lock<std::mutex> &lock, mfxU32 displayOrder, mfxU32 timeOut)
+{
+    bool bReady = m_asyncTaskDone.wait_for(lock, std::chrono::milliseconds(timeOut), [this, displayOrder]
+    {
+        return m_asyncSts != MFX_ERR_NONE
+            || (m_asyncTasks.empty() && !m_bAsyncBusy)
+            || m_scd.IsOutFrameReady(displayOrder);
+    });
+    MFX_CHECK_STS(m_asyncSts);
+    MFX_CHECK(bReady, MFX_WRN_IN_EXECUTION);
+
+    return MFX_ERR_NONE;
+}
+
+void EncTools::AsyncRoutine()
+{
+    std::unique_lock<std::mutex> lock(m_scdMutex);
+
+    for (;;)
+    {
+        m_asyncTaskReady.wait(lock, [this] { return m_bAsyncStop || !m_asyncTasks.empty(); });
+        if (m_asyncTasks.empty())
+            break;
+
+        AsyncTask task = m_asyncTasks.front();
+        m_asyncTasks.pop_front();
+        mfxStatus sts = MFX_ERR_NONE;
+
+        if (task.bFrame)
+        {
+            // the analysis runs unlocked, only its result is published under the lock
+            m_bAsyncBusy = true;
+            lock.unlock();
+
+            AEncFrame res = {};
+            sts = AnalyzeFrame(&task.surface, res);
+
+            lock.lock();
+            m_bAsyncBusy = false;
+
+            if (sts == MFX_ERR_NONE)
+            {
+                m_scd.AddOutFrame(res);
+                m_sharedFrameReady.notify_all();
+            }
+            else if (sts == MFX_ERR_MORE_DATA)
+                sts = MFX_ERR_NONE;
+        }
+        else if (task.bDiscard)
+            sts = m_scd.CompleteFrame(task.dispOrder);
+        else
+            m_scd.ReportEncResult(task.dispOrder, task.encRes);
+
+        if (sts < MFX_ERR_NONE && m_asyncSts == MFX_ERR_NONE)
+            m_asyncSts = sts;
+
+        m_asyncTaskDone.notify_all();
+    }
+}
+
+mfxStatus EncTools::AttachShared(EncTools const *pUser, mfxEncToolsCtrl const & ctrl, mfxExtEncToolsConfig *config)
+{
+    std::lock_guard<std::mutex> lock(m_scdMutex);
+    MFX_CHECK(m_bInit && !m_pShared && isPreEncSCD(m_config, m_ctrl), MFX_ERR_UNDEFINED_BEHAVIOR);
+    MFX_CHECK(isSameAnalysis(ctrl, m_ctrl), MFX_ERR_INCOMPATIBLE_VIDEO_PARAM);
+
+    CopyPreEncSCTools(m_config, config);
+    m_sharedUsers.push_back(pUser);
+
+    return MFX_ERR_NONE;
+}
+
+mfxStatus EncTools::CheckShared(mfxEncToolsCtrl const & ctrl)
+{
+    MFX_CHECK(isSameAnalysis(ctrl, m_ctrl), MFX_ERR_INCOMPATIBLE_VIDEO_PARAM);
+    return MFX_ERR_NONE;
+}
+
+void EncTools::DetachShared(EncTools const *pUser)
+{
+    std::lock_guard<std::mutex> lock(m_scdMutex);
+    auto user = std::find(m_sharedUsers.begin(), m_sharedUsers.end(), pUser);
+    assert(user != m_sharedUsers.end());
+    if (user == m_sharedUsers.end())
+        return;
+    m_sharedUsers.erase(user);
+
+    // the frames only the detached user has not discarded yet are complete now
+    for (auto frame = m_sharedDiscards.begin(); frame != m_sharedDiscards.end();)
+    {
+        std::vector<EncTools const *> &discarded = frame->second;
+        discarded.erase(std::remove(discarded.begin(), discarded.end(), pUser), discarded.end());
+
+        if (discarded.size() > m_sharedUsers.size())
+        {
+            // the frame is already out of the lookahead if this fails, nothing is left to release
+            DropFrame(frame->first);
+            frame = m_sharedDiscards.erase(frame);
+        }
+        else if (discarded.empty())
+            frame = m_sharedDiscards.erase(frame);
+        else
+            ++frame;
+    }
+}
+
+mfxStatus EncTools::QueryAnalysis(mfxU32 displayOrder, mfxEncToolsHintPreEncodeSceneChange *pPreEncSC,
+    mfxEncToolsHintPreEncodeGOP *pPreEncGOP, mfxEncToolsHintPreEncodeARefFrames *pPreEncARef, mfxU32 timeOut, bool bUser)
+{
+    mfxStatus sts = MFX_ERR_NONE;
+
+    std::unique_lock<std::mutex> lock(m_scdMutex);
+    if (bUser)
+    {
+        // a user may run ahead of this instance, it waits for the frame instead of flushing the analysis,
+        // the end of stream flush comes from the queries of this instance
+        bool bReady = m_sharedFrameReady.wait_for(lock, std::chrono::milliseconds(timeOut), [this, displayOrder]
+        {
+            return m_asyncSts != MFX_ERR_NONE || m_scd.IsOutFrameReady(displayOrder);
+        });
+        MFX_CHECK_STS(m_asyncSts);
+        MFX_CHECK(bReady, MFX_WRN_IN_EXECUTION);
+    }
+    else if (m_bAsync)
+    {
+        sts = WaitAsync(lock, displayOrder, timeOut);
+        MFX_CHECK(sts == MFX_ERR_NONE, sts);
+    }
+
+    if (pPreEncSC)
+    {
+        sts = m_scd.GetSCDecision(displayOrder, pPreEncSC);
+        MFX_CHECK_STS(sts);
+    }
+    if (pPreEncGOP)
+    {
+        if (isPreEncSCD(m_config, m_ctrl))
+        {
+            sts = m_scd.GetGOPDecision(displayOrder, pPreEncGOP);
+            MFX_CHECK_STS(sts);
+        }
+    }
+    if (pPreEncARef)
+    {
+        sts = m_scd.GetARefDecision(displayOrder, pPreEncARef);
+        MFX_CHECK_STS(sts);
+    }
+
+    // the queries of this instance flush the analysis at the end of stream
+    if (!m_sharedUsers.empty() && !bUser)
+        m_sharedFrameReady.notify_all();
+
+    return sts;
+}
+
+mfxStatus EncTools::CompleteFrame(mfxU32 displayOrder, EncTools const *pInstance)
+{
+    mfxStatus sts = MFX_ERR_NONE;
+
+    std::unique_lock<std::mutex> lock(m_scdMutex);
+    if (m_bAsync)
+    {
+        sts = WaitAsync(lock, displayOrder, UINT_MAX);
+        MFX_CHECK(sts == MFX_ERR_NONE, sts);
+    }
+
+    // the analysis of the frame is kept until this instance and all its users discard the frame
+    if (!m_sharedUsers.empty())
+    {
+        std::vector<EncTools const *> &discarded = m_sharedDiscards[displayOrder];
+        if (std::find(discarded.begin(), discarded.end(), pInstance) == discarded.end())
+            discarded.push_back(pInstance);
+        if (discarded.size() <= m_sharedUsers.size())
+            return MFX_ERR_NONE;
+        m_sharedDiscards.erase(displayOrder);
+    }
+
+    return DropFrame(displayOrder);
+}
+
+// called with m_scdMutex locked
+mfxStatus EncTools::DropFrame(mfxU32 displayOrder)
+{
+    if (m_bAsync)
+    {
+        // the encode result of the frame may be still in the queue
+        AsyncTask task = {};
+        task.bDiscard = true;
+        task.dispOrder = displayOrder;
+        m_asyncTasks.push_back(task);
+        m_asyncTaskReady.notify_one();
+        return MFX_ERR_NONE;
+    }
+
+    return m_scd.CompleteFrame(displayOrder);
+}
+
 mfxStatus EncTools::Submit(mfxEncToolsTaskParam const * par)
 {
     mfxStatus sts = MFX_ERR_NONE;
@@ -515,26 +841,51 @@ mfxStatus EncTools::Submit(mfxEncToolsTaskParam const * par)
     {
         pFrameData->Surface->Data.FrameOrder = par->DisplayOrder;
 
-        if (m_bVPPInit && (m_ctrl.IOPattern & MFX_IOPATTERN_IN_VIDEO_MEMORY) && (isPreEncSCD(m_config, m_ctrl) || isPreEncLA(m_config, m_ctrl)))
+        if (m_pShared)
+            return MFX_ERR_NONE; // the shared instance analyzes the frame
+
+        if (m_bAsync)
         {
-            sts = VPPDownScaleSurface(pFrameData->Surface, m_pIntSurfaces.data());
-            MFX_CHECK_STS(sts);
-            m_pIntSurfaces[0].Data.FrameOrder = pFrameData->Surface->Data.FrameOrder;
+            AsyncTask task = {};
+            task.bFrame = true;
+            task.dispOrder = par->DisplayOrder;
+            task.surface = *pFrameData->Surface;
+            return SubmitAsync(task);
+        }
 
-            if (isPreEncSCD(m_config, m_ctrl))
+        if (isPreEncSCD(m_config, m_ctrl))
+        {
+            std::lock_guard<std::mutex> lock(m_scdMutex);
+            AEncFrame res = {};
+            sts = AnalyzeFrame(pFrameData->Surface, res);
+            if (sts == MFX_ERR_NONE)
             {
-                m_pAllocator->Lock(m_pAllocator->pthis, m_pIntSurfaces[0].Data.MemId, &m_pIntSurfaces[0].Data);
-                sts = m_scd.SubmitFrame(m_pIntSurfaces.data());
-                m_pAllocator->Unlock(m_pAllocator->pthis, m_pIntSurfaces[0].Data.MemId, &m_pIntSurfaces[0].Data);
+                m_scd.AddOutFrame(res);
+                m_sharedFrameReady.notify_all();
             }
         }
-        else if (isPreEncSCD(m_config, m_ctrl))
-            sts = m_scd.SubmitFrame(pFrameData->Surface);
+        else if (m_bVPPInit && (m_ctrl.IOPattern & MFX_IOPATTERN_IN_VIDEO_MEMORY) && isPreEncLA(m_config, m_ctrl))
+        {
+            sts = VPPDownScaleSurface(pFrameData->Surface, m_pIntSurfaces.data());
+            MFX_CHECK_STS(sts);
+            m_pIntSurfaces[0].Data.FrameOrder = pFrameData->Surface->Data.FrameOrder;
+        }
         return sts;
     }
 
     mfxEncToolsBRCEncodeResult  *pEncRes = (mfxEncToolsBRCEncodeResult *)Et_GetExtBuffer(par->ExtParam, par->NumExtParam, MFX_EXTBUFF_ENCTOOLS_BRC_ENCODE_RESULT);
-    if (pEncRes) {
+    if (pEncRes && m_bAsync)
+    {
+        // goes through the queue to reach the analysis after the frames submitted before it
+        AsyncTask task = {};
+        task.dispOrder = par->DisplayOrder;
+        task.encRes = *pEncRes;
+        sts = SubmitAsync(task);
+        MFX_CHECK_STS(sts);
+    }
+    else if (pEncRes && !m_pShared) {
+        // the analysis follows the stream of the shared instance only
+        std::lock_guard<std::mutex> lock(m_scdMutex);
         m_scd.ReportEncResult(par->DisplayOrder, *pEncRes);
     }
     if (pEncRes && IsOn(m_config.BRC))
@@ -564,32 +915,22 @@ mfxStatus EncTools::Submit(mfxEncToolsTaskParam const * par)
     return sts;
 }
 
-mfxStatus EncTools::Query(mfxEncToolsTaskParam* par, mfxU32 /*timeOut*/)
+mfxStatus EncTools::Query(mfxEncToolsTaskParam* par, mfxU32 timeOut)
 {
     mfxStatus sts = MFX_ERR_NONE;
     MFX_CHECK_NULL_PTR1(par);
     MFX_CHECK(m_bInit, MFX_ERR_NOT_INITIALIZED);
 
     mfxEncToolsHintPreEncodeSceneChange *pPreEncSC = (mfxEncToolsHintPreEncodeSceneChange *)Et_GetExtBuffer(par->ExtParam, par->NumExtParam, MFX_EXTBUFF_ENCTOOLS_HINT_SCENE_CHANGE);
-    if (pPreEncSC)
-    {
-        sts = m_scd.GetSCDecision(par->DisplayOrder, pPreEncSC);
-        MFX_CHECK_STS(sts);
-    }
     mfxEncToolsHintPreEncodeGOP *pPreEncGOP = (mfxEncToolsHintPreEncodeGOP *)Et_GetExtBuffer(par->ExtParam, par->NumExtParam, MFX_EXTBUFF_ENCTOOLS_HINT_GOP);
-    if (pPreEncGOP)
-    {
-        if (isPreEncSCD(m_config, m_ctrl))
-        {
-            sts = m_scd.GetGOPDecision(par->DisplayOrder, pPreEncGOP);
-            MFX_CHECK_STS(sts);
-        }
-    }
     mfxEncToolsHintPreEncodeARefFrames *pPreEncARef = (mfxEncToolsHintPreEncodeARefFrames *)Et_GetExtBuffer(par->ExtParam, par->NumExtParam, MFX_EXTBUFF_ENCTOOLS_HINT_AREF);
-    if (pPreEncARef)
+
+    if (pPreEncSC || pPreEncGOP || pPreEncARef)
     {
-        sts = m_scd.GetARefDecision(par->DisplayOrder, pPreEncARef);
-        MFX_CHECK_STS(sts);
+        // the hints are relative (frame types, QP deltas and classes), they apply to any rendition as is
+        EncTools *pAnalysis = m_pShared ? m_pShared : this;
+        sts = pAnalysis->QueryAnalysis(par->DisplayOrder, pPreEncSC, pPreEncGOP, pPreEncARef, timeOut, pAnalysis != this);
+        MFX_CHECK(sts == MFX_ERR_NONE, sts);
     }
 
     mfxEncToolsBRCStatus  *pFrameSts = (mfxEncToolsBRCStatus *)Et_GetExtBuffer(par->ExtParam, par->NumExtParam, MFX_EXTBUFF_ENCTOOLS_BRC_STATUS);
@@ -611,10 +952,11 @@ mfxStatus EncTools::Query(mfxEncToolsTaskParam* par, mfxU32 /*timeOut*/)
 
 mfxStatus EncTools::Discard(mfxU32 displayOrder)
 {
-    mfxStatus sts = MFX_ERR_NONE;
+    if (IsOn(m_config.BRC))
+        m_brc.Discard(displayOrder);
 
-    sts = m_scd.CompleteFrame(displayOrder);
-    return sts;
+    EncTools *pAnalysis = m_pShared ? m_pShared : this;
+    return pAnalysis->CompleteFrame(displayOrder, this);
 }
 
 
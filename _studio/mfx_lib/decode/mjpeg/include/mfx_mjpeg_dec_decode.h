@@ -155,6 +155,10 @@ public:
 
 protected:
     CJpegTask *pLastTask;
+    // Task being collected by DecodeFrameCheck. It is taken out of the free
+    // queue, so the application thread never touches the queue while worker
+    // threads are returning completed frames into it.
+    std::unique_ptr<CJpegTask> m_pReservedTask;
     // Free tasks queue (if SW is used)
     std::queue<std::unique_ptr<CJpegTask>> m_freeTasks;
     // Count of created tasks (if SW is used)
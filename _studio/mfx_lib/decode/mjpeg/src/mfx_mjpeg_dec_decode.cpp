@@ -2038,19 +2038,28 @@ mfxStatus VideoDECODEMJPEGBase_SW::Init(mfxVideoParam *decPar, mfxFrameAllocRequ
 
 mfxStatus VideoDECODEMJPEGBase_SW::Reset(mfxVideoParam *par)
 {
-    m_tasksCount = 0;
+    // the free tasks keep their initialized JPEG decoders and picture
+    // buffers unless the new parameters change the decoder setup
+    bool isSameTasks = CJpegTask::IsSameSetup(m_vPar, *par);
+
     pLastTask = nullptr;
+    m_pReservedTask.reset();
     {
         std::lock_guard<std::mutex> guard(m_guard);
-        while(!m_freeTasks.empty())
+        while(!isSameTasks && !m_freeTasks.empty())
         {
             m_freeTasks.pop();
         }
+        m_tasksCount = (mfxU16)m_freeTasks.size();
     }
 
     memset(&m_stat, 0, sizeof(mfxDecodeStat));
     m_vPar = *par;
 
+    // the tasks created from now on are set up for the new parameters
+    ConvertMFXParamsToUMC(par, &umcVideoParams);
+    umcVideoParams.numThreads = m_vPar.mfx.NumThread;
+
     UMC::Status umcSts = m_FrameAllocator->Reset();
     MFX_CHECK(umcSts == UMC::UMC_OK, MFX_ERR_MEMORY_ALLOC);
 
@@ -2063,6 +2072,7 @@ mfxStatus VideoDECODEMJPEGBase_SW::Close()
 
     m_tasksCount = 0;
     pLastTask = nullptr;
+    m_pReservedTask.reset();
     memset(&m_stat, 0, sizeof(mfxDecodeStat));
 
     // delete free tasks queue
@@ -2099,21 +2109,22 @@ mfxStatus VideoDECODEMJPEGBase_SW::ReserveUMCDecoder(UMC::MJPEGVideoDecoderBaseM
     pMJPEGVideoDecoder = 0;
     MFX_SAFE_CALL(m_FrameAllocator->SetCurrentMFXSurface(surf, isOpaq));
 
-    pMJPEGVideoDecoder = m_freeTasks.front()->m_pMJPEGVideoDecoder.get();
+    MFX_CHECK(m_pReservedTask, MFX_ERR_UNDEFINED_BEHAVIOR);
+    pMJPEGVideoDecoder = m_pReservedTask->m_pMJPEGVideoDecoder.get();
     //pMJPEGVideoDecoder->Reset();
     return MFX_ERR_NONE;
 }
 
 void VideoDECODEMJPEGBase_SW::ReleaseReservedTask()
 {
-    if (!m_freeTasks.empty())
-        m_freeTasks.front()->Reset();
+    if (m_pReservedTask)
+        m_pReservedTask->Reset();
 }
 
 mfxStatus VideoDECODEMJPEGBase_SW::AddPicture(UMC::MediaDataEx *pSrcData, mfxU32 & numPic)
 {
     // select the field position. 0 means top, 1 means bottom.
-    mfxU32 fieldPos = m_freeTasks.front()->NumPicCollected();
+    mfxU32 fieldPos = m_pReservedTask->NumPicCollected();
 
     if (MFX_PICSTRUCT_FIELD_BFF == m_vPar.mfx.FrameInfo.PicStruct)
     {
@@ -2122,19 +2133,15 @@ mfxStatus VideoDECODEMJPEGBase_SW::AddPicture(UMC::MediaDataEx *pSrcData, mfxU32
     }
 
     // add picture to the task
-    MFX_SAFE_CALL(m_freeTasks.front()->AddPicture(pSrcData, fieldPos));
-    numPic = m_freeTasks.front()->NumPicCollected();
+    MFX_SAFE_CALL(m_pReservedTask->AddPicture(pSrcData, fieldPos));
+    numPic = m_pReservedTask->NumPicCollected();
     return MFX_ERR_NONE;
 }
 
 mfxStatus VideoDECODEMJPEGBase_SW::FillEntryPoint(MFX_ENTRY_POINT *pEntryPoint, mfxFrameSurface1 *surface_work, mfxFrameSurface1 *surface_out)
 {
-    // remove the ready task from the queue
-    {
-        std::lock_guard<std::mutex> guard(m_guard);
-        pLastTask = m_freeTasks.front().release();
-        m_freeTasks.pop();
-    }
+    // the collected task is owned by the scheduler until CompleteTask
+    pLastTask = m_pReservedTask.release();
 
     pLastTask->surface_work = surface_work;
     pLastTask->surface_out = surface_out;
@@ -2148,7 +2155,7 @@ mfxStatus VideoDECODEMJPEGBase_SW::FillEntryPoint(MFX_ENTRY_POINT *pEntryPoint,
 
 mfxStatus VideoDECODEMJPEGBase_SW::AllocateFrameData(UMC::FrameData *&data)
 {
-    CJpegTask *pTask = m_freeTasks.front().get();
+    CJpegTask *pTask = m_pReservedTask.get();
 
     // prepare the decoder(s)
     UMC::Status umcRes = pTask->m_pMJPEGVideoDecoder->AllocateFrame();
@@ -2160,37 +2167,48 @@ mfxStatus VideoDECODEMJPEGBase_SW::AllocateFrameData(UMC::FrameData *&data)
     // save parameters to the task
     pTask->dst = pTask->m_pMJPEGVideoDecoder.get()->GetDst();
 
-    UMC::FrameData *dst = m_freeTasks.front()->dst;
-    dst->SetTime(m_freeTasks.front()->GetPictureBuffer(0).timeStamp);
+    UMC::FrameData *dst = pTask->dst;
+    dst->SetTime(pTask->GetPictureBuffer(0).timeStamp);
     data = dst;
     return MFX_ERR_NONE;
 }
 
 mfxStatus VideoDECODEMJPEGBase_SW::CheckTaskAvailability(mfxU32 maxTaskNumber)
 {
-    if (m_freeTasks.empty())
+    if (m_pReservedTask)
+    {
+        return MFX_ERR_NONE;
+    }
+
+    // reuse a task returned by one of the completed frames. Each task owns
+    // its own set of JPEG decoders, so up to maxTaskNumber frames are decoded
+    // concurrently.
     {
-        if (m_tasksCount >= maxTaskNumber)
+        std::lock_guard<std::mutex> guard(m_guard);
+        if (!m_freeTasks.empty())
         {
-            return MFX_WRN_DEVICE_BUSY;
+            m_pReservedTask = std::move(m_freeTasks.front());
+            m_freeTasks.pop();
+            return MFX_ERR_NONE;
         }
+    }
 
-        std::unique_ptr<CJpegTask> pTask(new CJpegTask());
-        m_tasksCount++;
+    if (m_tasksCount >= maxTaskNumber)
+    {
+        return MFX_WRN_DEVICE_BUSY;
+    }
 
-        // initialize the task
-        MFX_SAFE_CALL(pTask->Initialize(umcVideoParams,
-                                        m_FrameAllocator.get(),
-                                        m_vPar.mfx.Rotation,
-                                        m_vPar.mfx.JPEGChromaFormat,
-                                        m_vPar.mfx.JPEGColorFormat));
+    std::unique_ptr<CJpegTask> pTask(new CJpegTask());
+    m_tasksCount++;
 
-        // save the task object into the queue
-        {
-            std::lock_guard<std::mutex> guard(m_guard);
-            m_freeTasks.push(std::move(pTask));
-        }
-    }
+    // initialize the task
+    MFX_SAFE_CALL(pTask->Initialize(umcVideoParams,
+                                    m_FrameAllocator.get(),
+                                    m_vPar.mfx.Rotation,
+                                    m_vPar.mfx.JPEGChromaFormat,
+                                    m_vPar.mfx.JPEGColorFormat));
+
+    m_pReservedTask = std::move(pTask);
 
     return MFX_ERR_NONE;
 }
@@ -2240,13 +2258,17 @@ mfxStatus VideoDECODEMJPEGBase_SW::CompleteTask(void *pParam, mfxStatus taskRes)
         }
 
         task.m_pMJPEGVideoDecoder->CloseFrame();
-
-        m_stat.NumFrame++;
     }
 
+    // frames complete in any order, the output order is kept by the
+    // surfaces and sync points assigned in DecodeFrameCheck
     task.Reset();
     {
         std::lock_guard<std::mutex> guard(m_guard);
+        if (MFX_ERR_NONE == taskRes)
+        {
+            m_stat.NumFrame++;
+        }
         m_freeTasks.emplace(&task);
     }
     return MFX_ERR_NONE;
@@ -731,6 +731,63 @@ static mfxStatus CheckExtBuffers(mfxExtBuffer** ebuffers, mfxU32 nbuffers)
 
 } // static mfxStatus CheckExtBuffers(mfxExtBuffer** ebuffers, mfxU32 nbuffers)
 
+// restart interval to use when application didn't set one: split the scan
+// into whole MCU rows, two pieces per encoding thread, so the pieces can be
+// encoded in parallel. Returns 0 if the frame should be encoded as one piece.
+static mfxU16 CalculateAutoRestartInterval(mfxVideoParam const & par, mfxU32 numThreads)
+{
+    mfxU32 mcuWidth, mcuHeight;
+
+    if (numThreads < 2)
+        return 0;
+
+    // each component of non-interleaved scan is already a separate piece
+    if (par.mfx.Interleaved != MFX_SCANTYPE_INTERLEAVED &&
+        par.mfx.FrameInfo.ChromaFormat != MFX_CHROMAFORMAT_YUV400)
+        return 0;
+
+    switch (par.mfx.FrameInfo.ChromaFormat)
+    {
+        case MFX_CHROMAFORMAT_YUV444:
+        case MFX_CHROMAFORMAT_YUV400:
+            mcuWidth = mcuHeight = 8;
+            break;
+        case MFX_CHROMAFORMAT_YUV422H:
+            mcuWidth  = 16;
+            mcuHeight = 8;
+            break;
+        case MFX_CHROMAFORMAT_YUV422V:
+            mcuWidth  = 8;
+            mcuHeight = 16;
+            break;
+        case MFX_CHROMAFORMAT_YUV420:
+            mcuWidth = mcuHeight = 16;
+            break;
+        default:
+            return 0;
+    }
+
+    mfxU32 width  = par.mfx.FrameInfo.CropW ? par.mfx.FrameInfo.CropW : par.mfx.FrameInfo.Width;
+    mfxU32 height = par.mfx.FrameInfo.CropH ? par.mfx.FrameInfo.CropH : par.mfx.FrameInfo.Height;
+
+    if (par.mfx.FrameInfo.PicStruct == MFX_PICSTRUCT_FIELD_TFF ||
+        par.mfx.FrameInfo.PicStruct == MFX_PICSTRUCT_FIELD_BFF)
+        height >>= 1;
+
+    mfxU32 numxMCU = (width  + (mcuWidth  - 1)) / mcuWidth;
+    mfxU32 numyMCU = (height + (mcuHeight - 1)) / mcuHeight;
+
+    mfxU32 numPieces = std::min<mfxU32>(numThreads * 2, numyMCU);
+    if (numxMCU == 0 || numPieces < 2)
+        return 0;
+
+    mfxU32 rowsPerPiece = (numyMCU + numPieces - 1) / numPieces;
+    rowsPerPiece = std::min<mfxU32>(rowsPerPiece, 0xffff / numxMCU);
+
+    return (mfxU16)(rowsPerPiece * numxMCU);
+
+} // static mfxU16 CalculateAutoRestartInterval(mfxVideoParam const & par, mfxU32 numThreads)
+
 MFXVideoENCODEMJPEG::MFXVideoENCODEMJPEG(VideoCORE *core, mfxStatus *status)
     : VideoENCODE()
     , m_core(core)
@@ -1321,7 +1378,8 @@ mfxStatus MFXVideoENCODEMJPEG::Init(mfxVideoParam *par_in)
     m_pUmcVideoParams->info.clip_info.width  = m_vParam.mfx.FrameInfo.Width;
     m_pUmcVideoParams->info.clip_info.height = m_vParam.mfx.FrameInfo.Height;
     m_pUmcVideoParams->buf_size              = 16384 + m_vParam.mfx.FrameInfo.Width * m_vParam.mfx.FrameInfo.Height * DoubleBytesPerPx / 2;
-    m_pUmcVideoParams->restart_interval      = m_vParam.mfx.RestartInterval;
+    m_pUmcVideoParams->restart_interval      = m_vParam.mfx.RestartInterval ? m_vParam.mfx.RestartInterval :
+                                               CalculateAutoRestartInterval(m_vParam, std::min<mfxU32>(m_vParam.mfx.NumThread, UMC::JPEG_ENC_MAX_THREADS));
     m_pUmcVideoParams->interleaved           = (m_vParam.mfx.Interleaved == MFX_SCANTYPE_INTERLEAVED) ? 1 : 0;
 
     switch(m_vParam.mfx.FrameInfo.PicStruct)
@@ -1489,7 +1547,8 @@ mfxStatus MFXVideoENCODEMJPEG::Reset(mfxVideoParam *par)
     m_pUmcVideoParams->info.clip_info.width  = m_vParam.mfx.FrameInfo.Width;
     m_pUmcVideoParams->info.clip_info.height = m_vParam.mfx.FrameInfo.Height;
     m_pUmcVideoParams->buf_size              = 16384 + m_vParam.mfx.FrameInfo.Width * m_vParam.mfx.FrameInfo.Height * DoubleBytesPerPx / 2;
-    m_pUmcVideoParams->restart_interval      = m_vParam.mfx.RestartInterval;
+    m_pUmcVideoParams->restart_interval      = m_vParam.mfx.RestartInterval ? m_vParam.mfx.RestartInterval :
+                                               CalculateAutoRestartInterval(m_vParam, std::min<mfxU32>(m_vParam.mfx.NumThread, UMC::JPEG_ENC_MAX_THREADS));
     m_pUmcVideoParams->interleaved           = (m_vParam.mfx.Interleaved == MFX_SCANTYPE_INTERLEAVED) ? 1 : 0;
 
     switch(m_vParam.mfx.FrameInfo.PicStruct)
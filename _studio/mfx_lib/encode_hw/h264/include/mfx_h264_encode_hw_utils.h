@@ -2022,6 +2022,10 @@ static mfxStatus InitCtrl(mfxVideoParam const & par, mfxEncToolsCtrl *ctrl)
         ctrl->ExtParam[0] = GetExtBuffer(par.ExtParam, par.NumExtParam, MFX_EXTBUFF_ENCTOOLS_DEVICE);
         ctrl->ExtParam[1] = GetExtBuffer(par.ExtParam, par.NumExtParam, MFX_EXTBUFF_ENCTOOLS_ALLOCATOR);
     }
+    if (ctrl->NumExtParam > 2)
+        ctrl->ExtParam[2] = GetExtBuffer(par.ExtParam, par.NumExtParam, MFX_EXTBUFF_ENCTOOLS_SHARED);
+    if (ctrl->NumExtParam > 3)
+        ctrl->ExtParam[3] = GetExtBuffer(par.ExtParam, par.NumExtParam, MFX_EXTBUFF_ENCTOOLS_ASYNC);
 
     return MFX_ERR_NONE;
 
@@ -2176,7 +2180,7 @@ public:
 
         memset(&m_EncToolCtrl, 0, sizeof(mfxEncToolsCtrl));
         m_EncToolCtrl.ExtParam = m_ExtParam;
-        m_EncToolCtrl.NumExtParam = 2;
+        m_EncToolCtrl.NumExtParam = 4;
 
         mfxStatus sts = InitCtrl(video, &m_EncToolCtrl);
         MFX_CHECK_STS(sts);
@@ -2609,7 +2613,7 @@ private:
     bool                    m_bEncToolsCreated = false;
     mfxEncToolsCtrl         m_EncToolCtrl = {};
     mfxExtEncToolsConfig    m_EncToolConfig = {};
-    mfxExtBuffer*           m_ExtParam[2] = {};
+    mfxExtBuffer*           m_ExtParam[4] = {};
 
 };
 #endif
@@ -110,6 +110,19 @@ struct MFX_CALL_INFO
 
 } MFX_CALL_INFO;
 
+typedef
+struct MFX_COMPLETION_CALLBACK
+{
+    // Callback and its parameter
+    mfxSyncPointCallback pCallback;
+    mfxHDL pParam;
+    // Sync point of the done task
+    mfxSyncPoint syncPoint;
+    // Final status of the task
+    mfxStatus status;
+
+} MFX_COMPLETION_CALLBACK;
+
 enum eWakeUpReason
 {
     // wake up threads without a visible reason
@@ -121,7 +134,7 @@ enum eWakeUpReason
 };
 
 
-class mfxSchedulerCore : public MFXIScheduler2
+class mfxSchedulerCore : public MFXIScheduler3
 {
 public:
     // Default constructor
@@ -210,9 +223,26 @@ public:
     // Notification to the scheduler that task got resolved dependencies
     void OnDependencyResolved(MFX_SCHEDULER_TASK *pTask);
 
+    // Wake up the threads waiting for the task, called under m_guard
+    void OnTaskDone(MFX_SCHEDULER_TASK *pTask);
+
     // WA for SINGLE THREAD MODE
     virtual
     mfxStatus GetTimeout(mfxU32 & maxTimeToRun);
+
+    // Get the load counters of the scheduler
+    virtual
+    mfxStatus GetMetrics(MFX_SCHEDULER_METRICS *pMetrics);
+
+    // Wait until any or all of the sync points are done
+    virtual
+    mfxStatus SynchronizeMulti(const mfxSyncPoint *pSyncPoints, mfxU32 count,
+                               bool waitAll, mfxU32 timeToWait, mfxStatus *pStatus);
+
+    // Set the callback called once the task of the sync point is done
+    virtual
+    mfxStatus SetCompletionCallback(mfxSyncPoint syncPoint,
+                                    mfxSyncPointCallback pCallback, mfxHDL pParam);
 protected:
     // Destructor is protected to avoid deletion the object by occasion.
     virtual
@@ -221,6 +251,10 @@ protected:
     // Release the object
     void Close(void);
 
+    // Keep the running threads for the new initialization, if they match
+    // the parameters and no task is in execution. Returns false otherwise.
+    bool ReuseThreads(const MFX_SCHEDULER_PARAM2 &param);
+
     // Wait until the scheduler got more work
     void Wait(const mfxU32 curThreadNum, std::unique_lock<std::mutex>& mutex);
 
@@ -290,6 +324,9 @@ protected:
     // Mark a piece of job completed by the thread
     void MarkTaskCompleted(const MFX_CALL_INFO *pCallInfo,
                            const mfxU32 threadNum);
+    // Call the completion callbacks of the done tasks,
+    // m_guard is temporarily released
+    void CallCompletionCallbacks(void);
     // Reset 'waiting' state for tasks with given owner
     void ResetWaitingTasks(const void *pOwner);
     // Managing HW event counter functions
@@ -440,6 +477,23 @@ protected:
     // Number of job submitted
     mfxU32 m_jobCounter;
 
+    // Load counters, protected by m_guard
+    mfxU64 m_tasksCompleted;
+    mfxU64 m_taskCalls;
+    mfxU64 m_taskTime;
+
+    // Waiting 'until any task is done' object for SynchronizeMulti, it is
+    // signaled only if there are waiters. Protected by m_guard.
+    std::condition_variable m_taskDone;
+    mfxU32 m_numMultiWaiters;
+
+    // Callbacks of the done tasks, they are called out of m_guard
+    // by the thread which completed the task. Protected by m_guard.
+    std::vector<MFX_COMPLETION_CALLBACK> m_completionCallbacks;
+    // Number of threads calling the callbacks taken out of the list.
+    // Protected by m_guard.
+    mfxU32 m_numRunningCallbacks;
+
     mfxU32 m_timer_hw_event;
 
 
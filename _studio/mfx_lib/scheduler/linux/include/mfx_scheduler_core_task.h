@@ -26,6 +26,7 @@
 #include <mfx_dependency_item.h>
 #include <mfx_task.h>
 #include <mfx_scheduler_core_handle.h>
+#include <mfx_interface_scheduler.h>
 
 #include <condition_variable>
 
@@ -148,6 +149,14 @@ struct MFX_SCHEDULER_TASK : public mfxDependencyItem<MFX_TASK_NUM_DEPENDENCIES>
             mfxU32 dstIdx[MFX_TASK_NUM_DEPENDENCIES];
         } dependencies;
 
+        // completion callback of the job
+        struct
+        {
+            mfxSyncPointCallback pCallback;
+            mfxHDL pParam;
+            mfxSyncPoint syncPoint;
+        } completion;
+
     } param;
 
     // Pointer to the next task
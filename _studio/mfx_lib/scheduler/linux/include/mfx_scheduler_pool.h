@@ -0,0 +1,69 @@
+// Copyright (c) 2020 Intel Corporation
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#if !defined(__MFX_SCHEDULER_POOL_H)
+#define __MFX_SCHEDULER_POOL_H
+
+#include <mfx_interface_scheduler.h>
+
+#include <mutex>
+#include <vector>
+
+// the default number of idle schedulers kept for reuse after the sessions are
+// closed, 0 disables the reuse. The MFX_SCHEDULER_POOL_SIZE environment
+// variable overrides it when the library is loaded.
+#ifndef MFX_SCHEDULER_POOL_SIZE
+#define MFX_SCHEDULER_POOL_SIZE 4
+#endif
+
+// Idle schedulers of the closed sessions. The threads of a parked scheduler
+// keep waiting for tasks, the next session initialized in the process takes
+// the scheduler instead of spawning the threads again. The pool lives as long
+// as the library is loaded, the dispatcher unloads it with the last session.
+class SchedulerPool
+{
+public:
+    static SchedulerPool& Instance();
+
+    // The size is read from the environment
+    SchedulerPool();
+    ~SchedulerPool();
+
+    // Takes the reference of the scheduler if it is idle and not shared
+    // with other sessions
+    bool Park(MFXIUnknown *pSchedulerAllocated);
+
+    // Returns a parked scheduler with the given number of threads,
+    // the latest parked one otherwise. NULL if the pool is empty.
+    MFXIUnknown* Take(mfxU32 numberOfThreads);
+
+    // Number of the schedulers kept at most
+    size_t Size() const { return m_size; }
+
+private:
+    SchedulerPool(const SchedulerPool &);
+    SchedulerPool & operator = (const SchedulerPool &);
+
+    size_t                    m_size;
+    std::mutex                m_guard;
+    std::vector<MFXIUnknown*> m_parked;
+};
+
+#endif // !defined(__MFX_SCHEDULER_POOL_H)
@@ -66,6 +66,12 @@ mfxSchedulerCore::mfxSchedulerCore(void)
     m_taskCounter = 0;
     m_jobCounter = 0;
 
+    m_tasksCompleted = 0;
+    m_taskCalls = 0;
+    m_taskTime = 0;
+    m_numMultiWaiters = 0;
+    m_numRunningCallbacks = 0;
+
     m_hwEventCounter = 0;
 
     m_timer_hw_event = MFX_THREAD_TIME_TO_WAIT;
@@ -172,6 +178,65 @@ void mfxSchedulerCore::Close(void)
     m_jobCounter = 0;
 }
 
+bool mfxSchedulerCore::ReuseThreads(const MFX_SCHEDULER_PARAM2 &param)
+{
+    mfxU32 numberOfThreads = param.numberOfThreads;
+    bool bInExecution = false;
+
+    if (numberOfThreads && param.params.NumThread)
+    {
+        numberOfThreads = param.params.NumThread;
+    }
+
+    // the parked threads read the parameters under the guard
+    std::lock_guard<std::mutex> guard(m_guard);
+
+    if ((NULL == m_pThreadCtx) ||
+        (MFX_SINGLE_THREAD == param.flags) ||
+        (numberOfThreads != m_param.numberOfThreads) ||
+        (param.params.SchedulingType != m_param.params.SchedulingType) ||
+        (param.params.Priority != m_param.params.Priority))
+    {
+        return false;
+    }
+
+    ForEachTaskWhile(
+        [&bInExecution](MFX_SCHEDULER_TASK *task)
+        {
+            bInExecution = (MFX_WRN_IN_EXECUTION == task->opRes);
+            return !bInExecution;
+        }
+    );
+    // a callback taken out of the list may be still running
+    if (bInExecution || m_numMultiWaiters || m_numRunningCallbacks || !m_completionCallbacks.empty())
+    {
+        return false;
+    }
+
+    // all tasks are done, move them to the free queue. The task objects
+    // are kept, the job counter is not reset to keep the sync points of
+    // the previous session invalid.
+    ScrubCompletedTasks(true);
+
+    m_param = param;
+    m_param.numberOfThreads = numberOfThreads;
+
+    memset(m_workingTime, 0, sizeof(m_workingTime));
+    m_timeIdx = 0;
+
+    memset(m_numAssignedTasks, 0, sizeof(m_numAssignedTasks));
+    m_numDependencies = 0;
+    m_numOccupancies = 0;
+    m_freeTasksCount = MFX_MAX_NUMBER_TASK;
+
+    m_tasksCompleted = 0;
+    m_taskCalls = 0;
+    m_taskTime = 0;
+
+    return true;
+
+} // bool mfxSchedulerCore::ReuseThreads(const MFX_SCHEDULER_PARAM2 &param)
+
 void mfxSchedulerCore::WakeUpThreads(mfxU32 num_dedicated_threads, mfxU32 num_regular_threads)
 {
     if (m_param.flags == MFX_SINGLE_THREAD)
@@ -522,7 +587,7 @@ void mfxSchedulerCore::RegisterTaskDependencies(MFX_SCHEDULER_TASK  *pTask)
         // save the status
         m_pFreeTasks->curStatus = taskRes;
         m_pFreeTasks->opRes = taskRes;
-        m_pFreeTasks->done.notify_all();
+        OnTaskDone(m_pFreeTasks);
     }
 
 } // void mfxSchedulerCore::RegisterTaskDependencies(MFX_SCHEDULER_TASK  *pTask)
@@ -57,6 +57,13 @@ mfxStatus mfxSchedulerCore::Initialize2(const MFX_SCHEDULER_PARAM2 *pParam)
 {
     mfxU32 i;
 
+    // the scheduler of a closed session is initialized again without
+    // respawning the threads
+    if (pParam && ReuseThreads(*pParam))
+    {
+        return MFX_ERR_NONE;
+    }
+
     // release the object before initialization
     Close();
 
@@ -269,6 +276,189 @@ mfxStatus mfxSchedulerCore::Synchronize(mfxTaskHandle handle, mfxU32 timeToWait)
     }
 }
 
+mfxStatus mfxSchedulerCore::SynchronizeMulti(const mfxSyncPoint *pSyncPoints, mfxU32 count,
+                                             bool waitAll, mfxU32 timeToWait, mfxStatus *pStatus)
+{
+    mfxU32 i;
+
+    // check error(s)
+    if (0 == m_param.numberOfThreads)
+    {
+        return MFX_ERR_NOT_INITIALIZED;
+    }
+    if ((NULL == pSyncPoints) || (NULL == pStatus))
+    {
+        return MFX_ERR_NULL_PTR;
+    }
+    for (i = 0; i < count; i += 1)
+    {
+        mfxTaskHandle handle;
+
+        handle.handle = (size_t) pSyncPoints[i];
+        if ((NULL == pSyncPoints[i]) ||
+            (nullptr == m_ppTaskLookUpTable.at(handle.taskID)))
+        {
+            return MFX_ERR_NULL_PTR;
+        }
+    }
+    if (0 == count)
+    {
+        return MFX_ERR_NONE;
+    }
+
+    // update the statuses of all sync points and check whether the wait is over,
+    // it is called with m_guard being held
+    auto IsWaitDone = [this, pSyncPoints, count, waitAll, pStatus]()
+    {
+        mfxU32 numDone = 0;
+
+        for (mfxU32 j = 0; j < count; j += 1)
+        {
+            mfxTaskHandle handle;
+            handle.handle = (size_t) pSyncPoints[j];
+            MFX_SCHEDULER_TASK *pTask = m_ppTaskLookUpTable[handle.taskID];
+
+            // the task executes the next job already, the previous one succeeded
+            pStatus[j] = (pTask->jobID != handle.jobID) ? MFX_ERR_NONE : pTask->opRes;
+            if (MFX_WRN_IN_EXECUTION != pStatus[j])
+            {
+                numDone += 1;
+            }
+        }
+
+        return waitAll ? (numDone == count) : (numDone > 0);
+    };
+
+    if (MFX_SINGLE_THREAD == m_param.flags)
+    {
+        MFX_CALL_INFO call = {};
+        mfxTaskHandle previousTaskHandle = {};
+        mfxU64 start = GetHighPerformanceCounter();
+        mfxU64 frequency = vm_time_get_frequency();
+
+        // run the tasks on the calling thread until the wait is over
+        for (;;)
+        {
+            std::unique_lock<std::mutex> guard(m_guard);
+
+            if (IsWaitDone())
+            {
+                return MFX_ERR_NONE;
+            }
+            if ((GetHighPerformanceCounter() - start) * 1000 / frequency > timeToWait)
+            {
+                return MFX_WRN_IN_EXECUTION;
+            }
+            if (MFX_ERR_NONE != GetTask(call, previousTaskHandle, 0))
+            {
+                // no task is ready, another thread may be running it. Wait
+                // for a task to be done instead of spinning on the guard.
+                m_numMultiWaiters += 1;
+                m_taskDone.wait_for(guard, std::chrono::milliseconds(1));
+                m_numMultiWaiters -= 1;
+                continue;
+            }
+
+            guard.unlock();
+
+            call.res = call.pTask->entryPoint.pRoutine(call.pTask->entryPoint.pState,
+                                                       call.pTask->entryPoint.pParam,
+                                                       call.threadNum,
+                                                       call.callNum);
+
+            guard.lock();
+
+            // save the previous task's handle
+            previousTaskHandle = call.taskHandle;
+
+            MarkTaskCompleted(&call, 0);
+
+            if (MFX_TASK_DONE != call.res)
+            {
+                IncrementHWEventCounter();
+            }
+        }
+    }
+    else
+    {
+        std::unique_lock<std::mutex> guard(m_guard);
+        bool bDone;
+
+        MFX_AUTO_LTRACE(MFX_TRACE_LEVEL_PRIVATE, "Scheduler::WaitMulti");
+        MFX_LTRACE_I(MFX_TRACE_LEVEL_SCHED, count);
+        MFX_LTRACE_I(MFX_TRACE_LEVEL_SCHED, timeToWait);
+
+        // every task completion wakes up all multi waiters, they recheck
+        // their own sync points
+        m_numMultiWaiters += 1;
+        bDone = m_taskDone.wait_for(guard, std::chrono::milliseconds(timeToWait), IsWaitDone);
+        m_numMultiWaiters -= 1;
+
+        return bDone ? MFX_ERR_NONE : MFX_WRN_IN_EXECUTION;
+    }
+
+} // mfxStatus mfxSchedulerCore::SynchronizeMulti(const mfxSyncPoint *pSyncPoints, ...)
+
+mfxStatus mfxSchedulerCore::SetCompletionCallback(mfxSyncPoint syncPoint,
+                                                  mfxSyncPointCallback pCallback, mfxHDL pParam)
+{
+    mfxTaskHandle handle;
+    mfxStatus taskRes;
+
+    // check error(s)
+    if (0 == m_param.numberOfThreads)
+    {
+        return MFX_ERR_NOT_INITIALIZED;
+    }
+    // no working thread completes the tasks, only Synchronize runs them
+    if (MFX_SINGLE_THREAD == m_param.flags)
+    {
+        return MFX_ERR_UNSUPPORTED;
+    }
+    if ((NULL == syncPoint) || (NULL == pCallback))
+    {
+        return MFX_ERR_NULL_PTR;
+    }
+
+    // look up the task
+    handle.handle = (size_t) syncPoint;
+    MFX_SCHEDULER_TASK *pTask = m_ppTaskLookUpTable.at(handle.taskID);
+
+    if (nullptr == pTask)
+    {
+        return MFX_ERR_NULL_PTR;
+    }
+
+    {
+        std::lock_guard<std::mutex> guard(m_guard);
+
+        // the task executes the next job already, the previous one succeeded
+        taskRes = (pTask->jobID != handle.jobID) ? MFX_ERR_NONE : pTask->opRes;
+
+        if (MFX_WRN_IN_EXECUTION == taskRes)
+        {
+            // only one callback per job
+            if (pTask->param.completion.pCallback)
+            {
+                return MFX_ERR_UNDEFINED_BEHAVIOR;
+            }
+
+            // OnTaskDone passes the callback to the thread completing the task
+            pTask->param.completion.pCallback = pCallback;
+            pTask->param.completion.pParam = pParam;
+            pTask->param.completion.syncPoint = syncPoint;
+
+            return MFX_ERR_NONE;
+        }
+    }
+
+    // the task is done already, call the callback on the calling thread
+    pCallback(pParam, syncPoint, taskRes);
+
+    return MFX_ERR_NONE;
+
+} // mfxStatus mfxSchedulerCore::SetCompletionCallback(mfxSyncPoint syncPoint, ...)
+
 mfxStatus mfxSchedulerCore::GetTimeout(mfxU32& maxTimeToRun)
 {
     (void)maxTimeToRun;
@@ -276,6 +466,44 @@ mfxStatus mfxSchedulerCore::GetTimeout(mfxU32& maxTimeToRun)
     return MFX_ERR_UNSUPPORTED;
 }
 
+mfxStatus mfxSchedulerCore::GetMetrics(MFX_SCHEDULER_METRICS *pMetrics)
+{
+    // check error(s)
+    if (0 == m_param.numberOfThreads)
+    {
+        return MFX_ERR_NOT_INITIALIZED;
+    }
+    if (NULL == pMetrics)
+    {
+        return MFX_ERR_NULL_PTR;
+    }
+
+    memset(pMetrics, 0, sizeof(MFX_SCHEDULER_METRICS));
+
+    {
+        std::lock_guard<std::mutex> guard(m_guard);
+
+        // the queues are short, walk them instead of tracking the depth on every call
+        ForEachTask(
+            [pMetrics](MFX_SCHEDULER_TASK *task)
+            {
+                if (MFX_WRN_IN_EXECUTION == task->opRes)
+                    pMetrics->queueDepth[task->param.task.priority] += 1;
+            }
+        );
+
+        pMetrics->tasksCompleted = m_tasksCompleted;
+        pMetrics->taskCalls = m_taskCalls;
+        pMetrics->taskTime = m_taskTime;
+    }
+
+    pMetrics->numberOfThreads = m_param.numberOfThreads;
+    pMetrics->taskTime = pMetrics->taskTime * 1000000 / vm_time_get_frequency();
+
+    return MFX_ERR_NONE;
+
+} // mfxStatus mfxSchedulerCore::GetMetrics(MFX_SCHEDULER_METRICS *pMetrics)
+
 mfxStatus mfxSchedulerCore::WaitForDependencyResolved(const void *pDependency)
 {
     mfxTaskHandle waitHandle = {};
@@ -523,6 +751,7 @@ mfxStatus mfxSchedulerCore::AddTask(const MFX_TASK &task, mfxSyncPoint *pSyncPoi
         // make sure that there is enough free task objects
         m_freeTasks.wait(guard, [this](){return m_freeTasksCount > 0;});
         --m_freeTasksCount;
+        MFX_LTRACE_COUNTER(MFX_TRACE_LEVEL_SCHED, "queue depth", this, MFX_MAX_NUMBER_TASK - m_freeTasksCount);
         mfxStatus mfxRes;
         MFX_SCHEDULER_TASK *pTask, **ppTemp;
         mfxTaskHandle handle;
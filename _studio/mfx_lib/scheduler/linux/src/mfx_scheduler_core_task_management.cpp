@@ -398,6 +398,62 @@ void mfxSchedulerCore::OnDependencyResolved(MFX_SCHEDULER_TASK *pTask)
     }
 }
 
+void mfxSchedulerCore::OnTaskDone(MFX_SCHEDULER_TASK *pTask)
+{
+    pTask->done.notify_all();
+
+    // SynchronizeMulti waits on several tasks at once
+    if (m_numMultiWaiters)
+    {
+        m_taskDone.notify_all();
+    }
+
+    // the callback is called later, out of the protected code section
+    if (pTask->param.completion.pCallback)
+    {
+        MFX_COMPLETION_CALLBACK callback;
+
+        callback.pCallback = pTask->param.completion.pCallback;
+        callback.pParam = pTask->param.completion.pParam;
+        callback.syncPoint = pTask->param.completion.syncPoint;
+        callback.status = pTask->opRes;
+        m_completionCallbacks.push_back(callback);
+
+        pTask->param.completion.pCallback = NULL;
+    }
+}
+
+void mfxSchedulerCore::CallCompletionCallbacks(void)
+{
+    std::vector<MFX_COMPLETION_CALLBACK> callbacks;
+
+    // take the whole list, other threads may add callbacks meanwhile
+    callbacks.swap(m_completionCallbacks);
+    m_numRunningCallbacks += 1;
+
+    // temporarily leave the protected code section
+    m_guard.unlock();
+
+    for (const MFX_COMPLETION_CALLBACK &callback : callbacks)
+    {
+        try {
+            callback.pCallback(callback.pParam, callback.syncPoint, callback.status);
+        } catch(...) {
+        }
+    }
+    callbacks.clear();
+
+    // enter the protected code section
+    m_guard.lock();
+    m_numRunningCallbacks -= 1;
+
+    // keep the storage for the next time
+    if (m_completionCallbacks.empty())
+    {
+        m_completionCallbacks.swap(callbacks);
+    }
+}
+
 void mfxSchedulerCore::MarkTaskCompleted(const MFX_CALL_INFO *pCallInfo,
                                          const mfxU32 threadNum)
 {
@@ -430,6 +486,8 @@ void mfxSchedulerCore::MarkTaskCompleted(const MFX_CALL_INFO *pCallInfo,
         m_workingTime[m_timeIdx].startTime = curTime;
     }
     m_workingTime[m_timeIdx].time[pTask->param.task.priority] += pCallInfo->timeSpend;
+    m_taskCalls += 1;
+    m_taskTime += pCallInfo->timeSpend;
 
     // update the scheduler
     m_numAssignedTasks[pTask->param.task.priority] -= 1;
@@ -530,8 +588,9 @@ void mfxSchedulerCore::MarkTaskCompleted(const MFX_CALL_INFO *pCallInfo,
 
             // save the status
             pTask->opRes = pTask->curStatus;
+            m_tasksCompleted += 1;
 
-            pTask->done.notify_all();
+            OnTaskDone(pTask);
 
             // update dependencies produced from the dependency table
             //for (i = 0; i < MFX_TASK_NUM_DEPENDENCIES; i += 1)
@@ -560,8 +619,9 @@ void mfxSchedulerCore::MarkTaskCompleted(const MFX_CALL_INFO *pCallInfo,
             pTask->jobID = 0;
             // save the status
             pTask->opRes = MFX_ERR_NONE;
+            m_tasksCompleted += 1;
 
-            pTask->done.notify_all();
+            OnTaskDone(pTask);
 
             // remove dependencies produced from the dependency table
             for (i = 0; i < MFX_TASK_NUM_DEPENDENCIES; i += 1)
@@ -594,6 +654,7 @@ void mfxSchedulerCore::MarkTaskCompleted(const MFX_CALL_INFO *pCallInfo,
     if (taskReleased)
     {
         ++m_freeTasksCount;
+        MFX_LTRACE_COUNTER(MFX_TRACE_LEVEL_SCHED, "queue depth", this, MFX_MAX_NUMBER_TASK - m_freeTasksCount);
         m_freeTasks.notify_one();
     }
 
@@ -603,6 +664,12 @@ void mfxSchedulerCore::MarkTaskCompleted(const MFX_CALL_INFO *pCallInfo,
         MFX_LTRACE_1(MFX_TRACE_LEVEL_SCHED, "^Completed^", "%d", nTraceTaskId);
     }
 
+    // notify the application about the done tasks
+    if (!m_completionCallbacks.empty())
+    {
+        CallCompletionCallbacks();
+    }
+
 }
 
 // update dependencies produced from the dependency table
@@ -0,0 +1,109 @@
+// Copyright (c) 2020 Intel Corporation
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <mfx_scheduler_pool.h>
+
+#include <stdlib.h>
+#include <algorithm>
+#include <iterator>
+
+SchedulerPool& SchedulerPool::Instance()
+{
+    static SchedulerPool pool;
+    return pool;
+
+} // SchedulerPool& SchedulerPool::Instance()
+
+SchedulerPool::SchedulerPool()
+    : m_size(MFX_SCHEDULER_POOL_SIZE)
+{
+    const char *size = getenv("MFX_SCHEDULER_POOL_SIZE");
+    if (size && *size)
+    {
+        char *end = NULL;
+        unsigned long value = strtoul(size, &end, 10);
+        if (!*end && value <= 64)
+            m_size = (size_t) value;
+    }
+
+} // SchedulerPool::SchedulerPool()
+
+SchedulerPool::~SchedulerPool()
+{
+    for (MFXIUnknown *pScheduler : m_parked)
+        pScheduler->Release();
+
+} // SchedulerPool::~SchedulerPool()
+
+bool SchedulerPool::Park(MFXIUnknown *pSchedulerAllocated)
+{
+    if (1 != pSchedulerAllocated->GetNumRef())
+        return false;
+
+    MFXIScheduler3 *pScheduler = (MFXIScheduler3 *) pSchedulerAllocated->QueryInterface(MFXIScheduler3_GUID);
+    if (!pScheduler)
+        return false;
+
+    MFX_SCHEDULER_PARAM param = {};
+    MFX_SCHEDULER_METRICS metrics = {};
+    bool bIdle = (MFX_ERR_NONE == pScheduler->GetParam(&param)) &&
+                 (MFX_SCHEDULER_DEFAULT == param.flags) &&
+                 (MFX_ERR_NONE == pScheduler->GetMetrics(&metrics));
+    for (mfxU32 queueDepth : metrics.queueDepth)
+        bIdle = bIdle && !queueDepth;
+    pScheduler->Release();
+
+    if (!bIdle)
+        return false;
+
+    std::lock_guard<std::mutex> guard(m_guard);
+    if (m_parked.size() >= m_size)
+        return false;
+
+    m_parked.push_back(pSchedulerAllocated);
+    return true;
+
+} // bool SchedulerPool::Park(MFXIUnknown *pSchedulerAllocated)
+
+MFXIUnknown* SchedulerPool::Take(mfxU32 numberOfThreads)
+{
+    std::lock_guard<std::mutex> guard(m_guard);
+    if (m_parked.empty())
+        return NULL;
+
+    auto it = std::find_if(m_parked.rbegin(), m_parked.rend(),
+        [numberOfThreads](MFXIUnknown *pScheduler)
+        {
+            MFXIScheduler *pInterface = (MFXIScheduler *) pScheduler->QueryInterface(MFXIScheduler_GUID);
+            MFX_SCHEDULER_PARAM param = {};
+            if (pInterface)
+            {
+                pInterface->GetParam(&param);
+                pInterface->Release();
+            }
+            return param.numberOfThreads == numberOfThreads;
+        });
+    auto parked = (it != m_parked.rend()) ? std::prev(it.base()) : std::prev(m_parked.end());
+
+    MFXIUnknown *pScheduler = *parked;
+    m_parked.erase(parked);
+    return pScheduler;
+
+} // MFXIUnknown* SchedulerPool::Take(mfxU32 numberOfThreads)
@@ -234,6 +234,8 @@ namespace MfxHwH264Encode
     BIND_EXTBUF_TYPE_TO_ID(mfxExtEncToolsConfig, MFX_EXTBUFF_ENCTOOLS_CONFIG);
     BIND_EXTBUF_TYPE_TO_ID(mfxEncToolsCtrlExtDevice, MFX_EXTBUFF_ENCTOOLS_DEVICE);
     BIND_EXTBUF_TYPE_TO_ID(mfxEncToolsCtrlExtAllocator, MFX_EXTBUFF_ENCTOOLS_ALLOCATOR);
+    BIND_EXTBUF_TYPE_TO_ID(mfxEncToolsCtrlExtShared, MFX_EXTBUFF_ENCTOOLS_SHARED);
+    BIND_EXTBUF_TYPE_TO_ID(mfxEncToolsCtrlExtAsync, MFX_EXTBUFF_ENCTOOLS_ASYNC);
     BIND_EXTBUF_TYPE_TO_ID(mfxEncToolsFrameToAnalyze, MFX_EXTBUFF_ENCTOOLS_FRAME_TO_ANALYZE);
     BIND_EXTBUF_TYPE_TO_ID(mfxEncToolsHintPreEncodeSceneChange, MFX_EXTBUFF_ENCTOOLS_HINT_SCENE_CHANGE);
     BIND_EXTBUF_TYPE_TO_ID(mfxEncToolsHintPreEncodeGOP, MFX_EXTBUFF_ENCTOOLS_HINT_GOP);
@@ -611,6 +613,8 @@ namespace MfxHwH264Encode
         mfxExtEncToolsConfig            m_encToolsConfig;
         mfxEncToolsCtrlExtDevice        m_extDevice;
         mfxEncToolsCtrlExtAllocator     m_extAllocator;
+        mfxEncToolsCtrlExtShared        m_extShared;
+        mfxEncToolsCtrlExtAsync         m_extAsync;
 #endif
 #if defined (MFX_ENABLE_MFE)
         mfxExtMultiFrameParam    m_MfeParam;
@@ -37,6 +37,11 @@ static const
 MFX_GUID MFXIScheduler2_GUID =
 { 0xdc775b1c, 0x951d, 0x421f, { 0xbf, 0xd8, 0xca, 0x56, 0x2d, 0x95, 0xa4, 0x18 } };
 
+// {6F0B7A3E-2C41-4E8D-9A57-3B1E8C64D2F9}
+static const
+MFX_GUID MFXIScheduler3_GUID =
+{ 0x6f0b7a3e, 0x2c41, 0x4e8d, { 0x9a, 0x57, 0x3b, 0x1e, 0x8c, 0x64, 0xd2, 0xf9 } };
+
 enum mfxSchedulerFlags
 {
     // default behaviour policy
@@ -142,4 +147,37 @@ public:
     mfxStatus GetTimeout(mfxU32 & maxTimeToRun) = 0;
 };
 
+struct MFX_SCHEDULER_METRICS
+{
+    // Number of not completed tasks for each priority
+    mfxU32 queueDepth[MFX_PRIORITY_HIGH + 1];
+    // Number of working threads
+    mfxU32 numberOfThreads;
+    // Number of tasks completed or failed since the initialization
+    mfxU64 tasksCompleted;
+    // Number of task routine calls and their integral time in microseconds
+    mfxU64 taskCalls;
+    mfxU64 taskTime;
+};
+
+class MFXIScheduler3 : public MFXIScheduler2
+{
+public:
+    // Get the load counters of the scheduler
+    virtual
+    mfxStatus GetMetrics(MFX_SCHEDULER_METRICS *pMetrics) = 0;
+
+    // Wait until any or all of the sync points are done. The status of each
+    // sync point is returned in pStatus, MFX_WRN_IN_EXECUTION if it is not done.
+    virtual
+    mfxStatus SynchronizeMulti(const mfxSyncPoint *pSyncPoints, mfxU32 count,
+                               bool waitAll, mfxU32 timeToWait, mfxStatus *pStatus) = 0;
+
+    // Set the callback called once the task of the sync point is done. If the
+    // task is done already, the callback is called before the function returns.
+    virtual
+    mfxStatus SetCompletionCallback(mfxSyncPoint syncPoint,
+                                    mfxSyncPointCallback pCallback, mfxHDL pParam) = 0;
+};
+
 #endif // __MFX_INTERFACE_SCHEDULER_H
@@ -22,6 +22,7 @@
 #include <mfx_session.h>
 #include <mfx_trace.h>
 #include <mfx_utils.h>
+#include <mfx_interface_scheduler.h>
 
 mfxStatus MFXVideoCORE_SyncOperation(mfxSession session, mfxSyncPoint syncp, mfxU32 wait)
 {
@@ -45,3 +46,63 @@ mfxStatus MFXVideoCORE_SyncOperation(mfxSession session, mfxSyncPoint syncp, mfx
 
     return mfxRes;
 }
+
+#if (MFX_VERSION >= MFX_VERSION_NEXT)
+mfxStatus MFXVideoCORE_SyncOperationMulti(mfxSession session, mfxSyncPoint *syncp, mfxU32 count, mfxU16 mode, mfxU32 wait, mfxStatus *status)
+{
+    MFX_AUTO_LTRACE(MFX_TRACE_LEVEL_API, "MFX_SyncOperationMulti");
+    mfxStatus mfxRes;
+
+    MFX_CHECK(session, MFX_ERR_INVALID_HANDLE);
+    MFX_CHECK(session->m_pScheduler, MFX_ERR_NOT_INITIALIZED);
+    MFX_CHECK_NULL_PTR2(syncp, status);
+    MFX_CHECK(MFX_SYNC_WAIT_ANY == mode || MFX_SYNC_WAIT_ALL == mode, MFX_ERR_UNSUPPORTED);
+
+    MFX_LTRACE_I(MFX_TRACE_LEVEL_API, count);
+    MFX_LTRACE_I(MFX_TRACE_LEVEL_API, wait);
+
+    MFXIScheduler3 *pScheduler = reinterpret_cast<MFXIScheduler3 *>(session->m_pScheduler->QueryInterface(MFXIScheduler3_GUID));
+    MFX_CHECK(pScheduler, MFX_ERR_UNSUPPORTED);
+
+    try {
+        // call the function
+        mfxRes = pScheduler->SynchronizeMulti(syncp, count, MFX_SYNC_WAIT_ALL == mode, wait, status);
+    } catch(...) {
+        // set the default error value
+        mfxRes = MFX_ERR_ABORTED;
+    }
+
+    pScheduler->Release();
+
+    MFX_LTRACE_I(MFX_TRACE_LEVEL_API, mfxRes);
+
+    return mfxRes;
+}
+
+mfxStatus MFXVideoCORE_SetSyncPointCallback(mfxSession session, mfxSyncPoint syncp, mfxSyncPointCallback callback, mfxHDL pthis)
+{
+    MFX_AUTO_LTRACE(MFX_TRACE_LEVEL_API, "MFX_SetSyncPointCallback");
+    mfxStatus mfxRes;
+
+    MFX_CHECK(session, MFX_ERR_INVALID_HANDLE);
+    MFX_CHECK(session->m_pScheduler, MFX_ERR_NOT_INITIALIZED);
+    MFX_CHECK_NULL_PTR2(syncp, callback);
+
+    MFXIScheduler3 *pScheduler = reinterpret_cast<MFXIScheduler3 *>(session->m_pScheduler->QueryInterface(MFXIScheduler3_GUID));
+    MFX_CHECK(pScheduler, MFX_ERR_UNSUPPORTED);
+
+    try {
+        // call the function
+        mfxRes = pScheduler->SetCompletionCallback(syncp, callback, pthis);
+    } catch(...) {
+        // set the default error value
+        mfxRes = MFX_ERR_ABORTED;
+    }
+
+    pScheduler->Release();
+
+    MFX_LTRACE_I(MFX_TRACE_LEVEL_API, mfxRes);
+
+    return mfxRes;
+}
+#endif
@@ -508,6 +508,7 @@ mfxStatus MFXVideoDECODE_DecodeFrameAsync(mfxSession session, mfxBitstream *bs,
 
 #ifdef MFX_TRACE_ENABLE
     MFX_AUTO_LTRACE_WITHID(MFX_TRACE_LEVEL_API, "MFX_DecodeFrameAsync");
+    MFX_LTRACE_1(MFX_TRACE_LEVEL_API, "^Session^", "%p", session);
     MFX_LTRACE_BUFFER(MFX_TRACE_LEVEL_API, bs);
     MFX_LTRACE_BUFFER(MFX_TRACE_LEVEL_API, surface_work);
 #endif
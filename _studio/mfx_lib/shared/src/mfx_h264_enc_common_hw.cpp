@@ -1866,6 +1866,8 @@ bool MfxHwH264Encode::IsVideoParamExtBufferIdSupported(mfxU32 id)
         || id == MFX_EXTBUFF_ENCTOOLS_CONFIG
         || id == MFX_EXTBUFF_ENCTOOLS_DEVICE
         || id == MFX_EXTBUFF_ENCTOOLS_ALLOCATOR
+        || id == MFX_EXTBUFF_ENCTOOLS_SHARED
+        || id == MFX_EXTBUFF_ENCTOOLS_ASYNC
 #endif
 
         || id == MFX_EXTBUFF_MVC_SEQ_DESC
@@ -8029,6 +8031,8 @@ void MfxVideoParam::Construct(mfxVideoParam const & par)
     CONSTRUCT_EXT_BUFFER(mfxExtEncToolsConfig,          m_encToolsConfig);
     CONSTRUCT_EXT_BUFFER(mfxEncToolsCtrlExtDevice,               m_extDevice);
     CONSTRUCT_EXT_BUFFER(mfxEncToolsCtrlExtAllocator,            m_extAllocator);
+    CONSTRUCT_EXT_BUFFER(mfxEncToolsCtrlExtShared,               m_extShared);
+    CONSTRUCT_EXT_BUFFER(mfxEncToolsCtrlExtAsync,                m_extAsync);
 #endif
 
 #if defined(MFX_ENABLE_MFE)
@@ -27,12 +27,12 @@
 
 #include <libmfx_core_factory.h>
 #include <libmfx_core.h>
+#include <mfx_scheduler_pool.h>
 
 #if defined(MFX_VA_LINUX)
 #include <libmfx_core_vaapi.h>
 #endif
 
-
 // static section of the file
 namespace
 {
@@ -646,7 +646,9 @@ mfxStatus _mfxSession::Init(mfxIMPL implInterface, mfxVersion *ver)
     // initialize the core interface
     InitCoreInterface(&m_coreInt, this);
 
-    // query the scheduler interface
+    // query the scheduler interface, the scheduler of a closed session
+    // is reused if there is one
+    m_pSchedulerAllocated = SchedulerPool::Instance().Take(maxNumThreads);
     m_pScheduler = QueryInterface<MFXIScheduler> (m_pSchedulerAllocated,
                                                   MFXIScheduler_GUID);
     if (NULL == m_pScheduler)
@@ -697,7 +699,8 @@ mfxStatus _mfxSession::ReleaseScheduler(void)
     if(m_pScheduler)
         m_pScheduler->Release();
 
-    if(m_pSchedulerAllocated)
+    // an idle scheduler is parked for the next session
+    if(m_pSchedulerAllocated && !SchedulerPool::Instance().Park(m_pSchedulerAllocated))
         m_pSchedulerAllocated->Release();
 
     m_pScheduler = nullptr;
@@ -862,7 +865,16 @@ mfxStatus _mfxSession_1_10::InitEx(mfxInitParam& par)
     // initialize the core interface
     InitCoreInterface(&m_coreInt, this);
 
-    // query the scheduler interface
+    // query the scheduler interface, the scheduler of a closed session
+    // is reused if there is one
+    if (maxNumThreads)
+    {
+        mfxU32 numberOfThreads = maxNumThreads;
+        if (par.NumExtParam && ((mfxExtThreadsParam*)par.ExtParam[0])->NumThread)
+            numberOfThreads = ((mfxExtThreadsParam*)par.ExtParam[0])->NumThread;
+
+        m_pSchedulerAllocated = SchedulerPool::Instance().Take(numberOfThreads);
+    }
     m_pScheduler = ::QueryInterface<MFXIScheduler>(m_pSchedulerAllocated, MFXIScheduler_GUID);
     if (NULL == m_pScheduler)
     {
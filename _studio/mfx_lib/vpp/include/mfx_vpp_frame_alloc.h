@@ -0,0 +1,79 @@
+// Copyright (c) 2020 Intel Corporation
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "mfx_common.h"
+
+#if defined (MFX_ENABLE_VPP)
+
+#ifndef __MFX_VPP_FRAME_ALLOC_H
+#define __MFX_VPP_FRAME_ALLOC_H
+
+#include <vector>
+
+#include "mfxvideo++int.h"
+
+namespace MfxHwVideoProcessing
+{
+    // Helper which checks number of allocated frames and auto-free
+    class MfxFrameAllocResponse : public mfxFrameAllocResponse
+    {
+    public:
+        MfxFrameAllocResponse();
+
+        ~MfxFrameAllocResponse();
+
+        mfxStatus Alloc(
+            VideoCORE *            core,
+            mfxFrameAllocRequest & req,
+            bool isCopyRequired = true);
+
+        mfxStatus Alloc(
+            VideoCORE *            core,
+            mfxFrameAllocRequest & req,
+            mfxFrameSurface1 **    opaqSurf,
+            mfxU32                 numOpaqSurf);
+
+        // Keeps the allocated frames if they fit the request: the same type
+        // and FourCC, enough frames and not smaller ones. Allocates otherwise.
+        mfxStatus Realloc(
+            VideoCORE *            core,
+            mfxFrameAllocRequest & req,
+            bool isCopyRequired = true);
+
+        mfxStatus Free( void );
+
+    private:
+        MfxFrameAllocResponse(MfxFrameAllocResponse const &);
+        MfxFrameAllocResponse & operator =(MfxFrameAllocResponse const &);
+
+        bool Fits(mfxFrameAllocRequest const & req) const;
+
+        VideoCORE * m_core;
+        mfxU16      m_numFrameActualReturnedByAllocFrames;
+        mfxU16      m_type;
+        mfxFrameInfo m_info;
+
+        std::vector<mfxFrameAllocResponse> m_responseQueue;
+        std::vector<mfxMemId>              m_mids;
+    };
+}; // namespace MfxHwVideoProcessing
+
+#endif // __MFX_VPP_FRAME_ALLOC_H
+#endif // MFX_ENABLE_VPP
@@ -32,6 +32,7 @@
 #include "umc_mutex.h"
 #include "mfx_vpp_interface.h"
 #include "mfx_vpp_defs.h"
+#include "mfx_vpp_frame_alloc.h"
 
  #include "cmrt_cross_platform.h" // Gpucopy stuff
  #if defined(MFX_ENABLE_SCENE_CHANGE_DETECTION_VPP)
@@ -105,39 +106,6 @@ namespace MfxHwVideoProcessing
         bool m_free;
     };
 
-
-    // Helper which checks number of allocated frames and auto-free
-    class MfxFrameAllocResponse : public mfxFrameAllocResponse
-    {
-    public:
-        MfxFrameAllocResponse();
-
-        ~MfxFrameAllocResponse();
-
-        mfxStatus Alloc(
-            VideoCORE *            core,
-            mfxFrameAllocRequest & req,
-            bool isCopyRequired = true);
-
-        mfxStatus Alloc(
-            VideoCORE *            core,
-            mfxFrameAllocRequest & req,
-            mfxFrameSurface1 **    opaqSurf,
-            mfxU32                 numOpaqSurf);
-
-        mfxStatus Free( void );
-
-    private:
-        MfxFrameAllocResponse(MfxFrameAllocResponse const &);
-        MfxFrameAllocResponse & operator =(MfxFrameAllocResponse const &);
-
-        VideoCORE * m_core;
-        mfxU16      m_numFrameActualReturnedByAllocFrames;
-
-        std::vector<mfxFrameAllocResponse> m_responseQueue;
-        std::vector<mfxMemId>              m_mids;
-    };
-
     struct ExtSurface
     {
         ExtSurface ()
@@ -0,0 +1,154 @@
+// Copyright (c) 2020 Intel Corporation
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "mfx_common.h"
+
+#if defined (MFX_ENABLE_VPP)
+
+#include <string.h>
+
+#include "mfx_vpp_frame_alloc.h"
+
+using namespace MfxHwVideoProcessing;
+
+MfxFrameAllocResponse::MfxFrameAllocResponse()
+    : m_core (0)
+    , m_numFrameActualReturnedByAllocFrames(0)
+    , m_type(0)
+{
+    memset(static_cast<mfxFrameAllocResponse *>(this), 0, sizeof(mfxFrameAllocResponse));
+    memset(&m_info, 0, sizeof(m_info));
+} // MfxFrameAllocResponse::MfxFrameAllocResponse()
+
+
+mfxStatus MfxFrameAllocResponse::Free( void )
+{
+    if (m_core == 0)
+        return MFX_ERR_NONE;
+
+    if (MFX_HW_D3D11  == m_core->GetVAType())
+    {
+        for (size_t i = 0; i < m_responseQueue.size(); i++)
+        {
+            m_core->FreeFrames(&m_responseQueue[i]);
+        }
+
+        m_responseQueue.clear();
+    }
+    else
+    {
+        if (mids)
+        {
+            NumFrameActual = m_numFrameActualReturnedByAllocFrames;
+            m_core->FreeFrames(this);
+            mids = 0;
+        }
+    }
+
+    // the frames are gone, nothing to free or reuse
+    m_core = 0;
+
+    return MFX_ERR_NONE;
+
+} // mfxStatus MfxFrameAllocResponse::Free( void )
+
+
+MfxFrameAllocResponse::~MfxFrameAllocResponse()
+{
+    Free();
+
+} // MfxFrameAllocResponse::~MfxFrameAllocResponse()
+
+
+mfxStatus MfxFrameAllocResponse::Alloc(
+    VideoCORE *            core,
+    mfxFrameAllocRequest & req, bool isCopyReqiured)
+{
+    req.NumFrameSuggested = req.NumFrameMin; // no need in 2 different NumFrames
+
+    {
+        mfxStatus sts = core->AllocFrames(&req, this, isCopyReqiured);
+        MFX_CHECK_STS(sts);
+    }
+
+    if (NumFrameActual < req.NumFrameMin)
+        return MFX_ERR_MEMORY_ALLOC;
+
+    m_core = core;
+    m_numFrameActualReturnedByAllocFrames = NumFrameActual;
+    m_type = req.Type;
+    m_info = req.Info;
+    NumFrameActual = req.NumFrameMin; // no need in redundant frames
+    return MFX_ERR_NONE;
+}
+
+mfxStatus MfxFrameAllocResponse::Alloc(
+    VideoCORE *            core,
+    mfxFrameAllocRequest & req,
+    mfxFrameSurface1 **    opaqSurf,
+    mfxU32                 numOpaqSurf)
+{
+    req.NumFrameSuggested = req.NumFrameMin; // no need in 2 different NumFrames
+
+    mfxStatus sts = core->AllocFrames(&req, this, opaqSurf, numOpaqSurf);
+    MFX_CHECK_STS(sts);
+
+    if (NumFrameActual < req.NumFrameMin)
+        return MFX_ERR_MEMORY_ALLOC;
+
+    m_core = core;
+    m_numFrameActualReturnedByAllocFrames = NumFrameActual;
+    m_type = req.Type;
+    m_info = req.Info;
+    NumFrameActual = req.NumFrameMin; // no need in redundant frames
+    return MFX_ERR_NONE;
+}
+
+
+bool MfxFrameAllocResponse::Fits(mfxFrameAllocRequest const & req) const
+{
+    return m_core
+        && req.Type        == m_type
+        && req.Info.FourCC == m_info.FourCC
+        && req.Info.ChromaFormat == m_info.ChromaFormat
+        && req.Info.Width  <= m_info.Width
+        && req.Info.Height <= m_info.Height
+        && req.NumFrameMin <= m_numFrameActualReturnedByAllocFrames;
+}
+
+mfxStatus MfxFrameAllocResponse::Realloc(
+    VideoCORE *            core,
+    mfxFrameAllocRequest & req,
+    bool isCopyRequired)
+{
+    req.NumFrameSuggested = req.NumFrameMin; // no need in 2 different NumFrames
+
+    if (core == m_core && Fits(req))
+    {
+        NumFrameActual = req.NumFrameMin;
+        return MFX_ERR_NONE;
+    }
+
+    MFX_SAFE_CALL(Free());
+
+    return Alloc(core, req, isCopyRequired);
+}
+
+#endif // MFX_ENABLE_VPP
@@ -2808,12 +2808,15 @@ mfxStatus VideoVPPHW::Reset(mfxVideoParam *par)
         request.Type        = MFX_MEMTYPE_DXVA2_PROCESSOR_TARGET | MFX_MEMTYPE_FROM_VPPOUT | MFX_MEMTYPE_INTERNAL_FRAME;
         request.NumFrameMin = request.NumFrameSuggested = m_config.m_surfCount[VPP_OUT] ;
 
-        if (m_config.m_surfCount[VPP_OUT] != m_internalVidSurf[VPP_OUT].NumFrameActual || m_executeParams.bComposite)
+        // the frames of the previous configuration are kept if they fit
+        if (m_executeParams.bComposite)
         {
-            sts = m_internalVidSurf[VPP_OUT].Alloc(m_pCore, request, par->vpp.Out.FourCC != MFX_FOURCC_YV12);
-            MFX_CHECK(MFX_ERR_NONE == sts, MFX_WRN_PARTIAL_ACCELERATION);
+            m_internalVidSurf[VPP_OUT].Free();
         }
 
+        sts = m_internalVidSurf[VPP_OUT].Realloc(m_pCore, request, par->vpp.Out.FourCC != MFX_FOURCC_YV12);
+        MFX_CHECK(MFX_ERR_NONE == sts, MFX_WRN_PARTIAL_ACCELERATION);
+
         m_config.m_IOPattern |= MFX_IOPATTERN_OUT_SYSTEM_MEMORY;
 
         m_config.m_surfCount[VPP_OUT] = request.NumFrameMin;
@@ -2827,12 +2830,15 @@ mfxStatus VideoVPPHW::Reset(mfxVideoParam *par)
         request.Type        = MFX_MEMTYPE_DXVA2_PROCESSOR_TARGET | MFX_MEMTYPE_FROM_VPPIN | MFX_MEMTYPE_INTERNAL_FRAME;
         request.NumFrameMin = request.NumFrameSuggested = m_config.m_surfCount[VPP_IN] ;
 
-        if (m_config.m_surfCount[VPP_IN] != m_internalVidSurf[VPP_IN].NumFrameActual || m_executeParams.bComposite)
+        // the frames of the previous configuration are kept if they fit
+        if (m_executeParams.bComposite)
         {
-            sts = m_internalVidSurf[VPP_IN].Alloc(m_pCore, request, par->vpp.In.FourCC != MFX_FOURCC_YV12);
-            MFX_CHECK(MFX_ERR_NONE == sts, MFX_WRN_PARTIAL_ACCELERATION);
+            m_internalVidSurf[VPP_IN].Free();
         }
 
+        sts = m_internalVidSurf[VPP_IN].Realloc(m_pCore, request, par->vpp.In.FourCC != MFX_FOURCC_YV12);
+        MFX_CHECK(MFX_ERR_NONE == sts, MFX_WRN_PARTIAL_ACCELERATION);
+
         m_config.m_IOPattern |= MFX_IOPATTERN_IN_SYSTEM_MEMORY;
 
         m_config.m_surfCount[VPP_IN] = request.NumFrameMin;
@@ -6607,90 +6613,6 @@ mfxStatus SetSignalInfo(const mfxVideoParam & videoParam, mfxU32 trMatrix, mfxU3
 } // mfxStatus SetMFXFrcMode(const mfxVideoParam & videoParam, mfxU32 mode)
 
 
-MfxFrameAllocResponse::MfxFrameAllocResponse()
-    : m_core (0)
-    , m_numFrameActualReturnedByAllocFrames(0)
-{
-    Zero(dynamic_cast<mfxFrameAllocResponse&>(*this));
-} // MfxFrameAllocResponse::MfxFrameAllocResponse()
-
-
-mfxStatus MfxFrameAllocResponse::Free( void )
-{
-    if (m_core == 0)
-        return MFX_ERR_NONE;
-
-    if (MFX_HW_D3D11  == m_core->GetVAType())
-    {
-        for (size_t i = 0; i < m_responseQueue.size(); i++)
-        {
-            m_core->FreeFrames(&m_responseQueue[i]);
-        }
-
-        m_responseQueue.clear();
-    }
-    else
-    {
-        if (mids)
-        {
-            NumFrameActual = m_numFrameActualReturnedByAllocFrames;
-            m_core->FreeFrames(this);
-        }
-    }
-
-    return MFX_ERR_NONE;
-
-} // mfxStatus MfxFrameAllocResponse::Free( void )
-
-
-MfxFrameAllocResponse::~MfxFrameAllocResponse()
-{
-    Free();
-
-} // MfxFrameAllocResponse::~MfxFrameAllocResponse()
-
-
-mfxStatus MfxFrameAllocResponse::Alloc(
-    VideoCORE *            core,
-    mfxFrameAllocRequest & req, bool isCopyReqiured)
-{
-    req.NumFrameSuggested = req.NumFrameMin; // no need in 2 different NumFrames
-
-    {
-        mfxStatus sts = core->AllocFrames(&req, this, isCopyReqiured);
-        MFX_CHECK_STS(sts);
-    }
-
-    if (NumFrameActual < req.NumFrameMin)
-        return MFX_ERR_MEMORY_ALLOC;
-
-    m_core = core;
-    m_numFrameActualReturnedByAllocFrames = NumFrameActual;
-    NumFrameActual = req.NumFrameMin; // no need in redundant frames
-    return MFX_ERR_NONE;
-}
-
-mfxStatus MfxFrameAllocResponse::Alloc(
-    VideoCORE *            core,
-    mfxFrameAllocRequest & req,
-    mfxFrameSurface1 **    opaqSurf,
-    mfxU32                 numOpaqSurf)
-{
-    req.NumFrameSuggested = req.NumFrameMin; // no need in 2 different NumFrames
-
-    mfxStatus sts = core->AllocFrames(&req, this, opaqSurf, numOpaqSurf);
-    MFX_CHECK_STS(sts);
-
-    if (NumFrameActual < req.NumFrameMin)
-        return MFX_ERR_MEMORY_ALLOC;
-
-    m_core = core;
-    m_numFrameActualReturnedByAllocFrames = NumFrameActual;
-    NumFrameActual = req.NumFrameMin; // no need in redundant frames
-    return MFX_ERR_NONE;
-}
-
-
 mfxStatus CopyFrameDataBothFields(
     VideoCORE *          core,
     mfxFrameData /*const*/ & dst,
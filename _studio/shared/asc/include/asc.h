@@ -24,6 +24,7 @@
 #include <map>
 #include <string>
 #include "asc_structures.h"
+#include "asc_thread_pool.h"
 
 namespace ns_asc {
 
@@ -36,6 +37,7 @@ typedef mfxI16(*t_AvgLumaCalc)(pmfxU32 pAvgLineVal, int len);
 typedef void(*t_ME_SAD_8x8_Block_Search)(mfxU8 *pSrc, mfxU8 *pRef, int pitch, int xrange, int yrange, mfxU16 *bestSAD, int *bestX, int *bestY);
 typedef void(*t_ME_SAD_8x8_Block_FSearch)(mfxU8 *pSrc, mfxU8 *pRef, int pitch, int xrange, int yrange, mfxU32 *bestSAD, int *bestX, int *bestY);
 typedef mfxStatus(*t_Calc_RaCa_pic)(mfxU8 *pPicY, mfxI32 width, mfxI32 height, mfxI32 pitch, mfxF64 &RsCs);
+typedef mfxU32(*t_SCDetectRF_Votes)(const mfxI32 *feature);
 
 typedef mfxU16(*t_ME_SAD_8x8_Block)(mfxU8 *pSrc, mfxU8 *pRef, mfxU32 srcPitch, mfxU32 refPitch);
 typedef void  (*t_ME_VAR_8x8_Block)(mfxU8 *pSrc, mfxU8 *pRef, mfxU8 *pMCref, mfxI16 srcAvgVal, mfxI16 refAvgVal, mfxU32 srcPitch, mfxU32 refPitch, mfxI32 &var, mfxI32 &jtvar, mfxI32 &jtMCvar);
@@ -178,6 +180,10 @@ private:
     std::map<void *, CmSurface2D *> m_tableCmRelations2;
     std::map<CmSurface2D *, SurfaceIndex *> m_tableCmIndex2;
 
+    // CPU backend threads, subsampling, RsCs and motion analysis are split in row bands
+    ASCThreadPool m_threadPool;
+
+    int m_AVX512_available;
     int m_AVX2_available;
     int m_SSE4_available;
     t_GainOffset               GainOffset;
@@ -187,6 +193,7 @@ private:
     t_ImageDiffHistogram       ImageDiffHistogram;
     t_ME_SAD_8x8_Block_Search  ME_SAD_8x8_Block_Search;
     t_Calc_RaCa_pic            Calc_RaCa_pic;
+    t_SCDetectRF_Votes         SCDetectRF_Votes;
     
     t_ME_SAD_8x8_Block         ME_SAD_8x8_Block;
     t_ME_VAR_8x8_Block         ME_VAR_8x8_Block;
@@ -264,6 +271,12 @@ public:
     ASC_API mfxStatus AssignResources(mfxU8 position, CmSurface2DUP *inputFrame, mfxU8 *pixelData);
     ASC_API mfxStatus SwapResources(mfxU8 position, CmSurface2DUP **inputFrame, mfxU8 **pixelData);
 
+    ASC_API mfxStatus SetNumThreads(mfxU32 numThreads);
+    ASC_API mfxU32 GetNumThreads();
+
+    // ASCFull_Search by default, Init resets it
+    ASC_API mfxStatus SetMotionSearchMode(ASCMotionSearch_Mode mode);
+
     ASC_API void SetControlLevel(mfxU8 level);
     ASC_API mfxStatus SetGoPSize(mfxU32 GoPSize);
     ASC_API void ResetGoPSize();
@@ -61,5 +61,6 @@ void GainOffset_AVX2(pmfxU8 *pSrc, pmfxU8 *pDst, mfxU16 width, mfxU16 height, mf
     mfxI16 gainDiff);
 mfxStatus Calc_RaCa_pic_AVX2(mfxU8 *pSrc, mfxI32 width, mfxI32 height, mfxI32 pitch, mfxF64 &RsCs);
 mfxI16 AvgLumaCalc_AVX2(pmfxU32 pAvgLineVal, int len);
+mfxU32 SCDetectRF_Votes_AVX2(const mfxI32 *feature);
 
 #endif //_ASC_AVX2_IMPL_H_
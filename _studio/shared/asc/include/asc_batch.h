@@ -0,0 +1,86 @@
+// Copyright (c) 2020 Intel Corporation
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef _ASC_BATCH_H_
+#define _ASC_BATCH_H_
+
+#include <memory>
+#include <vector>
+#include "asc.h"
+
+namespace ns_asc {
+
+typedef struct ASCStreamParameters {
+    mfxI32
+        Width,
+        Height,
+        Pitch;
+    mfxU32
+        PicStruct;
+} ASCStreamParam;
+
+typedef struct ASCBatchFrameData {
+    // in
+    mfxU32
+        stream;
+    mfxU8
+        *frame;          // luma plane in system memory
+    mfxI32
+        pitch;           // 0 keeps the pitch of the stream
+    // out
+    mfxStatus
+        sts;
+    mfxU32
+        shotDecision;    // Get_frame_shot_Decision of the stream
+} ASCBatchFrame;
+
+// Scene change analysis of many independent streams on the CPU backend.
+// Every stream keeps its own ASC history, PutFrames takes at most one frame
+// per stream and analyses the frames concurrently on one shared thread pool.
+class ASCBatch {
+public:
+    ASC_API ASCBatch();
+    ASC_API ~ASCBatch();
+
+    // numThreads counts the calling thread, 0 picks the hardware concurrency
+    ASC_API mfxStatus Init(mfxU32 numStreams, const ASCStreamParam *params, mfxU32 numThreads);
+    ASC_API void Close();
+
+    ASC_API mfxStatus PutFrames(mfxU32 count, ASCBatchFrame *frames);
+
+    ASC_API mfxU32 GetNumStreams();
+    // per stream results beyond the shot decision
+    ASC_API ASC *GetStream(mfxU32 stream);
+
+private:
+    ASCBatch(const ASCBatch &);
+    ASCBatch &operator=(const ASCBatch &);
+
+    std::vector<std::unique_ptr<ASC> >
+        m_streams;
+    std::vector<mfxU8>
+        m_interlaced,
+        m_busy;
+    ASCThreadPool
+        m_threadPool;
+};
+
+};
+#endif //_ASC_BATCH_H_
@@ -44,5 +44,8 @@ ASC_ALIGN_DECL(16) static const mfxU16 tab_killmask[8][8] = {
 };
 
 void calc_RACA_4x4_C(mfxU8 *pSrc, mfxI32 pitch, mfxI32 *RS, mfxI32 *CS);
+// RsCs of the picture from the block sums, shared by all code paths so that
+// FMA contraction in the AVX-512 build can not change the result
+mfxF64 calc_RACA_pic_C(mfxI32 RS, mfxI32 CS, mfxI32 width, mfxI32 height);
 
 #endif //_ASC_COMMON_IMPL_H_
@@ -25,6 +25,7 @@
 #include "asc_c_impl.h"
 #include "asc_sse4_impl.h"
 #include "asc_avx2_impl.h"
+#include "asc_avx512_impl.h"
 
 
 #endif //_ASC_CPU_DISPATCHER_H_
@@ -39,6 +39,7 @@
 #define S_AREA_SHIFT      13
 #define TSC_INT_SCALE     5
 #define GAINDIFF_THR      20
+#define ASC_MAX_THREADS   (ASC_SMALL_HEIGHT / MVBLK_SIZE) // CPU backend, one row of 8x8 blocks per thread
 
 /*--MACROS--*/
 #define NMAX(a,b)         ((a>b)?a:b)
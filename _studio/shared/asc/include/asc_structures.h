@@ -107,6 +107,10 @@ typedef enum ASCFrameTypeScan {
     ASCtopfieldfirst_frame,
     ASCbotfieldFirst_frame
 }ASCFTS;
+typedef enum ASCMotionSearch_Mode {
+    ASCFull_Search,         // +-8 search around the best spatial predictor for every block
+    ASCPredictive_Search    // spatial and temporal predictors first, the +-8 search only for outliers
+}ASCMSM;
 typedef enum ASCFrameFields {
     ASCTopField,
     ASCBottomField
@@ -194,7 +198,8 @@ typedef struct ASCVideo_characteristics {
         maxYrange,
         interlaceMode,
         StartingField,
-        currentField;
+        currentField,
+        searchMode;
     ASCTime
         timer;
 }ASCVidData;
@@ -0,0 +1,77 @@
+// Copyright (c) 2020 Intel Corporation
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef _ASC_THREAD_POOL_H_
+#define _ASC_THREAD_POOL_H_
+
+#include "mfxdefs.h"
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace ns_asc {
+
+// Worker threads of the CPU backend. Run() hands task indices out to the
+// workers and to the calling thread, in increasing order, and returns when
+// all tasks are done. Without workers the tasks run inline one after another.
+class ASCThreadPool {
+public:
+    ASCThreadPool();
+    ~ASCThreadPool();
+
+    // numThreads counts the calling thread, 1 stops all workers
+    mfxStatus Init(mfxU32 numThreads);
+    void Close();
+    mfxU32 GetNumThreads() const { return (mfxU32)m_workers.size() + 1; }
+
+    void Run(mfxU32 count, const std::function<void(mfxU32)> &task);
+
+private:
+    ASCThreadPool(const ASCThreadPool &);
+    ASCThreadPool &operator=(const ASCThreadPool &);
+
+    void Worker(mfxU64 generation);
+    void RunTasks();
+
+    std::vector<std::thread>
+        m_workers;
+    std::mutex
+        m_mutex;
+    std::condition_variable
+        m_wake,
+        m_done;
+    const std::function<void(mfxU32)>
+        *m_task;
+    mfxU32
+        m_count,
+        m_busy;
+    std::atomic<mfxU32>
+        m_next;
+    mfxU64
+        m_generation;
+    bool
+        m_exit;
+};
+
+};
+#endif //_ASC_THREAD_POOL_H_
@@ -33,6 +33,7 @@ mfxU16 __cdecl ME_simple(
     ASCImDetails *dataIn,
     ASCimageData *scale,
     ASCimageData *scaleRef,
+    ASCMVector *refMV,
     bool first,
     ASCVidData *limits,
     t_ME_SAD_8x8_Block_Search ME_SAD_8x8_Block_Search,
@@ -22,10 +22,73 @@
 
 #include "asc_structures.h"
 
+// Features of the scene change random forest, in SCDetectRF argument order
+enum ASCTreeFeature
+{
+    ASC_TREE_diffMVdiffVal = 0,
+    ASC_TREE_RsCsDiff,
+    ASC_TREE_MVDiff,
+    ASC_TREE_Rs,
+    ASC_TREE_AFD,
+    ASC_TREE_CsDiff,
+    ASC_TREE_diffTSC,
+    ASC_TREE_TSC,
+    ASC_TREE_gchDC,
+    ASC_TREE_diffRsCsdiff,
+    ASC_TREE_posBalance,
+    ASC_TREE_SC,
+    ASC_TREE_TSCindex,
+    ASC_TREE_Scindex,
+    ASC_TREE_Cs,
+    ASC_TREE_diffAFD,
+    ASC_TREE_negBalance,
+    ASC_TREE_ssDCval,
+    ASC_TREE_refDCval,
+    ASC_TREE_RsDiff,
+    ASC_TREE_LEAF,         // not a feature, marks leaf nodes
+    ASC_TREE_FEATURE_SLOTS = 32 // size of the feature array, padded for vector lookups
+};
+
+#define ASC_TREE_COUNT      21
+#define ASC_TREE_NODE_COUNT 10589
+#define ASC_TREE_DEPTH      17
+
+// The forest of src/tree.cpp flattened by tools/asc_tree_gen.py into src/tree_table.cpp.
+// Every tree is stored in level order starting at ASC_TREE_ROOT[t]. A node is packed to
+// 32 bits: the threshold, the feature it tests and the offset to its children. A split goes
+// to node + offset if the feature value is below the threshold and to node + offset + 1
+// otherwise. A leaf has feature ASC_TREE_LEAF and offset 0 and keeps its vote in threshold.
+#define ASC_TREE_NODE(threshold, feature, offset) \
+    ((mfxU32)(mfxU16)(mfxI16)(threshold) | ((mfxU32)(feature) << 16) | ((mfxU32)(offset) << 21))
+#define ASC_TREE_NODE_THRESHOLD(node) ((mfxI32)(mfxI16)((node) & 0xffff))
+#define ASC_TREE_NODE_FEATURE(node)   (((node) >> 16) & 0x1f)
+#define ASC_TREE_NODE_OFFSET(node)    ((node) >> 21)
+
+extern const mfxU16 ASC_TREE_ROOT[ASC_TREE_COUNT];
+extern const mfxU32 ASC_TREE_NODES[ASC_TREE_NODE_COUNT];
+
+// Fills the feature array for SCDetectRF_Votes_*
+void SCDetectRF_Features(mfxI32 feature[ASC_TREE_FEATURE_SLOTS],
+                         mfxI32 diffMVdiffVal, mfxU32 RsCsDiff,   mfxU32 MVDiff,   mfxU32 Rs,       mfxU32 AFD,
+                         mfxU32 CsDiff,        mfxI32 diffTSC,    mfxU32 TSC,      mfxU32 gchDC,    mfxI32 diffRsCsdiff,
+                         mfxU32 posBalance,    mfxU32 SC,         mfxU32 TSCindex, mfxU32 Scindex,  mfxU32 Cs,
+                         mfxI32 diffAFD,       mfxU32 negBalance, mfxU32 ssDCval,  mfxU32 refDCval, mfxU32 RsDiff);
+
+// Number of trees voting for a scene change
+mfxU32 SCDetectRF_Votes_C(const mfxI32 *feature);
+
 bool SCDetectRF( mfxI32 diffMVdiffVal, mfxU32 RsCsDiff,   mfxU32 MVDiff,   mfxU32 Rs,       mfxU32 AFD,
                  mfxU32 CsDiff,        mfxI32 diffTSC,    mfxU32 TSC,      mfxU32 gchDC,    mfxI32 diffRsCsdiff,
                  mfxU32 posBalance,    mfxU32 SC,         mfxU32 TSCindex, mfxU32 Scindex,  mfxU32 Cs,
                  mfxI32 diffAFD,       mfxU32 negBalance, mfxU32 ssDCval,  mfxU32 refDCval, mfxU32 RsDiff,
                  mfxU8 control);
 
+// Hand written forest (src/tree.cpp), the source of ASC_TREE_NODES. It is not part of
+// the library and only serves as the verification oracle for SCDetectRF.
+bool SCDetectRF_Ref( mfxI32 diffMVdiffVal, mfxU32 RsCsDiff,   mfxU32 MVDiff,   mfxU32 Rs,       mfxU32 AFD,
+                     mfxU32 CsDiff,        mfxI32 diffTSC,    mfxU32 TSC,      mfxU32 gchDC,    mfxI32 diffRsCsdiff,
+                     mfxU32 posBalance,    mfxU32 SC,         mfxU32 TSCindex, mfxU32 Scindex,  mfxU32 Cs,
+                     mfxI32 diffAFD,       mfxU32 negBalance, mfxU32 ssDCval,  mfxU32 refDCval, mfxU32 RsDiff,
+                     mfxU8 control);
+
 #endif //_TREE_H_
\ No newline at end of file
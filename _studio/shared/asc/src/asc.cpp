@@ -33,7 +33,9 @@
 #include "motion_estimation_engine.h"
 #include <limits.h>
 #include <algorithm>
+#include <atomic>
 #include <cmath>
+#include <thread>
 
 using std::min;
 using std::max;
@@ -218,6 +220,7 @@ ASC_API ASC::ASC()
     m_height = 0;
     m_pitch = 0;
 
+    m_AVX512_available = 0;
     m_AVX2_available = 0;
     m_SSE4_available = 0;
     GainOffset              = nullptr;
@@ -227,6 +230,7 @@ ASC_API ASC::ASC()
     ImageDiffHistogram      = nullptr;
     ME_SAD_8x8_Block_Search = nullptr;
     Calc_RaCa_pic           = nullptr;
+    SCDetectRF_Votes        = nullptr;
     resizeFunc              = nullptr;
     ME_SAD_8x8_Block        = nullptr;
     ME_VAR_8x8_Block        = nullptr;
@@ -335,6 +339,7 @@ void ASC::Params_Init() {
     m_dataIn->interlaceMode = 0;
     m_dataIn->StartingField = ASCTopField;
     m_dataIn->currentField = ASCTopField;
+    m_dataIn->searchMode = ASCFull_Search;
     ImDetails_Init(m_dataIn->layer);
 }
 
@@ -668,6 +673,10 @@ mfxStatus ASC::SetDimensions(mfxI32 Width, mfxI32 Height, mfxI32 Pitch) {
 #define ASC_CPU_DISP_INIT_AVX2_SSE4_C(func) (m_AVX2_available ? ASC_CPU_DISP_INIT_AVX2(func) : ASC_CPU_DISP_INIT_SSE4_C(func))
 #define ASC_CPU_DISP_INIT_AVX2_C(func)      (m_AVX2_available ? ASC_CPU_DISP_INIT_AVX2(func) : ASC_CPU_DISP_INIT_C(func))
 
+#define ASC_CPU_DISP_INIT_AVX512(func)               (func = (func ## _AVX512))
+#define ASC_CPU_DISP_INIT_AVX512_AVX2_SSE4_C(func)   (m_AVX512_available ? ASC_CPU_DISP_INIT_AVX512(func) : ASC_CPU_DISP_INIT_AVX2_SSE4_C(func))
+#define ASC_CPU_DISP_INIT_AVX512_AVX2_C(func)        (m_AVX512_available ? ASC_CPU_DISP_INIT_AVX512(func) : ASC_CPU_DISP_INIT_AVX2_C(func))
+
 ASC_API mfxStatus ASC::Init(mfxI32 Width, mfxI32 Height, mfxI32 Pitch, mfxU32 PicStruct, CmDevice* pCmDevice)
 {
     mfxStatus sts = MFX_ERR_NONE;
@@ -679,6 +688,7 @@ ASC_API mfxStatus ASC::Init(mfxI32 Width, mfxI32 Height, mfxI32 Pitch, mfxU32 Pi
     m_task = nullptr;
     m_taskCp = nullptr;
 
+    m_AVX512_available = CpuFeature_AVX512BW();
     m_AVX2_available = CpuFeature_AVX2();
     m_SSE4_available = CpuFeature_SSE41();
 
@@ -688,13 +698,14 @@ ASC_API mfxStatus ASC::Init(mfxI32 Width, mfxI32 Height, mfxI32 Pitch, mfxU32 Pi
     ME_SAD_8x8_Block    = ME_SAD_8x8_Block_SSE4;
     ME_VAR_8x8_Block    = ME_VAR_8x8_Block_SSE4;
 
-    ASC_CPU_DISP_INIT_C(GainOffset);
-    ASC_CPU_DISP_INIT_SSE4_C(RsCsCalc_4x4);
-    ASC_CPU_DISP_INIT_C(RsCsCalc_bound);
-    ASC_CPU_DISP_INIT_C(RsCsCalc_diff);
-    ASC_CPU_DISP_INIT_SSE4_C(ImageDiffHistogram);
-    ASC_CPU_DISP_INIT_AVX2_SSE4_C(ME_SAD_8x8_Block_Search);
-    ASC_CPU_DISP_INIT_SSE4_C(Calc_RaCa_pic);
+    ASC_CPU_DISP_INIT_AVX512_AVX2_C(GainOffset);
+    ASC_CPU_DISP_INIT_AVX512_AVX2_SSE4_C(RsCsCalc_4x4);
+    ASC_CPU_DISP_INIT_AVX512_AVX2_C(RsCsCalc_bound);
+    ASC_CPU_DISP_INIT_AVX512_AVX2_C(RsCsCalc_diff);
+    ASC_CPU_DISP_INIT_AVX512_AVX2_SSE4_C(ImageDiffHistogram);
+    ASC_CPU_DISP_INIT_AVX512_AVX2_SSE4_C(ME_SAD_8x8_Block_Search);
+    ASC_CPU_DISP_INIT_AVX512_AVX2_SSE4_C(Calc_RaCa_pic);
+    ASC_CPU_DISP_INIT_AVX512_AVX2_C(SCDetectRF_Votes);
 
     InitStruct();
     try
@@ -772,6 +783,28 @@ ASC_API bool ASC::IsASCinitialized(){
     return m_ASCinitialized;
 }
 
+ASC_API mfxStatus ASC::SetNumThreads(mfxU32 numThreads) {
+    if (numThreads == 0)
+        numThreads = std::max(std::thread::hardware_concurrency(), 1u);
+    numThreads = std::min<mfxU32>(numThreads, ASC_MAX_THREADS);
+    if (numThreads == m_threadPool.GetNumThreads())
+        return MFX_ERR_NONE;
+    return m_threadPool.Init(numThreads);
+}
+
+ASC_API mfxU32 ASC::GetNumThreads() {
+    return m_threadPool.GetNumThreads();
+}
+
+ASC_API mfxStatus ASC::SetMotionSearchMode(ASCMotionSearch_Mode mode) {
+    if (!m_dataIn)
+        return MFX_ERR_NOT_INITIALIZED;
+    if (mode != ASCFull_Search && mode != ASCPredictive_Search)
+        return MFX_ERR_INVALID_VIDEO_PARAM;
+    m_dataIn->searchMode = mode;
+    return MFX_ERR_NONE;
+}
+
 ASC_API void ASC::SetControlLevel(mfxU8 level) {
     if(level >= RF_DECISION_LEVEL) {
         ASC_PRINTF("\nWarning: Control level too high, shot change detection disabled! (%i)\n", level);
@@ -892,21 +925,31 @@ void ASC::SubSample_Point(
     mfxI32 step_h = srcHeight / dstHeight;
 
     mfxI32 need_correction = !(step_h % 2);
-    mfxI32 correction = 0;
-    mfxU32 sumAll = 0;
-    mfxI32 y = 0;
+    mfxU32 bands = m_threadPool.GetNumThreads();
+    mfxU32 sumBand[ASC_MAX_THREADS] = {};
+
+    m_threadPool.Run(bands, [&](mfxU32 band) {
+        mfxI32 correction = 0;
+        mfxU32 sumAll = 0;
+        mfxI32 y = 0;
 
-    for (y = 0; y < (mfxI32)dstHeight; y++) {
-        correction = (y % 2) & need_correction;
-        for (mfxI32 x = 0; x < (mfxI32)dstWidth; x++) {
+        for (y = dstHeight * band / bands; y < (mfxI32)(dstHeight * (band + 1) / bands); y++) {
+            correction = (y % 2) & need_correction;
+            for (mfxI32 x = 0; x < (mfxI32)dstWidth; x++) {
 
-            pmfxU8 ps = pSrc + ((y * step_h + correction) * srcPitch) + (x * step_w);
-            pmfxU8 pd = pDst + (y * dstPitch) + x;
+                pmfxU8 ps = pSrc + ((y * step_h + correction) * srcPitch) + (x * step_w);
+                pmfxU8 pd = pDst + (y * dstPitch) + x;
 
-            pd[0] = ps[0];
-            sumAll += ps[0];
+                pd[0] = ps[0];
+                sumAll += ps[0];
+            }
         }
-    }
+        sumBand[band] = sumAll;
+    });
+
+    mfxU32 sumAll = 0;
+    for (mfxU32 band = 0; band < bands; band++)
+        sumAll += sumBand[band];
     avgLuma = (mfxI16)(sumAll >> 13);
 }
 
@@ -923,16 +966,33 @@ mfxStatus ASC::RsCsCalc() {
 
     mfxI16
         diff = m_videoData[ASCReference_Frame]->layer.avgval - m_videoData[ASCCurrent_Frame]->layer.avgval;
-    ss = m_videoData[ASCReference_Frame]->layer.Image.Y;
-    if (!m_support->firstFrame && abs(diff) >= GAINDIFF_THR) {
-        if (m_support->gainCorrection.Image.Y == nullptr)
-            return MFX_ERR_MEMORY_ALLOC;
-        GainOffset(&ss, &m_support->gainCorrection.Image.Y, (mfxU16)vidCar._cwidth, (mfxU16)vidCar._cheight, (mfxU16)vidCar.Extended_Width, diff);
-    }
-    ss = m_videoData[ASCCurrent_Frame]->layer.Image.Y;
+    bool
+        gainCorrection = !m_support->firstFrame && abs(diff) >= GAINDIFF_THR;
+    if (gainCorrection && m_support->gainCorrection.Image.Y == nullptr)
+        return MFX_ERR_MEMORY_ALLOC;
 
-    RsCsCalc_4x4(ss, pFrame->pitch, wblocks, hblocks, m_videoData[ASCCurrent_Frame]->layer.Rs, m_videoData[ASCCurrent_Frame]->layer.Cs);
-    RsCsCalc_bound(m_videoData[ASCCurrent_Frame]->layer.Rs, m_videoData[ASCCurrent_Frame]->layer.Cs, m_videoData[ASCCurrent_Frame]->layer.RsCs, &m_videoData[ASCCurrent_Frame]->layer.RsVal, &m_videoData[ASCCurrent_Frame]->layer.CsVal, wblocks, hblocks);
+    // RsCsCalc_4x4 leaves out the first and the last row of blocks
+    mfxU32 bands = m_threadPool.GetNumThreads();
+    mfxU32 rows = hblocks - 2;
+    pmfxU16 pRs = m_videoData[ASCCurrent_Frame]->layer.Rs;
+    pmfxU16 pCs = m_videoData[ASCCurrent_Frame]->layer.Cs;
+
+    m_threadPool.Run(bands, [&](mfxU32 band) {
+        if (gainCorrection) {
+            mfxU32 y0 = vidCar._cheight * band / bands;
+            mfxU32 y1 = vidCar._cheight * (band + 1) / bands;
+            pmfxU8 src = m_videoData[ASCReference_Frame]->layer.Image.Y + y0 * vidCar.Extended_Width;
+            pmfxU8 dst = m_support->gainCorrection.Image.Y + y0 * vidCar.Extended_Width;
+            GainOffset(&src, &dst, (mfxU16)vidCar._cwidth, (mfxU16)(y1 - y0), (mfxU16)vidCar.Extended_Width, diff);
+        }
+
+        mfxU32 i0 = rows * band / bands;
+        mfxU32 i1 = rows * (band + 1) / bands;
+        if (i1 > i0)
+            RsCsCalc_4x4(ss + 4 * i0 * pFrame->pitch, pFrame->pitch, wblocks, i1 - i0 + 2, pRs + i0 * wblocks, pCs + i0 * wblocks);
+    });
+
+    RsCsCalc_bound(pRs, pCs, m_videoData[ASCCurrent_Frame]->layer.RsCs, &m_videoData[ASCCurrent_Frame]->layer.RsVal, &m_videoData[ASCCurrent_Frame]->layer.CsVal, wblocks, hblocks);
     return MFX_ERR_NONE;
 }
 
@@ -976,14 +1036,17 @@ mfxI32 ASC::ShotDetect(ASCimageData& Data, ASCimageData& DataRef, ASCImDetails&
     current->diffRsCsDiff  = current->RsCsDiff - reference->RsCsDiff;
     current->diffMVdiffVal = current->MVdiffVal - reference->MVdiffVal;
     mfxI32
-        SChange = SCDetectRF(
-            current->diffMVdiffVal, current->RsCsDiff,   current->MVdiffVal,
-            current->Rs,            current->AFD,        current->CsDiff,
-            current->diffTSC,       current->TSC,        current->gchDC,
-            current->diffRsCsDiff,  current->posBalance, current->SC,
-            current->TSCindex,      current->SCindex,    current->Cs,
-            current->diffAFD,       current->negBalance, current->ssDCval,
-            current->refDCval,      current->RsDiff,     controlLevel);
+        feature[ASC_TREE_FEATURE_SLOTS];
+    SCDetectRF_Features(feature,
+        current->diffMVdiffVal, current->RsCsDiff,   current->MVdiffVal,
+        current->Rs,            current->AFD,        current->CsDiff,
+        current->diffTSC,       current->TSC,        current->gchDC,
+        current->diffRsCsDiff,  current->posBalance, current->SC,
+        current->TSCindex,      current->SCindex,    current->Cs,
+        current->diffAFD,       current->negBalance, current->ssDCval,
+        current->refDCval,      current->RsDiff);
+    mfxI32
+        SChange = SCDetectRF_Votes(feature) > mfxU32(RF_DECISION_LEVEL + controlLevel);
 
     current->ltr_flag = Hint_LTR_op_on(current->SC, current->TSC);
     return SChange;
@@ -1008,23 +1071,67 @@ void ASC::MotionAnalysis(ASCVidSample *videoIn, ASCVidSample *videoRef, mfxU32 *
     if (abs(diff) >= GAINDIFF_THR) {
         referenceImageIn = &m_support->gainCorrection;
     }
+    struct RowStat {
+        mfxU32 acc, valb, MVdiffVal, AbsMVSize, AbsMVHSize, AbsMVVSize;
+        mfxI32 average, var, jtvar, mcjtvar;
+    } rowStat[ASC_MAX_THREADS] = {};
+
+    // A block starts from the vectors of its left, top and top left neighbours, so
+    // rows run as a wavefront: row i searches block j once row i - 1 is past it
+    mfxU16 rows = m_dataIn->layer[lyrIdx].Height_in_blocks;
+    mfxU16 cols = m_dataIn->layer[lyrIdx].Width_in_blocks;
+    assert(rows <= ASC_MAX_THREADS);
+    std::atomic<mfxU32> rowDone[ASC_MAX_THREADS];
+    for (mfxU16 i = 0; i < rows; i++)
+        rowDone[i].store(0, std::memory_order_relaxed);
+
+    m_threadPool.Run(rows, [&](mfxU32 i) {
+        RowStat &stat = rowStat[i];
+        ASCVidRead support = *m_support;
+        ASCimageData layer = videoIn->layer;
+        support.average = 0;
+        layer.var = 0;
+        layer.jtvar = 0;
+        layer.mcjtvar = 0;
+
+        mfxU16 prevFPos = (mfxU16)(i << 4);
+        for (mfxU16 j = 0; j < cols; j++) {
+            if (i > 0) {
+                while (rowDone[i - 1].load(std::memory_order_acquire) <= j)
+                    std::this_thread::yield();
+            }
+            mfxU16 fPos = prevFPos + j;
+            stat.acc += ME_simple(&support, fPos, m_dataIn->layer, &layer, referenceImageIn, videoRef->layer.pInteger, true, m_dataIn, ME_SAD_8x8_Block_Search, ME_SAD_8x8_Block, ME_VAR_8x8_Block);
+            stat.valb += videoIn->layer.SAD[fPos];
+            stat.MVdiffVal += (videoIn->layer.pInteger[fPos].x - videoRef->layer.pInteger[fPos].x) * (videoIn->layer.pInteger[fPos].x - videoRef->layer.pInteger[fPos].x);
+            stat.MVdiffVal += (videoIn->layer.pInteger[fPos].y - videoRef->layer.pInteger[fPos].y) * (videoIn->layer.pInteger[fPos].y - videoRef->layer.pInteger[fPos].y);
+            stat.AbsMVHSize += (videoIn->layer.pInteger[fPos].x * videoIn->layer.pInteger[fPos].x);
+            stat.AbsMVVSize += (videoIn->layer.pInteger[fPos].y * videoIn->layer.pInteger[fPos].y);
+            stat.AbsMVSize += (videoIn->layer.pInteger[fPos].x * videoIn->layer.pInteger[fPos].x) + (videoIn->layer.pInteger[fPos].y * videoIn->layer.pInteger[fPos].y);
+            rowDone[i].store(j + 1, std::memory_order_release);
+        }
+        stat.average = support.average;
+        stat.var = layer.var;
+        stat.jtvar = layer.jtvar;
+        stat.mcjtvar = layer.mcjtvar;
+    });
+
+    // integer sums, the result does not depend on the number of threads
     m_support->average = 0;
     videoIn->layer.var = 0;
     videoIn->layer.jtvar = 0;
     videoIn->layer.mcjtvar = 0;
-    for (mfxU16 i = 0; i < m_dataIn->layer[lyrIdx].Height_in_blocks; i++) {
-        mfxU16 prevFPos = i << 4;
-        for (mfxU16 j = 0; j < m_dataIn->layer[lyrIdx].Width_in_blocks; j++) {
-            mfxU16 fPos = prevFPos + j;
-            acc += ME_simple(m_support, fPos, m_dataIn->layer, &videoIn->layer, referenceImageIn, true, m_dataIn, ME_SAD_8x8_Block_Search, ME_SAD_8x8_Block, ME_VAR_8x8_Block);
-            valb += videoIn->layer.SAD[fPos];
-            *MVdiffVal += (videoIn->layer.pInteger[fPos].x - videoRef->layer.pInteger[fPos].x) * (videoIn->layer.pInteger[fPos].x - videoRef->layer.pInteger[fPos].x);
-            *MVdiffVal += (videoIn->layer.pInteger[fPos].y - videoRef->layer.pInteger[fPos].y) * (videoIn->layer.pInteger[fPos].y - videoRef->layer.pInteger[fPos].y);
-            *AbsMVHSize += (videoIn->layer.pInteger[fPos].x * videoIn->layer.pInteger[fPos].x);
-            *AbsMVVSize += (videoIn->layer.pInteger[fPos].y * videoIn->layer.pInteger[fPos].y);
-            *AbsMVSize += (videoIn->layer.pInteger[fPos].x * videoIn->layer.pInteger[fPos].x) + (videoIn->layer.pInteger[fPos].y * videoIn->layer.pInteger[fPos].y);
-
-        }
+    for (mfxU16 i = 0; i < rows; i++) {
+        acc += rowStat[i].acc;
+        valb += rowStat[i].valb;
+        *MVdiffVal += rowStat[i].MVdiffVal;
+        *AbsMVSize += rowStat[i].AbsMVSize;
+        *AbsMVHSize += rowStat[i].AbsMVHSize;
+        *AbsMVVSize += rowStat[i].AbsMVVSize;
+        m_support->average += rowStat[i].average;
+        videoIn->layer.var += rowStat[i].var;
+        videoIn->layer.jtvar += rowStat[i].jtvar;
+        videoIn->layer.mcjtvar += rowStat[i].mcjtvar;
     }
     videoIn->layer.var = videoIn->layer.var * 10 / 128 / 64;
     videoIn->layer.jtvar = videoIn->layer.jtvar * 10 / 128 / 64;
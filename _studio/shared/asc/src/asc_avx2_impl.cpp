@@ -20,6 +20,9 @@
 // SOFTWARE.
 */
 #include "asc_avx2_impl.h"
+#include "asc_c_impl.h"
+#include "tree.h"
+#include <algorithm>
 
 #if defined(__AVX2__)
 
@@ -233,4 +236,357 @@ mfxI16 AvgLumaCalc_AVX2(pmfxU32 pAvgLineVal, int len) {
     avgVal = (mfxI16)_mm_extract_epi32(tmp, 0);
     return avgVal;
 }
+
+void RsCsCalc_4x4_AVX2(pmfxU8 pSrc, int srcPitch, int wblocks, int hblocks, pmfxU16 pRs, pmfxU16 pCs)
+{
+    // lanes of the 16-bit block sums are [ 0 1 4 5 | 2 3 6 7 ] after hadd and pack
+    const __m256i order = _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7);
+    if (wblocks - 2 < 8)
+    {
+        RsCsCalc_4x4_C(pSrc, srcPitch, wblocks, hblocks, pRs, pCs);
+        return;
+    }
+
+    pSrc += (4 * srcPitch) + 4;
+    for (mfxI32 i = 0; i < hblocks - 2; i++)
+    {
+        // 8 horizontal blocks at a time, the last 8 blocks of the row overlap the previous ones
+        for (mfxI32 j = 0; j < wblocks - 2; j += 8)
+        {
+            j = std::min(j, wblocks - 10);
+            pmfxU8 p = pSrc + 4 * j;
+            __m256i rs0 = _mm256_setzero_si256();
+            __m256i cs0 = _mm256_setzero_si256();
+            __m256i rs1 = _mm256_setzero_si256();
+            __m256i cs1 = _mm256_setzero_si256();
+            __m256i a0 = _mm256_cvtepu8_epi16(_mm_loadu_si128((__m128i *)&p[-srcPitch + 0]));
+            __m256i a1 = _mm256_cvtepu8_epi16(_mm_loadu_si128((__m128i *)&p[-srcPitch + 16]));
+
+            for (mfxI32 k = 0; k < 4; k++)
+            {
+                __m256i b0 = _mm256_cvtepu8_epi16(_mm_loadu_si128((__m128i *)&p[-1]));
+                __m256i b1 = _mm256_cvtepu8_epi16(_mm_loadu_si128((__m128i *)&p[15]));
+                __m256i c0 = _mm256_cvtepu8_epi16(_mm_loadu_si128((__m128i *)&p[0]));
+                __m256i c1 = _mm256_cvtepu8_epi16(_mm_loadu_si128((__m128i *)&p[16]));
+                p += srcPitch;
+
+                // accRs += dRs * dRs
+                a0 = _mm256_srai_epi16(_mm256_abs_epi16(_mm256_sub_epi16(c0, a0)), 2);
+                a1 = _mm256_srai_epi16(_mm256_abs_epi16(_mm256_sub_epi16(c1, a1)), 2);
+                rs0 = _mm256_add_epi32(rs0, _mm256_madd_epi16(a0, a0));
+                rs1 = _mm256_add_epi32(rs1, _mm256_madd_epi16(a1, a1));
+
+                // accCs += dCs * dCs
+                b0 = _mm256_srai_epi16(_mm256_abs_epi16(_mm256_sub_epi16(c0, b0)), 2);
+                b1 = _mm256_srai_epi16(_mm256_abs_epi16(_mm256_sub_epi16(c1, b1)), 2);
+                cs0 = _mm256_add_epi32(cs0, _mm256_madd_epi16(b0, b0));
+                cs1 = _mm256_add_epi32(cs1, _mm256_madd_epi16(b1, b1));
+
+                // reuse next iteration
+                a0 = c0;
+                a1 = c1;
+            }
+            rs0 = _mm256_hadd_epi32(rs0, rs1);
+            cs0 = _mm256_hadd_epi32(cs0, cs1);
+
+            // store
+            rs0 = _mm256_permutevar8x32_epi32(_mm256_packus_epi32(rs0, cs0), order);
+            _mm_storeu_si128((__m128i *)&pRs[i * wblocks + j], _mm256_castsi256_si128(rs0));
+            _mm_storeu_si128((__m128i *)&pCs[i * wblocks + j], _mm256_extracti128_si256(rs0, 1));
+        }
+        pSrc += 4 * srcPitch;
+    }
+}
+
+void RsCsCalc_bound_AVX2(pmfxU16 pRs, pmfxU16 pCs, pmfxU16 pRsCs, pmfxU32 pRsFrame, pmfxU32 pCsFrame, int wblocks, int hblocks)
+{
+    const __m256i one = _mm256_set1_epi16(1);
+    mfxI32 len = wblocks * hblocks;
+    __m256i accRs = _mm256_setzero_si256();
+    __m256i accCs = _mm256_setzero_si256();
+
+    mfxI32 i;
+    for (i = 0; i + 16 <= len; i += 16)
+    {
+        __m256i rs = _mm256_loadu_si256((__m256i *)&pRs[i]);
+        __m256i cs = _mm256_loadu_si256((__m256i *)&pCs[i]);
+
+        accRs = _mm256_add_epi32(accRs, _mm256_madd_epi16(_mm256_srli_epi16(rs, 7), one));
+        accCs = _mm256_add_epi32(accCs, _mm256_madd_epi16(_mm256_srli_epi16(cs, 7), one));
+
+        // (rs + cs) >> 1 without the rounding of avg
+        __m256i rscs = _mm256_sub_epi16(_mm256_avg_epu16(rs, cs), _mm256_and_si256(_mm256_xor_si256(rs, cs), one));
+        _mm256_storeu_si256((__m256i *)&pRsCs[i], rscs);
+    }
+
+    // accumulators of the C code are 16 bit and wrap around
+    accRs = _mm256_hadd_epi32(accRs, accCs);
+    accRs = _mm256_hadd_epi32(accRs, accRs);
+    __m128i acc = _mm_add_epi32(_mm256_castsi256_si128(accRs), _mm256_extracti128_si256(accRs, 1));
+    mfxU16 sumRs = (mfxU16)_mm_extract_epi32(acc, 0);
+    mfxU16 sumCs = (mfxU16)_mm_extract_epi32(acc, 1);
+
+    for (; i < len; i++)
+    {
+        sumRs += pRs[i] >> 7;
+        sumCs += pCs[i] >> 7;
+        pRsCs[i] = (pRs[i] + pCs[i]) >> 1;
+    }
+
+    *pRsFrame = sumRs;
+    *pCsFrame = sumCs;
+}
+
+void RsCsCalc_diff_AVX2(pmfxU16 pRs0, pmfxU16 pCs0, pmfxU16 pRs1, pmfxU16 pCs1, int wblocks, int hblocks,
+    pmfxU32 pRsDiff, pmfxU32 pCsDiff)
+{
+    const __m256i one = _mm256_set1_epi16(1);
+    mfxU32 len = wblocks * hblocks;
+    __m256i accRs = _mm256_setzero_si256();
+    __m256i accCs = _mm256_setzero_si256();
+
+    mfxU32 i;
+    for (i = 0; i + 16 <= len; i += 16)
+    {
+        __m256i rs0 = _mm256_srli_epi16(_mm256_loadu_si256((__m256i *)&pRs0[i]), 5);
+        __m256i cs0 = _mm256_srli_epi16(_mm256_loadu_si256((__m256i *)&pCs0[i]), 5);
+        __m256i rs1 = _mm256_srli_epi16(_mm256_loadu_si256((__m256i *)&pRs1[i]), 5);
+        __m256i cs1 = _mm256_srli_epi16(_mm256_loadu_si256((__m256i *)&pCs1[i]), 5);
+
+        accRs = _mm256_add_epi32(accRs, _mm256_madd_epi16(_mm256_abs_epi16(_mm256_sub_epi16(rs0, rs1)), one));
+        accCs = _mm256_add_epi32(accCs, _mm256_madd_epi16(_mm256_abs_epi16(_mm256_sub_epi16(cs0, cs1)), one));
+    }
+
+    // accumulators of the C code are 16 bit and wrap around
+    accRs = _mm256_hadd_epi32(accRs, accCs);
+    accRs = _mm256_hadd_epi32(accRs, accRs);
+    __m128i acc = _mm_add_epi32(_mm256_castsi256_si128(accRs), _mm256_extracti128_si256(accRs, 1));
+    mfxU16 sumRs = (mfxU16)_mm_extract_epi32(acc, 0);
+    mfxU16 sumCs = (mfxU16)_mm_extract_epi32(acc, 1);
+
+    for (; i < len; i++)
+    {
+        sumRs += (mfxU16)abs((pRs0[i] >> 5) - (pRs1[i] >> 5));
+        sumCs += (mfxU16)abs((pCs0[i] >> 5) - (pCs1[i] >> 5));
+    }
+    *pRsDiff = sumRs;
+    *pCsDiff = sumCs;
+}
+
+void ImageDiffHistogram_AVX2(pmfxU8 pSrc, pmfxU8 pRef, mfxU32 pitch, mfxU32 width, mfxU32 height, mfxI32 histogram[5], mfxI64 *pSrcDC, mfxI64 *pRefDC) {
+    __m256i sDC = _mm256_setzero_si256();
+    __m256i rDC = _mm256_setzero_si256();
+
+    __m256i h0 = _mm256_setzero_si256();
+    __m256i h1 = _mm256_setzero_si256();
+    __m256i h2 = _mm256_setzero_si256();
+    __m256i h3 = _mm256_setzero_si256();
+
+    __m256i zero = _mm256_setzero_si256();
+
+    for (mfxU32 i = 0; i < height; i++)
+    {
+        // process 32 pixels per iteration, remaining 1..31 pixels with a partial load
+        for (mfxU32 j = 0; j < width; j += 32)
+        {
+            __m256i s, r, sv;
+            if (j + 32 <= width)
+            {
+                s = _mm256_loadu_si256((__m256i *)(&pSrc[j]));
+                r = _mm256_loadu_si256((__m256i *)(&pRef[j]));
+                sv = s;
+            }
+            else
+            {
+                s = LoadPartialYmm<0>(&pSrc[j], width & 0x1f);
+                r = LoadPartialYmm<0>(&pRef[j], width & 0x1f);
+                sv = LoadPartialYmm<-1>(&pSrc[j], width & 0x1f);  // ensure unused elements not counted
+            }
+
+            sDC = _mm256_add_epi64(sDC, _mm256_sad_epu8(s, zero));    //accumulate horizontal sums
+            rDC = _mm256_add_epi64(rDC, _mm256_sad_epu8(r, zero));
+
+            r = _mm256_sub_epi8(r, _mm256_set1_epi8(-128));   // convert to signed
+            s = _mm256_sub_epi8(sv, _mm256_set1_epi8(-128));
+
+            __m256i dn = _mm256_subs_epi8(r, s);   // -d saturated to [-128,127]
+            __m256i dp = _mm256_subs_epi8(s, r);   // +d saturated to [-128,127]
+
+            __m256i m0 = _mm256_cmpgt_epi8(dn, _mm256_set1_epi8(HIST_THRESH_HI)); // d < -12
+            __m256i m1 = _mm256_cmpgt_epi8(dn, _mm256_set1_epi8(HIST_THRESH_LO)); // d < -1
+            __m256i m2 = _mm256_cmpgt_epi8(_mm256_set1_epi8(HIST_THRESH_LO), dp); // d < +1
+            __m256i m3 = _mm256_cmpgt_epi8(_mm256_set1_epi8(HIST_THRESH_HI), dp); // d < +12
+
+            m0 = _mm256_sub_epi8(zero, m0);    // negate masks from 0xff to 1
+            m1 = _mm256_sub_epi8(zero, m1);
+            m2 = _mm256_sub_epi8(zero, m2);
+            m3 = _mm256_sub_epi8(zero, m3);
+
+            h0 = _mm256_add_epi32(h0, _mm256_sad_epu8(m0, zero)); // accumulate horizontal sums
+            h1 = _mm256_add_epi32(h1, _mm256_sad_epu8(m1, zero));
+            h2 = _mm256_add_epi32(h2, _mm256_sad_epu8(m2, zero));
+            h3 = _mm256_add_epi32(h3, _mm256_sad_epu8(m3, zero));
+        }
+        pSrc += pitch;
+        pRef += pitch;
+    }
+
+    // finish horizontal sums
+    __m128i s = _mm_add_epi64(_mm256_castsi256_si128(sDC), _mm256_extracti128_si256(sDC, 1));
+    __m128i r = _mm_add_epi64(_mm256_castsi256_si128(rDC), _mm256_extracti128_si256(rDC, 1));
+    s = _mm_add_epi64(s, _mm_movehl_epi64(s, s));
+    r = _mm_add_epi64(r, _mm_movehl_epi64(r, r));
+
+    // h0..h3 hold 4 qword counters each, pack them to [ h0 h1 h2 h3 ] dwords
+    h0 = _mm256_hadd_epi32(_mm256_hadd_epi32(h0, h1), _mm256_hadd_epi32(h2, h3));
+    __m128i h = _mm_add_epi32(_mm256_castsi256_si128(h0), _mm256_extracti128_si256(h0, 1));
+
+    _mm_storel_epi64((__m128i *)pSrcDC, s);
+    _mm_storel_epi64((__m128i *)pRefDC, r);
+
+    histogram[0] = _mm_extract_epi32(h, 0);
+    histogram[1] = _mm_extract_epi32(h, 1);
+    histogram[2] = _mm_extract_epi32(h, 2);
+    histogram[3] = _mm_extract_epi32(h, 3);
+    histogram[4] = width * height;
+
+    // undo cumulative counts, by differencing
+    histogram[4] -= histogram[3];
+    histogram[3] -= histogram[2];
+    histogram[2] -= histogram[1];
+    histogram[1] -= histogram[0];
+}
+
+void GainOffset_AVX2(pmfxU8 *pSrc, pmfxU8 *pDst, mfxU16 width, mfxU16 height, mfxU16 pitch, mfxI16 gainDiff) {
+    pmfxU8
+        ss = *pSrc,
+        dd = *pDst;
+    const __m256i gain = _mm256_set1_epi16(gainDiff);
+    for (mfxU16 i = 0; i < height; i++) {
+        mfxU16 j;
+        for (j = 0; j + 32 <= width; j += 32) {
+            // 16-bit wrap around and clamp to [0, 255] as the C code does
+            __m256i s0 = _mm256_sub_epi16(_mm256_cvtepu8_epi16(_mm_loadu_si128((__m128i *)&ss[j + i * pitch])), gain);
+            __m256i s1 = _mm256_sub_epi16(_mm256_cvtepu8_epi16(_mm_loadu_si128((__m128i *)&ss[j + i * pitch + 16])), gain);
+            s0 = _mm256_permute4x64_epi64(_mm256_packus_epi16(s0, s1), 0xd8);
+            _mm256_storeu_si256((__m256i *)&dd[j + i * pitch], s0);
+        }
+        for (; j < width; j++) {
+            mfxI16
+                val = ss[j + i * pitch] - gainDiff;
+            dd[j + i * pitch] = (mfxU8)std::min(std::max(val, mfxI16(0)), mfxI16(255));
+        }
+    }
+
+    *pSrc = *pDst;
+}
+
+mfxStatus Calc_RaCa_pic_AVX2(mfxU8 *pSrc, mfxI32 width, mfxI32 height, mfxI32 pitch, mfxF64 &RsCs) {
+    // block index of the lanes after hadd, [ rs 0 1 4 5, cs 0 1 4 5 | rs 2 3 6 7, cs 2 3 6 7 ]
+    const __m256i block = _mm256_setr_epi16(0, 1, 4, 5, 0, 1, 4, 5, 2, 3, 6, 7, 2, 3, 6, 7);
+    mfxI32 blocks = (width - 8 + 3) >> 2;
+    if (blocks < 8)
+        return Calc_RaCa_pic_C(pSrc, width, height, pitch, RsCs);
+
+    mfxI32
+        RS = 0,
+        CS = 0;
+    for (mfxI32 i = 4; i < height - 4; i += 4)
+    {
+        // 8 horizontal blocks at a time, the last 8 blocks of the row overlap the previous ones
+        for (mfxI32 b = 0; b < blocks; b += 8)
+        {
+            mfxI32 first = std::min(b, blocks - 8);
+            mfxU8 *pY = pSrc + i * pitch + 4 + 4 * first;
+            __m256i rs = _mm256_setzero_si256();
+            __m256i cs = _mm256_setzero_si256();
+            __m256i rs1 = _mm256_setzero_si256();
+            __m256i cs1 = _mm256_setzero_si256();
+            __m256i c0 = _mm256_cvtepu8_epi16(_mm_loadu_si128((__m128i *)&pY[0]));
+            __m256i c1 = _mm256_cvtepu8_epi16(_mm_loadu_si128((__m128i *)&pY[16]));
+            for (mfxI32 k = 0; k < 4; k++)
+            {
+                __m256i b0 = _mm256_cvtepu8_epi16(_mm_loadu_si128((__m128i *)&pY[1]));
+                __m256i b1 = _mm256_cvtepu8_epi16(_mm_loadu_si128((__m128i *)&pY[17]));
+                __m256i a0 = _mm256_cvtepu8_epi16(_mm_loadu_si128((__m128i *)&pY[pitch + 0]));
+                __m256i a1 = _mm256_cvtepu8_epi16(_mm_loadu_si128((__m128i *)&pY[pitch + 16]));
+                pY += pitch;
+
+                // Cs += (pS[j] > pS[j + 1]) ? (pS[j] - pS[j + 1]) : (pS[j + 1] - pS[j]);
+                cs = _mm256_add_epi16(cs, _mm256_abs_epi16(_mm256_sub_epi16(c0, b0)));
+                cs1 = _mm256_add_epi16(cs1, _mm256_abs_epi16(_mm256_sub_epi16(c1, b1)));
+
+                // Rs += (pS[j] > pS2[j]) ? (pS[j] - pS2[j]) : (pS2[j] - pS[j]);
+                rs = _mm256_add_epi16(rs, _mm256_abs_epi16(_mm256_sub_epi16(c0, a0)));
+                rs1 = _mm256_add_epi16(rs1, _mm256_abs_epi16(_mm256_sub_epi16(c1, a1)));
+
+                // reuse next iteration
+                c0 = a0;
+                c1 = a1;
+            }
+
+            rs = _mm256_hadd_epi16(_mm256_hadd_epi16(rs, rs1), _mm256_hadd_epi16(cs, cs1));
+            //Cs >> 4; Rs >> 4;
+            rs = _mm256_srai_epi16(rs, 4);
+            // drop the blocks counted by the previous step
+            rs = _mm256_and_si256(rs, _mm256_cmpgt_epi16(block, _mm256_set1_epi16((short)(b - first - 1))));
+            //*CS += Cs; *RS += Rs;
+            __m128i t = _mm_add_epi16(_mm256_castsi256_si128(rs), _mm256_extracti128_si256(rs, 1));
+            t = _mm_hadd_epi16(t, t);
+            t = _mm_hadd_epi16(t, t);
+            RS += _mm_extract_epi16(t, 0);
+            CS += _mm_extract_epi16(t, 1);
+        }
+    }
+
+    RsCs = calc_RACA_pic_C(RS, CS, width, height);
+    return MFX_ERR_NONE;
+}
+
+// Lane t walks tree t, lanes past ASC_TREE_COUNT walk tree 0 and are not counted
+mfxU32 SCDetectRF_Votes_AVX2(const mfxI32 *feature) {
+    static_assert(ASC_TREE_COUNT > 16 && ASC_TREE_COUNT <= 24, "SCDetectRF_Votes_AVX2 walks 24 trees at most");
+    ASC_ALIGN_DECL(32) mfxI32 node[24];
+    for (mfxU32 t = 0; t < 24; t++)
+        node[t] = ASC_TREE_ROOT[t < ASC_TREE_COUNT ? t : 0];
+
+    const int *nodes = (const int *)ASC_TREE_NODES;
+    const __m256i
+        featureMask = _mm256_set1_epi32(0x1f),
+        one = _mm256_set1_epi32(1);
+    __m256i
+        idx0 = _mm256_load_si256((__m256i*)&node[0]),
+        idx1 = _mm256_load_si256((__m256i*)&node[8]),
+        idx2 = _mm256_load_si256((__m256i*)&node[16]);
+
+#define ASC_TREE_STEP(idx)                                                                               \
+    {                                                                                                    \
+        __m256i n   = _mm256_i32gather_epi32(nodes, idx, 4);                                             \
+        __m256i thr = _mm256_srai_epi32(_mm256_slli_epi32(n, 16), 16);                                   \
+        __m256i val = _mm256_i32gather_epi32(feature, _mm256_and_si256(_mm256_srli_epi32(n, 16), featureMask), 4); \
+        __m256i ge  = _mm256_andnot_si256(_mm256_cmpgt_epi32(thr, val), one);                            \
+        idx = _mm256_add_epi32(idx, _mm256_add_epi32(_mm256_srli_epi32(n, 21), ge));                     \
+    }
+
+    for (mfxU32 level = 1; level < ASC_TREE_DEPTH; level++) {
+        ASC_TREE_STEP(idx0);
+        ASC_TREE_STEP(idx1);
+        ASC_TREE_STEP(idx2);
+    }
+#undef ASC_TREE_STEP
+
+    // leaf votes are 0 or 1, so the low halves of the nodes can be summed as is
+    __m256i
+        votes = _mm256_add_epi32(_mm256_i32gather_epi32(nodes, idx0, 4), _mm256_i32gather_epi32(nodes, idx1, 4));
+    votes = _mm256_and_si256(votes, _mm256_set1_epi32(0xffff));
+    __m256i
+        lastMask = _mm256_cmpgt_epi32(_mm256_set1_epi32(ASC_TREE_COUNT - 16), _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7)),
+        last = _mm256_and_si256(_mm256_i32gather_epi32(nodes, idx2, 4), _mm256_and_si256(lastMask, _mm256_set1_epi32(0xffff)));
+    votes = _mm256_add_epi32(votes, last);
+    votes = _mm256_hadd_epi32(votes, votes);
+    votes = _mm256_hadd_epi32(votes, votes);
+    __m128i
+        sum = _mm_add_epi32(_mm256_castsi256_si128(votes), _mm256_extracti128_si256(votes, 1));
+    return (mfxU32)_mm_cvtsi128_si32(sum);
+}
 #endif //defined(__AVX2__)
@@ -0,0 +1,373 @@
+// Copyright (c) 2020 Intel Corporation
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "asc_avx512_impl.h"
+#include "tree.h"
+#include <algorithm>
+
+#if defined(__AVX512F__) && defined(__AVX512BW__)
+
+// Mask of the first n elements, all of them when n >= 64
+static inline __mmask64 FirstN(mfxI32 n)
+{
+    return n >= 64 ? ~__mmask64(0) : (__mmask64(1) << n) - 1;
+}
+
+// Load n <= 32 bytes and zero extend them to 16 bit
+static inline __m512i LoadU8toU16(const mfxU8 *p, mfxI32 n)
+{
+    return _mm512_cvtepu8_epi16(_mm512_castsi512_si256(_mm512_maskz_loadu_epi8(FirstN(n), p)));
+}
+
+// Sums of 2 adjacent dwords of rs and cs, returned as [ rs 0..7 | cs 0..7 ]
+static inline __m512i PairSums(__m512i rs, __m512i cs)
+{
+    const __m512i even = _mm512_setr_epi32(0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30);
+    const __m512i odd = _mm512_setr_epi32(1, 3, 5, 7, 9, 11, 13, 15, 17, 19, 21, 23, 25, 27, 29, 31);
+    return _mm512_add_epi32(_mm512_permutex2var_epi32(rs, even, cs), _mm512_permutex2var_epi32(rs, odd, cs));
+}
+
+// Lane L of the result is [ pr + 8 * (L & 1) + (L >> 1) * pitch2 ], 16 bytes each
+static inline __m512i LoadRefLanes(const mfxU8 *pr, mfxI32 pitch2, bool right, bool down)
+{
+    const mfxU8 *p2 = down ? pr + pitch2 : pr;
+    __m512i r = _mm512_broadcast_i32x4(_mm_loadu_si128((__m128i *)pr));
+    if (right) {
+        r = _mm512_mask_broadcast_i32x4(r, 0x00f0, _mm_loadu_si128((__m128i *)(pr + 8)));
+        r = _mm512_mask_broadcast_i32x4(r, 0xff00, _mm_loadu_si128((__m128i *)p2));
+        r = _mm512_mask_broadcast_i32x4(r, 0xf000, _mm_loadu_si128((__m128i *)(p2 + 8)));
+    }
+    else {
+        r = _mm512_mask_broadcast_i32x4(r, 0xff00, _mm_loadu_si128((__m128i *)p2));
+    }
+    return r;
+}
+
+// 32 candidates per step: 16 x positions of rows y and y + SAD_SEARCH_VSTEP.
+// Every row keeps its own minimum, rows are compared in y order to pick the
+// same position as the C code when SADs are equal.
+void ME_SAD_8x8_Block_Search_AVX512(mfxU8 *pSrc, mfxU8 *pRef, int pitch, int xrange, int yrange,
+    mfxU16 *bestSAD, int *bestX, int *bestY) {
+    // [ 0..7 8..15 | 0..7 8..15 ] x offsets of the lanes
+    const __m512i xpos = _mm512_setr_epi32(
+        0x00010000, 0x00030002, 0x00050004, 0x00070006, 0x00090008, 0x000b000a, 0x000d000c, 0x000f000e,
+        0x00010000, 0x00030002, 0x00050004, 0x00070006, 0x00090008, 0x000b000a, 0x000d000c, 0x000f000e);
+    const __m512i kill = _mm512_set1_epi16(-1);
+    __m512i s[8][2];
+    for (int k = 0; k < 8; k++) {
+        s[k][0] = _mm512_set1_epi32(*(int *)&pSrc[k * pitch]);
+        s[k][1] = _mm512_set1_epi32(*(int *)&pSrc[k * pitch + 4]);
+    }
+
+    for (int y = 0; y < yrange; y += 2 * SAD_SEARCH_VSTEP) {
+        bool down = y + SAD_SEARCH_VSTEP < yrange;
+        mfxU16 rowSAD[2] = { 0xffff, 0xffff };
+        int rowX[2] = { 0, 0 };
+        for (int x = 0; x < xrange; x += 16) {
+            pmfxU8 pr = pRef + (y * pitch) + x;
+            __m512i sad = _mm512_setzero_si512();
+            for (int k = 0; k < 8; k++) {
+                __m512i r = LoadRefLanes(pr + k * pitch, SAD_SEARCH_VSTEP * pitch, xrange - x > 8, down);
+                // SADs of the first and the last 4 pixels at offsets 0..7 of every lane
+                sad = _mm512_add_epi16(sad, _mm512_dbsad_epu8(s[k][0], r, 0x94));
+                sad = _mm512_add_epi16(sad, _mm512_dbsad_epu8(s[k][1], r, 0xe9));
+            }
+            // kill out-of-bound values
+            sad = _mm512_mask_blend_epi16(_mm512_cmplt_epi16_mask(xpos, _mm512_set1_epi16((short)(xrange - x))), kill, sad);
+            // keep even x positions only, simulating search every two in X dimension
+            __m256i even = _mm512_cvtepi32_epi16(sad);
+            __m128i t[2] = { _mm_minpos_epu16(_mm256_castsi256_si128(even)), _mm_minpos_epu16(_mm256_extracti128_si256(even, 1)) };
+            for (int row = 0; row < 2; row++) {
+                mfxU16
+                    SAD = (mfxU16)_mm_extract_epi16(t[row], 0);
+                if (SAD < rowSAD[row]) {
+                    rowSAD[row] = SAD;
+                    rowX[row] = x + 2 * _mm_extract_epi16(t[row], 1);
+                }
+            }
+        }
+        for (int row = 0; row < (down ? 2 : 1); row++) {
+            if (rowSAD[row] < *bestSAD) {
+                *bestSAD = rowSAD[row];
+                *bestX = rowX[row];
+                *bestY = y + row * SAD_SEARCH_VSTEP;
+            }
+        }
+    }
+}
+
+void RsCsCalc_4x4_AVX512(pmfxU8 pSrc, int srcPitch, int wblocks, int hblocks, pmfxU16 pRs, pmfxU16 pCs)
+{
+    pSrc += (4 * srcPitch) + 4;
+    for (mfxI32 i = 0; i < hblocks - 2; i++)
+    {
+        // 8 horizontal blocks at a time, the last ones with masked loads
+        for (mfxI32 j = 0; j < wblocks - 2; j += 8)
+        {
+            mfxI32 n = std::min(wblocks - 2 - j, 8);
+            pmfxU8 p = pSrc + 4 * j;
+            __m512i rs = _mm512_setzero_si512();
+            __m512i cs = _mm512_setzero_si512();
+            __m512i a = LoadU8toU16(p - srcPitch, 4 * n);
+
+            for (mfxI32 k = 0; k < 4; k++)
+            {
+                __m512i b = LoadU8toU16(p - 1, 4 * n);
+                __m512i c = LoadU8toU16(p, 4 * n);
+                p += srcPitch;
+
+                // accRs += dRs * dRs, accCs += dCs * dCs
+                a = _mm512_srli_epi16(_mm512_abs_epi16(_mm512_sub_epi16(c, a)), 2);
+                b = _mm512_srli_epi16(_mm512_abs_epi16(_mm512_sub_epi16(c, b)), 2);
+                rs = _mm512_add_epi32(rs, _mm512_madd_epi16(a, a));
+                cs = _mm512_add_epi32(cs, _mm512_madd_epi16(b, b));
+
+                // reuse next iteration
+                a = c;
+            }
+            __m512i sum = PairSums(rs, cs);
+
+            __mmask16 store = (__mmask16)((1 << n) - 1);
+            _mm512_mask_cvtepi32_storeu_epi16(&pRs[i * wblocks + j], store, sum);
+            _mm512_mask_cvtepi32_storeu_epi16(&pCs[i * wblocks + j], store, _mm512_shuffle_i64x2(sum, sum, 0xee));
+        }
+        pSrc += 4 * srcPitch;
+    }
+}
+
+void RsCsCalc_bound_AVX512(pmfxU16 pRs, pmfxU16 pCs, pmfxU16 pRsCs, pmfxU32 pRsFrame, pmfxU32 pCsFrame, int wblocks, int hblocks)
+{
+    const __m512i one = _mm512_set1_epi16(1);
+    mfxI32 len = wblocks * hblocks;
+    __m512i accRs = _mm512_setzero_si512();
+    __m512i accCs = _mm512_setzero_si512();
+
+    for (mfxI32 i = 0; i < len; i += 32)
+    {
+        __mmask32 m = (__mmask32)FirstN(len - i);
+        __m512i rs = _mm512_maskz_loadu_epi16(m, &pRs[i]);
+        __m512i cs = _mm512_maskz_loadu_epi16(m, &pCs[i]);
+
+        accRs = _mm512_add_epi32(accRs, _mm512_madd_epi16(_mm512_srli_epi16(rs, 7), one));
+        accCs = _mm512_add_epi32(accCs, _mm512_madd_epi16(_mm512_srli_epi16(cs, 7), one));
+
+        // (rs + cs) >> 1 without the rounding of avg
+        __m512i rscs = _mm512_sub_epi16(_mm512_avg_epu16(rs, cs), _mm512_and_si512(_mm512_xor_si512(rs, cs), one));
+        _mm512_mask_storeu_epi16(&pRsCs[i], m, rscs);
+    }
+
+    // accumulators of the C code are 16 bit and wrap around
+    *pRsFrame = (mfxU16)_mm512_reduce_add_epi32(accRs);
+    *pCsFrame = (mfxU16)_mm512_reduce_add_epi32(accCs);
+}
+
+void RsCsCalc_diff_AVX512(pmfxU16 pRs0, pmfxU16 pCs0, pmfxU16 pRs1, pmfxU16 pCs1, int wblocks, int hblocks,
+    pmfxU32 pRsDiff, pmfxU32 pCsDiff)
+{
+    const __m512i one = _mm512_set1_epi16(1);
+    mfxI32 len = wblocks * hblocks;
+    __m512i accRs = _mm512_setzero_si512();
+    __m512i accCs = _mm512_setzero_si512();
+
+    for (mfxI32 i = 0; i < len; i += 32)
+    {
+        __mmask32 m = (__mmask32)FirstN(len - i);
+        __m512i rs0 = _mm512_srli_epi16(_mm512_maskz_loadu_epi16(m, &pRs0[i]), 5);
+        __m512i cs0 = _mm512_srli_epi16(_mm512_maskz_loadu_epi16(m, &pCs0[i]), 5);
+        __m512i rs1 = _mm512_srli_epi16(_mm512_maskz_loadu_epi16(m, &pRs1[i]), 5);
+        __m512i cs1 = _mm512_srli_epi16(_mm512_maskz_loadu_epi16(m, &pCs1[i]), 5);
+
+        accRs = _mm512_add_epi32(accRs, _mm512_madd_epi16(_mm512_abs_epi16(_mm512_sub_epi16(rs0, rs1)), one));
+        accCs = _mm512_add_epi32(accCs, _mm512_madd_epi16(_mm512_abs_epi16(_mm512_sub_epi16(cs0, cs1)), one));
+    }
+
+    // accumulators of the C code are 16 bit and wrap around
+    *pRsDiff = (mfxU16)_mm512_reduce_add_epi32(accRs);
+    *pCsDiff = (mfxU16)_mm512_reduce_add_epi32(accCs);
+}
+
+void ImageDiffHistogram_AVX512(pmfxU8 pSrc, pmfxU8 pRef, mfxU32 pitch, mfxU32 width, mfxU32 height, mfxI32 histogram[5], mfxI64 *pSrcDC, mfxI64 *pRefDC) {
+    const __m512i zero = _mm512_setzero_si512();
+    const __m512i one = _mm512_set1_epi8(1);
+    const __m512i sign = _mm512_set1_epi8(-128);
+    const __m512i lo = _mm512_set1_epi8(HIST_THRESH_LO);
+    const __m512i hi = _mm512_set1_epi8(HIST_THRESH_HI);
+
+    __m512i sDC = _mm512_setzero_si512();
+    __m512i rDC = _mm512_setzero_si512();
+
+    __m512i h0 = _mm512_setzero_si512();
+    __m512i h1 = _mm512_setzero_si512();
+    __m512i h2 = _mm512_setzero_si512();
+    __m512i h3 = _mm512_setzero_si512();
+
+    for (mfxU32 i = 0; i < height; i++)
+    {
+        // process 64 pixels per iteration, the last ones with masked loads
+        for (mfxU32 j = 0; j < width; j += 64)
+        {
+            __mmask64 m = FirstN(width - j);
+            __m512i s = _mm512_maskz_loadu_epi8(m, &pSrc[j]);
+            __m512i r = _mm512_maskz_loadu_epi8(m, &pRef[j]);
+
+            sDC = _mm512_add_epi64(sDC, _mm512_sad_epu8(s, zero));    //accumulate horizontal sums
+            rDC = _mm512_add_epi64(rDC, _mm512_sad_epu8(r, zero));
+
+            r = _mm512_sub_epi8(r, sign);   // convert to signed
+            s = _mm512_sub_epi8(s, sign);
+
+            __m512i dn = _mm512_subs_epi8(r, s);   // -d saturated to [-128,127]
+            __m512i dp = _mm512_subs_epi8(s, r);   // +d saturated to [-128,127]
+
+            __mmask64 m0 = _mm512_mask_cmpgt_epi8_mask(m, dn, hi); // d < -12
+            __mmask64 m1 = _mm512_mask_cmpgt_epi8_mask(m, dn, lo); // d < -1
+            __mmask64 m2 = _mm512_mask_cmpgt_epi8_mask(m, lo, dp); // d < +1
+            __mmask64 m3 = _mm512_mask_cmpgt_epi8_mask(m, hi, dp); // d < +12
+
+            h0 = _mm512_add_epi64(h0, _mm512_sad_epu8(_mm512_maskz_mov_epi8(m0, one), zero)); // accumulate horizontal sums
+            h1 = _mm512_add_epi64(h1, _mm512_sad_epu8(_mm512_maskz_mov_epi8(m1, one), zero));
+            h2 = _mm512_add_epi64(h2, _mm512_sad_epu8(_mm512_maskz_mov_epi8(m2, one), zero));
+            h3 = _mm512_add_epi64(h3, _mm512_sad_epu8(_mm512_maskz_mov_epi8(m3, one), zero));
+        }
+        pSrc += pitch;
+        pRef += pitch;
+    }
+
+    *pSrcDC = _mm512_reduce_add_epi64(sDC);
+    *pRefDC = _mm512_reduce_add_epi64(rDC);
+
+    histogram[0] = (mfxI32)_mm512_reduce_add_epi64(h0);
+    histogram[1] = (mfxI32)_mm512_reduce_add_epi64(h1);
+    histogram[2] = (mfxI32)_mm512_reduce_add_epi64(h2);
+    histogram[3] = (mfxI32)_mm512_reduce_add_epi64(h3);
+    histogram[4] = width * height;
+
+    // undo cumulative counts, by differencing
+    histogram[4] -= histogram[3];
+    histogram[3] -= histogram[2];
+    histogram[2] -= histogram[1];
+    histogram[1] -= histogram[0];
+}
+
+void GainOffset_AVX512(pmfxU8 *pSrc, pmfxU8 *pDst, mfxU16 width, mfxU16 height, mfxU16 pitch, mfxI16 gainDiff) {
+    pmfxU8
+        ss = *pSrc,
+        dd = *pDst;
+    const __m512i gain = _mm512_set1_epi16(gainDiff);
+    const __m512i order = _mm512_setr_epi64(0, 2, 4, 6, 1, 3, 5, 7);
+    for (mfxU16 i = 0; i < height; i++) {
+        for (mfxI32 j = 0; j < width; j += 64) {
+            __mmask64 m = FirstN(width - j);
+            __m512i s = _mm512_maskz_loadu_epi8(m, &ss[j + i * pitch]);
+            // 16-bit wrap around and clamp to [0, 255] as the C code does
+            __m512i s0 = _mm512_sub_epi16(_mm512_cvtepu8_epi16(_mm512_castsi512_si256(s)), gain);
+            __m512i s1 = _mm512_sub_epi16(_mm512_cvtepu8_epi16(_mm512_extracti64x4_epi64(s, 1)), gain);
+            s = _mm512_permutexvar_epi64(order, _mm512_packus_epi16(s0, s1));
+            _mm512_mask_storeu_epi8(&dd[j + i * pitch], m, s);
+        }
+    }
+
+    *pSrc = *pDst;
+}
+
+mfxStatus Calc_RaCa_pic_AVX512(mfxU8 *pSrc, mfxI32 width, mfxI32 height, mfxI32 pitch, mfxF64 &RsCs) {
+    const __m512i one = _mm512_set1_epi16(1);
+    mfxI32
+        RS = 0,
+        CS = 0;
+    for (mfxI32 i = 4; i < height - 4; i += 4)
+    {
+        // 8 horizontal blocks at a time, the last ones with masked loads
+        for (mfxI32 j = 4; j < width - 4; j += 32)
+        {
+            mfxI32 n = std::min((width - 4 - j + 3) & ~3, 32);
+            pmfxU8 p = pSrc + i * pitch + j;
+            __m512i rs = _mm512_setzero_si512();
+            __m512i cs = _mm512_setzero_si512();
+            __m512i c = LoadU8toU16(p, n);
+            for (mfxI32 k = 0; k < 4; k++)
+            {
+                __m512i b = LoadU8toU16(p + 1, n);
+                __m512i a = LoadU8toU16(p + pitch, n);
+                p += pitch;
+
+                // Cs += (pS[j] > pS[j + 1]) ? (pS[j] - pS[j + 1]) : (pS[j + 1] - pS[j]);
+                cs = _mm512_add_epi16(cs, _mm512_abs_epi16(_mm512_sub_epi16(c, b)));
+                // Rs += (pS[j] > pS2[j]) ? (pS[j] - pS2[j]) : (pS2[j] - pS[j]);
+                rs = _mm512_add_epi16(rs, _mm512_abs_epi16(_mm512_sub_epi16(c, a)));
+
+                // reuse next iteration
+                c = a;
+            }
+
+            //Cs >> 4; Rs >> 4;
+            __m512i sum = _mm512_srli_epi32(PairSums(_mm512_madd_epi16(rs, one), _mm512_madd_epi16(cs, one)), 4);
+            //*CS += Cs; *RS += Rs;
+            RS += _mm512_mask_reduce_add_epi32(0x00ff, sum);
+            CS += _mm512_mask_reduce_add_epi32(0xff00, sum);
+        }
+    }
+
+    RsCs = calc_RACA_pic_C(RS, CS, width, height);
+    return MFX_ERR_NONE;
+}
+
+// Lane t walks tree t, lanes past ASC_TREE_COUNT walk tree 0 and are not counted
+mfxU32 SCDetectRF_Votes_AVX512(const mfxI32 *feature) {
+    static_assert(ASC_TREE_COUNT > 16 && ASC_TREE_COUNT <= 32, "SCDetectRF_Votes_AVX512 walks 32 trees at most");
+    static_assert(ASC_TREE_FEATURE_SLOTS == 32, "features are permuted from two registers");
+    ASC_ALIGN_DECL(64) mfxI32 node[32];
+    for (mfxU32 t = 0; t < 32; t++)
+        node[t] = ASC_TREE_ROOT[t < ASC_TREE_COUNT ? t : 0];
+
+    const int *nodes = (const int *)ASC_TREE_NODES;
+    const __m512i
+        f0 = _mm512_loadu_si512(&feature[0]),
+        f1 = _mm512_loadu_si512(&feature[16]),
+        one = _mm512_set1_epi32(1);
+    __m512i
+        idx0 = _mm512_load_si512(&node[0]),
+        idx1 = _mm512_load_si512(&node[16]);
+
+    // the feature is picked by the low 5 bits of (node >> 16), offset bits above are ignored
+#define ASC_TREE_STEP(idx)                                                                       \
+    {                                                                                            \
+        __m512i n   = _mm512_i32gather_epi32(idx, nodes, 4);                                     \
+        __m512i thr = _mm512_srai_epi32(_mm512_slli_epi32(n, 16), 16);                           \
+        __m512i val = _mm512_permutex2var_epi32(f0, _mm512_srli_epi32(n, 16), f1);               \
+        idx = _mm512_add_epi32(idx, _mm512_srli_epi32(n, 21));                                   \
+        idx = _mm512_mask_add_epi32(idx, _mm512_cmpge_epi32_mask(val, thr), idx, one);           \
+    }
+
+    for (mfxU32 level = 1; level < ASC_TREE_DEPTH; level++) {
+        ASC_TREE_STEP(idx0);
+        ASC_TREE_STEP(idx1);
+    }
+#undef ASC_TREE_STEP
+
+    // leaf votes are 0 or 1, so the low halves of the nodes can be summed as is
+    const __m512i low = _mm512_set1_epi32(0xffff);
+    __m512i
+        votes = _mm512_and_si512(_mm512_i32gather_epi32(idx0, nodes, 4), low),
+        last = _mm512_maskz_and_epi32((__mmask16)((1 << (ASC_TREE_COUNT - 16)) - 1), _mm512_i32gather_epi32(idx1, nodes, 4), low);
+    return (mfxU32)_mm512_reduce_add_epi32(_mm512_add_epi32(votes, last));
+}
+
+#endif //defined(__AVX512F__) && defined(__AVX512BW__)
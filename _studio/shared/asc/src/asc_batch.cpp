@@ -0,0 +1,138 @@
+// Copyright (c) 2020 Intel Corporation
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "asc_batch.h"
+#include "asc_defs.h"
+#include <algorithm>
+#include <thread>
+
+namespace ns_asc {
+
+ASC_API ASCBatch::ASCBatch()
+    : m_streams()
+    , m_interlaced()
+    , m_busy()
+    , m_threadPool()
+{
+}
+
+ASC_API ASCBatch::~ASCBatch()
+{
+    Close();
+}
+
+ASC_API mfxStatus ASCBatch::Init(mfxU32 numStreams, const ASCStreamParam *params, mfxU32 numThreads)
+{
+    mfxStatus sts = MFX_ERR_NONE;
+    Close();
+    if (!params)
+        return MFX_ERR_NULL_PTR;
+    if (numStreams == 0)
+        return MFX_ERR_INVALID_VIDEO_PARAM;
+
+    if (numThreads == 0)
+        numThreads = std::max(std::thread::hardware_concurrency(), 1u);
+    sts = m_threadPool.Init(std::min(numThreads, numStreams));
+    SCD_CHECK_MFX_ERR(sts);
+
+    try
+    {
+        m_busy.resize(numStreams, 0);
+        for (mfxU32 i = 0; i < numStreams; i++)
+        {
+            m_streams.emplace_back(new ASC);
+            m_interlaced.push_back(!!(params[i].PicStruct & (MFX_PICSTRUCT_FIELD_TFF | MFX_PICSTRUCT_FIELD_BFF)));
+        }
+    }
+    catch (...)
+    {
+        Close();
+        return MFX_ERR_MEMORY_ALLOC;
+    }
+
+    // the streams run in parallel, each of them on a single thread
+    for (mfxU32 i = 0; i < numStreams; i++)
+    {
+        sts = m_streams[i]->Init(params[i].Width, params[i].Height, params[i].Pitch, params[i].PicStruct, nullptr);
+        if (sts != MFX_ERR_NONE)
+        {
+            Close();
+            return sts;
+        }
+    }
+    return sts;
+}
+
+ASC_API void ASCBatch::Close()
+{
+    for (auto &stream : m_streams)
+        stream->Close();
+    m_streams.clear();
+    m_interlaced.clear();
+    m_busy.clear();
+    m_threadPool.Close();
+}
+
+ASC_API mfxStatus ASCBatch::PutFrames(mfxU32 count, ASCBatchFrame *frames)
+{
+    if (m_streams.empty())
+        return MFX_ERR_NOT_INITIALIZED;
+    if (count && !frames)
+        return MFX_ERR_NULL_PTR;
+
+    mfxStatus sts = MFX_ERR_NONE;
+    for (mfxU32 i = 0; i < count && sts == MFX_ERR_NONE; i++)
+    {
+        if (frames[i].stream >= m_streams.size() || m_busy[frames[i].stream])
+            sts = MFX_ERR_INVALID_VIDEO_PARAM;
+        else if (!frames[i].frame)
+            sts = MFX_ERR_NULL_PTR;
+        else
+            m_busy[frames[i].stream] = 1;
+    }
+    std::fill(m_busy.begin(), m_busy.end(), 0);
+    SCD_CHECK_MFX_ERR(sts);
+
+    m_threadPool.Run(count, [this, frames](mfxU32 i) {
+        ASCBatchFrame &f = frames[i];
+        ASC &asc = *m_streams[f.stream];
+        f.sts = m_interlaced[f.stream] ? asc.PutFrameInterlaced(f.frame, f.pitch) : asc.PutFrameProgressive(f.frame, f.pitch);
+        f.shotDecision = (f.sts == MFX_ERR_NONE) ? asc.Get_frame_shot_Decision() : 0;
+    });
+
+    for (mfxU32 i = 0; i < count; i++)
+    {
+        if (frames[i].sts != MFX_ERR_NONE)
+            return frames[i].sts;
+    }
+    return MFX_ERR_NONE;
+}
+
+ASC_API mfxU32 ASCBatch::GetNumStreams()
+{
+    return (mfxU32)m_streams.size();
+}
+
+ASC_API ASC *ASCBatch::GetStream(mfxU32 stream)
+{
+    return stream < m_streams.size() ? m_streams[stream].get() : nullptr;
+}
+
+};
@@ -219,13 +219,7 @@ mfxStatus Calc_RaCa_pic_C(mfxU8 *pPicY, mfxI32 width, mfxI32 height, mfxI32 pitc
         }
     }
 
-    mfxI32 w4 = (width - 8) >> 2;
-    mfxI32 h4 = (height - 8) >> 2;
-    mfxF64 d1 = 1.0 / (mfxF64)(w4*h4);
-    mfxF64 drs = (mfxF64)Rs * d1;
-    mfxF64 dcs = (mfxF64)Cs * d1;
-
-    RsCs = sqrt(drs * drs + dcs * dcs);
+    RsCs = calc_RACA_pic_C(Rs, Cs, width, height);
     return MFX_ERR_NONE;
 }
 
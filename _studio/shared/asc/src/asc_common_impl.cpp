@@ -49,3 +49,14 @@ void calc_RACA_4x4_C(
     *CS += Cs >> 4;
     *RS += Rs >> 4;
 }
+
+mfxF64 calc_RACA_pic_C(mfxI32 RS, mfxI32 CS, mfxI32 width, mfxI32 height)
+{
+    mfxI32 w4 = (width - 8) >> 2;
+    mfxI32 h4 = (height - 8) >> 2;
+    mfxF64 d1 = 1.0 / (mfxF64)(w4*h4);
+    mfxF64 drs = (mfxF64)RS * d1;
+    mfxF64 dcs = (mfxF64)CS * d1;
+
+    return sqrt(drs * drs + dcs * dcs);
+}
@@ -584,16 +584,11 @@ mfxStatus Calc_RaCa_pic_SSE4(mfxU8 *pSrc, mfxI32 width, mfxI32 height, mfxI32 pi
             count++;
         }
 
-        pY -= width - 8;
+        // back to the row start, j stops at the first multiple of 4 past width - 8
+        pY -= j;
         pY += 4 * pitch;
     }
-    mfxI32 w4 = (width - 8) >> 2;
-    mfxI32 h4 = (height - 8) >> 2;
-    mfxF64 d1 = 1.0 / (mfxF64)(w4*h4);
-    mfxF64 drs = (mfxF64)RS * d1;
-    mfxF64 dcs = (mfxF64)CS * d1;
-
-    RsCs = sqrt(drs * drs + dcs * dcs);
+    RsCs = calc_RACA_pic_C(RS, CS, width, height);
     return MFX_ERR_NONE;
 }
 
@@ -0,0 +1,129 @@
+// Copyright (c) 2020 Intel Corporation
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "asc_thread_pool.h"
+
+namespace ns_asc {
+
+ASCThreadPool::ASCThreadPool()
+    : m_workers()
+    , m_mutex()
+    , m_wake()
+    , m_done()
+    , m_task(nullptr)
+    , m_count(0)
+    , m_busy(0)
+    , m_next(0)
+    , m_generation(0)
+    , m_exit(false)
+{
+}
+
+ASCThreadPool::~ASCThreadPool()
+{
+    Close();
+}
+
+mfxStatus ASCThreadPool::Init(mfxU32 numThreads)
+{
+    Close();
+    if (numThreads == 0)
+        return MFX_ERR_INVALID_VIDEO_PARAM;
+
+    try
+    {
+        for (mfxU32 i = 1; i < numThreads; i++)
+            m_workers.emplace_back(&ASCThreadPool::Worker, this, m_generation);
+    }
+    catch (...)
+    {
+        Close();
+        return MFX_ERR_MEMORY_ALLOC;
+    }
+    return MFX_ERR_NONE;
+}
+
+void ASCThreadPool::Close()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_exit = true;
+    }
+    m_wake.notify_all();
+    for (auto &worker : m_workers)
+        worker.join();
+    m_workers.clear();
+    m_exit = false;
+}
+
+void ASCThreadPool::RunTasks()
+{
+    for (mfxU32 i = m_next++; i < m_count; i = m_next++)
+        (*m_task)(i);
+}
+
+void ASCThreadPool::Run(mfxU32 count, const std::function<void(mfxU32)> &task)
+{
+    if (m_workers.empty() || count < 2)
+    {
+        for (mfxU32 i = 0; i < count; i++)
+            task(i);
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_task  = &task;
+        m_count = count;
+        m_next  = 0;
+        m_busy  = (mfxU32)m_workers.size();
+        m_generation++;
+    }
+    m_wake.notify_all();
+
+    RunTasks();
+
+    // every worker has to leave this generation before m_task goes out of scope
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_done.wait(lock, [this] { return m_busy == 0; });
+    m_task = nullptr;
+}
+
+void ASCThreadPool::Worker(mfxU64 generation)
+{
+    for (;;)
+    {
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_wake.wait(lock, [this, generation] { return m_exit || m_generation != generation; });
+            if (m_exit)
+                return;
+            generation = m_generation;
+        }
+
+        RunTasks();
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (--m_busy == 0)
+            m_done.notify_one();
+    }
+}
+
+};
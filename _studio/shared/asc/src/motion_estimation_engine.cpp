@@ -139,12 +139,108 @@ void MVpropagationCheck(mfxI32 xLoc, mfxI32 yLoc, ASCImDetails dataIn, ASCMVecto
 
 #define SAD_SEARCH_VSTEP 2  // 1=FS 2=FHS
 
+#define PRED_SAD_MIN_THR   256  // 4 per pixel, the noise of a good match
+#define PRED_SAD_MAX_THR   2048 // 32 per pixel, above it a block always gets the full search
+#define PRED_REFINE_STEPS  4    // +-1 steps around the best predictor
+
+//
+// Predictive search, tries the vectors of the left, top and top left blocks
+// and the co-located, right and bottom vectors of the reference frame, then
+// walks from the best of them in +-1 steps until the SAD drops below 1.5x the
+// best SAD of the neighbours, clamped to [MIN, MAX]. A block which does not get
+// there is an outlier and gets the full search from the vector found.
+//
+static bool ME_predictive(
+    mfxI32              fPos,
+    mfxI16              xLoc,
+    mfxI16              yLoc,
+    ASCImDetails       *dataIn,
+    ASCMVector         *current,
+    mfxU16             *outSAD,
+    ASCMVector         *refMV,
+    pmfxU8              objFrame,
+    pmfxU8              refFrame,
+    mfxU16             &bestSAD,
+    mfxI32             &distance,
+    ASCVidData         *limits,
+    t_ME_SAD_8x8_Block  ME_SAD_8x8_opt)
+{
+    ASCMVector
+        cand[6],
+        best = current[fPos],
+        center,
+        tMV;
+    mfxU32
+        count = 0;
+    mfxU16
+        neighborSAD = USHRT_MAX,
+        thr = PRED_SAD_MIN_THR;
+    mfxI16
+        limitXleft  = 0,
+        limitXright = 0,
+        limitYup    = 0,
+        limitYdown  = 0;
+    mfxI32
+        wBlocks = dataIn->Width_in_blocks;
+
+    if (xLoc > 0) {
+        cand[count++] = current[fPos - 1];
+        neighborSAD = NMIN(neighborSAD, outSAD[fPos - 1]);
+    }
+    if (yLoc > 0) {
+        cand[count++] = current[fPos - wBlocks];
+        neighborSAD = NMIN(neighborSAD, outSAD[fPos - wBlocks]);
+        if (xLoc > 0) {
+            cand[count++] = current[fPos - wBlocks - 1];
+            neighborSAD = NMIN(neighborSAD, outSAD[fPos - wBlocks - 1]);
+        }
+    }
+    if (refMV) {
+        cand[count++] = refMV[fPos];
+        if (xLoc + 1 < wBlocks)
+            cand[count++] = refMV[fPos + 1];
+        if (yLoc + 1 < dataIn->Height_in_blocks)
+            cand[count++] = refMV[fPos + wBlocks];
+    }
+    if (neighborSAD != USHRT_MAX)
+        thr = (mfxU16)NMIN(NMAX(neighborSAD * 3 / 2, PRED_SAD_MIN_THR), PRED_SAD_MAX_THR);
+
+    for (mfxU32 i = 0; i < count; i++) {
+        MVpropagationCheck(xLoc, yLoc, *dataIn, &cand[i]);
+        if (cand[i].x == best.x && cand[i].y == best.y)
+            continue;
+        if (MVcalcSAD8x8(cand[i], objFrame, refFrame, dataIn, &bestSAD, &distance, ME_SAD_8x8_opt))
+            best = cand[i];
+    }
+
+    for (mfxU32 step = 0; step < PRED_REFINE_STEPS && bestSAD > thr; step++) {
+        center = best;
+        SearchLimitsCalc(xLoc, yLoc, &limitXleft, &limitXright, &limitYup, &limitYdown, dataIn, 1, center, limits);
+        for (tMV.y = limitYup; tMV.y <= limitYdown; tMV.y++) {
+            for (tMV.x = limitXleft; tMV.x <= limitXright; tMV.x++) {
+                if (tMV.x != 0 || tMV.y != 0) {
+                    ASCMVector predMV = { (mfxI16)(center.x + tMV.x), (mfxI16)(center.y + tMV.y) };
+                    if (MVcalcSAD8x8(predMV, objFrame, refFrame, dataIn, &bestSAD, &distance, ME_SAD_8x8_opt))
+                        best = predMV;
+                }
+            }
+        }
+        if (best.x == center.x && best.y == center.y)
+            break;
+    }
+
+    current[fPos] = best;
+    outSAD[fPos]  = bestSAD;
+    return bestSAD <= thr;
+}
+
 mfxU16 __cdecl ME_simple(
     ASCVidRead *videoIn,
     mfxI32                    fPos,
     ASCImDetails             *dataIn,
     ASCimageData             *scale,
     ASCimageData             *scaleRef,
+    ASCMVector               *refMV,
     bool /*first*/,
     ASCVidData               *limits,
     t_ME_SAD_8x8_Block_Search ME_SAD_8x8_Block_Search,
@@ -197,6 +293,13 @@ mfxU16 __cdecl ME_simple(
     if (bestSAD == 0)
         return bestSAD;
 
+    if (limits->searchMode == ASCPredictive_Search &&
+        ME_predictive(fPos, xLoc, yLoc, dataIn, current, outSAD, refMV, objFrame, refFrame, bestSAD, mainDistance, limits, ME_SAD_8x8_opt)) {
+        videoIn->average += (current[fPos].x * current[fPos].x) + (current[fPos].y * current[fPos].y);
+        MVcalcVar8x8(current[fPos], objFrame, refFrame, scale->avgval, scaleRef->avgval, scale->var, scale->jtvar, scale->mcjtvar, dataIn, ME_VAR_8x8_opt);
+        return(zeroSAD);
+    }
+
     if ((fPos > (mfxI32)dataIn->Width_in_blocks) && (xLoc > 0)) { //Top Left
         neighbor_count++;
         Nmv.x += current[fPos - dataIn->Width_in_blocks - 1].x;
@@ -0,0 +1,99 @@
+// Copyright (c) 2020 Intel Corporation
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <algorithm>
+#include "../include/tree.h"
+#include "../include/asc_defs.h"
+
+// Thresholds are within (-0x8000, 0x7fff] (checked by tools/asc_tree_gen.py), so features
+// saturated to 16 bits give the same decisions as the full values in tree.cpp
+static inline mfxI32 TreeFeature(mfxU32 val)
+{
+    return (mfxI32)std::min<mfxU32>(val, 0x7fff);
+}
+
+static inline mfxI32 TreeFeature(mfxI32 val)
+{
+    return std::max<mfxI32>(-0x8000, std::min<mfxI32>(val, 0x7fff));
+}
+
+void SCDetectRF_Features(
+    mfxI32 feature[ASC_TREE_FEATURE_SLOTS],
+    mfxI32 diffMVdiffVal, mfxU32 RsCsDiff, mfxU32 MVDiff, mfxU32 Rs, mfxU32 AFD,
+    mfxU32 CsDiff, mfxI32 diffTSC, mfxU32 TSC, mfxU32 gchDC, mfxI32 diffRsCsdiff,
+    mfxU32 posBalance, mfxU32 SC, mfxU32 TSCindex, mfxU32 Scindex, mfxU32 Cs,
+    mfxI32 diffAFD, mfxU32 negBalance, mfxU32 ssDCval, mfxU32 refDCval, mfxU32 RsDiff) {
+    std::fill(feature, feature + ASC_TREE_FEATURE_SLOTS, 0);
+    feature[ASC_TREE_diffMVdiffVal] = TreeFeature(diffMVdiffVal);
+    feature[ASC_TREE_RsCsDiff]      = TreeFeature(RsCsDiff);
+    feature[ASC_TREE_MVDiff]        = TreeFeature(MVDiff);
+    feature[ASC_TREE_Rs]            = TreeFeature(Rs);
+    feature[ASC_TREE_AFD]           = TreeFeature(AFD);
+    feature[ASC_TREE_CsDiff]        = TreeFeature(CsDiff);
+    feature[ASC_TREE_diffTSC]       = TreeFeature(diffTSC);
+    feature[ASC_TREE_TSC]           = TreeFeature(TSC);
+    feature[ASC_TREE_gchDC]         = TreeFeature(gchDC);
+    feature[ASC_TREE_diffRsCsdiff]  = TreeFeature(diffRsCsdiff);
+    feature[ASC_TREE_posBalance]    = TreeFeature(posBalance);
+    feature[ASC_TREE_SC]            = TreeFeature(SC);
+    feature[ASC_TREE_TSCindex]      = TreeFeature(TSCindex);
+    feature[ASC_TREE_Scindex]       = TreeFeature(Scindex);
+    feature[ASC_TREE_Cs]            = TreeFeature(Cs);
+    feature[ASC_TREE_diffAFD]       = TreeFeature(diffAFD);
+    feature[ASC_TREE_negBalance]    = TreeFeature(negBalance);
+    feature[ASC_TREE_ssDCval]       = TreeFeature(ssDCval);
+    feature[ASC_TREE_refDCval]      = TreeFeature(refDCval);
+    feature[ASC_TREE_RsDiff]        = TreeFeature(RsDiff);
+    // below any leaf vote, so leaves never move
+    feature[ASC_TREE_LEAF]          = -0x8000;
+}
+
+// All trees are walked in lockstep for ASC_TREE_DEPTH levels. The walks do not depend
+// on each other, so their loads overlap, and there are no data dependent branches.
+mfxU32 SCDetectRF_Votes_C(const mfxI32 *feature) {
+    mfxU32 node[ASC_TREE_COUNT];
+    for (mfxU32 t = 0; t < ASC_TREE_COUNT; t++)
+        node[t] = ASC_TREE_ROOT[t];
+
+    for (mfxU32 level = 1; level < ASC_TREE_DEPTH; level++) {
+        for (mfxU32 t = 0; t < ASC_TREE_COUNT; t++) {
+            mfxU32 n = ASC_TREE_NODES[node[t]];
+            node[t] += ASC_TREE_NODE_OFFSET(n) + (feature[ASC_TREE_NODE_FEATURE(n)] >= ASC_TREE_NODE_THRESHOLD(n));
+        }
+    }
+
+    mfxU32 votes = 0;
+    for (mfxU32 t = 0; t < ASC_TREE_COUNT; t++)
+        votes += ASC_TREE_NODE_THRESHOLD(ASC_TREE_NODES[node[t]]);
+    return votes;
+}
+
+bool SCDetectRF(
+    mfxI32 diffMVdiffVal, mfxU32 RsCsDiff, mfxU32 MVDiff, mfxU32 Rs, mfxU32 AFD,
+    mfxU32 CsDiff, mfxI32 diffTSC, mfxU32 TSC, mfxU32 gchDC, mfxI32 diffRsCsdiff,
+    mfxU32 posBalance, mfxU32 SC, mfxU32 TSCindex, mfxU32 Scindex, mfxU32 Cs,
+    mfxI32 diffAFD, mfxU32 negBalance, mfxU32 ssDCval, mfxU32 refDCval, mfxU32 RsDiff,
+    mfxU8 control) {
+    mfxI32 feature[ASC_TREE_FEATURE_SLOTS];
+    SCDetectRF_Features(feature,
+        diffMVdiffVal, RsCsDiff, MVDiff, Rs, AFD, CsDiff, diffTSC, TSC, gchDC, diffRsCsdiff,
+        posBalance, SC, TSCindex, Scindex, Cs, diffAFD, negBalance, ssDCval, refDCval, RsDiff);
+    return(SCDetectRF_Votes_C(feature) > mfxU32(RF_DECISION_LEVEL + control));
+}
@@ -0,0 +1,2687 @@
+// Copyright (c) 2020 Intel Corporation
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+// Generated by tools/asc_tree_gen.py from src/tree.cpp, do not edit.
+
+#include "../include/tree.h"
+
+static_assert(ASC_TREE_COUNT == 21, "tree.h is out of sync with tree_table.cpp");
+static_assert(ASC_TREE_NODE_COUNT == 10589, "tree.h is out of sync with tree_table.cpp");
+static_assert(ASC_TREE_DEPTH == 17, "tree.h is out of sync with tree_table.cpp");
+
+const mfxU16 ASC_TREE_ROOT[ASC_TREE_COUNT] =
+{
+        0,   519,  1014,  1515,  1972,  2465,  2956,  3483,
+     4016,  4523,  5044,  5531,  6050,  6545,  7030,  7525,
+     8034,  8531,  9044,  9551, 10078,
+};
+
+// ASC_TREE_NODE(threshold, feature, offset)
+const mfxU32 ASC_TREE_NODES[ASC_TREE_NODE_COUNT] =
+{
+    ASC_TREE_NODE(    7,  6,   1), ASC_TREE_NODE(   53,  0,   2), ASC_TREE_NODE(   52,  2,   3), ASC_TREE_NODE(   14,  8,   4),
+    ASC_TREE_NODE(    8, 15,   5), ASC_TREE_NODE(   34, 18,   6), ASC_TREE_NODE(   72,  9,   7), ASC_TREE_NODE(   21, 17,   8),
+    ASC_TREE_NODE(   62,  4,   9), ASC_TREE_NODE(   23,  8,  10), ASC_TREE_NODE(   42, 17,  11), ASC_TREE_NODE(   73,  9,  12),
+    ASC_TREE_NODE(   13,  6,  13), ASC_TREE_NODE(   88,  0,  14), ASC_TREE_NODE(   58,  0,  15), ASC_TREE_NODE(  251,  1,  16),
+    ASC_TREE_NODE(    5,  8,  17), ASC_TREE_NODE(   40, 17,  18), ASC_TREE_NODE( 1324, 14,  19), ASC_TREE_NODE(   38, 17,  20),
+    ASC_TREE_NODE(   58,  4,  21), ASC_TREE_NODE(  162, 14,  22), ASC_TREE_NODE(  106,  3,  23), ASC_TREE_NODE(   17,  7,  24),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   12,  4,  24), ASC_TREE_NODE(    5,  5,  25), ASC_TREE_NODE(   66,  4,  26),
+    ASC_TREE_NODE(   15,  8,  27), ASC_TREE_NODE(   84, 10,  28), ASC_TREE_NODE(   17, 15,  29), ASC_TREE_NODE(    5,  9,  30),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   55,  2,  30), ASC_TREE_NODE(   94,  3,  31), ASC_TREE_NODE(   13, 15,  32),
+    ASC_TREE_NODE(   75, 19,  33), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  187,  0,  32),
+    ASC_TREE_NODE(   34,  4,  33), ASC_TREE_NODE(    2, 11,  34), ASC_TREE_NODE(  910, 14,  35), ASC_TREE_NODE(  348,  0,  36),
+    ASC_TREE_NODE(  368, 11,  37), ASC_TREE_NODE(   17,  1,  38), ASC_TREE_NODE(  426,  2,  39), ASC_TREE_NODE(  -70,  0,  40),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   24, 19,  40), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(   42,  2,  39), ASC_TREE_NODE(  478,  3,  40), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   13, 15,  40),
+    ASC_TREE_NODE(   23, 15,  41), ASC_TREE_NODE(  102, 17,  42), ASC_TREE_NODE(  501,  9,  43), ASC_TREE_NODE( 1321,  3,  44),
+    ASC_TREE_NODE(   17, 16,  45), ASC_TREE_NODE(    2,  0,  46), ASC_TREE_NODE(    7,  2,  47), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(   24, 18,  47), ASC_TREE_NODE(   93,  3,  48), ASC_TREE_NODE(   32, 19,  49), ASC_TREE_NODE(   86, 16,  50),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  408,  3,  50), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   31,  9,  50),
+    ASC_TREE_NODE(   10,  4,  51), ASC_TREE_NODE(   41,  5,  52), ASC_TREE_NODE(   -1, 15,  53), ASC_TREE_NODE(   -1, 15,  54),
+    ASC_TREE_NODE(  -24,  6,  55), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   58, 11,  54),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   13, 15,  53), ASC_TREE_NODE(   48, 18,  54),
+    ASC_TREE_NODE(   -1,  9,  55), ASC_TREE_NODE( 1355, 11,  56), ASC_TREE_NODE(   61,  9,  57), ASC_TREE_NODE(  402,  3,  58),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  178, 19,  56),
+    ASC_TREE_NODE(   32, 16,  57), ASC_TREE_NODE(  344,  2,  58), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   10,  8,  58),
+    ASC_TREE_NODE(   31,  1,  59), ASC_TREE_NODE(   11,  7,  60), ASC_TREE_NODE(   25, 16,  61), ASC_TREE_NODE(   20,  6,  62),
+    ASC_TREE_NODE(   60, 10,  63), ASC_TREE_NODE(  411, 14,  64), ASC_TREE_NODE(   68, 18,  65), ASC_TREE_NODE(   70,  0,  66),
+    ASC_TREE_NODE(  365, 14,  67), ASC_TREE_NODE( 1982, 11,  68), ASC_TREE_NODE(   26, 15,  69), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(   10,  2,  69), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   24, 17,  68),
+    ASC_TREE_NODE( 2455,  1,  69), ASC_TREE_NODE(  227, 18,  70), ASC_TREE_NODE(  293, 11,  71), ASC_TREE_NODE(    6,  6,  72),
+    ASC_TREE_NODE(   64, 10,  73), ASC_TREE_NODE(    9,  7,  74), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE( -233,  0,  74),
+    ASC_TREE_NODE(   59,  4,  75), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  129,  0,  75), ASC_TREE_NODE(    4,  6,  76),
+    ASC_TREE_NODE(  376, 14,  77), ASC_TREE_NODE(   41, 17,  78), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  270,  2,  78),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  204,  3,  76),
+    ASC_TREE_NODE(  181,  1,  77), ASC_TREE_NODE(   42, 11,  78), ASC_TREE_NODE(   11,  7,  79), ASC_TREE_NODE(   36, 18,  80),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   10, 15,  80), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  188, 14,  80),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   17,  9,  80), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  165, 18,  80),
+    ASC_TREE_NODE( 2551, 11,  81), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE( 5540, 14,  77), ASC_TREE_NODE(    5,  8,  78),
+    ASC_TREE_NODE(  412, 11,  79), ASC_TREE_NODE(  210,  2,  80), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(   43,  9,  79), ASC_TREE_NODE(  263, 14,  80), ASC_TREE_NODE(   54, 17,  81), ASC_TREE_NODE(   99, 10,  82),
+    ASC_TREE_NODE(   24,  8,  83), ASC_TREE_NODE(   96, 18,  84), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  954,  3,  84),
+    ASC_TREE_NODE( 1737,  3,  85), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  101, 17,  85), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   18,  4,  84), ASC_TREE_NODE(  100, 10,  85), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   12,  7,  84), ASC_TREE_NODE(   10, 19,  85), ASC_TREE_NODE(  619,  3,  86),
+    ASC_TREE_NODE(   80,  0,  87), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(   -4,  6,  85), ASC_TREE_NODE(   11,  7,  86), ASC_TREE_NODE( 2357,  3,  87), ASC_TREE_NODE(    8, 15,  88),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(   46,  0,  85), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE( 2814, 14,  85), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    6,  5,  84), ASC_TREE_NODE(   38,  4,  85), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(  938,  3,  85), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   14,  4,  82), ASC_TREE_NODE(    7,  5,  83), ASC_TREE_NODE(    4,  6,  84),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE( 3607, 11,  84), ASC_TREE_NODE(    4,  6,  85), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE( 1574, 14,  85), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  183,  1,  85), ASC_TREE_NODE(  201,  0,  86),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(  188,  2,  83), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  396,  2,  80), ASC_TREE_NODE(    6,  6,  81), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(  684, 11,  81), ASC_TREE_NODE(   64,  4,  82), ASC_TREE_NODE(   92, 17,  83), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   61, 16,  82), ASC_TREE_NODE(   20, 15,  83), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(   31,  4,  83), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    4,  8,  83), ASC_TREE_NODE(   40, 18,  84),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  112,  2,  83), ASC_TREE_NODE(   17,  1,  84),
+    ASC_TREE_NODE(   63,  4,  85), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   32,  7,  85), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(   20,  7,  85), ASC_TREE_NODE(   19,  7,  86), ASC_TREE_NODE(  146,  1,  87), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  907, 14,  86), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(  119, 17,  85), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  150, 17,  84),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(   20, 15,  81), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   10,  5,  81), ASC_TREE_NODE(   16, 19,  82),
+    ASC_TREE_NODE(   38, 15,  83), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(   43, 18,  81), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(   16,  3,  79), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   30,  1,  79), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  125, 16,  78), ASC_TREE_NODE(   -4,  6,  79), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(  169, 11,  79), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    4,  5,  77), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(  667,  3,  71), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(   73, 18,  69), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(  359,  2,  67), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   60, 16,  67), ASC_TREE_NODE(   73, 16,  68),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(  766,  3,  65), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   49, 10,  64),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  158, 17,  63), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(  638, 14,  59), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   18, 16,  58),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   34, 18,  58), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    7, 16,  58),
+    ASC_TREE_NODE(   69,  4,  59), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    9,  5,  59), ASC_TREE_NODE(  151,  9,  60),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE( 2539,  3,  59), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   70,  2,  58), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   29,  7,  55), ASC_TREE_NODE(  145,  2,  56),
+    ASC_TREE_NODE(   20,  8,  57), ASC_TREE_NODE(  635, 14,  58), ASC_TREE_NODE(  155, 17,  59), ASC_TREE_NODE(   49,  4,  60),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  645,  3,  60), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1,  4,  55), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE( 1248,  3,  48), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   41, 16,  44),
+    ASC_TREE_NODE(  227, 14,  45), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    7, 19,  42), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(   35,  4,  41), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(   24,  9,  39), ASC_TREE_NODE(   68,  3,  40), ASC_TREE_NODE(  199,  2,  41), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   76, 14,  40), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  336,  3,  40),
+    ASC_TREE_NODE(   81, 17,  41), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE( 2987, 14,  41), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE( 1875, 11,  41), ASC_TREE_NODE(   17,  7,  42), ASC_TREE_NODE(   39, 15,  43), ASC_TREE_NODE(   20,  6,  44),
+    ASC_TREE_NODE(   30,  4,  45), ASC_TREE_NODE(  146, 17,  46), ASC_TREE_NODE(  716,  3,  47), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(   74,  2,  47), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE( 7496,  3,  47), ASC_TREE_NODE(   10,  7,  48),
+    ASC_TREE_NODE(    7,  5,  49), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    5,  5,  43), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  208,  3,  42),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(  101, 10,  39), ASC_TREE_NODE(   13,  1,  40), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  606, 11,  40),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   27,  7,  39), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  314,  9,  38), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE( 2643, 11,  33), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   58,  4,  33), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   22, 15,  31), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE( 3727, 14,  31), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   42,  4,  31), ASC_TREE_NODE( 1680,  3,  32),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(  123, 16,  29), ASC_TREE_NODE(  575, 14,  30), ASC_TREE_NODE(  373,  2,  31), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  191, 14,  30), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE( 1213, 11,  30),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  597, 14,  25), ASC_TREE_NODE(  191,  1,  26),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE( 2477, 11,  26), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  626, 14,  24), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE( 1849,  3,  22), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   27,  7,  19), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   28,  8,  17), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  257,  2,  16), ASC_TREE_NODE(  208,  2,  17), ASC_TREE_NODE(   46,  7,  18),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   54,  4,   8),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  404, 14,   7), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   65,  0,   1),
+    ASC_TREE_NODE(   10, 15,   2), ASC_TREE_NODE(    2,  9,   3), ASC_TREE_NODE(   19,  8,   4), ASC_TREE_NODE(   30, 15,   5),
+    ASC_TREE_NODE(    7, 15,   6), ASC_TREE_NODE(   12, 15,   7), ASC_TREE_NODE(   21, 17,   8), ASC_TREE_NODE(   62,  4,   9),
+    ASC_TREE_NODE(   34, 18,  10), ASC_TREE_NODE(   16,  7,  11), ASC_TREE_NODE(   61,  4,  12), ASC_TREE_NODE(   43, 17,  13),
+    ASC_TREE_NODE(   39, 17,  14), ASC_TREE_NODE(   33, 16,  15), ASC_TREE_NODE(  263,  1,  16), ASC_TREE_NODE(  -65,  0,  17),
+    ASC_TREE_NODE(   25, 18,  18), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  254,  1,  18), ASC_TREE_NODE(   59,  2,  19),
+    ASC_TREE_NODE(   11,  5,  20), ASC_TREE_NODE(   64,  2,  21), ASC_TREE_NODE(  378,  2,  22), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(  116,  0,  22), ASC_TREE_NODE(  211, 11,  23), ASC_TREE_NODE(   31, 18,  24), ASC_TREE_NODE(   83,  8,  25),
+    ASC_TREE_NODE(   28, 15,  26), ASC_TREE_NODE(   74,  9,  27), ASC_TREE_NODE(    7,  9,  28), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(  145,  2,  28), ASC_TREE_NODE(   67, 19,  29), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   91, 17,  29),
+    ASC_TREE_NODE(   24, 18,  30), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   10,  6,  30), ASC_TREE_NODE(   22, 16,  31),
+    ASC_TREE_NODE(  235,  1,  32), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE( 8222, 14,  32), ASC_TREE_NODE(   16,  6,  33),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  167,  8,  33), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   26, 10,  33),
+    ASC_TREE_NODE(    9,  6,  34), ASC_TREE_NODE(   46, 19,  35), ASC_TREE_NODE(    5,  6,  36), ASC_TREE_NODE(   10, 15,  37),
+    ASC_TREE_NODE(    9, 15,  38), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   30,  4,  38), ASC_TREE_NODE(   86, 10,  39),
+    ASC_TREE_NODE(  601, 14,  40), ASC_TREE_NODE(   10,  6,  41), ASC_TREE_NODE(   12,  1,  42), ASC_TREE_NODE(    2,  7,  43),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    2,  9,  43), ASC_TREE_NODE(  221, 17,  44), ASC_TREE_NODE( 2688,  3,  45),
+    ASC_TREE_NODE(   30,  4,  46), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  -62,  9,  46), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE( 1909, 14,  45), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   21, 15,  45),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   26, 19,  41), ASC_TREE_NODE(  393,  2,  42), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(   72, 18,  42), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   26,  1,  42), ASC_TREE_NODE(  112, 17,  43),
+    ASC_TREE_NODE(  221,  0,  44), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  499, 11,  43),
+    ASC_TREE_NODE(    4, 15,  44), ASC_TREE_NODE(   17,  3,  45), ASC_TREE_NODE(   32,  7,  46), ASC_TREE_NODE(  103,  0,  47),
+    ASC_TREE_NODE(   48, 17,  48), ASC_TREE_NODE(    8,  5,  49), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   13, 16,  49),
+    ASC_TREE_NODE(   29,  4,  50), ASC_TREE_NODE(    8,  6,  51), ASC_TREE_NODE( 2379, 11,  52), ASC_TREE_NODE(   29, 10,  53),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    5, 16,  53), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  109,  3,  51), ASC_TREE_NODE(  400,  9,  52), ASC_TREE_NODE(    7,  7,  53),
+    ASC_TREE_NODE( 1118,  3,  54), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  644,  1,  54), ASC_TREE_NODE(   -8, 15,  55),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   21,  4,  55), ASC_TREE_NODE(  338,  1,  56), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(  329,  2,  56), ASC_TREE_NODE(   15,  9,  57), ASC_TREE_NODE(   39,  4,  58), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    3,  6,  58), ASC_TREE_NODE(    7,  3,  59), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(  112, 10,  58), ASC_TREE_NODE(    5,  6,  59), ASC_TREE_NODE(  183,  2,  60), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  314,  2,  59), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  951,  3,  59),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   37, 17,  59), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    5, 19,  58), ASC_TREE_NODE(   10, 19,  59), ASC_TREE_NODE(  418,  2,  60), ASC_TREE_NODE(  337, 11,  61),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  341, 11,  61), ASC_TREE_NODE(   18,  8,  62), ASC_TREE_NODE(   18, 15,  63),
+    ASC_TREE_NODE(   22,  7,  64), ASC_TREE_NODE(   33,  7,  65), ASC_TREE_NODE(   66, 18,  66), ASC_TREE_NODE(   24, 15,  67),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   24,  8,  67), ASC_TREE_NODE(    5,  6,  68), ASC_TREE_NODE(   78, 17,  69),
+    ASC_TREE_NODE(   71, 16,  70), ASC_TREE_NODE(   18,  6,  71), ASC_TREE_NODE( 1277,  3,  72), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   47, 18,  71), ASC_TREE_NODE(   54,  0,  72), ASC_TREE_NODE(    5, 13,  73),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  571, 14,  69), ASC_TREE_NODE(   27, 17,  70), ASC_TREE_NODE(   75,  3,  71),
+    ASC_TREE_NODE(   27, 14,  72), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(   54,  0,  70), ASC_TREE_NODE(    9,  6,  71), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   50,  4,  71),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  -94,  0,  71), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   29,  3,  71),
+    ASC_TREE_NODE(    5,  3,  72), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1,  5,  71),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(   31,  4,  64), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  102,  0,  64), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  214, 14,  63), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    8,  8,  61), ASC_TREE_NODE(    3,  5,  62), ASC_TREE_NODE(   23,  9,  63),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE( 1037, 14,  61),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  131, 17,  61), ASC_TREE_NODE(   92, 10,  62), ASC_TREE_NODE(   19,  5,  63),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  259,  3,  63), ASC_TREE_NODE(   89, 17,  64), ASC_TREE_NODE(    4,  5,  65),
+    ASC_TREE_NODE(   18,  7,  66), ASC_TREE_NODE(   54, 17,  67), ASC_TREE_NODE(   74, 17,  68), ASC_TREE_NODE(   67,  0,  69),
+    ASC_TREE_NODE(   77, 18,  70), ASC_TREE_NODE(  392,  0,  71), ASC_TREE_NODE(   26,  7,  72), ASC_TREE_NODE(   24, 15,  73),
+    ASC_TREE_NODE(   65,  4,  74), ASC_TREE_NODE( 9666,  3,  75), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(   61, 17,  74), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   29, 18,  73),
+    ASC_TREE_NODE( 1868,  3,  74), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   58,  9,  69),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   45, 18,  68), ASC_TREE_NODE(   41,  3,  69),
+    ASC_TREE_NODE(  108, 17,  70), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  328,  3,  70), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(  620,  3,  70), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(  102,  8,  68), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   13,  9,  64), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   51, 17,  62), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(   23,  4,  62), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   77,  0,  61),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   21,  6,  61), ASC_TREE_NODE(  230, 14,  62), ASC_TREE_NODE( 2698,  3,  63),
+    ASC_TREE_NODE(   15,  6,  64), ASC_TREE_NODE(   26,  6,  65), ASC_TREE_NODE(   43, 15,  66), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    8,  6,  65), ASC_TREE_NODE(   12,  9,  66), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(  138,  0,  66), ASC_TREE_NODE(   46, 17,  67), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  375,  3,  67),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(  430,  3,  64), ASC_TREE_NODE(  104, 18,  65), ASC_TREE_NODE(  532,  9,  66), ASC_TREE_NODE(   19,  7,  67),
+    ASC_TREE_NODE(   86, 10,  68), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(   35,  4,  66), ASC_TREE_NODE(   86,  8,  67), ASC_TREE_NODE(   77,  0,  68), ASC_TREE_NODE(   60, 10,  69),
+    ASC_TREE_NODE(  183,  1,  70), ASC_TREE_NODE(10564,  3,  71), ASC_TREE_NODE( -108,  0,  72), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(   19,  3,  72), ASC_TREE_NODE(   15,  7,  73), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE( 2838, 11,  73),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE( 1417, 14,  73), ASC_TREE_NODE(  184,  9,  74), ASC_TREE_NODE(-1164,  0,  75),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  624, 14,  75), ASC_TREE_NODE(    3, 19,  76), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  133,  2,  75), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   71, 17,  71),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   54,  9,  71), ASC_TREE_NODE(   91, 14,  72), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   15, 15,  71), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   48,  4,  71),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE( 3620,  3,  71), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   50, 18,  67),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    8,  6,  64), ASC_TREE_NODE(   61,  3,  65), ASC_TREE_NODE(   35,  4,  66), ASC_TREE_NODE(   74,  4,  67),
+    ASC_TREE_NODE(   45, 17,  68), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  921,  3,  67),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE( 1116,  3,  65),
+    ASC_TREE_NODE( 1826,  3,  66), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  514,  3,  61),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE( 1778,  3,  61), ASC_TREE_NODE(  223,  9,  62), ASC_TREE_NODE( 2001,  3,  63),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  146, 17,  62), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  272, 14,  55),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(   90,  9,  52), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE( 6709, 11,  51),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   71,  2,  51), ASC_TREE_NODE(   61,  3,  52), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE( 1343,  3,  52), ASC_TREE_NODE(   44, 18,  53), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE( 1716,  3,  51), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   41, 18,  49), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(   12, 16,  48), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   31,  7,  48), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  264, 14,  47), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   31,  4,  47),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE( 1225, 11,  32), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE( 1052, 14,  31),
+    ASC_TREE_NODE(   84,  0,  32), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE( 1006, 14,  29), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE( 5217,  3,  29),
+    ASC_TREE_NODE(   11,  7,  30), ASC_TREE_NODE(   15,  7,  31), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(   45,  4,  30), ASC_TREE_NODE(  201,  1,  31), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    5, 16,  27),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE( 1064,  3,  27), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  944, 14,  20), ASC_TREE_NODE(   30,  7,  21),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE( 1301, 14,  14), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   23, 16,   9),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(  319,  2,   2), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  335,  3,   2), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   13, 15,   1), ASC_TREE_NODE(   68, 16,   2),
+    ASC_TREE_NODE(   65,  0,   3), ASC_TREE_NODE(   66,  0,   4), ASC_TREE_NODE(  217,  2,   5), ASC_TREE_NODE(   24,  7,   6),
+    ASC_TREE_NODE(   26, 16,   7), ASC_TREE_NODE(   24, 18,   8), ASC_TREE_NODE(    4,  6,   9), ASC_TREE_NODE(  105,  0,  10),
+    ASC_TREE_NODE(    9, 15,  11), ASC_TREE_NODE(   70, 17,  12), ASC_TREE_NODE(   13,  5,  13), ASC_TREE_NODE(    6, 16,  14),
+    ASC_TREE_NODE(   64,  9,  15), ASC_TREE_NODE(  109,  9,  16), ASC_TREE_NODE(   32,  7,  17), ASC_TREE_NODE(   40, 17,  18),
+    ASC_TREE_NODE(   48, 17,  19), ASC_TREE_NODE(  227, 18,  20), ASC_TREE_NODE(    7, 15,  21), ASC_TREE_NODE(   20,  5,  22),
+    ASC_TREE_NODE(   68, 18,  23), ASC_TREE_NODE(   52, 16,  24), ASC_TREE_NODE(    8,  8,  25), ASC_TREE_NODE(   65,  2,  26),
+    ASC_TREE_NODE(  105, 17,  27), ASC_TREE_NODE(   17, 18,  28), ASC_TREE_NODE(   29, 15,  29), ASC_TREE_NODE(  593, 11,  30),
+    ASC_TREE_NODE(   92,  0,  31), ASC_TREE_NODE(    2,  5,  32), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   19,  0,  32),
+    ASC_TREE_NODE( 1639,  3,  33), ASC_TREE_NODE(    8, 15,  34), ASC_TREE_NODE(   41,  4,  35), ASC_TREE_NODE(    7, 15,  36),
+    ASC_TREE_NODE(   11,  3,  37), ASC_TREE_NODE(   24, 17,  38), ASC_TREE_NODE(   10,  4,  39), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(  803,  3,  39), ASC_TREE_NODE(    5,  5,  40), ASC_TREE_NODE(   95, 17,  41), ASC_TREE_NODE(    5,  7,  42),
+    ASC_TREE_NODE(   45, 17,  43), ASC_TREE_NODE(  553,  9,  44), ASC_TREE_NODE(   18, 10,  45), ASC_TREE_NODE(   59,  2,  46),
+    ASC_TREE_NODE(   12, 19,  47), ASC_TREE_NODE(   22, 15,  48), ASC_TREE_NODE(   95, 18,  49), ASC_TREE_NODE(   91,  2,  50),
+    ASC_TREE_NODE( 1809,  9,  51), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE( 2733,  2,  51), ASC_TREE_NODE(  804,  3,  52),
+    ASC_TREE_NODE(  163,  9,  53), ASC_TREE_NODE(  129,  0,  54), ASC_TREE_NODE(   42,  4,  55), ASC_TREE_NODE(   10,  6,  56),
+    ASC_TREE_NODE(   26, 15,  57), ASC_TREE_NODE(    4, 19,  58), ASC_TREE_NODE(   18, 18,  59), ASC_TREE_NODE(  370,  2,  60),
+    ASC_TREE_NODE( 2305,  1,  61), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE( 4784, 14,  61), ASC_TREE_NODE(    3,  5,  62),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 16,  62), ASC_TREE_NODE(  950,  3,  63), ASC_TREE_NODE(    8, 12,  64),
+    ASC_TREE_NODE(   57, 10,  65), ASC_TREE_NODE(    5, 15,  66), ASC_TREE_NODE(   25, 19,  67), ASC_TREE_NODE(    1, 19,  68),
+    ASC_TREE_NODE(   40,  4,  69), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   12, 15,  68),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  -43,  6,  68), ASC_TREE_NODE(   -5, 15,  69), ASC_TREE_NODE(   25, 19,  70),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  223,  3,  69), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(  -32,  9,  69), ASC_TREE_NODE(   17,  6,  70), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(   65, 16,  69), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   13,  6,  69), ASC_TREE_NODE(  305, 14,  70),
+    ASC_TREE_NODE( 2529, 11,  71), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE( -114,  9,  70),
+    ASC_TREE_NODE(   69, 10,  71), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE( 4714, 11,  71), ASC_TREE_NODE(   56,  4,  72),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   75,  8,  72), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   13,  7,  72),
+    ASC_TREE_NODE(  114, 10,  73), ASC_TREE_NODE( 1668, 11,  74), ASC_TREE_NODE(   59,  4,  75), ASC_TREE_NODE(    1,  9,  76),
+    ASC_TREE_NODE(  480,  2,  77), ASC_TREE_NODE(   12,  7,  78), ASC_TREE_NODE(   20,  9,  79), ASC_TREE_NODE( 1345,  3,  80),
+    ASC_TREE_NODE(  225,  9,  81), ASC_TREE_NODE(   34,  4,  82), ASC_TREE_NODE(   38, 15,  83), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    6,  2,  82), ASC_TREE_NODE(    9,  4,  83), ASC_TREE_NODE(   10,  6,  84),
+    ASC_TREE_NODE(   20,  4,  85), ASC_TREE_NODE(  -24,  6,  86), ASC_TREE_NODE(   26,  4,  87), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  139,  0,  85), ASC_TREE_NODE(    3, 19,  86),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE( 3451, 11,  85), ASC_TREE_NODE(   42,  3,  86),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    9,  1,  86), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  141,  0,  84), ASC_TREE_NODE(   37,  4,  85), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   43, 18,  84), ASC_TREE_NODE(   -1, 15,  85), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   31, 18,  83), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(   56, 10,  83), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE( 2062,  3,  83), ASC_TREE_NODE(   13, 10,  84),
+    ASC_TREE_NODE(  864, 14,  85), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE( 1167, 14,  85), ASC_TREE_NODE(   53,  0,  86),
+    ASC_TREE_NODE(  711,  3,  87), ASC_TREE_NODE(   61, 18,  88), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   51, 16,  86), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   19,  7,  86),
+    ASC_TREE_NODE(  120, 18,  87), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   22,  6,  87), ASC_TREE_NODE(   12, 19,  88),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   11,  7,  84), ASC_TREE_NODE( 6991, 11,  85), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    5, 19,  85), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  420, 14,  85), ASC_TREE_NODE(  101, 10,  86),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   40, 15,  85), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(  189,  2,  85), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   37,  4,  85), ASC_TREE_NODE(   41, 17,  86),
+    ASC_TREE_NODE(    9,  6,  87), ASC_TREE_NODE(   70,  4,  88), ASC_TREE_NODE(  584, 14,  89), ASC_TREE_NODE(  106,  9,  90),
+    ASC_TREE_NODE(   36, 19,  91), ASC_TREE_NODE(  221,  1,  92), ASC_TREE_NODE(   24,  4,  93), ASC_TREE_NODE( 4750,  3,  94),
+    ASC_TREE_NODE(  297,  2,  95), ASC_TREE_NODE(   59,  4,  96), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    3, 19,  95), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  659,  3,  95), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(   44, 17,  95), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   63, 17,  95), ASC_TREE_NODE(   15,  5,  96),
+    ASC_TREE_NODE(    6,  6,  97), ASC_TREE_NODE( 3880, 14,  98), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   30,  1,  98),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  633,  3,  97), ASC_TREE_NODE(  335,  2,  98),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(  130,  2,  95), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  178,  2,  95), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   43, 10,  94), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   46, 10,  94),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  132, 14,  94), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  948,  3,  94),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   19,  8,  92),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE( 1185, 14,  89), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  722, 14,  89), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   30,  4,  87), ASC_TREE_NODE(  250, 14,  88),
+    ASC_TREE_NODE(    2, 19,  89), ASC_TREE_NODE(   46,  2,  90), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE( 2360,  3,  89), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  250,  9,  89), ASC_TREE_NODE(  178, 17,  90),
+    ASC_TREE_NODE( 2895, 11,  91), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  636, 14,  90),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  328,  2,  90), ASC_TREE_NODE(   15, 19,  91), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  872,  3,  90), ASC_TREE_NODE(   28,  7,  91), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   54, 10,  90), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(  179,  3,  89), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    2,  8,  89), ASC_TREE_NODE(   56, 18,  90),
+    ASC_TREE_NODE(   10,  9,  91), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    6, 19,  90),
+    ASC_TREE_NODE(   19,  6,  91), ASC_TREE_NODE(   72,  2,  92), ASC_TREE_NODE( 1367, 14,  93), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE( 5582,  3,  93), ASC_TREE_NODE( 2140, 11,  94), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE( 2819, 11,  94),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    9,  6,  94), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   92, 17,  94),
+    ASC_TREE_NODE(  369,  2,  95), ASC_TREE_NODE(  123, 16,  96), ASC_TREE_NODE(  285,  2,  97), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   49, 18,  92), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  247,  9,  89), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE( 1670,  3,  83), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   12,  6,  81), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   10, 19,  79), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   38,  9,  78), ASC_TREE_NODE(   15,  5,  79), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE( 8896,  3,  74), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(  131, 17,  65), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  174,  3,  65), ASC_TREE_NODE(    5,  0,  66),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   16,  7,  66), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(   17, 16,  65), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   60,  4,  61), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(   11,  7,  61), ASC_TREE_NODE(  890,  0,  62), ASC_TREE_NODE(    8, 19,  63), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  912, 11,  60),
+    ASC_TREE_NODE(   75,  0,  61), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  195,  0,  61), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(   29,  7,  61), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   37, 16,  52),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   15,  7,  52), ASC_TREE_NODE( 1098,  3,  53), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(  180,  9,  53), ASC_TREE_NODE( 1439,  1,  54), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE( 1210,  3,  53), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   83, 14,  53), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(   14,  4,  53), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  828,  2,  52),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  336,  0,  50),
+    ASC_TREE_NODE(   56, 17,  51), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE( 1272,  3,  51), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE( 1372,  3,  45), ASC_TREE_NODE(  297,  3,  46),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  826,  2,  46), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   30,  7,  46),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  480, 11,  46), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(   39,  3,  45), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   26,  4,  36),
+    ASC_TREE_NODE(    5, 13,  37), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(  133,  2,  35), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   37,  4,  35), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE( 1475,  1,  35), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   22,  7,  31), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   73, 16,  30), ASC_TREE_NODE(   97, 18,  31), ASC_TREE_NODE(   35, 10,  32),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE( 1999, 14,  15), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE( 2699,  3,   9), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   21,  7,   6),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   52,  0,   1),
+    ASC_TREE_NODE(   11,  8,   2), ASC_TREE_NODE(   14, 15,   3), ASC_TREE_NODE(    6,  6,   4), ASC_TREE_NODE(   22,  7,   5),
+    ASC_TREE_NODE(    4,  6,   6), ASC_TREE_NODE(   32, 16,   7), ASC_TREE_NODE(   21, 18,   8), ASC_TREE_NODE( 1563, 14,   9),
+    ASC_TREE_NODE(   28, 18,  10), ASC_TREE_NODE(  297,  1,  11), ASC_TREE_NODE(    7, 15,  12), ASC_TREE_NODE(   54, 17,  13),
+    ASC_TREE_NODE(   29, 15,  14), ASC_TREE_NODE(   10,  6,  15), ASC_TREE_NODE(  263,  1,  16), ASC_TREE_NODE(   25,  2,  17),
+    ASC_TREE_NODE(   13,  6,  18), ASC_TREE_NODE(   16,  6,  19), ASC_TREE_NODE(   18,  8,  20), ASC_TREE_NODE(   14, 15,  21),
+    ASC_TREE_NODE(   25, 18,  22), ASC_TREE_NODE( 2190,  3,  23), ASC_TREE_NODE(  -43,  6,  24), ASC_TREE_NODE(   16,  4,  25),
+    ASC_TREE_NODE(    5,  8,  26), ASC_TREE_NODE(   55,  1,  27), ASC_TREE_NODE(   73,  0,  28), ASC_TREE_NODE(   34,  7,  29),
+    ASC_TREE_NODE( 2011,  3,  30), ASC_TREE_NODE(   73,  0,  31), ASC_TREE_NODE(    7,  1,  32), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  221, 17,  31), ASC_TREE_NODE(   66, 17,  32), ASC_TREE_NODE(   56, 10,  33),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE( 4506, 14,  33), ASC_TREE_NODE(  453,  3,  34), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(   26, 17,  34), ASC_TREE_NODE( -112,  0,  35), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   23,  8,  35),
+    ASC_TREE_NODE( 1626, 14,  36), ASC_TREE_NODE(   17,  6,  37), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   34,  4,  37),
+    ASC_TREE_NODE(    6,  8,  38), ASC_TREE_NODE(   41, 17,  39), ASC_TREE_NODE(    4,  5,  40), ASC_TREE_NODE(   19,  1,  41),
+    ASC_TREE_NODE(   38, 18,  42), ASC_TREE_NODE(   36,  7,  43), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   11,  7,  43),
+    ASC_TREE_NODE(    4, 16,  44), ASC_TREE_NODE(   48,  4,  45), ASC_TREE_NODE(   92, 18,  46), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(  123, 17,  46), ASC_TREE_NODE(   25, 15,  47), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    9,  2,  47),
+    ASC_TREE_NODE(  259,  9,  48), ASC_TREE_NODE(    5,  8,  49), ASC_TREE_NODE(  149,  2,  50), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE( 1967,  3,  49), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    9,  5,  46), ASC_TREE_NODE(  228, 18,  47),
+    ASC_TREE_NODE( 1352, 14,  48), ASC_TREE_NODE(  161,  9,  49), ASC_TREE_NODE(   64, 17,  50), ASC_TREE_NODE(  142,  8,  51),
+    ASC_TREE_NODE(  104, 17,  52), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  111, 10,  51),
+    ASC_TREE_NODE(   28, 17,  52), ASC_TREE_NODE(   99,  1,  53), ASC_TREE_NODE(    2,  6,  54), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    6, 19,  54), ASC_TREE_NODE( 1426,  2,  55), ASC_TREE_NODE(   23,  4,  56), ASC_TREE_NODE(    2,  8,  57),
+    ASC_TREE_NODE(   16,  4,  58), ASC_TREE_NODE(  103, 16,  59), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   11,  7,  59),
+    ASC_TREE_NODE(  681, 14,  60), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   82,  0,  60), ASC_TREE_NODE(   35,  9,  61),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  110, 17,  61), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   40, 15,  61),
+    ASC_TREE_NODE(   74, 17,  62), ASC_TREE_NODE(  947, 14,  63), ASC_TREE_NODE(  102, 18,  64), ASC_TREE_NODE(   40,  4,  65),
+    ASC_TREE_NODE(   29,  7,  66), ASC_TREE_NODE(  271,  2,  67), ASC_TREE_NODE(    2, 16,  68), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(  224,  2,  68), ASC_TREE_NODE(   46, 17,  69), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  232, 18,  69),
+    ASC_TREE_NODE(   12,  5,  70), ASC_TREE_NODE(   15,  4,  71), ASC_TREE_NODE(   62, 10,  72), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    4,  7,  69),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    8,  7,  68), ASC_TREE_NODE(  206,  2,  69),
+    ASC_TREE_NODE(  987,  3,  70), ASC_TREE_NODE(   13, 19,  71), ASC_TREE_NODE(  133,  3,  72), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(   11,  6,  72), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   35,  4,  71),
+    ASC_TREE_NODE(  -10,  6,  72), ASC_TREE_NODE(   30, 16,  73), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 15,  73),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    9, 14,  73), ASC_TREE_NODE(   11,  8,  74), ASC_TREE_NODE(  106,  2,  75),
+    ASC_TREE_NODE(   76, 17,  76), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   31,  4,  73), ASC_TREE_NODE(   17,  8,  74), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(   42, 18,  74), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   17,  1,  74), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(   43,  4,  74), ASC_TREE_NODE(  510,  2,  75), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(   28,  8,  74), ASC_TREE_NODE(   17, 15,  75), ASC_TREE_NODE(   15,  6,  76), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   14,  5,  75), ASC_TREE_NODE(   -1,  6,  76), ASC_TREE_NODE(    9,  6,  77),
+    ASC_TREE_NODE(   11, 19,  78), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   18, 10,  78), ASC_TREE_NODE(   60,  0,  79),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   38,  7,  79), ASC_TREE_NODE(   20,  8,  80), ASC_TREE_NODE(  121,  2,  81),
+    ASC_TREE_NODE(   80,  0,  82), ASC_TREE_NODE(   54, 16,  83), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    6,  8,  81), ASC_TREE_NODE(   15, 19,  82), ASC_TREE_NODE(    5, 12,  83),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  623,  2,  79), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    7,  7,  76), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(  423, 14,  76), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  344,  2,  72), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(  402,  2,  72), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    5,  1,  69), ASC_TREE_NODE(   29, 16,  70), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE( 1561, 11,  70), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   12, 11,  70), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(   14,  7,  66), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(   38, 17,  64), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  840, 11,  64), ASC_TREE_NODE(   83,  0,  65),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  210,  3,  65), ASC_TREE_NODE(   34,  4,  66), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE( 1931,  3,  65), ASC_TREE_NODE(  368,  3,  66), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   22,  7,  65), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   70,  9,  65),
+    ASC_TREE_NODE(  116, 17,  66), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   11,  7,  66), ASC_TREE_NODE(   35, 16,  67),
+    ASC_TREE_NODE(    5,  8,  68), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  111, 16,  68), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(  324,  3,  68), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   90, 17,  63),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   90,  2,  62), ASC_TREE_NODE(  -17,  9,  63),
+    ASC_TREE_NODE(  214,  0,  64), ASC_TREE_NODE(   27, 15,  65), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  225,  2,  65),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   34, 19,  64), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE( 1755,  3,  60), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(   57, 19,  58), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   13,  4,  57),
+    ASC_TREE_NODE(  130,  8,  58), ASC_TREE_NODE(    2, 15,  59), ASC_TREE_NODE(   33,  7,  60), ASC_TREE_NODE(  516,  2,  61),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   15,  8,  59),
+    ASC_TREE_NODE(   30, 17,  60), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   15,  4,  59),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    8,  6,  56), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(   15,  9,  54), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   75, 17,  54), ASC_TREE_NODE(    8,  5,  55),
+    ASC_TREE_NODE(   57,  8,  56), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE( 1540, 14,  55),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   97,  9,  53),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   27, 15,  53), ASC_TREE_NODE(   24, 15,  54), ASC_TREE_NODE(   17,  7,  55),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE( 1134, 14,  54), ASC_TREE_NODE(   86, 18,  55),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  635, 14,  55), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE( 3455, 14,  54), ASC_TREE_NODE(  509,  2,  55), ASC_TREE_NODE(   58,  4,  56), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(  531,  3,  56), ASC_TREE_NODE(   16,  9,  57), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    3,  7,  52), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  870, 11,  49), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(   37, 17,  48), ASC_TREE_NODE(  144, 17,  49), ASC_TREE_NODE(  517,  1,  50), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    8,  7,  50), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(   57, 16,  48), ASC_TREE_NODE(   30,  4,  49), ASC_TREE_NODE(   22, 16,  50), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  146,  2,  49), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE( 1345, 14,  49),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(  108,  0,  46), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  196,  3,  45),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  561, 14,  45), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE( 3594, 14,  43), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE( 2888, 14,  43),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   21,  8,  39), ASC_TREE_NODE(  270,  0,  40), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  278,  3,  37),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  765,  3,  25), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1,  5,  23), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   95, 10,  23),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE( 7548, 11,  23), ASC_TREE_NODE(   48, 10,  24), ASC_TREE_NODE(   20,  7,  25),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  516,  0,  17), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   14,  6,  10), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   10,  7,   7),
+    ASC_TREE_NODE(  -11,  9,   8), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE( 1055,  2,   7),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  473,  3,   5),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   37, 18,   5), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE( 1557,  3,   5),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  339,  3,   4), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    7,  6,   1), ASC_TREE_NODE(    8, 15,   2), ASC_TREE_NODE(   55,  0,   3), ASC_TREE_NODE(  252,  2,   4),
+    ASC_TREE_NODE(   59,  0,   5), ASC_TREE_NODE(   16,  6,   6), ASC_TREE_NODE(   69,  9,   7), ASC_TREE_NODE(   20, 17,   8),
+    ASC_TREE_NODE(   32,  7,   9), ASC_TREE_NODE(   82, 16,  10), ASC_TREE_NODE(   62, 17,  11), ASC_TREE_NODE(  130,  2,  12),
+    ASC_TREE_NODE(   13, 19,  13), ASC_TREE_NODE(   39, 16,  14), ASC_TREE_NODE(   26, 15,  15), ASC_TREE_NODE(    4,  9,  16),
+    ASC_TREE_NODE( 4482,  1,  17), ASC_TREE_NODE(    2,  8,  18), ASC_TREE_NODE(  116, 18,  19), ASC_TREE_NODE(   33,  0,  20),
+    ASC_TREE_NODE(   56, 18,  21), ASC_TREE_NODE(   42, 17,  22), ASC_TREE_NODE(   24, 15,  23), ASC_TREE_NODE(   69, 17,  24),
+    ASC_TREE_NODE(    8,  8,  25), ASC_TREE_NODE(  217,  3,  26), ASC_TREE_NODE( 3893, 14,  27), ASC_TREE_NODE(  673, 11,  28),
+    ASC_TREE_NODE(  139, 18,  29), ASC_TREE_NODE( 2150, 11,  30), ASC_TREE_NODE(    3, 16,  31), ASC_TREE_NODE(    3,  5,  32),
+    ASC_TREE_NODE( 1040, 11,  33), ASC_TREE_NODE(  106, 16,  34), ASC_TREE_NODE(   -1, 15,  35), ASC_TREE_NODE(   18, 18,  36),
+    ASC_TREE_NODE(   38, 17,  37), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(   51, 10,  35), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   42,  8,  35), ASC_TREE_NODE(   53, 18,  36),
+    ASC_TREE_NODE(   22, 10,  37), ASC_TREE_NODE(  106,  3,  38), ASC_TREE_NODE(   83, 18,  39), ASC_TREE_NODE(   24, 19,  40),
+    ASC_TREE_NODE(    1, 14,  41), ASC_TREE_NODE(    5,  5,  42), ASC_TREE_NODE(   36,  9,  43), ASC_TREE_NODE(    4,  5,  44),
+    ASC_TREE_NODE(   44,  2,  45), ASC_TREE_NODE(   30,  6,  46), ASC_TREE_NODE( 4866,  3,  47), ASC_TREE_NODE(   15,  9,  48),
+    ASC_TREE_NODE(    4,  5,  49), ASC_TREE_NODE(   12, 15,  50), ASC_TREE_NODE(   26,  9,  51), ASC_TREE_NODE(  111,  0,  52),
+    ASC_TREE_NODE(   17, 15,  53), ASC_TREE_NODE( 8601,  3,  54), ASC_TREE_NODE(   82, 10,  55), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(   18, 18,  55), ASC_TREE_NODE(  326, 11,  56), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   40,  2,  56),
+    ASC_TREE_NODE(  226, 18,  57), ASC_TREE_NODE(   34,  5,  58), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  215,  3,  58),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   10,  9,  58), ASC_TREE_NODE(   13,  7,  59), ASC_TREE_NODE(   36, 17,  60),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  753, 14,  59), ASC_TREE_NODE(  360, 11,  60),
+    ASC_TREE_NODE(    6,  5,  61), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   68,  9,  61), ASC_TREE_NODE(    4,  5,  62),
+    ASC_TREE_NODE(   21, 15,  63), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  291,  2,  63), ASC_TREE_NODE(   15, 15,  64),
+    ASC_TREE_NODE( 1889, 14,  65), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  157,  3,  64),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   99, 17,  63), ASC_TREE_NODE(   46, 14,  64),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE( 1439,  3,  64), ASC_TREE_NODE(   76, 17,  65), ASC_TREE_NODE(   92, 10,  66),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   18, 19,  66), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   11,  7,  66),
+    ASC_TREE_NODE(  106,  0,  67), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  652, 14,  67), ASC_TREE_NODE(   59, 18,  68),
+    ASC_TREE_NODE(   39,  4,  69), ASC_TREE_NODE(   68,  3,  70), ASC_TREE_NODE(  149, 17,  71), ASC_TREE_NODE(   98,  9,  72),
+    ASC_TREE_NODE(  102, 17,  73), ASC_TREE_NODE(   36,  8,  74), ASC_TREE_NODE(   17,  8,  75), ASC_TREE_NODE( 1090,  3,  76),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  121, 16,  76), ASC_TREE_NODE(  218,  9,  77), ASC_TREE_NODE( 1027,  3,  78),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  129,  8,  76),
+    ASC_TREE_NODE(   28, 17,  77), ASC_TREE_NODE(  108,  0,  78), ASC_TREE_NODE(  135,  2,  79), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1,  6,  76),
+    ASC_TREE_NODE(   30, 17,  77), ASC_TREE_NODE(  132,  8,  78), ASC_TREE_NODE(   50, 10,  79), ASC_TREE_NODE(  574,  3,  80),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(   35,  1,  77), ASC_TREE_NODE(   20,  8,  78), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   82,  3,  78),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   65, 17,  78), ASC_TREE_NODE(    1, 19,  79), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(   23,  7,  79), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   36,  8,  78),
+    ASC_TREE_NODE(   21,  0,  79), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  574, 14,  76), ASC_TREE_NODE(   56,  8,  77), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   28,  8,  74),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE( 2268, 14,  74), ASC_TREE_NODE(  592,  3,  75), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  299, 11,  74), ASC_TREE_NODE(    7, 16,  75), ASC_TREE_NODE(  154, 17,  76),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   63,  1,  76), ASC_TREE_NODE( 5818,  3,  77), ASC_TREE_NODE(  239,  3,  78),
+    ASC_TREE_NODE(   38,  9,  79), ASC_TREE_NODE(  847,  0,  80), ASC_TREE_NODE(   45,  9,  81), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   51,  7,  80), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  664, 14,  80),
+    ASC_TREE_NODE(   21, 10,  81), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  113, 17,  81), ASC_TREE_NODE(   27,  4,  82),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  137, 17,  82), ASC_TREE_NODE(   64, 17,  83), ASC_TREE_NODE(  520,  3,  84),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   73,  0,  84), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  920, 14,  84),
+    ASC_TREE_NODE(   74, 18,  85), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   21, 17,  84),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    4,  7,  84), ASC_TREE_NODE(   37, 19,  85), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    5, 15,  85), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    7,  5,  84),
+    ASC_TREE_NODE(   61, 10,  85), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  498,  3,  85), ASC_TREE_NODE(  228, 18,  86),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   85,  8,  86), ASC_TREE_NODE(   78, 10,  87), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   94,  0,  86), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    9,  7,  85), ASC_TREE_NODE(    5,  6,  86), ASC_TREE_NODE(   50, 17,  87), ASC_TREE_NODE(   51,  3,  88),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   49, 14,  83), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    8, 19,  83), ASC_TREE_NODE(    8,  5,  84), ASC_TREE_NODE(   22, 10,  85), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE( 1080,  3,  85), ASC_TREE_NODE(   40, 16,  86), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    4,  9,  79), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  348,  3,  78), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  455, 14,  75), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   40, 16,  74), ASC_TREE_NODE( 1145,  2,  75), ASC_TREE_NODE(  134,  0,  76),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  375, 14,  74),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   13,  7,  74), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   10,  8,  72), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  830,  9,  69), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   73,  2,  68), ASC_TREE_NODE(  781,  0,  69), ASC_TREE_NODE(    5,  5,  70),
+    ASC_TREE_NODE(   43, 15,  71), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   75, 18,  71), ASC_TREE_NODE(    5,  4,  72),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   31,  9,  72), ASC_TREE_NODE(   42,  9,  73), ASC_TREE_NODE(  100,  0,  74),
+    ASC_TREE_NODE(    4,  7,  75), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   15,  4,  74),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   24, 17,  74), ASC_TREE_NODE( 1197,  2,  75), ASC_TREE_NODE(   34, 17,  76),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  226, 17,  75), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  860, 14,  74), ASC_TREE_NODE(    1,  3,  75), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(  390,  3,  75), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  -10,  9,  75), ASC_TREE_NODE(   62,  3,  76),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  462, 14,  76), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(   31,  4,  71), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(   94, 17,  69), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(  161, 14,  67), ASC_TREE_NODE(   17,  4,  68), ASC_TREE_NODE(  205, 14,  69), ASC_TREE_NODE(   24,  7,  70),
+    ASC_TREE_NODE(   37, 15,  71), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE( 1571, 11,  71), ASC_TREE_NODE(   30,  4,  72),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(  305,  2,  69), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE( 1324, 14,  64),
+    ASC_TREE_NODE(   26,  4,  65), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   93, 17,  65), ASC_TREE_NODE(   28, 10,  66),
+    ASC_TREE_NODE(   71, 10,  67), ASC_TREE_NODE( 1707,  3,  68), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE( 1020,  3,  68),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  130,  2,  67), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1,  4,  65), ASC_TREE_NODE(   24, 17,  66),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  101,  0,  65), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   16,  4,  63), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    5,  7,  62), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1,  3,  60), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   55, 17,  60),
+    ASC_TREE_NODE(   58,  4,  61), ASC_TREE_NODE(   41,  4,  62), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   29,  1,  56), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  114, 10,  49), ASC_TREE_NODE(   37, 18,  50),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   -1,  9,  41), ASC_TREE_NODE(   93, 10,  42),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE( 8571,  3,  39), ASC_TREE_NODE(   27, 10,  40), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(   10, 19,  39), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE( 2476,  3,  36), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  295,  3,  32),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   33, 10,  31), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(   89, 14,  31), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    9,  5,  29), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  323,  3,  26), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(   36, 14,  25), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  105,  3,  25), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    8,  5,  25), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   20, 15,  25), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    7,  5,  23), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  145, 14,  20),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE( 1653,  2,  20), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   35,  4,  18), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(  204,  3,  13), ASC_TREE_NODE(  110, 11,  14), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  425,  2,   6),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(  314,  2,   3), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   65,  0,   1), ASC_TREE_NODE(   13, 15,   2), ASC_TREE_NODE(   13, 15,   3),
+    ASC_TREE_NODE(   22,  8,   4), ASC_TREE_NODE(   13,  6,   5), ASC_TREE_NODE(    8, 15,   6), ASC_TREE_NODE(   66,  9,   7),
+    ASC_TREE_NODE(   24, 18,   8), ASC_TREE_NODE(  767,  1,   9), ASC_TREE_NODE(   56,  2,  10), ASC_TREE_NODE(  483,  1,  11),
+    ASC_TREE_NODE(   32,  7,  12), ASC_TREE_NODE(   42, 17,  13), ASC_TREE_NODE(   66, 17,  14), ASC_TREE_NODE(   12,  6,  15),
+    ASC_TREE_NODE(   12,  5,  16), ASC_TREE_NODE(   55,  2,  17), ASC_TREE_NODE(   25, 18,  18), ASC_TREE_NODE(   92, 16,  19),
+    ASC_TREE_NODE(  180, 14,  20), ASC_TREE_NODE(   62, 16,  21), ASC_TREE_NODE(   84, 10,  22), ASC_TREE_NODE( 3040, 14,  23),
+    ASC_TREE_NODE(   30, 17,  24), ASC_TREE_NODE(  830,  3,  25), ASC_TREE_NODE(   10,  8,  26), ASC_TREE_NODE(   80, 18,  27),
+    ASC_TREE_NODE(   17, 16,  28), ASC_TREE_NODE(  728, 14,  29), ASC_TREE_NODE( 1258,  3,  30), ASC_TREE_NODE(   26, 16,  31),
+    ASC_TREE_NODE( 1517,  2,  32), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  230, 18,  32), ASC_TREE_NODE(   32, 19,  33),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   63,  9,  33), ASC_TREE_NODE( 4758, 11,  34), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(  158, 14,  34), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   50,  0,  34), ASC_TREE_NODE(   15,  9,  35),
+    ASC_TREE_NODE(  -44,  0,  36), ASC_TREE_NODE(   37, 18,  37), ASC_TREE_NODE(  642,  1,  38), ASC_TREE_NODE(    9,  8,  39),
+    ASC_TREE_NODE(    3,  6,  40), ASC_TREE_NODE(   93,  8,  41), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   51,  4,  41),
+    ASC_TREE_NODE(   41, 17,  42), ASC_TREE_NODE(  184, 14,  43), ASC_TREE_NODE(    3, 13,  44), ASC_TREE_NODE(  133, 17,  45),
+    ASC_TREE_NODE(   43, 17,  46), ASC_TREE_NODE(    6, 19,  47), ASC_TREE_NODE(    7,  6,  48), ASC_TREE_NODE(    5,  5,  49),
+    ASC_TREE_NODE(  824, 11,  50), ASC_TREE_NODE(  416,  0,  51), ASC_TREE_NODE(   37, 15,  52), ASC_TREE_NODE(   26, 15,  53),
+    ASC_TREE_NODE(    7,  1,  54), ASC_TREE_NODE(    1,  4,  55), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    4,  7,  55),
+    ASC_TREE_NODE(    5,  6,  56), ASC_TREE_NODE(   71, 10,  57), ASC_TREE_NODE(  226, 18,  58), ASC_TREE_NODE(  226,  2,  59),
+    ASC_TREE_NODE(   13, 19,  60), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(   61, 17,  58), ASC_TREE_NODE(    8,  5,  59), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    8,  5,  59),
+    ASC_TREE_NODE(    6, 19,  60), ASC_TREE_NODE(    9, 19,  61), ASC_TREE_NODE(    4,  0,  62), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE( 3874, 11,  62), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(12050, 14,  62), ASC_TREE_NODE(   17, 19,  63),
+    ASC_TREE_NODE(  -16,  6,  64), ASC_TREE_NODE(  181,  3,  65), ASC_TREE_NODE(    5,  5,  66), ASC_TREE_NODE(    3, 19,  67),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   25, 18,  66), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1,  5,  66), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   31,  9,  66), ASC_TREE_NODE(    7,  5,  67),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   38,  4,  67), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(   39,  4,  66), ASC_TREE_NODE(  273,  3,  67), ASC_TREE_NODE(   24, 15,  68), ASC_TREE_NODE(   14, 16,  69),
+    ASC_TREE_NODE( 1194,  3,  70), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  741,  2,  70), ASC_TREE_NODE(   33, 16,  71),
+    ASC_TREE_NODE(   60, 10,  72), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  819,  3,  72), ASC_TREE_NODE(    1, 16,  73),
+    ASC_TREE_NODE(   19,  8,  74), ASC_TREE_NODE(   65, 18,  75), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    2, 10,  75),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(  224,  2,  72), ASC_TREE_NODE(   46, 17,  73), ASC_TREE_NODE( 3912, 11,  74), ASC_TREE_NODE(   37,  4,  75),
+    ASC_TREE_NODE(   33, 18,  76), ASC_TREE_NODE(  289, 11,  77), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   95, 17,  77),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   93,  2,  76), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE( 3913, 11,  75), ASC_TREE_NODE(   95,  3,  76), ASC_TREE_NODE(   96, 18,  77),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   16,  2,  76), ASC_TREE_NODE( 2096,  3,  77),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  117, 10,  77), ASC_TREE_NODE(  133, 17,  78), ASC_TREE_NODE(   63,  4,  79),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    2, 15,  75), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(   35, 18,  74), ASC_TREE_NODE(   36,  4,  75), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(  156,  3,  74), ASC_TREE_NODE(   75, 11,  75), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   13, 19,  75),
+    ASC_TREE_NODE(   14,  4,  76), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE( 1769, 11,  75),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    9,  5,  75), ASC_TREE_NODE(    7,  6,  76), ASC_TREE_NODE(    3,  5,  77),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE( 1216, 11,  77), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(   13,  7,  76), ASC_TREE_NODE(   33,  7,  77), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  184,  9,  74), ASC_TREE_NODE(   66,  0,  75),
+    ASC_TREE_NODE(   77, 18,  76), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE( 1029,  1,  75),
+    ASC_TREE_NODE( 2996, 11,  76), ASC_TREE_NODE(  188,  1,  77), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  123, 17,  77),
+    ASC_TREE_NODE(  703,  0,  78), ASC_TREE_NODE(16399, 11,  79), ASC_TREE_NODE( 1346, 11,  80), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   22,  4,  79), ASC_TREE_NODE(   46, 16,  80), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(  101, 17,  80), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE( 3555,  3,  80), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE( 1321, 11,  80), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(   18,  7,  78), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    9,  8,  77),
+    ASC_TREE_NODE(    6,  6,  78), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE( 6043, 11,  77),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   60,  4,  77), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(   24,  7,  76), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  134,  2,  76), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(  420,  3,  72), ASC_TREE_NODE(   72,  8,  73), ASC_TREE_NODE(  268,  0,  74), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(   35, 17,  74), ASC_TREE_NODE( 1612, 11,  75), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(   30,  3,  74), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   45, 14,  73),
+    ASC_TREE_NODE(   54, 17,  74), ASC_TREE_NODE(    6,  9,  75), ASC_TREE_NODE(    9,  7,  76), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   59, 18,  74), ASC_TREE_NODE(  590, 11,  75),
+    ASC_TREE_NODE(  374, 11,  76), ASC_TREE_NODE(  164,  2,  77), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE( 1024,  3,  77),
+    ASC_TREE_NODE(  238,  3,  78), ASC_TREE_NODE(   57,  8,  79), ASC_TREE_NODE( 1076, 11,  80), ASC_TREE_NODE(  872,  3,  81),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  894,  3,  81), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  241, 14,  81),
+    ASC_TREE_NODE(  236,  2,  82), ASC_TREE_NODE(   52, 10,  83), ASC_TREE_NODE(   43, 18,  84), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE( 2190, 11,  82), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(   75, 16,  82), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   18,  6,  82), ASC_TREE_NODE( 2582, 14,  83),
+    ASC_TREE_NODE(   55, 17,  84), ASC_TREE_NODE(17009, 11,  85), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    4,  5,  85),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   52, 18,  85), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  813,  3,  85),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE( 1544,  3,  77), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  127,  1,  77),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(   17,  8,  74), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  131, 11,  70), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  119, 11,  69), ASC_TREE_NODE(   11,  7,  70), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(  999,  3,  70), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(  114, 10,  64), ASC_TREE_NODE(   50, 17,  65), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    6,  7,  64), ASC_TREE_NODE(    6,  5,  65), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   38, 18,  65),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(   21,  8,  58), ASC_TREE_NODE(   24, 14,  59), ASC_TREE_NODE(    8,  6,  60), ASC_TREE_NODE(   15,  6,  61),
+    ASC_TREE_NODE(    2,  5,  62), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   10,  7,  59), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(   25, 15,  58), ASC_TREE_NODE(   17,  7,  59), ASC_TREE_NODE(  353,  2,  60), ASC_TREE_NODE(   32, 15,  61),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   19,  6,  60), ASC_TREE_NODE( 4619, 14,  61),
+    ASC_TREE_NODE(   40,  4,  62), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE( 1324,  3,  60), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    3,  8,  56), ASC_TREE_NODE(   53,  0,  57),
+    ASC_TREE_NODE(  354,  3,  58), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   85,  3,  51), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   42, 10,  48), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   90,  3,  45),
+    ASC_TREE_NODE(   79,  3,  46), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(   29,  1,  44), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   14,  7,  41), ASC_TREE_NODE(  476, 11,  42), ASC_TREE_NODE(  616, 14,  43),
+    ASC_TREE_NODE(  127, 18,  44), ASC_TREE_NODE( 1115, 11,  45), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   74,  4,  45),
+    ASC_TREE_NODE(   36, 17,  46), ASC_TREE_NODE(   41, 18,  47), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE( 1934,  3,  47),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    8, 16,  46), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   32,  7,  45), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  214,  0,  41),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE( 1381,  3,  41), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   10,  8,  41),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  859,  3,  41), ASC_TREE_NODE(  320, 11,  42), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  188,  3,  39),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(   42,  3,  32), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   95,  0,  32), ASC_TREE_NODE(  659, 14,  33),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  498, 14,  29), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    9,  6,  28), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE( 2932, 11,  26), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(  134,  2,  24), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  478, 14,  19),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   49, 10,  17),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    3,  5,  16), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   83, 17,   7), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  161, 18,   5), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(   14, 15,   1), ASC_TREE_NODE(   82,  2,   2), ASC_TREE_NODE(   23, 15,   3), ASC_TREE_NODE(  248,  9,   4),
+    ASC_TREE_NODE(   76,  0,   5), ASC_TREE_NODE(   54,  0,   6), ASC_TREE_NODE(   48,  0,   7), ASC_TREE_NODE(   18, 17,   8),
+    ASC_TREE_NODE(   36, 18,   9), ASC_TREE_NODE(   59,  4,  10), ASC_TREE_NODE(    1,  9,  11), ASC_TREE_NODE(   68, 17,  12),
+    ASC_TREE_NODE(   25,  4,  13), ASC_TREE_NODE(   22,  6,  14), ASC_TREE_NODE(   98, 10,  15), ASC_TREE_NODE(    7,  1,  16),
+    ASC_TREE_NODE(   67,  0,  17), ASC_TREE_NODE(    1,  8,  18), ASC_TREE_NODE(   14,  0,  19), ASC_TREE_NODE(    6,  6,  20),
+    ASC_TREE_NODE( 1203, 11,  21), ASC_TREE_NODE(    8, 15,  22), ASC_TREE_NODE(   41, 18,  23), ASC_TREE_NODE(  707, 14,  24),
+    ASC_TREE_NODE(   12,  6,  25), ASC_TREE_NODE(  102, 18,  26), ASC_TREE_NODE(   65, 17,  27), ASC_TREE_NODE(  107,  2,  28),
+    ASC_TREE_NODE(  214,  1,  29), ASC_TREE_NODE(   11,  6,  30), ASC_TREE_NODE(   61, 18,  31), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(  570, 14,  31), ASC_TREE_NODE(  226, 18,  32), ASC_TREE_NODE(  302,  3,  33), ASC_TREE_NODE( 2749,  3,  34),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   80, 18,  33), ASC_TREE_NODE(   49, 18,  34),
+    ASC_TREE_NODE(    6, 15,  35), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE( 2800,  3,  35), ASC_TREE_NODE(   31, 17,  36),
+    ASC_TREE_NODE(   42, 17,  37), ASC_TREE_NODE(  113,  2,  38), ASC_TREE_NODE(   34,  7,  39), ASC_TREE_NODE(   48, 16,  40),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   46,  8,  40), ASC_TREE_NODE(  -62,  0,  41), ASC_TREE_NODE(  233,  3,  42),
+    ASC_TREE_NODE(   88, 17,  43), ASC_TREE_NODE(   58,  9,  44), ASC_TREE_NODE(    6,  6,  45), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(   59, 16,  45), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   24,  6,  45), ASC_TREE_NODE(  443,  3,  46),
+    ASC_TREE_NODE(    5,  9,  47), ASC_TREE_NODE(    2, 16,  48), ASC_TREE_NODE(   37, 15,  49), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    4,  5,  49), ASC_TREE_NODE(  229, 17,  50), ASC_TREE_NODE(  226, 17,  51), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    7,  8,  48),
+    ASC_TREE_NODE(    4,  7,  49), ASC_TREE_NODE(   16,  4,  50), ASC_TREE_NODE(   43,  4,  51), ASC_TREE_NODE(   92, 17,  52),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    6,  4,  50),
+    ASC_TREE_NODE(   61,  4,  51), ASC_TREE_NODE(   10, 15,  52), ASC_TREE_NODE( 3839,  3,  53), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    8,  8,  53), ASC_TREE_NODE(   11, 15,  54), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   16,  6,  54),
+    ASC_TREE_NODE(   76, 18,  55), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  237,  3,  55), ASC_TREE_NODE(   27,  8,  56),
+    ASC_TREE_NODE(   99, 19,  57), ASC_TREE_NODE(  135,  0,  58), ASC_TREE_NODE(   92, 10,  59), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    2,  8,  59), ASC_TREE_NODE(  154, 14,  60), ASC_TREE_NODE( 2094,  3,  61), ASC_TREE_NODE(    1, 14,  62),
+    ASC_TREE_NODE(  166,  9,  63), ASC_TREE_NODE(  468, 14,  64), ASC_TREE_NODE(    5, 19,  65), ASC_TREE_NODE(  154,  2,  66),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   74,  4,  66), ASC_TREE_NODE(  165,  2,  67), ASC_TREE_NODE(  185, 14,  68),
+    ASC_TREE_NODE(  410,  9,  69), ASC_TREE_NODE(    1,  3,  70), ASC_TREE_NODE(   61,  4,  71), ASC_TREE_NODE(   95,  0,  72),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    4,  2,  72), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE( 5571,  3,  68),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE( 2111,  3,  68), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE( 1538,  2,  68),
+    ASC_TREE_NODE(    1,  9,  69), ASC_TREE_NODE( 4482,  1,  70), ASC_TREE_NODE(   76, 17,  71), ASC_TREE_NODE(   97, 10,  72),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   26,  4,  71), ASC_TREE_NODE(   25,  7,  72),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   39, 14,  71), ASC_TREE_NODE(   11, 16,  72),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   60, 10,  72), ASC_TREE_NODE(  226, 11,  73), ASC_TREE_NODE(   48, 17,  74),
+    ASC_TREE_NODE(   86, 17,  75), ASC_TREE_NODE( 1137,  3,  76), ASC_TREE_NODE(  534,  3,  77), ASC_TREE_NODE(    8,  5,  78),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE( 1738, 14,  75), ASC_TREE_NODE(  254,  3,  76), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   83, 17,  76),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   10,  7,  76), ASC_TREE_NODE(   35, 18,  77), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   22, 15,  76), ASC_TREE_NODE(   68, 18,  77), ASC_TREE_NODE(   66, 10,  78),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   36, 16,  76),
+    ASC_TREE_NODE( 3212, 11,  77), ASC_TREE_NODE(  192, 14,  78), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(   66,  4,  77), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   24,  4,  76),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   17,  5,  75), ASC_TREE_NODE(    1,  5,  76),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   21,  8,  76), ASC_TREE_NODE(   84,  8,  77), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(   46,  7,  77), ASC_TREE_NODE(  372, 14,  78), ASC_TREE_NODE(   55,  7,  79), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE( 4606,  3,  79), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    5,  1,  74),
+    ASC_TREE_NODE(    1,  4,  75), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  257, 14,  75), ASC_TREE_NODE(   37, 17,  76),
+    ASC_TREE_NODE( 3227,  3,  77), ASC_TREE_NODE(   73, 17,  78), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  -24,  0,  78),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   56,  8,  78), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(   13,  8,  77), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   61,  3,  76),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   26, 17,  76), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    5,  7,  76),
+    ASC_TREE_NODE( 2259,  3,  77), ASC_TREE_NODE(  650, 14,  78), ASC_TREE_NODE(    5,  3,  79), ASC_TREE_NODE(   30, 16,  80),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  165,  3,  72), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    6,  7,  72),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  293,  3,  72), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(  785,  2,  71), ASC_TREE_NODE(  -11,  9,  72), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE( 1516,  3,  71), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  531,  3,  71), ASC_TREE_NODE(  674,  0,  72),
+    ASC_TREE_NODE(    7,  8,  73), ASC_TREE_NODE(  159, 17,  74), ASC_TREE_NODE(  784,  9,  75), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  198,  3,  72),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE( 1838, 11,  72), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(  114,  2,  71), ASC_TREE_NODE( 3100, 11,  72), ASC_TREE_NODE(   28, 15,  73), ASC_TREE_NODE(   55,  0,  74),
+    ASC_TREE_NODE( 3522, 11,  75), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    6, 19,  73), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    7, 16,  72),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   29, 18,  71), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(   41,  3,  71), ASC_TREE_NODE(  269,  3,  72), ASC_TREE_NODE(  747, 14,  73), ASC_TREE_NODE(   47,  3,  74),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   27, 17,  72),
+    ASC_TREE_NODE( 1696,  3,  73), ASC_TREE_NODE(  367, 14,  74), ASC_TREE_NODE(   17, 19,  75), ASC_TREE_NODE(   43,  1,  76),
+    ASC_TREE_NODE(  177,  8,  77), ASC_TREE_NODE( 1658, 14,  78), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   51, 10,  75), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    3,  6,  72),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   14,  7,  71), ASC_TREE_NODE(  427, 11,  72),
+    ASC_TREE_NODE(  101, 16,  73), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   38, 16,  69), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    4, 11,  68), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  783, 14,  65), ASC_TREE_NODE(   33,  9,  66),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   79, 10,  65), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  137, 17,  63), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   20,  7,  62), ASC_TREE_NODE(  237,  2,  63), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   77,  0,  62), ASC_TREE_NODE(  172,  0,  63), ASC_TREE_NODE(   79, 16,  64),
+    ASC_TREE_NODE(   69, 16,  65), ASC_TREE_NODE(  100, 18,  66), ASC_TREE_NODE( 3753,  3,  67), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  187,  0,  66), ASC_TREE_NODE(   34,  8,  67), ASC_TREE_NODE(  106,  8,  68),
+    ASC_TREE_NODE(  107, 17,  69), ASC_TREE_NODE(   39, 16,  70), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(   23,  4,  65), ASC_TREE_NODE(   11,  3,  66), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   23, 18,  58),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    5,  7,  54), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   35,  9,  54),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    4, 13,  53), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   94,  0,  52), ASC_TREE_NODE(   39, 17,  53), ASC_TREE_NODE(  380,  3,  54),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  182, 14,  49), ASC_TREE_NODE(    9, 19,  50),
+    ASC_TREE_NODE(   27,  7,  51), ASC_TREE_NODE(   50,  4,  52), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE( 2591, 11,  50), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   11, 19,  50),
+    ASC_TREE_NODE(   41, 16,  51), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(  114, 17,  49), ASC_TREE_NODE(   35, 18,  50), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE( 3532, 14,  49), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  847,  9,  49), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(  114, 10,  49), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  151,  2,  49), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  422,  3,  48), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1,  4,  48),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    2,  6,  47), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   18,  4,  41), ASC_TREE_NODE(  518, 14,  42),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   30, 14,  42), ASC_TREE_NODE(   42, 17,  43), ASC_TREE_NODE(   52, 18,  44),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(   86, 10,  41), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE( 1344,  3,  41), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  464,  3,  36), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  298,  3,  36),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(   56, 17,  33), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE( 4489,  3,  32),
+    ASC_TREE_NODE( 9666,  3,  33), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   37,  4,  32),
+    ASC_TREE_NODE(   51, 18,  33), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE( 1253, 11,  25), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  956,  3,  23), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   47,  1,  21), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  532, 11,  18),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   50,  4,  17), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  146, 17,  15), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   33,  7,  13), ASC_TREE_NODE(  101, 18,  14),
+    ASC_TREE_NODE(  552, 14,  15), ASC_TREE_NODE(   23,  9,  16), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   27,  4,  16),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    5,  5,  15), ASC_TREE_NODE(   45, 18,  16),
+    ASC_TREE_NODE(   38, 15,  17), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(10400,  3,  17), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  179,  3,  12), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   29,  7,   8),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   99, 17,   7), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   33, 10,   6), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(   47,  4,   5), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    7,  6,   1),
+    ASC_TREE_NODE(  100,  2,   2), ASC_TREE_NODE(   58,  0,   3), ASC_TREE_NODE(   20, 17,   4), ASC_TREE_NODE(    8, 15,   5),
+    ASC_TREE_NODE(   34,  4,   6), ASC_TREE_NODE(   30, 16,   7), ASC_TREE_NODE(    7,  9,   8), ASC_TREE_NODE(   62,  0,   9),
+    ASC_TREE_NODE(   23,  8,  10), ASC_TREE_NODE(   94,  0,  11), ASC_TREE_NODE(   34, 18,  12), ASC_TREE_NODE(   20, 15,  13),
+    ASC_TREE_NODE(   21, 15,  14), ASC_TREE_NODE(    2,  9,  15), ASC_TREE_NODE(    3,  5,  16), ASC_TREE_NODE(   25, 10,  17),
+    ASC_TREE_NODE(  111, 19,  18), ASC_TREE_NODE(    9, 15,  19), ASC_TREE_NODE(   38, 17,  20), ASC_TREE_NODE(   31,  7,  21),
+    ASC_TREE_NODE(   40, 17,  22), ASC_TREE_NODE(   53, 17,  23), ASC_TREE_NODE(  108,  1,  24), ASC_TREE_NODE(  929, 14,  25),
+    ASC_TREE_NODE(   24,  6,  26), ASC_TREE_NODE(  103, 17,  27), ASC_TREE_NODE(   34, 18,  28), ASC_TREE_NODE(  123,  9,  29),
+    ASC_TREE_NODE(  119, 17,  30), ASC_TREE_NODE(   18, 15,  31), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    9,  2,  31),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  228, 18,  30), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   77, 17,  29), ASC_TREE_NODE(  223,  0,  30), ASC_TREE_NODE(  254,  9,  31),
+    ASC_TREE_NODE(  128, 10,  32), ASC_TREE_NODE(  137, 18,  33), ASC_TREE_NODE(  173,  2,  34), ASC_TREE_NODE(   61, 10,  35),
+    ASC_TREE_NODE(    8,  8,  36), ASC_TREE_NODE(   41,  9,  37), ASC_TREE_NODE(  102,  8,  38), ASC_TREE_NODE(    6,  5,  39),
+    ASC_TREE_NODE(   94,  1,  40), ASC_TREE_NODE(   16,  6,  41), ASC_TREE_NODE(   40, 18,  42), ASC_TREE_NODE(   99, 18,  43),
+    ASC_TREE_NODE(  226,  2,  44), ASC_TREE_NODE(   35, 15,  45), ASC_TREE_NODE(  438,  2,  46), ASC_TREE_NODE(  170, 11,  47),
+    ASC_TREE_NODE(   22,  7,  48), ASC_TREE_NODE(    3, 16,  49), ASC_TREE_NODE(   69,  4,  50), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(   57, 17,  50), ASC_TREE_NODE(   39,  8,  51), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE( 1076,  9,  50), ASC_TREE_NODE(  224, 17,  51), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(   12,  9,  50), ASC_TREE_NODE(    5,  5,  51), ASC_TREE_NODE(   34,  4,  52), ASC_TREE_NODE(   55, 18,  53),
+    ASC_TREE_NODE(   91,  8,  54), ASC_TREE_NODE(   84, 11,  55), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE( 7069,  3,  55),
+    ASC_TREE_NODE(   37, 18,  56), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   11, 15,  56), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(   35, 18,  56), ASC_TREE_NODE(   14, 15,  57), ASC_TREE_NODE(  467,  0,  58), ASC_TREE_NODE(  488,  3,  59),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(   40, 16,  56), ASC_TREE_NODE(   10,  6,  57), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   17,  7,  57),
+    ASC_TREE_NODE(  708, 14,  58), ASC_TREE_NODE(   76, 17,  59), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(   63,  1,  58), ASC_TREE_NODE(   54,  4,  59), ASC_TREE_NODE(   -4,  9,  60), ASC_TREE_NODE(  -36,  0,  61),
+    ASC_TREE_NODE(  681,  3,  62), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   12,  7,  62), ASC_TREE_NODE(  369,  9,  63),
+    ASC_TREE_NODE(    5, 16,  64), ASC_TREE_NODE(  152, 17,  65), ASC_TREE_NODE(  104,  8,  66), ASC_TREE_NODE(  105, 10,  67),
+    ASC_TREE_NODE(   48, 16,  68), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   25, 18,  68), ASC_TREE_NODE(    4,  8,  69),
+    ASC_TREE_NODE(   11,  6,  70), ASC_TREE_NODE(  162, 18,  71), ASC_TREE_NODE(  228, 17,  72), ASC_TREE_NODE(   80, 18,  73),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    8,  7,  72), ASC_TREE_NODE(   32, 18,  73),
+    ASC_TREE_NODE(   43, 10,  74), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   16,  7,  74), ASC_TREE_NODE(   53,  0,  75),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   24,  5,  74), ASC_TREE_NODE(   15,  7,  75),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   59,  3,  71), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   18, 10,  71),
+    ASC_TREE_NODE(   30, 17,  72), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   40, 17,  72), ASC_TREE_NODE(   27,  4,  73),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   26,  4,  73), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   23, 15,  73),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   69, 17,  73), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   31,  4,  73),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   65, 17,  73), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE( -166,  0,  72), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   15,  7,  71),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE( 1894,  3,  71), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE( 8909,  3,  71),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   21, 19,  71), ASC_TREE_NODE(    1,  1,  72), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    6,  5,  71), ASC_TREE_NODE(  423, 11,  72), ASC_TREE_NODE(   18, 15,  73),
+    ASC_TREE_NODE(    1,  3,  74), ASC_TREE_NODE(  857, 14,  75), ASC_TREE_NODE(  787,  3,  76), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE( 1565, 14,  75), ASC_TREE_NODE( 1024, 14,  76), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   54, 10,  75), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  262,  3,  75),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   34, 19,  75), ASC_TREE_NODE( 2902, 11,  76), ASC_TREE_NODE(   41, 15,  77),
+    ASC_TREE_NODE(    4,  5,  78), ASC_TREE_NODE(  529, 14,  79), ASC_TREE_NODE(   43,  0,  80), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE( 6844, 11,  80), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE( 1517,  2,  80), ASC_TREE_NODE(   72, 16,  81),
+    ASC_TREE_NODE(  483,  3,  82), ASC_TREE_NODE(   79, 16,  83), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE( 1022,  2,  83),
+    ASC_TREE_NODE(  257,  3,  84), ASC_TREE_NODE( 3219,  1,  85), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   15,  7,  85),
+    ASC_TREE_NODE(    7, 15,  86), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  136, 18,  85),
+    ASC_TREE_NODE(   30,  3,  86), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   36, 11,  85),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  150,  0,  84), ASC_TREE_NODE(   21,  8,  85),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   45, 17,  85), ASC_TREE_NODE(   57, 14,  86), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(  517,  0,  86), ASC_TREE_NODE(   19, 19,  87), ASC_TREE_NODE(   72, 10,  88), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  601, 14,  87), ASC_TREE_NODE(   29,  4,  88), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   44,  8,  85),
+    ASC_TREE_NODE( 1642, 14,  86), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE( 9790,  3,  85),
+    ASC_TREE_NODE(  281, 14,  86), ASC_TREE_NODE(   46,  2,  87), ASC_TREE_NODE(   52, 11,  88), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(  311,  2,  88), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  222, 14,  88), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   48, 18,  87), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1,  5,  86), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  174,  0,  86), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    7,  5,  84), ASC_TREE_NODE(  636,  9,  85),
+    ASC_TREE_NODE(   37,  7,  86), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   35, 16,  85),
+    ASC_TREE_NODE(   13, 15,  86), ASC_TREE_NODE( 6129,  3,  87), ASC_TREE_NODE(  161,  0,  88), ASC_TREE_NODE(   69, 18,  89),
+    ASC_TREE_NODE(   33,  7,  90), ASC_TREE_NODE( 1241,  2,  91), ASC_TREE_NODE(    3,  5,  92), ASC_TREE_NODE(   36, 15,  93),
+    ASC_TREE_NODE(  226, 14,  94), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  247,  9,  93),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    5,  8,  92), ASC_TREE_NODE(    3,  3,  93),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(  256,  3,  86), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   47, 18,  86), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  227,  2,  85), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   35, 17,  85),
+    ASC_TREE_NODE( 1028,  3,  86), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    8, 14,  84), ASC_TREE_NODE(   22,  4,  85), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   10,  7,  83), ASC_TREE_NODE(    2,  3,  84), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   68, 17,  82), ASC_TREE_NODE( 2260, 11,  83),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   41,  0,  82), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   58,  8,  77), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  112, 10,  67), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  280,  2,  61), ASC_TREE_NODE(  174,  2,  62), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(   31,  7,  62), ASC_TREE_NODE(  134,  2,  63), ASC_TREE_NODE(  169, 14,  64), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE( 1227,  3,  63), ASC_TREE_NODE(   84, 10,  64), ASC_TREE_NODE(   32,  4,  65),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    9,  7,  64), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   73, 16,  63), ASC_TREE_NODE(   80,  0,  64), ASC_TREE_NODE(   26, 19,  65),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   26,  7,  65), ASC_TREE_NODE(   74,  3,  66), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(   28,  7,  66), ASC_TREE_NODE(   86,  4,  67), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE( 2984, 11,  65), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   24, 17,  65),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    4,  6,  64), ASC_TREE_NODE(    2, 19,  65),
+    ASC_TREE_NODE(   59, 17,  66), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE( 1887,  3,  66), ASC_TREE_NODE(   35,  4,  67),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  221,  3,  62), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  140, 18,  59),
+    ASC_TREE_NODE(    7,  5,  60), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  210, 14,  57), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   35, 18,  53),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE( 1774, 14,  51),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  458,  2,  50), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE( 1446,  3,  49), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    8, 19,  48), ASC_TREE_NODE(  142,  0,  49), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   97, 18,  49),
+    ASC_TREE_NODE(   85, 10,  50), ASC_TREE_NODE( 3933, 11,  51), ASC_TREE_NODE(   78, 10,  52), ASC_TREE_NODE(   19,  7,  53),
+    ASC_TREE_NODE(   54,  4,  54), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE( 2633,  3,  50), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(   56, 11,  46), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 10,  46), ASC_TREE_NODE(    3,  8,  47),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   16, 19,  41),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  724,  3,  37), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   24,  7,  35), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(  137, 14,  30), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  307,  3,  29),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   34,  4,  29), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   18, 19,  26), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   20,  8,  25), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   91, 17,  25),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(  673,  2,  22), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   46, 17,  22), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  445,  1,  21), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   37,  7,  19), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE( 3197, 11,  17), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(   21,  5,  16), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   19,  6,  15),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  622,  1,  15), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  757,  2,  15),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(   29, 15,   8), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   60, 10,   8), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    3,  7,   6), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE( 1274,  3,   5), ASC_TREE_NODE(   97, 16,   6), ASC_TREE_NODE(   81, 10,   7),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE( 2228,  3,   3), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   58,  4,   3),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(   13, 15,   1), ASC_TREE_NODE(  125,  2,   2), ASC_TREE_NODE(   65,  0,   3), ASC_TREE_NODE(   31,  0,   4),
+    ASC_TREE_NODE(    4,  6,   5), ASC_TREE_NODE(   16,  7,   6), ASC_TREE_NODE(   22, 15,   7), ASC_TREE_NODE(   24, 18,   8),
+    ASC_TREE_NODE(   44, 17,   9), ASC_TREE_NODE(   -1,  9,  10), ASC_TREE_NODE(    8, 12,  11), ASC_TREE_NODE(   62, 18,  12),
+    ASC_TREE_NODE(   21,  6,  13), ASC_TREE_NODE(   70, 17,  14), ASC_TREE_NODE(   26, 16,  15), ASC_TREE_NODE(    2, 15,  16),
+    ASC_TREE_NODE( 1513,  9,  17), ASC_TREE_NODE(    9, 15,  18), ASC_TREE_NODE(   32, 19,  19), ASC_TREE_NODE(   -8, 15,  20),
+    ASC_TREE_NODE(   12, 19,  21), ASC_TREE_NODE(    1,  9,  22), ASC_TREE_NODE(    8,  8,  23), ASC_TREE_NODE(    2,  5,  24),
+    ASC_TREE_NODE(  435, 14,  25), ASC_TREE_NODE(   23, 15,  26), ASC_TREE_NODE(  275,  1,  27), ASC_TREE_NODE(   41, 17,  28),
+    ASC_TREE_NODE(    7,  6,  29), ASC_TREE_NODE(  157,  9,  30), ASC_TREE_NODE(  306,  1,  31), ASC_TREE_NODE(   18, 18,  32),
+    ASC_TREE_NODE(  282, 14,  33), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE( 2808,  3,  33), ASC_TREE_NODE(  418,  1,  34),
+    ASC_TREE_NODE(  114,  2,  35), ASC_TREE_NODE(    9, 14,  36), ASC_TREE_NODE( 3730, 14,  37), ASC_TREE_NODE(  155,  8,  38),
+    ASC_TREE_NODE(  115,  3,  39), ASC_TREE_NODE(   98,  8,  40), ASC_TREE_NODE(   23,  8,  41), ASC_TREE_NODE(   96,  3,  42),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   48, 18,  42), ASC_TREE_NODE(  100,  0,  43), ASC_TREE_NODE(   14,  7,  44),
+    ASC_TREE_NODE(   33, 17,  45), ASC_TREE_NODE(   78, 16,  46), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE( 1588,  3,  46),
+    ASC_TREE_NODE(   34, 16,  47), ASC_TREE_NODE(   60, 17,  48), ASC_TREE_NODE(   25, 19,  49), ASC_TREE_NODE(    6,  7,  50),
+    ASC_TREE_NODE(   17, 15,  51), ASC_TREE_NODE(   19,  4,  52), ASC_TREE_NODE(  143, 18,  53), ASC_TREE_NODE(  165,  0,  54),
+    ASC_TREE_NODE(  125, 10,  55), ASC_TREE_NODE(   92, 17,  56), ASC_TREE_NODE(   16,  6,  57), ASC_TREE_NODE(    7,  1,  58),
+    ASC_TREE_NODE(    1,  3,  59), ASC_TREE_NODE(    9,  4,  60), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(   73, 19,  59), ASC_TREE_NODE(   27, 14,  60), ASC_TREE_NODE(   13,  4,  61), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    9,  7,  60), ASC_TREE_NODE(  102,  0,  61), ASC_TREE_NODE( 2366, 14,  62),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    6,  5,  60),
+    ASC_TREE_NODE(   15,  7,  61), ASC_TREE_NODE(   42, 17,  62), ASC_TREE_NODE(   23,  3,  63), ASC_TREE_NODE(   46, 17,  64),
+    ASC_TREE_NODE(   56,  4,  65), ASC_TREE_NODE(   97, 18,  66), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   96,  0,  66),
+    ASC_TREE_NODE(   28,  4,  67), ASC_TREE_NODE(    1, 16,  68), ASC_TREE_NODE(   23,  1,  69), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  261,  3,  68), ASC_TREE_NODE(   14,  7,  69), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(   15,  7,  69), ASC_TREE_NODE(  123,  9,  70), ASC_TREE_NODE( 7358, 14,  71), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE( 6908, 11,  71), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  -62,  9,  71), ASC_TREE_NODE(   21,  0,  72),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  -11,  9,  71), ASC_TREE_NODE(    9,  8,  72),
+    ASC_TREE_NODE(   22, 16,  73), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  419,  0,  73), ASC_TREE_NODE(   78, 10,  74),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   25,  4,  74), ASC_TREE_NODE(   97, 10,  75), ASC_TREE_NODE(   98, 17,  76),
+    ASC_TREE_NODE(   30,  4,  77), ASC_TREE_NODE(   55, 17,  78), ASC_TREE_NODE(    8,  6,  79), ASC_TREE_NODE(   30,  7,  80),
+    ASC_TREE_NODE( 9642,  3,  81), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  718, 14,  81), ASC_TREE_NODE(  108,  8,  82),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    8, 15,  78), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    8, 19,  73), ASC_TREE_NODE(  122, 17,  74), ASC_TREE_NODE( 6466, 11,  75), ASC_TREE_NODE(  -29,  9,  76),
+    ASC_TREE_NODE(   -1, 15,  77), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   -4,  9,  77), ASC_TREE_NODE(    6, 15,  78),
+    ASC_TREE_NODE(   16,  7,  79), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    7, 19,  79), ASC_TREE_NODE(   10,  5,  80),
+    ASC_TREE_NODE(  111,  0,  81), ASC_TREE_NODE(   37, 17,  82), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   35, 17,  80), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    8,  7,  80),
+    ASC_TREE_NODE(   29,  4,  81), ASC_TREE_NODE(  360,  2,  82), ASC_TREE_NODE(   73,  1,  83), ASC_TREE_NODE(   24, 11,  84),
+    ASC_TREE_NODE(   46, 17,  85), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(   59, 10,  83), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   22, 18,  82),
+    ASC_TREE_NODE(  246,  2,  83), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   45,  0,  82),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   27,  7,  80),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    3,  3,  80), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   32,  4,  80),
+    ASC_TREE_NODE(   16,  8,  81), ASC_TREE_NODE(   85, 10,  82), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE( 1256,  3,  81), ASC_TREE_NODE( 1418, 14,  82), ASC_TREE_NODE(  392, 14,  83), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(   27,  1,  83), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   27,  7,  83), ASC_TREE_NODE(  131,  2,  84),
+    ASC_TREE_NODE(   25, 16,  85), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    9,  5,  85), ASC_TREE_NODE(   54, 17,  86),
+    ASC_TREE_NODE(    1,  5,  87), ASC_TREE_NODE(  456, 14,  88), ASC_TREE_NODE(  110, 16,  89), ASC_TREE_NODE( 1663,  3,  90),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(10400,  3,  89), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    7,  2,  89), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   37, 17,  80),
+    ASC_TREE_NODE(   36,  4,  81), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    7, 19,  79), ASC_TREE_NODE(   12,  9,  80), ASC_TREE_NODE(  134, 14,  81), ASC_TREE_NODE(   13,  9,  82),
+    ASC_TREE_NODE(   16,  8,  83), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE( 1577,  3,  79), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(  144,  2,  79), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   39,  3,  79), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   19, 19,  77), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(   30, 18,  77), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   30,  7,  77), ASC_TREE_NODE(   10, 14,  78),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   33,  7,  77), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   20, 15,  75), ASC_TREE_NODE(   20,  7,  76),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  -30,  0,  76), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   51, 17,  69), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   44,  4,  66),
+    ASC_TREE_NODE( 5906, 11,  67), ASC_TREE_NODE(   97,  0,  68), ASC_TREE_NODE(   19, 15,  69), ASC_TREE_NODE(    2,  5,  70),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   23,  1,  70), ASC_TREE_NODE(  152, 17,  71), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(   35, 18,  71), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   69, 18,  71), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   39,  4,  70), ASC_TREE_NODE(  204,  2,  71), ASC_TREE_NODE(  196, 11,  72),
+    ASC_TREE_NODE(   46,  4,  73), ASC_TREE_NODE(   36,  3,  74), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   26, 15,  74),
+    ASC_TREE_NODE(  840,  3,  75), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   20,  7,  75), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    2, 19,  72),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   81, 11,  71), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  -21, 15,  70), ASC_TREE_NODE(   37, 17,  71), ASC_TREE_NODE(   16,  4,  72),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   14,  9,  71), ASC_TREE_NODE(   77, 18,  72),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   17, 19,  72), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  381,  2,  69), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(   16,  7,  69), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(   11,  6,  67), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   46,  3,  66),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   69, 16,  65), ASC_TREE_NODE( 1361, 14,  66),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   54, 10,  65), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(  445,  3,  65), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   23,  7,  65), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   22,  4,  63), ASC_TREE_NODE(  271,  3,  64),
+    ASC_TREE_NODE(   20,  9,  65), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   31, 15,  64),
+    ASC_TREE_NODE(   23, 15,  65), ASC_TREE_NODE(  244,  2,  66), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   23, 18,  66),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  105, 18,  64),
+    ASC_TREE_NODE(   38,  1,  65), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE( 2044, 11,  61), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  112, 17,  60), ASC_TREE_NODE( 1116,  2,  61), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   53, 16,  60), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(   12, 14,  59), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   37, 10,  58),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   38,  1,  58), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    4, 19,  57), ASC_TREE_NODE(   18,  4,  58), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    7,  5,  58),
+    ASC_TREE_NODE(   53,  1,  59), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   15,  7,  59), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE( 2496,  3,  56),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   11,  6,  55), ASC_TREE_NODE(  240,  3,  56),
+    ASC_TREE_NODE(  206,  3,  57), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE( 1183, 11,  55), ASC_TREE_NODE(   29,  3,  56), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   74, 17,  53), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   46,  4,  51), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  660,  3,  50), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   32,  7,  43), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(   70, 16,  43), ASC_TREE_NODE( 1077, 11,  44), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   90, 18,  44),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   62, 17,  43), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  120, 11,  41), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(   28, 18,  41), ASC_TREE_NODE(   22,  4,  42), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  401,  3,  38),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    7, 10,  34), ASC_TREE_NODE(  709,  3,  35), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(   79, 18,  27), ASC_TREE_NODE(   95, 17,  28), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   60, 18,  26), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   46,  9,  22),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  218,  2,  22), ASC_TREE_NODE(    8,  7,  23), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  369,  3,  16),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    2, 14,  13), ASC_TREE_NODE(   31,  8,  14), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  459, 14,  12), ASC_TREE_NODE(   88,  0,  13), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  541, 14,   6),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   65,  0,   1),
+    ASC_TREE_NODE(   13,  6,   2), ASC_TREE_NODE(   13, 15,   3), ASC_TREE_NODE(   25,  7,   4), ASC_TREE_NODE(   25, 19,   5),
+    ASC_TREE_NODE(    4,  6,   6), ASC_TREE_NODE(   66,  9,   7), ASC_TREE_NODE(   54,  2,   8), ASC_TREE_NODE(   58,  4,   9),
+    ASC_TREE_NODE(   25, 18,  10), ASC_TREE_NODE( 5022, 14,  11), ASC_TREE_NODE(   27,  8,  12), ASC_TREE_NODE(   48, 17,  13),
+    ASC_TREE_NODE(  601, 14,  14), ASC_TREE_NODE(   10,  6,  15), ASC_TREE_NODE(   24, 18,  16), ASC_TREE_NODE(  173,  2,  17),
+    ASC_TREE_NODE(   80, 19,  18), ASC_TREE_NODE(    2,  0,  19), ASC_TREE_NODE(  132, 17,  20), ASC_TREE_NODE( 2771,  3,  21),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   51,  2,  21), ASC_TREE_NODE(   18,  1,  22), ASC_TREE_NODE(   24, 17,  23),
+    ASC_TREE_NODE(   17, 16,  24), ASC_TREE_NODE(    5,  5,  25), ASC_TREE_NODE(   88, 10,  26), ASC_TREE_NODE(   83,  1,  27),
+    ASC_TREE_NODE(   67, 17,  28), ASC_TREE_NODE(   21, 16,  29), ASC_TREE_NODE(    3, 15,  30), ASC_TREE_NODE(  577,  9,  31),
+    ASC_TREE_NODE(   11, 15,  32), ASC_TREE_NODE(    6,  6,  33), ASC_TREE_NODE(   98, 17,  34), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(   12, 19,  30), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(  106,  2,  28), ASC_TREE_NODE(   42, 17,  29), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   45,  9,  29),
+    ASC_TREE_NODE(  956,  3,  30), ASC_TREE_NODE(  113, 16,  31), ASC_TREE_NODE(    7,  3,  32), ASC_TREE_NODE(   59,  4,  33),
+    ASC_TREE_NODE(    2,  9,  34), ASC_TREE_NODE(   18,  9,  35), ASC_TREE_NODE(  986,  3,  36), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(   35, 16,  36), ASC_TREE_NODE( 1579,  3,  37), ASC_TREE_NODE(   46, 15,  38), ASC_TREE_NODE(   20,  8,  39),
+    ASC_TREE_NODE(    2, 19,  40), ASC_TREE_NODE(   54,  3,  41), ASC_TREE_NODE(  229, 18,  42), ASC_TREE_NODE(  344, 14,  43),
+    ASC_TREE_NODE(  649,  1,  44), ASC_TREE_NODE(   49, 17,  45), ASC_TREE_NODE(  -30,  9,  46), ASC_TREE_NODE(    5,  5,  47),
+    ASC_TREE_NODE(   11,  8,  48), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   91, 17,  48), ASC_TREE_NODE(   22,  8,  49),
+    ASC_TREE_NODE(   87, 11,  50), ASC_TREE_NODE(   13,  9,  51), ASC_TREE_NODE(   50,  9,  52), ASC_TREE_NODE(   36,  4,  53),
+    ASC_TREE_NODE(  228, 17,  54), ASC_TREE_NODE(   12,  5,  55), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(   20,  4,  54), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    6, 11,  54), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(  396,  3,  54), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   62, 17,  54), ASC_TREE_NODE(   87,  0,  55),
+    ASC_TREE_NODE(   11,  7,  56), ASC_TREE_NODE(   32,  7,  57), ASC_TREE_NODE(  569,  0,  58), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  258,  2,  57), ASC_TREE_NODE(  906, 14,  58), ASC_TREE_NODE(  164, 17,  59),
+    ASC_TREE_NODE(  573,  3,  60), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE( 9642,  3,  60), ASC_TREE_NODE(   42,  4,  61),
+    ASC_TREE_NODE(  130, 17,  62), ASC_TREE_NODE(    2, 10,  63), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    4,  4,  61), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   12,  4,  61),
+    ASC_TREE_NODE(    9, 15,  62), ASC_TREE_NODE(   30, 18,  63), ASC_TREE_NODE(  150,  9,  64), ASC_TREE_NODE(    9,  6,  65),
+    ASC_TREE_NODE(   19,  8,  66), ASC_TREE_NODE(  -25,  9,  67), ASC_TREE_NODE(   45,  0,  68), ASC_TREE_NODE(  984, 14,  69),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   26, 15,  69), ASC_TREE_NODE(  916, 11,  70), ASC_TREE_NODE(  198,  3,  71),
+    ASC_TREE_NODE(   14,  6,  72), ASC_TREE_NODE(   16,  5,  73), ASC_TREE_NODE(    9,  3,  74), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(   35, 18,  74), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  476,  3,  74), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(  101,  3,  74), ASC_TREE_NODE(    2,  6,  75), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(   -3, 15,  74), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   25, 18,  74), ASC_TREE_NODE(  173,  3,  75),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   24,  7,  74), ASC_TREE_NODE(   24,  7,  75),
+    ASC_TREE_NODE(  186,  2,  76), ASC_TREE_NODE(  198, 11,  77), ASC_TREE_NODE(  150, 14,  78), ASC_TREE_NODE(    7,  6,  79),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   29, 15,  79), ASC_TREE_NODE(  872, 11,  80), ASC_TREE_NODE(  152, 17,  81),
+    ASC_TREE_NODE( 1212, 11,  82), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   34,  4,  82), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(   16, 16,  82), ASC_TREE_NODE(  146,  1,  83), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  208,  9,  81), ASC_TREE_NODE(   12,  6,  82), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(   27, 15,  82), ASC_TREE_NODE(   26, 15,  83), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    3,  9,  82), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(   11,  7,  80), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   15,  3,  79),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  103, 10,  79), ASC_TREE_NODE(  144,  2,  80), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   15,  8,  79), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   58, 18,  79),
+    ASC_TREE_NODE(   -3,  6,  80), ASC_TREE_NODE(   57,  8,  81), ASC_TREE_NODE(    9,  7,  82), ASC_TREE_NODE(   19,  7,  83),
+    ASC_TREE_NODE(    6, 19,  84), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  317,  2,  84), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    3,  5,  84), ASC_TREE_NODE(   78, 10,  85), ASC_TREE_NODE(  246, 14,  86), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE( 1967,  3,  86), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   15, 19,  86), ASC_TREE_NODE(   13, 19,  87),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   36, 17,  86), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(   30, 18,  86), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   91,  3,  86), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(  197,  1,  86), ASC_TREE_NODE( 1317,  3,  87), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  111, 11,  87),
+    ASC_TREE_NODE(  164,  3,  88), ASC_TREE_NODE(    2,  9,  89), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   22,  4,  89),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  255,  0,  88), ASC_TREE_NODE(    9,  5,  89),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   37,  4,  89), ASC_TREE_NODE(  417,  2,  90), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   88,  2,  89), ASC_TREE_NODE(   65, 18,  90), ASC_TREE_NODE(   34, 16,  91),
+    ASC_TREE_NODE(   20,  8,  92), ASC_TREE_NODE(   27,  7,  93), ASC_TREE_NODE(   49,  1,  94), ASC_TREE_NODE(   41,  1,  95),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  461,  3,  94), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(   67,  0,  94), ASC_TREE_NODE(   15,  7,  95), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE( 1141, 11,  95),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  809, 14,  94), ASC_TREE_NODE(   53,  4,  95),
+    ASC_TREE_NODE(   92, 17,  96), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   39,  4,  96), ASC_TREE_NODE(  120, 16,  97),
+    ASC_TREE_NODE(   16, 19,  98), ASC_TREE_NODE(    7,  5,  99), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    6,  5,  94), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    2,  8,  94), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(   37,  4,  94), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  105,  3,  94), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  118, 11,  93), ASC_TREE_NODE(   78, 17,  94), ASC_TREE_NODE(   47,  4,  95),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(   47, 17,  92), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  705, 14,  91),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  115, 10,  91), ASC_TREE_NODE(   55, 17,  92), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   28,  4,  90), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(   24,  7,  90), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   37, 17,  87), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   38, 10,  87),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  860, 14,  85),
+    ASC_TREE_NODE(  828, 11,  86), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    8,  8,  82), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(  306, 14,  82), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  950,  3,  81),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE( 1633,  3,  81), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   20,  7,  81),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  241, 14,  80), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  432,  0,  79), ASC_TREE_NODE(  396,  3,  80), ASC_TREE_NODE(    1, 13,  81),
+    ASC_TREE_NODE(    2,  9,  82), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    4, 19,  81),
+    ASC_TREE_NODE(    2, 16,  82), ASC_TREE_NODE(   21, 16,  83), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   93, 10,  83),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  430,  3,  82), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  199,  1,  79),
+    ASC_TREE_NODE(  768, 14,  80), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   12, 16,  80), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   63, 10,  79), ASC_TREE_NODE(  175,  0,  80), ASC_TREE_NODE(  930,  3,  81),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   38,  4,  81), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   49,  4,  81),
+    ASC_TREE_NODE(  825, 14,  82), ASC_TREE_NODE(   22,  8,  83), ASC_TREE_NODE(   61, 19,  84), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(  354,  3,  84), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   13,  8,  84), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(   13,  7,  80), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(   42,  4,  74), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   20,  8,  73),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE( 1944,  3,  71),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  -11,  6,  70), ASC_TREE_NODE(   52, 10,  71),
+    ASC_TREE_NODE(    8,  5,  72), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 14,  62), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(   51,  9,  60), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(  429,  2,  58), ASC_TREE_NODE(  167, 17,  59), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  306,  3,  59),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  121,  2,  58), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(   87,  8,  58), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   28,  4,  54), ASC_TREE_NODE(  227, 14,  55),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  113, 10,  54), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  386,  1,  52), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE( 2005,  3,  48), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE( 1670,  3,  47),
+    ASC_TREE_NODE(   40,  7,  48), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE( 1739, 11,  43),
+    ASC_TREE_NODE( 1610,  2,  44), ASC_TREE_NODE(   57, 14,  45), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE( 1596, 14,  43), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   20,  4,  39),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   70,  1,  34), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(   43, 16,  34), ASC_TREE_NODE(  228,  3,  35), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   32,  4,  25), ASC_TREE_NODE(  172,  9,  26), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE( 1879,  3,  21), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(   17,  9,  20), ASC_TREE_NODE(   -3,  6,  21), ASC_TREE_NODE(    1,  5,  22), ASC_TREE_NODE(   73, 10,  23),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   31, 15,  18), ASC_TREE_NODE(  933,  2,  19),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  132, 17,  17),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    2,  7,  13), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  977,  3,   9),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   13,  7,   7),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(   13, 15,   1), ASC_TREE_NODE(   43,  0,   2), ASC_TREE_NODE(   56,  2,   3), ASC_TREE_NODE(   14,  8,   4),
+    ASC_TREE_NODE(   50, 17,   5), ASC_TREE_NODE(   24,  7,   6), ASC_TREE_NODE(   63,  0,   7), ASC_TREE_NODE(  107,  2,   8),
+    ASC_TREE_NODE(   59,  4,   9), ASC_TREE_NODE(    1,  9,  10), ASC_TREE_NODE(    5,  6,  11), ASC_TREE_NODE(    7,  8,  12),
+    ASC_TREE_NODE( 4804, 14,  13), ASC_TREE_NODE(   10, 19,  14), ASC_TREE_NODE(   27, 16,  15), ASC_TREE_NODE(   21, 17,  16),
+    ASC_TREE_NODE(    5,  6,  17), ASC_TREE_NODE(  128, 10,  18), ASC_TREE_NODE( 1102, 14,  19), ASC_TREE_NODE(    7, 15,  20),
+    ASC_TREE_NODE(    8, 15,  21), ASC_TREE_NODE(   87,  8,  22), ASC_TREE_NODE(   36,  7,  23), ASC_TREE_NODE(   48,  0,  24),
+    ASC_TREE_NODE(   32, 18,  25), ASC_TREE_NODE(  105, 17,  26), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   67,  9,  26),
+    ASC_TREE_NODE(    9,  6,  27), ASC_TREE_NODE(   60,  9,  28), ASC_TREE_NODE(   10,  6,  29), ASC_TREE_NODE(   83,  9,  30),
+    ASC_TREE_NODE(   10,  6,  31), ASC_TREE_NODE(  690,  2,  32), ASC_TREE_NODE(   44, 17,  33), ASC_TREE_NODE(   24, 18,  34),
+    ASC_TREE_NODE(  910, 11,  35), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   65,  8,  34),
+    ASC_TREE_NODE(  218,  2,  35), ASC_TREE_NODE(   32,  4,  36), ASC_TREE_NODE(   31, 17,  37), ASC_TREE_NODE(   32,  7,  38),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   39,  9,  38), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    4,  5,  38),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   15, 19,  37), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(  -14,  0,  37), ASC_TREE_NODE(  270,  3,  38), ASC_TREE_NODE(  115,  2,  39), ASC_TREE_NODE(   80, 16,  40),
+    ASC_TREE_NODE(   84, 10,  41), ASC_TREE_NODE(   11,  7,  42), ASC_TREE_NODE(   31, 15,  43), ASC_TREE_NODE(   27,  4,  44),
+    ASC_TREE_NODE(   21,  8,  45), ASC_TREE_NODE(    2, 19,  46), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE( 1513,  9,  46),
+    ASC_TREE_NODE(   47, 17,  47), ASC_TREE_NODE(   63, 19,  48), ASC_TREE_NODE(   -3,  6,  49), ASC_TREE_NODE(  174,  3,  50),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  644,  9,  49), ASC_TREE_NODE(   90, 18,  50),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE( -246,  9,  50), ASC_TREE_NODE(    4,  3,  51), ASC_TREE_NODE(   12,  4,  52),
+    ASC_TREE_NODE(    8, 15,  53), ASC_TREE_NODE(   30, 17,  54), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(   97,  0,  53), ASC_TREE_NODE(   14,  7,  54), ASC_TREE_NODE( 1676,  3,  55), ASC_TREE_NODE(   64,  3,  56),
+    ASC_TREE_NODE( 1013,  3,  57), ASC_TREE_NODE(   11,  6,  58), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(   25,  4,  57), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  359, 11,  56),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  115,  1,  55), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(  658, 14,  55), ASC_TREE_NODE( 2727, 14,  56), ASC_TREE_NODE(   48,  7,  57), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(   33, 15,  57), ASC_TREE_NODE(  694, 14,  58), ASC_TREE_NODE(    1, 16,  59), ASC_TREE_NODE(   36, 17,  60),
+    ASC_TREE_NODE(   18, 15,  61), ASC_TREE_NODE(   43, 16,  62), ASC_TREE_NODE(   29, 15,  63), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    6,  2,  63), ASC_TREE_NODE(  230, 18,  64), ASC_TREE_NODE( 5352, 11,  65), ASC_TREE_NODE( 3868, 11,  66),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   18,  4,  66), ASC_TREE_NODE( 7960, 11,  67), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(   -9, 15,  67), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  293, 14,  67), ASC_TREE_NODE(  231,  2,  68),
+    ASC_TREE_NODE( 1204, 14,  69), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   29, 17,  68),
+    ASC_TREE_NODE(  282,  0,  69), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   17,  4,  69), ASC_TREE_NODE(   28,  3,  70),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  244, 14,  70), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    9,  9,  70),
+    ASC_TREE_NODE(    7, 15,  71), ASC_TREE_NODE(   97,  2,  72), ASC_TREE_NODE(   13, 10,  73), ASC_TREE_NODE(   30, 16,  74),
+    ASC_TREE_NODE(   33, 14,  75), ASC_TREE_NODE(   54,  4,  76), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   54, 17,  76),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  253,  2,  76), ASC_TREE_NODE(   82, 18,  77), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    3,  6,  74),
+    ASC_TREE_NODE(    2, 16,  75), ASC_TREE_NODE(   29,  4,  76), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    3,  5,  74), ASC_TREE_NODE( 8691,  3,  75), ASC_TREE_NODE(   27, 19,  76),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  116,  0,  76), ASC_TREE_NODE(   42,  4,  77), ASC_TREE_NODE(   16, 15,  78),
+    ASC_TREE_NODE(  916,  9,  79), ASC_TREE_NODE(    9,  5,  80), ASC_TREE_NODE(   86, 17,  81), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(  108,  0,  81), ASC_TREE_NODE(   98, 16,  82), ASC_TREE_NODE(   48,  9,  83), ASC_TREE_NODE(  135,  9,  84),
+    ASC_TREE_NODE(   12,  6,  85), ASC_TREE_NODE(   28,  7,  86), ASC_TREE_NODE(   87,  4,  87), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    4,  7,  85), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(  223,  2,  81), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1,  8,  80),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(   27, 17,  77), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  441,  2,  73), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   13,  7,  66),
+    ASC_TREE_NODE(  228,  3,  67), ASC_TREE_NODE(    7, 19,  68), ASC_TREE_NODE(    5, 19,  69), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    9,  6,  69), ASC_TREE_NODE(   13,  9,  70), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    9, 19,  70),
+    ASC_TREE_NODE(   69, 16,  71), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    5, 19,  69), ASC_TREE_NODE(   23,  4,  70), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   18, 19,  70),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   30,  3,  70), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    3, 19,  69), ASC_TREE_NODE( 1516, 11,  70), ASC_TREE_NODE( 1823, 11,  71), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(   80, 16,  71), ASC_TREE_NODE(  139,  2,  72), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   30,  4,  72),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  209,  2,  71), ASC_TREE_NODE(    4,  5,  72),
+    ASC_TREE_NODE(  152, 17,  73), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE( 1622,  3,  72),
+    ASC_TREE_NODE(   26,  4,  73), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE( 1174,  3,  72),
+    ASC_TREE_NODE(  816, 14,  73), ASC_TREE_NODE(  479,  3,  74), ASC_TREE_NODE(   12, 10,  75), ASC_TREE_NODE(   78, 17,  76),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    8,  6,  76), ASC_TREE_NODE( 1703, 11,  77), ASC_TREE_NODE(   31,  4,  78),
+    ASC_TREE_NODE( 8314,  3,  79), ASC_TREE_NODE(   49,  4,  80), ASC_TREE_NODE( 1206,  2,  81), ASC_TREE_NODE(   63, 17,  82),
+    ASC_TREE_NODE(   41,  6,  83), ASC_TREE_NODE(    7,  5,  84), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   51, 18,  81), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   41,  4,  80), ASC_TREE_NODE(   57, 18,  81), ASC_TREE_NODE(   76, 10,  82),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE( 1059,  3,  81), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  196,  2,  78),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    5,  7,  78), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(  588, 11,  77), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(   54, 10,  75), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   21,  7,  75), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(  314,  3,  75), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  617, 14,  71), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(   29,  8,  67), ASC_TREE_NODE( 1913,  9,  68), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE( 2873, 11,  68),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  173,  0,  68), ASC_TREE_NODE(   18, 15,  69), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   51,  4,  68), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  339,  9,  68),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  207,  1,  63), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  534,  3,  62), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   78,  9,  62),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   70, 10,  62), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE( 1633,  3,  61), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   13,  6,  61), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   80,  2,  60), ASC_TREE_NODE(  163,  0,  61), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(  513,  3,  61), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   91, 10,  61), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  622, 14,  60), ASC_TREE_NODE(   22,  8,  61), ASC_TREE_NODE(    4,  5,  62),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    3, 19,  60),
+    ASC_TREE_NODE(   92,  9,  61), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    4,  3,  61), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   52, 17,  54),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE( 1581, 14,  48),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE( 6452,  3,  47), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   65, 14,  46), ASC_TREE_NODE(   19,  1,  47), ASC_TREE_NODE(   41, 18,  48),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  105, 17,  48), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  847, 14,  48),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   59,  7,  48), ASC_TREE_NODE(   35, 15,  49), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    7,  5,  47), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(  498,  3,  47), ASC_TREE_NODE(    5,  6,  48), ASC_TREE_NODE( 2722, 11,  49), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE( 2277, 11,  42),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   41,  9,  42), ASC_TREE_NODE( 2542, 11,  43), ASC_TREE_NODE(   47, 16,  44),
+    ASC_TREE_NODE(   16,  6,  45), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  450, 14,  45), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(   41, 16,  45), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE( 1961, 11,  45), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE( 1156,  3,  37), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE( 2141,  3,  28),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   60, 10,  27), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE( 3950, 11,  23), ASC_TREE_NODE(   90, 17,  24), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  590,  0,  24),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   50,  4,  22),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  113, 17,  22), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  237,  2,  20), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  733,  3,  13), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    7,  6,  13), ASC_TREE_NODE(  -72,  9,  14), ASC_TREE_NODE(  519,  3,  15), ASC_TREE_NODE(  111,  0,  16),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE( 1917, 14,   7), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   13, 15,   1),
+    ASC_TREE_NODE(   52,  0,   2), ASC_TREE_NODE(   62,  0,   3), ASC_TREE_NODE(  231,  2,   4), ASC_TREE_NODE(    1,  9,   5),
+    ASC_TREE_NODE(   13,  6,   6), ASC_TREE_NODE(   21, 15,   7), ASC_TREE_NODE(   20, 17,   8), ASC_TREE_NODE(   62,  4,   9),
+    ASC_TREE_NODE(  219,  0,  10), ASC_TREE_NODE(   44, 17,  11), ASC_TREE_NODE(   56,  2,  12), ASC_TREE_NODE(    9, 19,  13),
+    ASC_TREE_NODE(   82, 18,  14), ASC_TREE_NODE(   59,  9,  15), ASC_TREE_NODE(    6,  5,  16), ASC_TREE_NODE(   66, 19,  17),
+    ASC_TREE_NODE(   12,  9,  18), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   22,  4,  18), ASC_TREE_NODE(   41, 17,  19),
+    ASC_TREE_NODE(    3,  5,  20), ASC_TREE_NODE(    4,  6,  21), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   47, 10,  21),
+    ASC_TREE_NODE(    4, 13,  22), ASC_TREE_NODE(   42,  6,  23), ASC_TREE_NODE(   42, 16,  24), ASC_TREE_NODE(   53, 17,  25),
+    ASC_TREE_NODE(   21, 16,  26), ASC_TREE_NODE(   31, 15,  27), ASC_TREE_NODE(    2, 19,  28), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    9, 15,  28), ASC_TREE_NODE(  853, 14,  29), ASC_TREE_NODE(    6,  8,  30), ASC_TREE_NODE(    1, 16,  31),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  263,  2,  31), ASC_TREE_NODE(    3, 15,  32), ASC_TREE_NODE(  162,  8,  33),
+    ASC_TREE_NODE(   11,  4,  34), ASC_TREE_NODE(    5,  6,  35), ASC_TREE_NODE( 1883,  1,  36), ASC_TREE_NODE(  111,  3,  37),
+    ASC_TREE_NODE(    3,  6,  38), ASC_TREE_NODE(   76,  9,  39), ASC_TREE_NODE(   60,  9,  40), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE( 3538, 14,  40), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   13,  7,  40), ASC_TREE_NODE(   41, 17,  41),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    7,  6,  41), ASC_TREE_NODE( 1013, 11,  42), ASC_TREE_NODE(    7, 19,  43),
+    ASC_TREE_NODE(    5, 16,  44), ASC_TREE_NODE(   95, 10,  45), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    6,  2,  45),
+    ASC_TREE_NODE(  228, 18,  46), ASC_TREE_NODE(  158, 14,  47), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   32,  7,  47),
+    ASC_TREE_NODE(   -3,  6,  48), ASC_TREE_NODE(   26, 18,  49), ASC_TREE_NODE(  287, 14,  50), ASC_TREE_NODE(   46, 17,  51),
+    ASC_TREE_NODE( 4432, 14,  52), ASC_TREE_NODE(  270,  2,  53), ASC_TREE_NODE(    7,  3,  54), ASC_TREE_NODE(   88, 10,  55),
+    ASC_TREE_NODE(    5,  6,  56), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   33, 17,  55),
+    ASC_TREE_NODE(  149,  9,  56), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   32,  7,  56), ASC_TREE_NODE(   39, 10,  57),
+    ASC_TREE_NODE(    2,  5,  58), ASC_TREE_NODE(   34, 16,  59), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   51,  0,  59),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  388,  2,  59), ASC_TREE_NODE(   24,  2,  60), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(  733,  1,  60), ASC_TREE_NODE(    9,  8,  61), ASC_TREE_NODE(    9,  6,  62), ASC_TREE_NODE(   16,  5,  63),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    8,  6,  63), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  116, 17,  63),
+    ASC_TREE_NODE(   77,  8,  64), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   20,  8,  64), ASC_TREE_NODE(   96,  2,  65),
+    ASC_TREE_NODE(  173, 17,  66), ASC_TREE_NODE(   11,  6,  67), ASC_TREE_NODE(  123, 16,  68), ASC_TREE_NODE(   35,  7,  69),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  260,  9,  68), ASC_TREE_NODE(  207, 17,  69),
+    ASC_TREE_NODE(    4,  5,  70), ASC_TREE_NODE(   27,  7,  71), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  -18, 15,  69), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  230, 18,  69),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   18,  4,  68), ASC_TREE_NODE(  232,  2,  69),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   10,  8,  68), ASC_TREE_NODE(  393,  2,  69),
+    ASC_TREE_NODE(    3,  3,  70), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    3, 13,  70), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    3, 14,  69), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    6,  6,  69),
+    ASC_TREE_NODE(  651, 14,  70), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  391,  0,  70), ASC_TREE_NODE(   10, 19,  71),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   23, 16,  71), ASC_TREE_NODE(  140,  2,  72), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE( 1712, 14,  71), ASC_TREE_NODE( -103,  0,  72), ASC_TREE_NODE( 3795,  3,  73),
+    ASC_TREE_NODE(   84,  9,  74), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE( -114,  9,  73),
+    ASC_TREE_NODE(   91, 10,  74), ASC_TREE_NODE(12216, 11,  75), ASC_TREE_NODE(12050, 14,  76), ASC_TREE_NODE( 6143,  1,  77),
+    ASC_TREE_NODE(  406, 11,  78), ASC_TREE_NODE(  505,  2,  79), ASC_TREE_NODE(   25, 18,  80), ASC_TREE_NODE(   46,  4,  81),
+    ASC_TREE_NODE(  369, 14,  82), ASC_TREE_NODE(   13,  8,  83), ASC_TREE_NODE(  107, 18,  84), ASC_TREE_NODE(   32,  3,  85),
+    ASC_TREE_NODE(   36,  4,  86), ASC_TREE_NODE(   34, 14,  87), ASC_TREE_NODE(  107,  2,  88), ASC_TREE_NODE(  543,  2,  89),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE( 1182, 11,  86), ASC_TREE_NODE(   30, 16,  87), ASC_TREE_NODE(    4,  5,  88), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(   46, 18,  88), ASC_TREE_NODE(  218,  0,  89), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    5, 13,  89),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   15,  3,  88), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   93, 17,  87), ASC_TREE_NODE(    2,  3,  88), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(   72, 18,  88), ASC_TREE_NODE(  468,  2,  89), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  -52,  0,  89),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  304,  9,  89), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    9,  8,  88), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   23,  4,  88), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  429,  3,  87), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(  336,  3,  86), ASC_TREE_NODE(  189,  3,  87), ASC_TREE_NODE(   17,  9,  88), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  610,  2,  87), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(  770,  3,  86), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(   25,  9,  84), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    2, 19,  84), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  793,  3,  82), ASC_TREE_NODE(   79, 18,  83),
+    ASC_TREE_NODE(   47,  4,  84), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE( 2220, 14,  84), ASC_TREE_NODE(   29,  4,  85),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(17545, 11,  85), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(   41,  4,  84), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   17,  4,  83),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  422, 14,  83), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   17, 16,  83),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    2,  5,  82), ASC_TREE_NODE(   26,  4,  83),
+    ASC_TREE_NODE(   42, 18,  84), ASC_TREE_NODE(   37,  4,  85), ASC_TREE_NODE( 5104,  3,  86), ASC_TREE_NODE(    3, 10,  87),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    5, 19,  86), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1,  3,  86), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  241, 14,  86), ASC_TREE_NODE(   93, 18,  87),
+    ASC_TREE_NODE(  419, 14,  88), ASC_TREE_NODE(   40,  9,  89), ASC_TREE_NODE(   45, 18,  90), ASC_TREE_NODE(   48, 10,  91),
+    ASC_TREE_NODE( 2439, 11,  92), ASC_TREE_NODE(   30,  7,  93), ASC_TREE_NODE(  501, 14,  94), ASC_TREE_NODE( 1246,  2,  95),
+    ASC_TREE_NODE( 1474,  3,  96), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE( 1033,  2,  95),
+    ASC_TREE_NODE(    6, 12,  96), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   50, 11,  96), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(   24,  3,  92), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE( 1509, 14,  89), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE( 3249, 11,  89),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   21,  7,  89), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    6, 12,  86), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   31, 18,  84), ASC_TREE_NODE(   40, 17,  85),
+    ASC_TREE_NODE(  797,  3,  86), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(   45, 18,  84), ASC_TREE_NODE(    8,  6,  85), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   27,  7,  82), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  200,  9,  80), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE( 1867,  3,  80), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(   23,  5,  78), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   37,  4,  73),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(  429, 14,  70), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(  835, 14,  68), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(  107, 10,  66), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   99, 18,  61),
+    ASC_TREE_NODE(   78,  8,  62), ASC_TREE_NODE(   31,  8,  63), ASC_TREE_NODE(  219,  3,  64), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(  384,  3,  64), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE( 1961,  3,  64), ASC_TREE_NODE(   33, 16,  65),
+    ASC_TREE_NODE(   73, 10,  66), ASC_TREE_NODE(  916,  9,  67), ASC_TREE_NODE(   36, 17,  68), ASC_TREE_NODE(   60,  4,  69),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE( 1319,  2,  67),
+    ASC_TREE_NODE(  813, 14,  68), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   66,  4,  68), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE( 1923, 14,  68), ASC_TREE_NODE(   53, 18,  69), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(  -20,  0,  68), ASC_TREE_NODE(    5,  9,  69), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    2, 11,  66), ASC_TREE_NODE(   81, 16,  67),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(  238,  2,  64), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  101,  0,  60), ASC_TREE_NODE( 1269, 14,  61),
+    ASC_TREE_NODE(   53,  0,  62), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   69, 17,  62), ASC_TREE_NODE(  132, 18,  63),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(  451,  0,  60), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE( 1155, 11,  58), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  493, 14,  57),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(  221,  3,  54), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   70,  4,  53),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE( 4409, 11,  51),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   71, 17,  51), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(  128, 17,  50), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    6, 19,  50), ASC_TREE_NODE(   27, 19,  51),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  930,  3,  45),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE( 3378, 11,  44), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  707, 14,  41),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   12, 15,  41), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(  117, 16,  40), ASC_TREE_NODE(   67,  1,  41), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   44, 10,  41),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  425, 14,  40), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(  790, 14,  40), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  112, 17,  39),
+    ASC_TREE_NODE(    4,  9,  40), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(  134,  2,  30), ASC_TREE_NODE(   11, 19,  31), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  920,  9,  27),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   45, 18,  21),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  155,  3,  21), ASC_TREE_NODE(  266,  3,  22), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  378,  2,  21), ASC_TREE_NODE( 1896,  3,  22), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  376, 14,  17), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(  815,  3,  16), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  172,  2,   3),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   14,  6,   1),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    6,  6,   1), ASC_TREE_NODE(    7, 15,   2),
+    ASC_TREE_NODE(   22, 15,   3), ASC_TREE_NODE(   47,  4,   4), ASC_TREE_NODE(   60, 17,   5), ASC_TREE_NODE(   54,  0,   6),
+    ASC_TREE_NODE(   64,  0,   7), ASC_TREE_NODE(   23,  0,   8), ASC_TREE_NODE(    9,  5,   9), ASC_TREE_NODE(   94,  0,  10),
+    ASC_TREE_NODE(   28,  8,  11), ASC_TREE_NODE( 1002, 11,  12), ASC_TREE_NODE(   49, 17,  13), ASC_TREE_NODE(    6, 19,  14),
+    ASC_TREE_NODE(   13, 16,  15), ASC_TREE_NODE(   24, 18,  16), ASC_TREE_NODE(  117,  8,  17), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(   22,  8,  17), ASC_TREE_NODE(   21,  3,  18), ASC_TREE_NODE(   78, 16,  19), ASC_TREE_NODE(   70,  2,  20),
+    ASC_TREE_NODE(  292, 14,  21), ASC_TREE_NODE(  482,  2,  22), ASC_TREE_NODE(   12,  6,  23), ASC_TREE_NODE(    1,  9,  24),
+    ASC_TREE_NODE(   17, 15,  25), ASC_TREE_NODE(   26,  0,  26), ASC_TREE_NODE(   16,  7,  27), ASC_TREE_NODE(  102, 17,  28),
+    ASC_TREE_NODE(    6,  5,  29), ASC_TREE_NODE(   12,  5,  30), ASC_TREE_NODE(    4,  8,  31), ASC_TREE_NODE(   37, 17,  32),
+    ASC_TREE_NODE(    9, 12,  33), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE( 2189,  3,  33), ASC_TREE_NODE(    5,  3,  34),
+    ASC_TREE_NODE(   34, 18,  35), ASC_TREE_NODE(   80, 10,  36), ASC_TREE_NODE(   21,  8,  37), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(  784,  0,  37), ASC_TREE_NODE(    4,  6,  38), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   52, 17,  38),
+    ASC_TREE_NODE(    4,  1,  39), ASC_TREE_NODE(   60,  2,  40), ASC_TREE_NODE(   53, 19,  41), ASC_TREE_NODE(  197,  0,  42),
+    ASC_TREE_NODE(    3, 19,  43), ASC_TREE_NODE(  485,  0,  44), ASC_TREE_NODE(   16,  8,  45), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(   59, 17,  45), ASC_TREE_NODE(  589, 14,  46), ASC_TREE_NODE(  369, 14,  47), ASC_TREE_NODE(   24, 18,  48),
+    ASC_TREE_NODE(   33,  6,  49), ASC_TREE_NODE(   46, 16,  50), ASC_TREE_NODE(   34,  9,  51), ASC_TREE_NODE(  127, 17,  52),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   87, 11,  51), ASC_TREE_NODE(   18,  1,  52),
+    ASC_TREE_NODE(   15,  7,  53), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    6,  3,  53), ASC_TREE_NODE(  109, 10,  54),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   32, 17,  52),
+    ASC_TREE_NODE(  119,  2,  53), ASC_TREE_NODE(   61,  3,  54), ASC_TREE_NODE(  238,  3,  55), ASC_TREE_NODE(  169,  3,  56),
+    ASC_TREE_NODE(   14,  7,  57), ASC_TREE_NODE(   11,  4,  58), ASC_TREE_NODE(  111, 17,  59), ASC_TREE_NODE(  210, 14,  60),
+    ASC_TREE_NODE(  179, 18,  61), ASC_TREE_NODE(   13,  7,  62), ASC_TREE_NODE(  -19,  9,  63), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   61,  2,  61), ASC_TREE_NODE(   20,  5,  62),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   11,  7,  61), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(  175,  9,  61), ASC_TREE_NODE(  175, 11,  62), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  121, 17,  62),
+    ASC_TREE_NODE(  212,  0,  63), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(   40, 18,  61), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  337,  9,  61), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    7, 16,  60), ASC_TREE_NODE(  111, 17,  61), ASC_TREE_NODE(  192,  3,  62),
+    ASC_TREE_NODE(   -1,  9,  63), ASC_TREE_NODE(  121, 14,  64), ASC_TREE_NODE(   16,  6,  65), ASC_TREE_NODE(    7,  1,  66),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    4,  5,  66), ASC_TREE_NODE(   14,  7,  67), ASC_TREE_NODE(    4,  6,  68),
+    ASC_TREE_NODE(   60,  9,  69), ASC_TREE_NODE( 1500,  9,  70), ASC_TREE_NODE(   -3,  6,  71), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  137, 18,  70), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  524, 11,  67), ASC_TREE_NODE(   40, 17,  68),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   35,  3,  68), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   28, 10,  68),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   25,  8,  68), ASC_TREE_NODE(   36,  8,  69), ASC_TREE_NODE( 2301,  3,  70),
+    ASC_TREE_NODE(   76, 17,  71), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    5,  8,  66),
+    ASC_TREE_NODE(  781, 11,  67), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   11,  4,  67), ASC_TREE_NODE( 1201,  3,  68),
+    ASC_TREE_NODE(   28,  4,  69), ASC_TREE_NODE(  115,  1,  70), ASC_TREE_NODE( 3973, 11,  71), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(   43,  4,  71), ASC_TREE_NODE(   76,  0,  72), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   -1,  9,  72),
+    ASC_TREE_NODE(   41,  1,  73), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE( 1137, 11,  73), ASC_TREE_NODE(   14, 11,  74),
+    ASC_TREE_NODE(   19,  9,  75), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   25,  8,  74),
+    ASC_TREE_NODE(  106, 18,  75), ASC_TREE_NODE(   32,  4,  76), ASC_TREE_NODE(   59,  4,  77), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    5,  1,  76), ASC_TREE_NODE(    3,  5,  77), ASC_TREE_NODE(   50,  4,  78),
+    ASC_TREE_NODE(   26, 10,  79), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE( 1964,  3,  78),
+    ASC_TREE_NODE(  121, 16,  79), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   18, 18,  79), ASC_TREE_NODE(-1334,  9,  80),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   62, 17,  79), ASC_TREE_NODE(   36, 17,  80),
+    ASC_TREE_NODE(  244,  2,  81), ASC_TREE_NODE(    1, 13,  82), ASC_TREE_NODE( 1965,  1,  83), ASC_TREE_NODE(  100,  0,  84),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   12,  8,  84), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   10, 15,  82), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    1,  5,  81), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    3,  7,  80),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  100, 14,  80), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   30,  4,  80),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  101,  3,  78),
+    ASC_TREE_NODE(   67,  4,  79), ASC_TREE_NODE(  214, 14,  80), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    8,  8,  80),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    9,  7,  80), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   88, 17,  77), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE( -168,  0,  77), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  188,  2,  77), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   20,  4,  76), ASC_TREE_NODE(   31,  4,  77), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(  119, 18,  77), ASC_TREE_NODE(   34, 18,  78), ASC_TREE_NODE( 1436,  3,  79), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   58, 17,  77), ASC_TREE_NODE(  141,  3,  78),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   30,  0,  78), ASC_TREE_NODE(  851, 14,  79), ASC_TREE_NODE(   84,  8,  80),
+    ASC_TREE_NODE(   58,  2,  81), ASC_TREE_NODE(    5,  5,  82), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    2,  5,  78),
+    ASC_TREE_NODE(   25, 15,  79), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  225,  2,  78),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   29,  7,  78), ASC_TREE_NODE(   29, 19,  79), ASC_TREE_NODE(   39,  7,  80),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    9,  2,  80), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(   74, 11,  79), ASC_TREE_NODE(   17,  8,  80), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(  264,  0,  79), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(   97,  0,  77), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(   95, 10,  75), ASC_TREE_NODE(   -9, 15,  76), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(   19,  4,  75), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    9,  7,  68), ASC_TREE_NODE(   27,  7,  69), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(   25,  7,  69), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   14,  8,  64),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  953, 14,  63), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE( 1845, 11,  61), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(   15,  8,  61), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   10,  8,  58), ASC_TREE_NODE(   39,  7,  59), ASC_TREE_NODE(  223,  3,  60),
+    ASC_TREE_NODE(   30,  5,  61), ASC_TREE_NODE(   39,  3,  62), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE( 1468, 11,  62),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   60,  8,  62), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(22468,  3,  60), ASC_TREE_NODE( 1998,  3,  61), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE( 4820, 14,  61), ASC_TREE_NODE(   78, 14,  62), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(  162,  0,  61), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  615, 14,  61), ASC_TREE_NODE(    1,  8,  62),
+    ASC_TREE_NODE( 2633, 14,  63), ASC_TREE_NODE(   35, 10,  64), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  740, 11,  64),
+    ASC_TREE_NODE(   37, 15,  65), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(   69, 18,  63), ASC_TREE_NODE(  885,  3,  64), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  300,  2,  61), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(  176,  2,  61), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  308,  2,  61), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   68, 16,  58),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   10,  5,  56),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   13, 19,  56), ASC_TREE_NODE(   24,  6,  57), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   84,  0,  54),
+    ASC_TREE_NODE( 1271,  3,  55), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  150,  2,  52), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  677,  3,  50), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   20,  7,  46),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   31, 15,  42), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   22,  3,  42),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  352, 14,  42), ASC_TREE_NODE(   67,  0,  43), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   24, 19,  41), ASC_TREE_NODE(  730, 11,  42),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(   39, 14,  39), ASC_TREE_NODE(  955, 11,  40), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    5,  7,  40),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE( 1939,  3,  37), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   49, 10,  37), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE( 3418,  3,  37), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE( 2999,  3,  37), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(   63,  4,  37), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   41,  9,  36),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   32,  4,  36), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   23,  7,  32),
+    ASC_TREE_NODE(   37,  8,  33), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   13,  7,  30), ASC_TREE_NODE( 3034, 11,  31), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  793,  3,  22), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(   88, 17,  13), ASC_TREE_NODE(  128,  0,  14), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   77,  0,   8), ASC_TREE_NODE( 2207, 14,   9), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  184,  2,   8), ASC_TREE_NODE(  482,  2,   9), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   39,  4,   8), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE( 3093, 11,   8),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  433, 14,   8), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE( 1523, 11,   1), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   13, 15,   1), ASC_TREE_NODE(   52,  0,   2), ASC_TREE_NODE(   65,  0,   3),
+    ASC_TREE_NODE(   53,  4,   4), ASC_TREE_NODE(    4,  6,   5), ASC_TREE_NODE(   13,  6,   6), ASC_TREE_NODE(   23, 15,   7),
+    ASC_TREE_NODE(   24, 18,   8), ASC_TREE_NODE(  114, 17,   9), ASC_TREE_NODE(   32,  8,  10), ASC_TREE_NODE(   50, 17,  11),
+    ASC_TREE_NODE(  143,  2,  12), ASC_TREE_NODE(   11, 19,  13), ASC_TREE_NODE(   27,  4,  14), ASC_TREE_NODE(   22, 16,  15),
+    ASC_TREE_NODE(    2, 15,  16), ASC_TREE_NODE( 1513,  9,  17), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE( 1498, 14,  17),
+    ASC_TREE_NODE(    8, 15,  18), ASC_TREE_NODE(  119,  9,  19), ASC_TREE_NODE(    9, 15,  20), ASC_TREE_NODE(   59,  4,  21),
+    ASC_TREE_NODE(   69, 17,  22), ASC_TREE_NODE(   30,  4,  23), ASC_TREE_NODE( 1535, 11,  24), ASC_TREE_NODE( 3054, 14,  25),
+    ASC_TREE_NODE(   44, 17,  26), ASC_TREE_NODE(   69, 10,  27), ASC_TREE_NODE(    5, 16,  28), ASC_TREE_NODE(   12,  6,  29),
+    ASC_TREE_NODE(   34, 17,  30), ASC_TREE_NODE(   16, 10,  31), ASC_TREE_NODE(    5,  6,  32), ASC_TREE_NODE( 2757,  3,  33),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   30, 17,  32), ASC_TREE_NODE(   60, 17,  33),
+    ASC_TREE_NODE( 1653,  2,  34), ASC_TREE_NODE(   12,  5,  35), ASC_TREE_NODE(   39, 16,  36), ASC_TREE_NODE(   55,  0,  37),
+    ASC_TREE_NODE(    4,  3,  38), ASC_TREE_NODE( 1114,  3,  39), ASC_TREE_NODE(   66, 17,  40), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(  -84,  0,  40), ASC_TREE_NODE(   31, 15,  41), ASC_TREE_NODE(   60,  9,  42), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(  725,  1,  42), ASC_TREE_NODE(   75, 10,  43), ASC_TREE_NODE(   94,  2,  44), ASC_TREE_NODE(    2,  9,  45),
+    ASC_TREE_NODE(  114, 17,  46), ASC_TREE_NODE(    7,  5,  47), ASC_TREE_NODE( 1861, 14,  48), ASC_TREE_NODE(   24,  7,  49),
+    ASC_TREE_NODE(   80,  2,  50), ASC_TREE_NODE(  -16,  9,  51), ASC_TREE_NODE(    5,  9,  52), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   54, 17,  51), ASC_TREE_NODE(   27, 14,  52), ASC_TREE_NODE(   -9,  0,  53),
+    ASC_TREE_NODE(    6,  4,  54), ASC_TREE_NODE(   50, 17,  55), ASC_TREE_NODE(    3,  5,  56), ASC_TREE_NODE(   40,  4,  57),
+    ASC_TREE_NODE(   26, 10,  58), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  110,  0,  58), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  899,  3,  55),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   13,  8,  55), ASC_TREE_NODE(  228,  2,  56), ASC_TREE_NODE( 1016, 14,  57),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   50,  0,  56), ASC_TREE_NODE( 1439,  3,  57),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  128, 11,  57), ASC_TREE_NODE(   60,  4,  58), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(   24, 18,  58), ASC_TREE_NODE(    2,  8,  59), ASC_TREE_NODE( 2534, 11,  60), ASC_TREE_NODE(    2,  8,  61),
+    ASC_TREE_NODE(   46,  2,  62), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   36, 17,  62), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   16, 16,  61), ASC_TREE_NODE(   53,  4,  62), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(   44, 18,  62), ASC_TREE_NODE(   74, 18,  63), ASC_TREE_NODE(   37, 15,  64), ASC_TREE_NODE( 5452,  3,  65),
+    ASC_TREE_NODE(    1,  5,  66), ASC_TREE_NODE(  112, 17,  67), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   69,  4,  67),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  245,  1,  67), ASC_TREE_NODE( 1517,  2,  68), ASC_TREE_NODE(    2, 10,  69),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   37,  9,  68), ASC_TREE_NODE(  107,  2,  69),
+    ASC_TREE_NODE(  230,  2,  70), ASC_TREE_NODE(   23,  4,  71), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  -21,  9,  68), ASC_TREE_NODE(   -1,  6,  69),
+    ASC_TREE_NODE(   13,  9,  70), ASC_TREE_NODE( 1558, 11,  71), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  147,  3,  71),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  110,  1,  71), ASC_TREE_NODE(  141,  2,  72), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(   20,  4,  72), ASC_TREE_NODE(    9,  7,  73), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(   39,  1,  72), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  156,  1,  71),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    6,  8,  69),
+    ASC_TREE_NODE(  158,  2,  70), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   40,  4,  70), ASC_TREE_NODE(  224,  3,  71),
+    ASC_TREE_NODE(    8, 19,  72), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   92, 10,  72), ASC_TREE_NODE(   25,  8,  73),
+    ASC_TREE_NODE( 6382,  3,  74), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   18,  4,  71), ASC_TREE_NODE(  163,  3,  72), ASC_TREE_NODE(    5,  6,  73),
+    ASC_TREE_NODE(    8,  6,  74), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   55, 17,  74), ASC_TREE_NODE(  411,  2,  75),
+    ASC_TREE_NODE(   74,  9,  76), ASC_TREE_NODE(  140, 14,  77), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  924, 14,  77),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(   88, 10,  74), ASC_TREE_NODE(   68,  8,  75), ASC_TREE_NODE(   28,  9,  76), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(   41,  4,  76), ASC_TREE_NODE(   21, 10,  77), ASC_TREE_NODE(    3,  5,  78), ASC_TREE_NODE(   24, 17,  79),
+    ASC_TREE_NODE(    9,  2,  80), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  -25,  9,  80), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   14,  7,  79), ASC_TREE_NODE(    2,  8,  80), ASC_TREE_NODE(    3,  5,  81),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   87, 17,  81), ASC_TREE_NODE(   84,  3,  82), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(  404, 14,  82), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   15,  1,  81),
+    ASC_TREE_NODE(   10, 19,  82), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   57, 16,  81),
+    ASC_TREE_NODE(   63, 18,  82), ASC_TREE_NODE(   13, 19,  83), ASC_TREE_NODE(  212,  3,  84), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   41, 18,  83), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  381,  3,  83),
+    ASC_TREE_NODE(  116, 10,  84), ASC_TREE_NODE(   32, 16,  85), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   39,  4,  82), ASC_TREE_NODE(  109, 10,  83),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    3, 19,  82), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE( 1837, 11,  79),
+    ASC_TREE_NODE(   14,  6,  80), ASC_TREE_NODE( 1579,  3,  81), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   21, 15,  77),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   97, 17,  77), ASC_TREE_NODE( 1600, 11,  78), ASC_TREE_NODE(   10,  8,  79),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  425,  2,  77),
+    ASC_TREE_NODE(  401,  3,  78), ASC_TREE_NODE( 2430,  3,  79), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  154,  0,  75),
+    ASC_TREE_NODE(  786, 14,  76), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   38,  4,  76), ASC_TREE_NODE( 1961,  3,  77),
+    ASC_TREE_NODE(   38, 16,  78), ASC_TREE_NODE(   85,  0,  79), ASC_TREE_NODE(   26, 15,  80), ASC_TREE_NODE( 4988, 11,  81),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   18, 18,  81), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  102, 16,  78), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   52, 18,  77), ASC_TREE_NODE(   87,  2,  78), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    6, 15,  77), ASC_TREE_NODE( 1090,  9,  78), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   38, 17,  73), ASC_TREE_NODE(   12,  5,  74), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  321,  3,  73), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  -37, 15,  73),
+    ASC_TREE_NODE(   18,  7,  74), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(   12, 15,  68), ASC_TREE_NODE(    6, 16,  69), ASC_TREE_NODE(    9,  7,  70), ASC_TREE_NODE(   34,  9,  71),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   20,  7,  69),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  214, 14,  69), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(   38, 18,  68), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE( 1381, 14,  68), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(   69, 17,  68), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  813,  2,  68), ASC_TREE_NODE(  842, 14,  69),
+    ASC_TREE_NODE(   72, 18,  70), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   19, 15,  69),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE( 4084,  3,  65), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   11, 19,  65),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE( 2134, 14,  65), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  979,  0,  65),
+    ASC_TREE_NODE(  119,  0,  66), ASC_TREE_NODE(  822,  1,  67), ASC_TREE_NODE(   85, 10,  68), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   57, 18,  67), ASC_TREE_NODE(   33,  4,  68), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  496,  9,  67), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  216, 17,  65), ASC_TREE_NODE(   50, 18,  66), ASC_TREE_NODE(   56, 19,  67),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   29, 18,  66), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(   35, 18,  66), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   20,  4,  66), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  592, 14,  59),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   11,  8,  59), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE( 1331, 11,  55),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(   80,  0,  48), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  231, 14,  47),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE( 1220,  3,  45),
+    ASC_TREE_NODE(   31,  8,  46), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(   57,  8,  44), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    7, 19,  40), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   78, 10,  38), ASC_TREE_NODE(  136, 17,  39),
+    ASC_TREE_NODE(    7,  5,  40), ASC_TREE_NODE(   35, 15,  41), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   43, 16,  39), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    3,  4,  39),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE( 8492, 11,  37),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    8,  6,  27),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  883, 14,  27), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(   20,  3,  26), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE( 2808,  3,  25),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  135,  2,  24), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE( 1410,  3,  24), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(   25,  1,  22), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  499,  3,  22), ASC_TREE_NODE(   11,  1,  23),
+    ASC_TREE_NODE(   41, 16,  24), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   35,  4,  16), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(   92, 11,  16), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  806, 14,   9), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    3,  8,   9),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE( 2641, 14,   9), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(  364,  3,   4), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   65,  0,   1), ASC_TREE_NODE(   13,  6,   2),
+    ASC_TREE_NODE(   13, 15,   3), ASC_TREE_NODE(   55,  2,   4), ASC_TREE_NODE(  487,  1,   5), ASC_TREE_NODE(    1,  9,   6),
+    ASC_TREE_NODE(   30, 16,   7), ASC_TREE_NODE(  577,  9,   8), ASC_TREE_NODE(   52,  4,   9), ASC_TREE_NODE(   21,  8,  10),
+    ASC_TREE_NODE( 3637, 14,  11), ASC_TREE_NODE(   23,  8,  12), ASC_TREE_NODE(   32, 18,  13), ASC_TREE_NODE(  141,  9,  14),
+    ASC_TREE_NODE(   10,  6,  15), ASC_TREE_NODE(   24, 18,  16), ASC_TREE_NODE(   42, 17,  17), ASC_TREE_NODE(   10, 15,  18),
+    ASC_TREE_NODE(   13,  5,  19), ASC_TREE_NODE( 2165, 14,  20), ASC_TREE_NODE(   25, 18,  21), ASC_TREE_NODE(  106, 18,  22),
+    ASC_TREE_NODE(   46,  2,  23), ASC_TREE_NODE(    8, 15,  24), ASC_TREE_NODE(  189,  1,  25), ASC_TREE_NODE(   25, 18,  26),
+    ASC_TREE_NODE(   48, 17,  27), ASC_TREE_NODE(   99,  0,  28), ASC_TREE_NODE(   86, 10,  29), ASC_TREE_NODE(   25,  7,  30),
+    ASC_TREE_NODE(   14, 10,  31), ASC_TREE_NODE(    5,  9,  32), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1,  6,  32),
+    ASC_TREE_NODE(  374, 14,  33), ASC_TREE_NODE(   28,  4,  34), ASC_TREE_NODE(   39, 16,  35), ASC_TREE_NODE(   57,  0,  36),
+    ASC_TREE_NODE( 2496,  3,  37), ASC_TREE_NODE(   51, 16,  38), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  147, 17,  38),
+    ASC_TREE_NODE(  103, 14,  39), ASC_TREE_NODE(   17,  6,  40), ASC_TREE_NODE(  112, 18,  41), ASC_TREE_NODE(   33, 18,  42),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   40,  4,  42), ASC_TREE_NODE(   16,  4,  43), ASC_TREE_NODE(   24, 17,  44),
+    ASC_TREE_NODE(  269,  2,  45), ASC_TREE_NODE(   28, 17,  46), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    3,  6,  46),
+    ASC_TREE_NODE(   20,  7,  47), ASC_TREE_NODE(   84, 10,  48), ASC_TREE_NODE(   12,  7,  49), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE( 1069,  3,  49), ASC_TREE_NODE(   78, 17,  50), ASC_TREE_NODE(    4,  8,  51), ASC_TREE_NODE(   31,  9,  52),
+    ASC_TREE_NODE(  239,  9,  53), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   13, 10,  53), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    6,  6,  50),
+    ASC_TREE_NODE(   78, 17,  51), ASC_TREE_NODE( 2839, 14,  52), ASC_TREE_NODE(   87, 17,  53), ASC_TREE_NODE(  -49,  9,  54),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   16,  6,  52),
+    ASC_TREE_NODE(    2,  5,  53), ASC_TREE_NODE( 1899, 11,  54), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   55,  8,  54),
+    ASC_TREE_NODE(   45,  7,  55), ASC_TREE_NODE(   57, 17,  56), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(   16,  7,  55), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   23, 18,  54),
+    ASC_TREE_NODE(  330,  2,  55), ASC_TREE_NODE(   70, 10,  56), ASC_TREE_NODE(   55, 17,  57), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(   64, 18,  57), ASC_TREE_NODE( 3761,  3,  58), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  384, 14,  56), ASC_TREE_NODE(    8,  8,  57), ASC_TREE_NODE(  100,  0,  58),
+    ASC_TREE_NODE(   38,  9,  59), ASC_TREE_NODE( 2080, 11,  60), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  311,  3,  60),
+    ASC_TREE_NODE(   76,  8,  61), ASC_TREE_NODE(   10,  6,  62), ASC_TREE_NODE(    3, 16,  63), ASC_TREE_NODE(   65, 18,  64),
+    ASC_TREE_NODE(  207,  0,  65), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE( 5050, 11,  63), ASC_TREE_NODE(   24,  7,  64), ASC_TREE_NODE(   14,  6,  65), ASC_TREE_NODE(    4,  5,  66),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   37, 19,  66), ASC_TREE_NODE(  387,  2,  67), ASC_TREE_NODE(    8,  6,  68),
+    ASC_TREE_NODE(  112, 19,  69), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE( 4052,  3,  69), ASC_TREE_NODE(    5,  6,  70),
+    ASC_TREE_NODE(   49,  8,  71), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE( 1310,  3,  70),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   23, 15,  69), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE( 2725, 11,  69), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  260,  3,  69), ASC_TREE_NODE(  198,  3,  70),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   70, 18,  69), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(  536,  2,  69), ASC_TREE_NODE(   23, 14,  70), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  211, 14,  70),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   24,  4,  68),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  101,  3,  68), ASC_TREE_NODE(  -44,  6,  69), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    6, 19,  68), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  975, 11,  68),
+    ASC_TREE_NODE(   31, 17,  69), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   12,  9,  69), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE( 2164,  3,  69), ASC_TREE_NODE(   85,  2,  70), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   28, 15,  68), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   31,  4,  68),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  999,  9,  67), ASC_TREE_NODE(  132,  0,  68),
+    ASC_TREE_NODE(    9,  6,  69), ASC_TREE_NODE(    4, 13,  70), ASC_TREE_NODE(  108, 18,  71), ASC_TREE_NODE(   32,  7,  72),
+    ASC_TREE_NODE(   45,  4,  73), ASC_TREE_NODE(   12,  6,  74), ASC_TREE_NODE(   42, 15,  75), ASC_TREE_NODE(   24, 15,  76),
+    ASC_TREE_NODE( 8722,  3,  77), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  690,  2,  76),
+    ASC_TREE_NODE( 2335,  3,  77), ASC_TREE_NODE(  230,  2,  78), ASC_TREE_NODE(   14,  7,  79), ASC_TREE_NODE(   56, 18,  80),
+    ASC_TREE_NODE(   45, 16,  81), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   66,  3,  78), ASC_TREE_NODE(    7,  8,  79), ASC_TREE_NODE(   56,  0,  80),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  652, 14,  78),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    9, 19,  78), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  269, 14,  76), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    2, 11,  63), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    3, 15,  63), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(  466,  3,  63), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE( 2446, 11,  61), ASC_TREE_NODE(  531,  1,  62), ASC_TREE_NODE( 6613,  3,  63), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   25,  4,  62), ASC_TREE_NODE(   12, 16,  63), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   16,  6,  62), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   98,  9,  62),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   72, 18,  62), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  272,  2,  62),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    4,  5,  62), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE( 1401, 11,  61), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  134,  0,  60),
+    ASC_TREE_NODE(  181,  1,  61), ASC_TREE_NODE(   55,  4,  62), ASC_TREE_NODE(   59,  7,  63), ASC_TREE_NODE( 3709, 11,  64),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  156, 18,  63), ASC_TREE_NODE(    4,  6,  64),
+    ASC_TREE_NODE(  211, 17,  65), ASC_TREE_NODE( 1971, 11,  66), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(  243,  2,  65), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   -7, 15,  64),
+    ASC_TREE_NODE(   63, 19,  65), ASC_TREE_NODE(   42,  4,  66), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   23,  4,  64), ASC_TREE_NODE( -178,  0,  65), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE( 1432,  3,  65), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 14,  60),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  113,  0,  56), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  439,  2,  56),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   37, 18,  54),
+    ASC_TREE_NODE(   77, 17,  55), ASC_TREE_NODE(   62,  8,  56), ASC_TREE_NODE(  700,  2,  57), ASC_TREE_NODE(  353, 14,  58),
+    ASC_TREE_NODE(  207,  1,  59), ASC_TREE_NODE(   26,  4,  60), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  583,  3,  60),
+    ASC_TREE_NODE( 2395, 11,  61), ASC_TREE_NODE(  282, 14,  62), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(   53,  4,  61), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   34,  4,  60),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  152, 18,  59), ASC_TREE_NODE(   46, 16,  60),
+    ASC_TREE_NODE(  222,  1,  61), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE( 6538, 11,  59), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   34,  7,  59), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(   17,  3,  59), ASC_TREE_NODE(   -3,  6,  60), ASC_TREE_NODE(    2,  4,  61), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   11,  8,  58),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   53,  0,  58), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   10,  7,  56), ASC_TREE_NODE(  155,  2,  57), ASC_TREE_NODE(   12,  8,  58),
+    ASC_TREE_NODE( 3382,  3,  59), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    7,  5,  56), ASC_TREE_NODE(   11, 15,  57), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  183,  3,  56), ASC_TREE_NODE(   18, 15,  57), ASC_TREE_NODE(   32,  9,  58),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   39,  7,  56),
+    ASC_TREE_NODE(    6,  5,  57), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   49, 18,  57), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(   28,  7,  57), ASC_TREE_NODE(    6,  7,  58), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE( 1539,  2,  58),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   43,  9,  58), ASC_TREE_NODE(   13,  5,  59), ASC_TREE_NODE(  205,  3,  60),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE( 1892, 14,  60), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  710, 14,  60),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   78,  0,  60), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   44,  4,  60),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE( 2757, 11,  59), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE( 1610,  2,  53), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   45, 14,  51), ASC_TREE_NODE(   25,  3,  52),
+    ASC_TREE_NODE(   -4, 15,  53), ASC_TREE_NODE(  609,  3,  54), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(   42,  4,  53), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  166,  2,  50), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  136, 17,  50),
+    ASC_TREE_NODE(  423,  2,  51), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  172, 14,  47), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE( 3011,  3,  44),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE( 1848,  3,  43), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE( 1186, 11,  43), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   39,  1,  42),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE( 1314,  3,  41), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  892,  3,  36), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE( 1413,  3,  36),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(   41,  3,  33), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   14,  3,  32),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  518,  3,  32), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  197,  2,  26), ASC_TREE_NODE( 1755, 11,  27), ASC_TREE_NODE(   85, 10,  28),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  168,  2,  24), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  257,  2,  21), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  180,  2,  10),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(  386, 14,   7), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   13, 15,   1), ASC_TREE_NODE(   54,  0,   2), ASC_TREE_NODE(   14,  6,   3),
+    ASC_TREE_NODE(  233,  2,   4), ASC_TREE_NODE(    8, 15,   5), ASC_TREE_NODE(   56,  2,   6), ASC_TREE_NODE(   26, 16,   7),
+    ASC_TREE_NODE(   24, 18,   8), ASC_TREE_NODE(   15,  5,   9), ASC_TREE_NODE(   33,  7,  10), ASC_TREE_NODE(   48, 18,  11),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   80,  0,  11), ASC_TREE_NODE(   13,  5,  12), ASC_TREE_NODE(   26, 15,  13),
+    ASC_TREE_NODE(    3, 15,  14), ASC_TREE_NODE(    7,  8,  15), ASC_TREE_NODE(  -23, 15,  16), ASC_TREE_NODE( 4381, 11,  17),
+    ASC_TREE_NODE(   39, 17,  18), ASC_TREE_NODE( 2198, 11,  19), ASC_TREE_NODE(   50, 17,  20), ASC_TREE_NODE(   16,  6,  21),
+    ASC_TREE_NODE(  122,  9,  22), ASC_TREE_NODE(   75, 10,  23), ASC_TREE_NODE(   85, 10,  24), ASC_TREE_NODE( 5227, 14,  25),
+    ASC_TREE_NODE(   82, 17,  26), ASC_TREE_NODE(  124, 18,  27), ASC_TREE_NODE(  130, 17,  28), ASC_TREE_NODE(   52,  3,  29),
+    ASC_TREE_NODE(   60,  2,  30), ASC_TREE_NODE(   53, 19,  31), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    6,  6,  31),
+    ASC_TREE_NODE(  -21,  9,  32), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    5,  5,  32), ASC_TREE_NODE(   34,  4,  33),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   31, 18,  32), ASC_TREE_NODE(   35, 16,  33),
+    ASC_TREE_NODE(  574,  2,  34), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   59, 10,  34), ASC_TREE_NODE(    7,  6,  35),
+    ASC_TREE_NODE(   78, 17,  36), ASC_TREE_NODE(   11,  7,  37), ASC_TREE_NODE(   46,  0,  38), ASC_TREE_NODE(  142,  0,  39),
+    ASC_TREE_NODE(  293,  0,  40), ASC_TREE_NODE( 3183,  3,  41), ASC_TREE_NODE(   19,  8,  42), ASC_TREE_NODE(   69,  0,  43),
+    ASC_TREE_NODE(   44,  9,  44), ASC_TREE_NODE(   56,  0,  45), ASC_TREE_NODE(    7,  1,  46), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    8,  7,  43),
+    ASC_TREE_NODE(  228, 18,  44), ASC_TREE_NODE( 1351,  3,  45), ASC_TREE_NODE( 1661,  2,  46), ASC_TREE_NODE(   97, 17,  47),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE( 2125,  3,  47), ASC_TREE_NODE(   65,  8,  48), ASC_TREE_NODE(   32,  9,  49),
+    ASC_TREE_NODE(   95, 10,  50), ASC_TREE_NODE(   -4, 15,  51), ASC_TREE_NODE(  260,  3,  52), ASC_TREE_NODE(   35, 18,  53),
+    ASC_TREE_NODE(  107, 14,  54), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   70, 16,  54), ASC_TREE_NODE(   28,  4,  55),
+    ASC_TREE_NODE(  619,  3,  56), ASC_TREE_NODE(   58, 16,  57), ASC_TREE_NODE(   23, 10,  58), ASC_TREE_NODE(  711,  3,  59),
+    ASC_TREE_NODE(   19, 15,  60), ASC_TREE_NODE(   24, 15,  61), ASC_TREE_NODE(  891, 14,  62), ASC_TREE_NODE(    9,  6,  63),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  116,  3,  62), ASC_TREE_NODE(  809, 14,  63),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  102, 17,  63), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(   49,  0,  62), ASC_TREE_NODE(   73,  1,  63), ASC_TREE_NODE(17052, 11,  64), ASC_TREE_NODE(   17, 10,  65),
+    ASC_TREE_NODE(   96,  0,  66), ASC_TREE_NODE(   43, 15,  67), ASC_TREE_NODE( 2318, 14,  68), ASC_TREE_NODE(    1,  9,  69),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    4, 10,  69), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   39, 17,  69),
+    ASC_TREE_NODE(   30, 19,  70), ASC_TREE_NODE(   73, 14,  71), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(   28,  4,  70), ASC_TREE_NODE(   34, 10,  71), ASC_TREE_NODE(   15,  7,  72), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   10,  4,  70), ASC_TREE_NODE(    5,  3,  71),
+    ASC_TREE_NODE(  -64,  9,  72), ASC_TREE_NODE(    6, 15,  73), ASC_TREE_NODE(    4,  6,  74), ASC_TREE_NODE(   28, 16,  75),
+    ASC_TREE_NODE(  304,  2,  76), ASC_TREE_NODE(    5,  6,  77), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   11,  4,  77),
+    ASC_TREE_NODE(   38, 17,  78), ASC_TREE_NODE(  180, 14,  79), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    9,  6,  78), ASC_TREE_NODE(   42, 10,  79), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  856, 14,  79),
+    ASC_TREE_NODE(  216,  2,  80), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   12,  7,  79),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE( 1262, 14,  77),
+    ASC_TREE_NODE(   53, 18,  78), ASC_TREE_NODE(   84,  8,  79), ASC_TREE_NODE(    4,  5,  80), ASC_TREE_NODE(   69,  4,  81),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   42, 16,  80), ASC_TREE_NODE(   35, 16,  81),
+    ASC_TREE_NODE(   18,  7,  82), ASC_TREE_NODE(   18, 18,  83), ASC_TREE_NODE(    3,  5,  84), ASC_TREE_NODE(   53, 15,  85),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  126, 10,  85), ASC_TREE_NODE(  689,  3,  86), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   16,  6,  85), ASC_TREE_NODE(   52,  7,  86), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   19,  8,  85), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  102, 17,  85),
+    ASC_TREE_NODE(   77,  0,  86), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE( 1265, 14,  86), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE( 9642,  3,  85), ASC_TREE_NODE( 1400, 11,  86), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(   10,  7,  86), ASC_TREE_NODE( 4482,  1,  87), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   33,  0,  87),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  122, 16,  86), ASC_TREE_NODE(   62, 17,  87),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   71, 17,  85),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    6,  8,  85), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(   12,  7,  84), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  348,  3,  83),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    7,  7,  83), ASC_TREE_NODE(  132,  8,  84), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(   46, 10,  84), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   -1, 15,  83),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    5, 19,  82), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    4,  6,  81), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    9,  5,  81),
+    ASC_TREE_NODE(  217,  0,  82), ASC_TREE_NODE(   79, 17,  83), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(  130,  2,  82), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  204,  3,  81),
+    ASC_TREE_NODE( 1634, 11,  82), ASC_TREE_NODE(   22,  7,  83), ASC_TREE_NODE(   50, 16,  84), ASC_TREE_NODE( 3058, 11,  85),
+    ASC_TREE_NODE( 1529, 14,  86), ASC_TREE_NODE(   20,  3,  87), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    9,  6,  87),
+    ASC_TREE_NODE(   36,  8,  88), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE( 6923, 11,  88), ASC_TREE_NODE(   13,  9,  89),
+    ASC_TREE_NODE(   16,  7,  90), ASC_TREE_NODE(   24,  7,  91), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE( 1284,  3,  90), ASC_TREE_NODE(  350,  9,  91), ASC_TREE_NODE(   19,  7,  92), ASC_TREE_NODE(   25,  7,  93),
+    ASC_TREE_NODE(   33, 18,  94), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   15,  6,  90), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(   24,  5,  90), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   22,  8,  89),
+    ASC_TREE_NODE(   36, 17,  90), ASC_TREE_NODE(   99, 18,  91), ASC_TREE_NODE(   16, 19,  92), ASC_TREE_NODE(  377,  2,  93),
+    ASC_TREE_NODE(    3, 19,  94), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   10, 19,  94), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(   17,  2,  94), ASC_TREE_NODE(    4, 19,  95), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE( 3227,  3,  93), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE( 3191,  3,  93),
+    ASC_TREE_NODE(   16,  9,  94), ASC_TREE_NODE(  219, 17,  95), ASC_TREE_NODE(   21,  8,  96), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  174,  2,  94), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  174, 17,  85), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  312,  3,  85),
+    ASC_TREE_NODE(   13,  4,  86), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  828,  3,  86), ASC_TREE_NODE(  185,  3,  87),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE( 2041,  3,  87), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  317,  2,  87),
+    ASC_TREE_NODE(    5,  5,  88), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   46, 18,  88), ASC_TREE_NODE(    8,  5,  89),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   19,  8,  87),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   58, 10,  87), ASC_TREE_NODE(  599,  3,  88), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(   26,  8,  88), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   41, 16,  88), ASC_TREE_NODE(   20,  5,  89),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  211,  3,  88), ASC_TREE_NODE(   10,  8,  89),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  591, 14,  89), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    7, 16,  86), ASC_TREE_NODE(  137, 17,  87),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE( 1316,  3,  87), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   21, 16,  85), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(   10, 16,  84), ASC_TREE_NODE(   51,  4,  85), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    7, 19,  84), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE( 4506, 14,  83),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  420,  2,  83), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  155,  1,  80), ASC_TREE_NODE(   42, 15,  81),
+    ASC_TREE_NODE(   26,  5,  82), ASC_TREE_NODE(   47, 16,  83), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(   84,  0,  82), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    3,  7,  73),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   10,  7,  72), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    3,  3,  71), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    4,  5,  70), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   26,  4,  65),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   47, 10,  60), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(   59, 16,  60), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   11,  7,  60), ASC_TREE_NODE( 2965,  3,  61),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE( 1819,  3,  61), ASC_TREE_NODE(    6,  7,  62), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(   15,  7,  62), ASC_TREE_NODE(   55, 17,  63), ASC_TREE_NODE(  223,  3,  64), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(  210,  2,  64), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE( 1697, 11,  61), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(   84, 18,  60), ASC_TREE_NODE(   15, 15,  61), ASC_TREE_NODE(  174,  2,  62), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    5, 19,  58), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  691, 11,  58), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    9,  5,  54), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   32,  7,  53),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   15,  6,  51),
+    ASC_TREE_NODE(   76, 10,  52), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE( 1201,  2,  51),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE( 1505,  3,  49),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   39, 17,  32), ASC_TREE_NODE(   21,  7,  33),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   48,  3,  33), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(  793, 11,  28), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  159,  3,  28), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(   22,  8,  28), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  404, 14,  24), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE( 1300,  3,  22), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   55,  4,  21), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(  119,  2,  12), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    7,  6,   1), ASC_TREE_NODE(   66,  0,   2),
+    ASC_TREE_NODE(   29,  4,   3), ASC_TREE_NODE(   30,  4,   4), ASC_TREE_NODE(    3,  6,   5), ASC_TREE_NODE(   46,  2,   6),
+    ASC_TREE_NODE(   68,  0,   7), ASC_TREE_NODE(   24, 18,   8), ASC_TREE_NODE(   24,  7,   9), ASC_TREE_NODE(   12,  9,  10),
+    ASC_TREE_NODE(  301,  3,  11), ASC_TREE_NODE(    7,  8,  12), ASC_TREE_NODE(   54,  0,  13), ASC_TREE_NODE(   31,  6,  14),
+    ASC_TREE_NODE(   64,  9,  15), ASC_TREE_NODE(   12,  5,  16), ASC_TREE_NODE(   97,  2,  17), ASC_TREE_NODE(  182,  2,  18),
+    ASC_TREE_NODE(   -2,  6,  19), ASC_TREE_NODE(  105,  8,  20), ASC_TREE_NODE(  498,  3,  21), ASC_TREE_NODE(   53, 17,  22),
+    ASC_TREE_NODE(   33,  7,  23), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   12,  6,  23), ASC_TREE_NODE(    8,  5,  24),
+    ASC_TREE_NODE(   22, 16,  25), ASC_TREE_NODE(   69,  9,  26), ASC_TREE_NODE(   90,  2,  27), ASC_TREE_NODE(   20,  8,  28),
+    ASC_TREE_NODE(   32, 16,  29), ASC_TREE_NODE(   34, 17,  30), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  228, 18,  30),
+    ASC_TREE_NODE(    8, 15,  31), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   57, 17,  31), ASC_TREE_NODE(  113, 17,  32),
+    ASC_TREE_NODE(   91, 17,  33), ASC_TREE_NODE(   41, 17,  34), ASC_TREE_NODE(    8,  7,  35), ASC_TREE_NODE(  207, 11,  36),
+    ASC_TREE_NODE( 1855,  1,  37), ASC_TREE_NODE(    4,  9,  38), ASC_TREE_NODE(    4,  5,  39), ASC_TREE_NODE(   68, 10,  40),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  558, 14,  39), ASC_TREE_NODE(  182,  1,  40),
+    ASC_TREE_NODE(   13,  6,  41), ASC_TREE_NODE(  297,  9,  42), ASC_TREE_NODE(   49, 17,  43), ASC_TREE_NODE(    4,  8,  44),
+    ASC_TREE_NODE(   49,  2,  45), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE( 3051, 11,  45), ASC_TREE_NODE(    9,  6,  46),
+    ASC_TREE_NODE(   25, 15,  47), ASC_TREE_NODE(  451,  9,  48), ASC_TREE_NODE(   15, 15,  49), ASC_TREE_NODE(    5,  9,  50),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  248,  9,  50), ASC_TREE_NODE(  224, 17,  51), ASC_TREE_NODE(   17,  9,  52),
+    ASC_TREE_NODE(   50, 17,  53), ASC_TREE_NODE(   -7,  6,  54), ASC_TREE_NODE(  183,  2,  55), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    3, 15,  54), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1,  6,  54),
+    ASC_TREE_NODE(   70,  0,  55), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    6, 19,  54),
+    ASC_TREE_NODE(   55, 10,  55), ASC_TREE_NODE(   22, 15,  56), ASC_TREE_NODE( 2759, 14,  57), ASC_TREE_NODE(    6,  6,  58),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   84, 16,  58), ASC_TREE_NODE(   83, 10,  59), ASC_TREE_NODE(   42, 17,  60),
+    ASC_TREE_NODE(   21, 15,  61), ASC_TREE_NODE(   13, 15,  62), ASC_TREE_NODE(   32, 18,  63), ASC_TREE_NODE(   19, 18,  64),
+    ASC_TREE_NODE(   10,  6,  65), ASC_TREE_NODE(  224,  3,  66), ASC_TREE_NODE(   93, 18,  67), ASC_TREE_NODE(   11,  7,  68),
+    ASC_TREE_NODE( 2293,  3,  69), ASC_TREE_NODE(   67,  0,  70), ASC_TREE_NODE(   10,  6,  71), ASC_TREE_NODE(    1,  5,  72),
+    ASC_TREE_NODE( 1260, 11,  73), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   11,  6,  73), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   13,  7,  72), ASC_TREE_NODE(   49,  4,  73), ASC_TREE_NODE(  123, 17,  74),
+    ASC_TREE_NODE(   33,  7,  75), ASC_TREE_NODE(  941,  3,  76), ASC_TREE_NODE(  254,  2,  77), ASC_TREE_NODE( 2370, 11,  78),
+    ASC_TREE_NODE(   41, 15,  79), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   18, 17,  79), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE( 3906, 11,  79), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   62, 19,  78),
+    ASC_TREE_NODE(  121,  3,  79), ASC_TREE_NODE(   10,  7,  80), ASC_TREE_NODE(   41,  8,  81), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(  -95,  0,  81), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   47,  4,  81), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(   86, 17,  81), ASC_TREE_NODE(    7,  5,  82), ASC_TREE_NODE(   25, 17,  83), ASC_TREE_NODE(   35,  4,  84),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   98, 16,  82),
+    ASC_TREE_NODE(    3, 19,  83), ASC_TREE_NODE(   32, 17,  84), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   23, 10,  82), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(  480,  2,  81), ASC_TREE_NODE(    6, 19,  82), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  104, 16,  82),
+    ASC_TREE_NODE(   58,  9,  83), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(   46,  0,  77), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE( 1304, 11,  72),
+    ASC_TREE_NODE(   41, 17,  73), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   27,  4,  73), ASC_TREE_NODE(  327,  3,  74),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   13, 15,  74), ASC_TREE_NODE(   14, 15,  75), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE( 1209, 11,  74), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  677,  3,  74),
+    ASC_TREE_NODE(   21, 16,  75), ASC_TREE_NODE(  160,  2,  76), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(   33,  7,  75), ASC_TREE_NODE(  104, 18,  76), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  683, 14,  76),
+    ASC_TREE_NODE(   71,  4,  77), ASC_TREE_NODE(   16, 15,  78), ASC_TREE_NODE(  194,  9,  79), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(  939,  9,  79), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   36,  8,  79), ASC_TREE_NODE(   69, 10,  80),
+    ASC_TREE_NODE(  948,  0,  81), ASC_TREE_NODE(    3,  0,  82), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE( 3900, 11,  82),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  123, 16,  82), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(   17,  7,  81), ASC_TREE_NODE(   38, 17,  82), ASC_TREE_NODE(    4,  5,  83), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(   72, 11,  83), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   -2,  9,  83), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(  -34,  9,  83), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE( 1449, 14,  83), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(  587,  3,  83), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  173,  0,  83), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   49, 10,  82), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    5,  8,  82),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    2,  6,  81), ASC_TREE_NODE(   19, 11,  82),
+    ASC_TREE_NODE(  277, 11,  83), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  432,  3,  79), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(   73, 17,  79), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  384, 11,  79), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   38, 18,  77), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   84, 10,  74),
+    ASC_TREE_NODE(   82,  0,  75), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   59,  8,  75), ASC_TREE_NODE(   16,  6,  76),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   54,  4,  75), ASC_TREE_NODE(    7, 19,  76),
+    ASC_TREE_NODE(   36, 10,  77), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(  204,  3,  75), ASC_TREE_NODE( 4708,  3,  76), ASC_TREE_NODE(  485,  2,  77), ASC_TREE_NODE(    1,  5,  78),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   61,  7,  77), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    4, 16,  77), ASC_TREE_NODE(  164,  2,  78), ASC_TREE_NODE(  123, 10,  79), ASC_TREE_NODE( 2464,  3,  80),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   16,  6,  78),
+    ASC_TREE_NODE(   25,  7,  79), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  513,  3,  79), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  249,  9,  78), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(  124, 16,  77), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   49, 17,  77), ASC_TREE_NODE(   15, 15,  78),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  952,  3,  74), ASC_TREE_NODE(   44,  4,  75), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE( 1193,  3,  75), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  108, 14,  71), ASC_TREE_NODE(   28,  8,  72),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(   50, 10,  69), ASC_TREE_NODE(    4,  7,  70), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   18, 14,  70),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE( 2099,  3,  68),
+    ASC_TREE_NODE(  534,  2,  69), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   72, 17,  68),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  600, 11,  67), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   75,  0,  66), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(   21, 15,  65), ASC_TREE_NODE(   56,  0,  66), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   20,  7,  64), ASC_TREE_NODE(  115, 17,  65), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE( 1033, 11,  64), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   44, 18,  62), ASC_TREE_NODE(   36, 17,  63), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  104,  8,  62), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE( 2430,  3,  60), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE( 1201,  3,  60),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   36,  4,  60), ASC_TREE_NODE(   49,  4,  61), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE( 1314,  1,  61), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    9,  7,  60),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE( 2486,  3,  49), ASC_TREE_NODE(   36, 17,  50), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    3,  4,  50),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   75, 18,  50), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   15,  4,  48), ASC_TREE_NODE(  233,  2,  49), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   33, 16,  42),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  211,  3,  42), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(  803, 14,  41), ASC_TREE_NODE(   18,  7,  42), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   19, 15,  42),
+    ASC_TREE_NODE(  304,  9,  43), ASC_TREE_NODE(   21,  9,  44), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   92, 10,  41), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   74, 18,  40), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1,  8,  37), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    7,  5,  37), ASC_TREE_NODE(   19,  6,  38), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   62,  3,  34),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   27, 17,  30), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  230,  2,  30),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   70, 10,  22), ASC_TREE_NODE(   50, 17,  23), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(   13,  6,  23), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   40, 18,  23), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(   99, 10,  23), ASC_TREE_NODE(   11, 19,  24), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(   23, 19,  23), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE( 1975, 11,  22),
+    ASC_TREE_NODE(    8,  5,  23), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(   50, 15,  13), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  252, 11,  12),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE( 1275,  3,  12), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   60, 18,  12),
+    ASC_TREE_NODE(   18,  7,  13), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   28,  8,  13), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(   35,  4,   9), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  572, 14,   8),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   24, 10,   7), ASC_TREE_NODE(   17,  8,   8),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   63,  4,   2),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   13, 15,   1),
+    ASC_TREE_NODE(   52,  0,   2), ASC_TREE_NODE(   23, 15,   3), ASC_TREE_NODE(  224,  2,   4), ASC_TREE_NODE(   40, 17,   5),
+    ASC_TREE_NODE(   75, 17,   6), ASC_TREE_NODE(   55,  0,   7), ASC_TREE_NODE(   24, 18,   8), ASC_TREE_NODE(   62,  4,   9),
+    ASC_TREE_NODE(    3,  6,  10), ASC_TREE_NODE(    8, 15,  11), ASC_TREE_NODE(   74,  0,  12), ASC_TREE_NODE(   83,  0,  13),
+    ASC_TREE_NODE(   39, 18,  14), ASC_TREE_NODE(   28, 16,  15), ASC_TREE_NODE(    3, 15,  16), ASC_TREE_NODE(   55, 19,  17),
+    ASC_TREE_NODE(   12,  9,  18), ASC_TREE_NODE( 2800,  3,  19), ASC_TREE_NODE(   16,  8,  20), ASC_TREE_NODE(  102,  3,  21),
+    ASC_TREE_NODE(   32,  7,  22), ASC_TREE_NODE( 1304, 11,  23), ASC_TREE_NODE(   69, 16,  24), ASC_TREE_NODE(   44, 17,  25),
+    ASC_TREE_NODE(    7,  8,  26), ASC_TREE_NODE(    6,  6,  27), ASC_TREE_NODE(  163,  2,  28), ASC_TREE_NODE(   65, 16,  29),
+    ASC_TREE_NODE(   38, 15,  30), ASC_TREE_NODE(   80,  9,  31), ASC_TREE_NODE(  128, 10,  32), ASC_TREE_NODE(    3, 19,  33),
+    ASC_TREE_NODE(    8,  8,  34), ASC_TREE_NODE( 1931, 14,  35), ASC_TREE_NODE(   10,  7,  36), ASC_TREE_NODE(   24, 18,  37),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   10,  9,  36), ASC_TREE_NODE(   35,  9,  37),
+    ASC_TREE_NODE(    8, 15,  38), ASC_TREE_NODE(    6, 19,  39), ASC_TREE_NODE(   93,  8,  40), ASC_TREE_NODE(  779,  3,  41),
+    ASC_TREE_NODE(    8,  8,  42), ASC_TREE_NODE(   46,  4,  43), ASC_TREE_NODE(  163,  1,  44), ASC_TREE_NODE( 1014, 14,  45),
+    ASC_TREE_NODE(    7, 12,  46), ASC_TREE_NODE(   18, 15,  47), ASC_TREE_NODE(   23,  7,  48), ASC_TREE_NODE(  402,  2,  49),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   82, 17,  49), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE( 2193, 11,  49),
+    ASC_TREE_NODE(19315,  1,  50), ASC_TREE_NODE(  105,  2,  51), ASC_TREE_NODE(    5, 16,  52), ASC_TREE_NODE(   57, 18,  53),
+    ASC_TREE_NODE(   39,  4,  54), ASC_TREE_NODE(   39, 15,  55), ASC_TREE_NODE(    2, 19,  56), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    9, 15,  54), ASC_TREE_NODE(    1, 11,  55),
+    ASC_TREE_NODE(    4,  5,  56), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  -12, 15,  56), ASC_TREE_NODE(   58, 17,  57),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   21, 10,  57), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    5,  5,  57),
+    ASC_TREE_NODE(  -17,  6,  58), ASC_TREE_NODE(    5,  5,  59), ASC_TREE_NODE(   11, 19,  60), ASC_TREE_NODE(   21,  4,  61),
+    ASC_TREE_NODE(  129,  0,  62), ASC_TREE_NODE(  426,  3,  63), ASC_TREE_NODE(   16,  7,  64), ASC_TREE_NODE(  772, 14,  65),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   10, 19,  65), ASC_TREE_NODE(   61, 16,  66), ASC_TREE_NODE(  227, 17,  67),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    9,  5,  67), ASC_TREE_NODE(   24, 18,  68), ASC_TREE_NODE( 3849, 11,  69),
+    ASC_TREE_NODE(   75, 18,  70), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  119, 14,  70), ASC_TREE_NODE(  -11,  9,  71),
+    ASC_TREE_NODE(    4,  8,  72), ASC_TREE_NODE(   19,  8,  73), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   45,  2,  73),
+    ASC_TREE_NODE(13162,  3,  74), ASC_TREE_NODE(  130, 17,  75), ASC_TREE_NODE(  162,  0,  76), ASC_TREE_NODE(   11,  7,  77),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   16,  7,  76), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(  463,  3,  76), ASC_TREE_NODE(   22, 10,  77), ASC_TREE_NODE(  128, 10,  78), ASC_TREE_NODE(   37,  4,  79),
+    ASC_TREE_NODE(   74,  8,  80), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   80,  2,  80), ASC_TREE_NODE(   11,  6,  81),
+    ASC_TREE_NODE(   52,  4,  82), ASC_TREE_NODE(   75,  2,  83), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   18, 18,  83),
+    ASC_TREE_NODE(  200,  2,  84), ASC_TREE_NODE(   44, 18,  85), ASC_TREE_NODE(  220, 17,  86), ASC_TREE_NODE(    1,  4,  87),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    6,  6,  85),
+    ASC_TREE_NODE(   -6,  6,  86), ASC_TREE_NODE(   16,  6,  87), ASC_TREE_NODE(   98, 17,  88), ASC_TREE_NODE(   46, 17,  89),
+    ASC_TREE_NODE(  560, 14,  90), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE( 1691,  2,  89),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   67,  3,  85), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   11,  4,  85),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   41,  5,  84), ASC_TREE_NODE(   53,  0,  85),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(   41, 18,  82), ASC_TREE_NODE(  452,  2,  83), ASC_TREE_NODE(   25,  9,  84), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   27,  8,  83), ASC_TREE_NODE(  337,  3,  84), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(   28,  4,  84), ASC_TREE_NODE(   33, 10,  85), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE( 1960, 11,  85),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 14,  84), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   14, 15,  83), ASC_TREE_NODE(    9, 12,  84), ASC_TREE_NODE(   92,  0,  85),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE( -115,  0,  84), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   30,  4,  81),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   70,  1,  81), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  545,  1,  81),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   12, 19,  80), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    2, 11,  79), ASC_TREE_NODE(  224, 14,  80), ASC_TREE_NODE(   30,  9,  81),
+    ASC_TREE_NODE(  224,  1,  82), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   38, 16,  81),
+    ASC_TREE_NODE( 1329,  2,  82), ASC_TREE_NODE(  -17,  9,  83), ASC_TREE_NODE(   11,  6,  84), ASC_TREE_NODE(    6, 19,  85),
+    ASC_TREE_NODE( 5148, 14,  86), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    5,  2,  86), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  256,  9,  85), ASC_TREE_NODE(   36, 16,  86), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    9,  5,  86), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE( 1058,  9,  85),
+    ASC_TREE_NODE(  122, 16,  86), ASC_TREE_NODE(  569,  3,  87), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  -17,  9,  87),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  114,  3,  87), ASC_TREE_NODE(  561,  3,  88), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(   18,  4,  88), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(   12,  4,  86), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  470, 14,  83), ASC_TREE_NODE(   95, 10,  84), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   36,  4,  83), ASC_TREE_NODE(  295,  3,  84), ASC_TREE_NODE(  118,  2,  85),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   90,  3,  84), ASC_TREE_NODE(  513,  3,  85),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(   12,  0,  82), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  501,  1,  82), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(   32,  4,  78), ASC_TREE_NODE(   22,  4,  79), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE( 3942, 11,  77), ASC_TREE_NODE(   38,  4,  78), ASC_TREE_NODE(  111, 16,  79),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE( 1855,  3,  77),
+    ASC_TREE_NODE(   18,  7,  78), ASC_TREE_NODE(  105, 17,  79), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   90,  0,  75),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE( 1020,  3,  75), ASC_TREE_NODE(   33,  7,  76), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(  419, 14,  76), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  329,  3,  76), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(   70,  4,  76), ASC_TREE_NODE(   19, 10,  77), ASC_TREE_NODE(    2,  8,  78), ASC_TREE_NODE(   13,  8,  79),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   77,  0,  79), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    3, 19,  77), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  924, 14,  77),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    8,  7,  77), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE( 4349,  3,  75), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  124, 16,  75),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   28, 10,  74), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE( -189,  9,  67),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  276, 14,  65),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  860, 14,  65), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    3, 19,  64), ASC_TREE_NODE(   15,  4,  65), ASC_TREE_NODE(   75, 17,  66), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(  445,  2,  66), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    1,  5,  60), ASC_TREE_NODE(    9,  6,  61), ASC_TREE_NODE(   44, 18,  62), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(  358,  3,  62), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  134, 17,  62), ASC_TREE_NODE( 3222, 11,  63),
+    ASC_TREE_NODE(   41,  9,  64), ASC_TREE_NODE(  122,  2,  65), ASC_TREE_NODE(  251,  3,  66), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   11,  5,  65), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   94,  1,  65),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE( 7548, 11,  65), ASC_TREE_NODE(  813, 14,  66), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  246,  3,  64), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   64,  4,  62), ASC_TREE_NODE(   45, 16,  63),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE( 1663,  3,  63), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    5,  5,  63),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   69,  4,  63), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  901, 14,  52), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   26, 16,  51), ASC_TREE_NODE(   10,  5,  52), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(   67, 17,  48), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(   16,  7,  46), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   78, 18,  46), ASC_TREE_NODE(  111,  0,  47),
+    ASC_TREE_NODE( 1288,  3,  48), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  136, 17,  45), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(  565, 14,  44), ASC_TREE_NODE(   33,  7,  45), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   69,  4,  41),
+    ASC_TREE_NODE(   89, 17,  42), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   37, 18,  42), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   81, 17,  36), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   31, 10,  35), ASC_TREE_NODE(  536, 14,  36), ASC_TREE_NODE(   47, 17,  37),
+    ASC_TREE_NODE(    9,  5,  38), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    4,  6,  34), ASC_TREE_NODE(   23,  7,  35),
+    ASC_TREE_NODE(  211,  0,  36), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  197,  3,  33), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   19,  7,  33),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE( -469,  9,  31),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   19, 15,  30), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  104,  2,  25), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   17,  6,  25),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(   46, 17,  22), ASC_TREE_NODE(   24, 15,  23), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   39,  7,  23),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  188,  0,  23), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 19,  21), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   38,  7,  19), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(   16, 19,  18), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(  352,  3,  16), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   18,  6,  16), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(   22,  7,  16), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   45,  4,  13), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   26,  8,  10), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   26,  8,   7),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(   13, 15,   1), ASC_TREE_NODE(  125,  2,   2), ASC_TREE_NODE(   63,  0,   3), ASC_TREE_NODE(   31,  0,   4),
+    ASC_TREE_NODE(   99,  0,   5), ASC_TREE_NODE(   16,  6,   6), ASC_TREE_NODE(   25, 15,   7), ASC_TREE_NODE(   21, 17,   8),
+    ASC_TREE_NODE(   46, 17,   9), ASC_TREE_NODE(   14,  7,  10), ASC_TREE_NODE(    4,  6,  11), ASC_TREE_NODE(  158,  2,  12),
+    ASC_TREE_NODE(   11, 19,  13), ASC_TREE_NODE(   66, 17,  14), ASC_TREE_NODE(   16, 16,  15), ASC_TREE_NODE(    3, 15,  16),
+    ASC_TREE_NODE(   75, 19,  17), ASC_TREE_NODE(    8, 15,  18), ASC_TREE_NODE(   30, 19,  19), ASC_TREE_NODE(   38, 17,  20),
+    ASC_TREE_NODE(  263,  2,  21), ASC_TREE_NODE(   41, 17,  22), ASC_TREE_NODE(   34, 16,  23), ASC_TREE_NODE(   68, 17,  24),
+    ASC_TREE_NODE(   48, 16,  25), ASC_TREE_NODE(  575, 14,  26), ASC_TREE_NODE(   36, 18,  27), ASC_TREE_NODE(    7,  8,  28),
+    ASC_TREE_NODE(   14,  8,  29), ASC_TREE_NODE(   33, 15,  30), ASC_TREE_NODE(  218,  9,  31), ASC_TREE_NODE(    7,  1,  32),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  197, 17,  32), ASC_TREE_NODE( 1541,  3,  33), ASC_TREE_NODE(   17, 19,  34),
+    ASC_TREE_NODE(   36, 17,  35), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   69, 10,  35), ASC_TREE_NODE(    2,  9,  36),
+    ASC_TREE_NODE(  376,  2,  37), ASC_TREE_NODE(   14,  3,  38), ASC_TREE_NODE(   19,  5,  39), ASC_TREE_NODE(    8,  4,  40),
+    ASC_TREE_NODE(   19,  7,  41), ASC_TREE_NODE(   60,  3,  42), ASC_TREE_NODE(   51, 18,  43), ASC_TREE_NODE(  148,  9,  44),
+    ASC_TREE_NODE(  103,  8,  45), ASC_TREE_NODE(  188,  9,  46), ASC_TREE_NODE(    5,  8,  47), ASC_TREE_NODE(   39,  4,  48),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   12,  5,  48), ASC_TREE_NODE( 3440, 14,  49), ASC_TREE_NODE(   35, 18,  50),
+    ASC_TREE_NODE(  109,  0,  51), ASC_TREE_NODE(    7,  6,  52), ASC_TREE_NODE(  284,  0,  53), ASC_TREE_NODE(  439,  0,  54),
+    ASC_TREE_NODE(   32,  7,  55), ASC_TREE_NODE(   41,  4,  56), ASC_TREE_NODE(   11,  7,  57), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    6,  2,  57), ASC_TREE_NODE(   55,  2,  58), ASC_TREE_NODE(   28,  8,  59), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  680,  3,  57), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    9,  8,  57), ASC_TREE_NODE(  126, 17,  58), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE( 1517,  2,  58),
+    ASC_TREE_NODE(    7, 12,  59), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   10, 15,  59), ASC_TREE_NODE(   50, 14,  60),
+    ASC_TREE_NODE(   51, 18,  61), ASC_TREE_NODE(   26, 18,  62), ASC_TREE_NODE( 2256,  3,  63), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(   35,  1,  63), ASC_TREE_NODE(  128, 10,  64), ASC_TREE_NODE(  897,  9,  65), ASC_TREE_NODE(    6, 15,  66),
+    ASC_TREE_NODE(   27,  8,  67), ASC_TREE_NODE(    7,  8,  68), ASC_TREE_NODE(   19,  1,  69), ASC_TREE_NODE(   69, 16,  70),
+    ASC_TREE_NODE( 1613, 14,  71), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(  282,  1,  69), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    7,  5,  69), ASC_TREE_NODE(  284,  3,  70),
+    ASC_TREE_NODE(   27,  7,  71), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  105, 17,  70),
+    ASC_TREE_NODE(   17,  7,  71), ASC_TREE_NODE(   74,  0,  72), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   36, 17,  72),
+    ASC_TREE_NODE( 1064,  2,  73), ASC_TREE_NODE(  240, 11,  74), ASC_TREE_NODE( 1418, 14,  75), ASC_TREE_NODE(    7,  6,  76),
+    ASC_TREE_NODE(   98, 10,  77), ASC_TREE_NODE(   17,  5,  78), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    7, 16,  78),
+    ASC_TREE_NODE(  111, 10,  79), ASC_TREE_NODE(  103,  2,  80), ASC_TREE_NODE(   37, 15,  81), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(   43, 16,  81), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE( 2455,  1,  79), ASC_TREE_NODE(   93, 16,  80), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE( 2452,  3,  75), ASC_TREE_NODE(   82, 16,  76), ASC_TREE_NODE(    1,  4,  77), ASC_TREE_NODE(   17, 17,  78),
+    ASC_TREE_NODE(    3, 15,  79), ASC_TREE_NODE(  377,  2,  80), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   -2, 15,  78), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(  265,  2,  77), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   24, 17,  76),
+    ASC_TREE_NODE(  747, 14,  77), ASC_TREE_NODE(  277,  9,  78), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   40,  4,  78),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(  239, 11,  75), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   43, 18,  75), ASC_TREE_NODE(   15,  4,  76),
+    ASC_TREE_NODE(   34,  7,  77), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   34,  4,  77), ASC_TREE_NODE(    8,  7,  78),
+    ASC_TREE_NODE(   31, 17,  79), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   27, 15,  79), ASC_TREE_NODE(   15, 15,  80),
+    ASC_TREE_NODE(  955, 14,  81), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   21,  8,  81), ASC_TREE_NODE(  314,  3,  82),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   54,  4,  81), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  745, 14,  80), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   51, 18,  80),
+    ASC_TREE_NODE(   49,  9,  81), ASC_TREE_NODE( 1891,  3,  82), ASC_TREE_NODE(   56, 11,  83), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  510,  2,  82), ASC_TREE_NODE(   12,  6,  83), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(   13,  7,  83), ASC_TREE_NODE(   14, 19,  84), ASC_TREE_NODE(    3, 16,  85), ASC_TREE_NODE(   13, 16,  86),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  104,  8,  86), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(   51, 15,  85), ASC_TREE_NODE(   12,  7,  86), ASC_TREE_NODE(   37, 18,  87), ASC_TREE_NODE(   40,  9,  88),
+    ASC_TREE_NODE(   86,  0,  89), ASC_TREE_NODE( 3578, 11,  90), ASC_TREE_NODE(   18,  7,  91), ASC_TREE_NODE(   11, 15,  92),
+    ASC_TREE_NODE( 5093, 11,  93), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    5,  4,  93), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   24, 17,  91), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE( 1865,  3,  88),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   53,  3,  88), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  628,  3,  88),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   72, 17,  87), ASC_TREE_NODE(  939,  2,  88),
+    ASC_TREE_NODE(   12, 15,  89), ASC_TREE_NODE(  105,  3,  90), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  101,  0,  90),
+    ASC_TREE_NODE(   11, 15,  91), ASC_TREE_NODE(   21,  7,  92), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   11, 15,  90), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  108,  3,  90),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  271,  3,  90), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   11,  6,  87), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   63, 16,  82), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(  561, 14,  81), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   23,  5,  80),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(   12, 19,  77), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   51, 17,  77), ASC_TREE_NODE(   79,  8,  78),
+    ASC_TREE_NODE(   21,  5,  79), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(  460,  3,  77), ASC_TREE_NODE( 1742,  1,  78), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   16,  4,  78),
+    ASC_TREE_NODE( 1040,  3,  79), ASC_TREE_NODE(  118, 16,  80), ASC_TREE_NODE( 2265, 14,  81), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(  479,  3,  81), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  794,  3,  81), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   62,  8,  80), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE( 2035, 11,  79), ASC_TREE_NODE(  161,  2,  80), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  503, 11,  80),
+    ASC_TREE_NODE(  762, 14,  81), ASC_TREE_NODE(   44,  4,  82), ASC_TREE_NODE(   16, 10,  83), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    2,  8,  83), ASC_TREE_NODE(   11,  6,  84), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(  120,  2,  83), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   -3,  6,  72), ASC_TREE_NODE(   10,  5,  73), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(   21,  4,  73), ASC_TREE_NODE(  230,  2,  74), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(   -6,  6,  73), ASC_TREE_NODE(    3, 19,  74), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   35,  4,  72), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  115, 14,  68),
+    ASC_TREE_NODE(  201,  2,  69), ASC_TREE_NODE(   20,  4,  70), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   22,  4,  62),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  -15,  9,  62), ASC_TREE_NODE(  145, 18,  63), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE( 6338,  3,  59), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   12,  5,  58),
+    ASC_TREE_NODE(   79,  0,  59), ASC_TREE_NODE(  344,  0,  60), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  392,  1,  57), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   46,  7,  55), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE( 1868,  3,  55), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   33, 15,  54),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   28, 15,  54), ASC_TREE_NODE(   26,  7,  55), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   55, 18,  53), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE( 2476,  3,  53), ASC_TREE_NODE(   34,  4,  54), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(  462,  3,  53), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE( 1988, 11,  53), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE( 1076,  3,  53), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  214,  2,  52),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  117, 16,  51), ASC_TREE_NODE(  205,  3,  52),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE( 2521, 11,  48), ASC_TREE_NODE(  381,  2,  49), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  661,  3,  48), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  344,  3,  48),
+    ASC_TREE_NODE(  824, 11,  49), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   38,  3,  46), ASC_TREE_NODE( 2180, 14,  47), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(  108, 17,  47), ASC_TREE_NODE(  257, 14,  48), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  671,  0,  46), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   68, 18,  40), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  191,  2,  40),
+    ASC_TREE_NODE(  146, 17,  41), ASC_TREE_NODE(   39, 15,  42), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(   40,  4,  41), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   26,  1,  40),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE( 1223, 14,  40), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   33, 17,  38), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    7,  5,  36), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    7,  5,  35), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   38,  9,  31), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(  923,  3,  31), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  160,  2,  30),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(   28,  1,  23), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   10,  5,  23), ASC_TREE_NODE( 2075,  3,  24),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(   33,  0,  21), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    9, 12,  13), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(   14, 15,  13), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE( 1109,  3,  13), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(  432,  2,   9), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   14, 15,   1),
+    ASC_TREE_NODE(    3,  8,   2), ASC_TREE_NODE(   24, 15,   3), ASC_TREE_NODE(   52,  0,   4), ASC_TREE_NODE(  164,  2,   5),
+    ASC_TREE_NODE(   55,  0,   6), ASC_TREE_NODE(   51,  2,   7), ASC_TREE_NODE(   20, 18,   8), ASC_TREE_NODE(    1,  9,   9),
+    ASC_TREE_NODE(   66,  0,  10), ASC_TREE_NODE(   31, 17,  11), ASC_TREE_NODE(   31, 18,  12), ASC_TREE_NODE(   70, 17,  13),
+    ASC_TREE_NODE(   25,  6,  14), ASC_TREE_NODE(   30, 16,  15), ASC_TREE_NODE(    2, 19,  16), ASC_TREE_NODE(    5,  6,  17),
+    ASC_TREE_NODE(    8, 15,  18), ASC_TREE_NODE(  126,  3,  19), ASC_TREE_NODE(   24, 18,  20), ASC_TREE_NODE(   43, 17,  21),
+    ASC_TREE_NODE(    1,  5,  22), ASC_TREE_NODE(    4,  6,  23), ASC_TREE_NODE(   21,  1,  24), ASC_TREE_NODE(   11,  6,  25),
+    ASC_TREE_NODE(  109,  0,  26), ASC_TREE_NODE(  586, 11,  27), ASC_TREE_NODE(   39,  0,  28), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(  175,  0,  28), ASC_TREE_NODE(   55,  0,  29), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   31,  2,  29),
+    ASC_TREE_NODE(    5,  3,  30), ASC_TREE_NODE(   43, 18,  31), ASC_TREE_NODE(   80, 10,  32), ASC_TREE_NODE(  105,  3,  33),
+    ASC_TREE_NODE(   13,  3,  34), ASC_TREE_NODE(   40, 17,  35), ASC_TREE_NODE(    4, 19,  36), ASC_TREE_NODE(   55, 19,  37),
+    ASC_TREE_NODE(    9, 15,  38), ASC_TREE_NODE(    7,  8,  39), ASC_TREE_NODE(  148, 18,  40), ASC_TREE_NODE(    8, 19,  41),
+    ASC_TREE_NODE(   32,  7,  42), ASC_TREE_NODE(    9,  5,  43), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  109, 17,  43),
+    ASC_TREE_NODE(   83,  3,  44), ASC_TREE_NODE(   15,  5,  45), ASC_TREE_NODE(   15,  8,  46), ASC_TREE_NODE(    7,  8,  47),
+    ASC_TREE_NODE(  126, 18,  48), ASC_TREE_NODE(    7,  6,  49), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(   11, 19,  48), ASC_TREE_NODE(    5,  9,  49), ASC_TREE_NODE(    6, 19,  50), ASC_TREE_NODE(    9,  5,  51),
+    ASC_TREE_NODE(    6,  2,  52), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE( 1513,  2,  52), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(  746,  3,  52), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   81, 10,  51),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(   13,  4,  48), ASC_TREE_NODE(  348,  0,  49), ASC_TREE_NODE(    1,  7,  50), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(  575,  9,  50), ASC_TREE_NODE( -464,  9,  51), ASC_TREE_NODE(   64, 18,  52), ASC_TREE_NODE(    9,  7,  53),
+    ASC_TREE_NODE(    5,  6,  54), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   23, 18,  54), ASC_TREE_NODE(   23,  4,  55),
+    ASC_TREE_NODE(   -1,  6,  56), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    7, 15,  56), ASC_TREE_NODE(   53, 16,  57),
+    ASC_TREE_NODE(    9,  7,  58), ASC_TREE_NODE(  248,  2,  59), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(   76, 14,  58), ASC_TREE_NODE(   36, 17,  59), ASC_TREE_NODE(   21, 16,  60), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(  110,  2,  60), ASC_TREE_NODE(   26,  8,  61), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   27,  4,  61),
+    ASC_TREE_NODE(   15, 15,  62), ASC_TREE_NODE(  262,  3,  63), ASC_TREE_NODE(   95, 10,  64), ASC_TREE_NODE(   89,  9,  65),
+    ASC_TREE_NODE(  476, 11,  66), ASC_TREE_NODE(  125, 10,  67), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   57, 18,  67),
+    ASC_TREE_NODE(   40, 18,  68), ASC_TREE_NODE(  105, 17,  69), ASC_TREE_NODE(   50, 16,  70), ASC_TREE_NODE(   62,  9,  71),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1,  7,  71), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    3,  3,  71),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(   28,  9,  68), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   54,  0,  68), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  228, 18,  66), ASC_TREE_NODE( 1889, 14,  67),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(11871, 11,  67), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  720, 11,  67),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   31, 16,  66), ASC_TREE_NODE( 1914, 11,  67),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(  -11,  6,  64), ASC_TREE_NODE(  193,  3,  65), ASC_TREE_NODE(   12,  9,  66), ASC_TREE_NODE(   61, 10,  67),
+    ASC_TREE_NODE(  563,  3,  68), ASC_TREE_NODE(  126,  9,  69), ASC_TREE_NODE(    2, 13,  70), ASC_TREE_NODE(   39,  9,  71),
+    ASC_TREE_NODE(   59,  4,  72), ASC_TREE_NODE( 2190, 11,  73), ASC_TREE_NODE(   39,  3,  74), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(  460,  3,  74), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  799, 14,  73),
+    ASC_TREE_NODE(   23, 15,  74), ASC_TREE_NODE(   60, 16,  75), ASC_TREE_NODE(   17,  8,  76), ASC_TREE_NODE( 1903,  3,  77),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  106,  1,  77), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   10,  9,  77),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE( 1191,  3,  75),
+    ASC_TREE_NODE(  635,  0,  76), ASC_TREE_NODE(   16,  8,  77), ASC_TREE_NODE(   50,  0,  78), ASC_TREE_NODE(   17, 16,  79),
+    ASC_TREE_NODE(   17,  6,  80), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    5, 19,  80), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   33,  4,  78), ASC_TREE_NODE(  136,  2,  79),
+    ASC_TREE_NODE(    3, 13,  80), ASC_TREE_NODE(   22,  8,  81), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   38, 15,  81),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   52, 16,  76), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   84,  3,  75), ASC_TREE_NODE(   32, 19,  76), ASC_TREE_NODE(   25,  7,  77),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(  153,  3,  74), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    8,  7,  72), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  403,  3,  71),
+    ASC_TREE_NODE(  223, 17,  72), ASC_TREE_NODE(   27, 14,  73), ASC_TREE_NODE(  187, 11,  74), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(  233,  2,  70), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  173,  3,  70), ASC_TREE_NODE(    8, 19,  71),
+    ASC_TREE_NODE(   11,  6,  72), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    2, 15,  71),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    3,  5,  68), ASC_TREE_NODE(17401, 11,  69), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  787,  3,  69),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE( 1596,  3,  68), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  147, 18,  66), ASC_TREE_NODE( 3009,  3,  67),
+    ASC_TREE_NODE(   32,  4,  68), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(  891, 11,  66), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE( 1448, 14,  66), ASC_TREE_NODE(   18, 15,  67),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  150, 17,  66), ASC_TREE_NODE(  664,  3,  67),
+    ASC_TREE_NODE( 3185, 11,  68), ASC_TREE_NODE(   49,  0,  69), ASC_TREE_NODE(  335,  3,  70), ASC_TREE_NODE(  126, 10,  71),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   34, 16,  70), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   55,  4,  69), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   41,  4,  69),
+    ASC_TREE_NODE(  128,  2,  70), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE( 5256,  3,  63), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE( 1123,  2,  61), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(   62, 17,  60), ASC_TREE_NODE(    7,  4,  61), ASC_TREE_NODE(   54, 10,  62), ASC_TREE_NODE(   37, 17,  63),
+    ASC_TREE_NODE(   63, 11,  64), ASC_TREE_NODE(   60, 17,  65), ASC_TREE_NODE(   14,  3,  66), ASC_TREE_NODE(  195,  0,  67),
+    ASC_TREE_NODE(   10,  1,  68), ASC_TREE_NODE(   25, 18,  69), ASC_TREE_NODE(   50, 18,  70), ASC_TREE_NODE(   12,  6,  71),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   13, 15,  69),
+    ASC_TREE_NODE(   41, 10,  70), ASC_TREE_NODE(   44,  4,  71), ASC_TREE_NODE(   70, 18,  72), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE( 1672,  2,  68), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   21,  9,  64), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE( 1095,  9,  63), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE( 1407, 14,  63),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  774,  3,  63), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   39, 15,  63),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE( 1388,  3,  62), ASC_TREE_NODE(  173,  1,  63),
+    ASC_TREE_NODE(   30,  3,  64), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  416,  2,  64), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  251, 14,  62), ASC_TREE_NODE(   35,  6,  63),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  124,  0,  63), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   21, 19,  63),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(   28,  4,  60), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    3,  7,  60), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  168,  0,  58), ASC_TREE_NODE(   -5,  6,  59),
+    ASC_TREE_NODE(   42,  4,  60), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   15,  5,  60), ASC_TREE_NODE(   13, 15,  61),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   31, 14,  60), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(   27, 18,  60), ASC_TREE_NODE(  136, 17,  61), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(  772,  3,  60), ASC_TREE_NODE(  221,  2,  61), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  521,  2,  61),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   48, 16,  56), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(  449, 11,  56), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  297,  3,  55),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   10,  6,  55), ASC_TREE_NODE(   95,  0,  56), ASC_TREE_NODE(   33, 19,  57),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  105, 10,  47),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  619,  2,  47), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(  129,  2,  46), ASC_TREE_NODE(   68, 16,  47), ASC_TREE_NODE(   87,  0,  48), ASC_TREE_NODE(   79,  8,  49),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   57, 10,  49), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(  442,  3,  48), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  516,  2,  48), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  -47,  9,  46), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(   32,  3,  42), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  450, 14,  42), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   24,  4,  39),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  268,  2,  38), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(   69,  3,  38), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE( 2387, 14,  36), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE( 1934,  3,  32), ASC_TREE_NODE(   52, 18,  33),
+    ASC_TREE_NODE(  144,  0,  34), ASC_TREE_NODE(  638, 14,  35), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   30,  7,  35),
+    ASC_TREE_NODE(  939, 11,  36), ASC_TREE_NODE(    5,  1,  37), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE( 1121,  2,  37),
+    ASC_TREE_NODE(  494,  9,  38), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   48, 11,  38), ASC_TREE_NODE(   44, 16,  39),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   -6,  6,  38), ASC_TREE_NODE(  601,  2,  39),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    7,  7,  39), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(   65, 18,  38), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  900, 14,  35), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   10, 19,  28), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE( 1130,  3,  26), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE( 1259, 14,  21), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   65,  4,  21),
+    ASC_TREE_NODE(   17,  3,  22), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  465,  3,  19), ASC_TREE_NODE( 2009, 14,  20), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   68,  1,  17),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   31,  4,  16), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(  129,  2,  12), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  107,  0,   1), ASC_TREE_NODE( 1994,  3,   2), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   13, 15,   1), ASC_TREE_NODE(    4,  6,   2),
+    ASC_TREE_NODE(   57,  0,   3), ASC_TREE_NODE(  168,  2,   4), ASC_TREE_NODE(   53, 17,   5), ASC_TREE_NODE(   27, 18,   6),
+    ASC_TREE_NODE(   23, 15,   7), ASC_TREE_NODE(   23, 17,   8), ASC_TREE_NODE(    6, 15,   9), ASC_TREE_NODE(   48, 16,  10),
+    ASC_TREE_NODE(   22,  8,  11), ASC_TREE_NODE(   17, 15,  12), ASC_TREE_NODE(   25, 15,  13), ASC_TREE_NODE(   88, 18,  14),
+    ASC_TREE_NODE(   81, 10,  15), ASC_TREE_NODE(    3, 15,  16), ASC_TREE_NODE( 3703,  1,  17), ASC_TREE_NODE(    6,  8,  18),
+    ASC_TREE_NODE(   42, 17,  19), ASC_TREE_NODE(   83,  0,  20), ASC_TREE_NODE(   21, 10,  21), ASC_TREE_NODE(   63,  2,  22),
+    ASC_TREE_NODE(   59,  4,  23), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  118,  8,  23), ASC_TREE_NODE(  206, 14,  24),
+    ASC_TREE_NODE(   14,  7,  25), ASC_TREE_NODE(   63, 10,  26), ASC_TREE_NODE(   88,  9,  27), ASC_TREE_NODE(   10,  6,  28),
+    ASC_TREE_NODE(   33, 16,  29), ASC_TREE_NODE(    7,  9,  30), ASC_TREE_NODE(   33,  5,  31), ASC_TREE_NODE(  106, 16,  32),
+    ASC_TREE_NODE( 3803, 14,  33), ASC_TREE_NODE(   17,  9,  34), ASC_TREE_NODE(   32,  7,  35), ASC_TREE_NODE(  626,  2,  36),
+    ASC_TREE_NODE(  100, 18,  37), ASC_TREE_NODE(   24, 18,  38), ASC_TREE_NODE(    7,  8,  39), ASC_TREE_NODE(   43,  4,  40),
+    ASC_TREE_NODE(  219, 14,  41), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   12,  9,  41), ASC_TREE_NODE(  200,  3,  42),
+    ASC_TREE_NODE( 2129, 11,  43), ASC_TREE_NODE(   12,  5,  44), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE( 2540, 11,  44),
+    ASC_TREE_NODE(  681,  2,  45), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   28, 16,  45), ASC_TREE_NODE(  505,  2,  46),
+    ASC_TREE_NODE(  196,  3,  47), ASC_TREE_NODE(  601, 14,  48), ASC_TREE_NODE( 1850, 11,  49), ASC_TREE_NODE(   80, 17,  50),
+    ASC_TREE_NODE(   38,  8,  51), ASC_TREE_NODE(  175,  0,  52), ASC_TREE_NODE(    8,  5,  53), ASC_TREE_NODE(   12,  1,  54),
+    ASC_TREE_NODE(    7,  2,  55), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   66,  0,  54),
+    ASC_TREE_NODE(  212, 17,  55), ASC_TREE_NODE(   85, 18,  56), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    2,  7,  55), ASC_TREE_NODE(  173,  8,  56), ASC_TREE_NODE( 1355,  3,  57), ASC_TREE_NODE(   14,  8,  58),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   36,  3,  58), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE( 2021, 11,  58),
+    ASC_TREE_NODE(   23, 19,  59), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  190,  2,  59), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   15, 14,  58), ASC_TREE_NODE(   41,  0,  59), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(  174,  3,  59), ASC_TREE_NODE(   41, 18,  60), ASC_TREE_NODE(   60,  9,  61), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  537, 14,  60), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  151,  2,  60),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    6,  8,  60), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(   97, 17,  59), ASC_TREE_NODE(    8,  6,  60), ASC_TREE_NODE(   48, 17,  61), ASC_TREE_NODE(   65, 10,  62),
+    ASC_TREE_NODE(   20,  7,  63), ASC_TREE_NODE(   89, 17,  64), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  100, 10,  64),
+    ASC_TREE_NODE(   16,  7,  65), ASC_TREE_NODE( 1936,  3,  66), ASC_TREE_NODE(  189,  0,  67), ASC_TREE_NODE(   47, 16,  68),
+    ASC_TREE_NODE(   60,  9,  69), ASC_TREE_NODE(    9,  5,  70), ASC_TREE_NODE(    3,  5,  71), ASC_TREE_NODE(  767, 14,  72),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    8,  2,  71), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   37,  4,  69), ASC_TREE_NODE(  108,  0,  70),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   84,  2,  69), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(   47, 18,  69), ASC_TREE_NODE(  217,  2,  70), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE( 3635,  3,  69), ASC_TREE_NODE(    8,  8,  70), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   53,  4,  70),
+    ASC_TREE_NODE(   20,  7,  71), ASC_TREE_NODE(  282,  3,  72), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   16,  4,  70), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(   78,  2,  69), ASC_TREE_NODE(   66, 10,  70), ASC_TREE_NODE(    9, 12,  71), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(   80, 18,  71), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    5, 19,  71), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(   74,  0,  71), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(   13,  7,  69), ASC_TREE_NODE(   24,  0,  70), ASC_TREE_NODE(   10, 19,  71), ASC_TREE_NODE(  191, 14,  72),
+    ASC_TREE_NODE(   11, 19,  73), ASC_TREE_NODE(   36, 17,  74), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  -11,  9,  74),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  106,  0,  73), ASC_TREE_NODE(   74,  0,  74),
+    ASC_TREE_NODE(    7,  5,  75), ASC_TREE_NODE(    1, 10,  76), ASC_TREE_NODE(   18,  9,  77), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   34,  4,  75), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE( 1930, 14,  75), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   25,  9,  75), ASC_TREE_NODE(   79,  9,  76),
+    ASC_TREE_NODE(   12,  6,  77), ASC_TREE_NODE(  522, 11,  78), ASC_TREE_NODE(   44,  8,  79), ASC_TREE_NODE(   50, 18,  80),
+    ASC_TREE_NODE( 2468, 11,  81), ASC_TREE_NODE(    5,  1,  82), ASC_TREE_NODE(    7, 16,  83), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(   61,  4,  83), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   26, 17,  82),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  210, 14,  81), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE( 2530,  3,  81), ASC_TREE_NODE( 1476,  3,  82), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(   37, 17,  81), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE( 7860, 14,  81), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(   46, 18,  81), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  277,  9,  80),
+    ASC_TREE_NODE(    7,  8,  81), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  444, 14,  81), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  317,  2,  76), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   73, 18,  76),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  230,  0,  75), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(   37, 16,  75), ASC_TREE_NODE(   53,  3,  76), ASC_TREE_NODE(   28,  4,  77), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(   69, 18,  77), ASC_TREE_NODE(    7,  8,  78), ASC_TREE_NODE(   65, 17,  79), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(   36, 10,  79), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE( 3677, 14,  79), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(   50, 16,  79), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(   13,  7,  77), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    8,  6,  77), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE( 2122,  3,  77), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   53,  4,  77), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(   17,  7,  77), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   12,  6,  77), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  157,  3,  76), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   73, 10,  76),
+    ASC_TREE_NODE(   48, 10,  77), ASC_TREE_NODE(   65,  4,  78), ASC_TREE_NODE( 1241,  2,  79), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    5, 19,  79), ASC_TREE_NODE(  131,  0,  80), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(  525, 14,  79), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   12, 19,  79), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(   32, 15,  79), ASC_TREE_NODE(   69,  8,  80), ASC_TREE_NODE(  364,  2,  81), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    9,  3,  80), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  330,  3,  78), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   -7, 15,  76), ASC_TREE_NODE(   13,  7,  77), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(   19, 19,  73), ASC_TREE_NODE( 1262, 11,  74), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(   46,  9,  69), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(  149, 17,  67), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(  783,  2,  65), ASC_TREE_NODE(  561,  3,  66), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  608,  3,  66),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   15,  7,  65), ASC_TREE_NODE( 1144,  3,  66),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE( 1694,  3,  66), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(   14, 15,  65), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   80, 17,  65), ASC_TREE_NODE(  533,  3,  66),
+    ASC_TREE_NODE(    3,  5,  67), ASC_TREE_NODE(   55, 18,  68), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE( 4720, 14,  63), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   86,  2,  62),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE( 1858,  3,  62), ASC_TREE_NODE(  663,  2,  63), ASC_TREE_NODE( 1599, 14,  64),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   33,  7,  64), ASC_TREE_NODE(   15, 19,  65), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    6, 19,  65), ASC_TREE_NODE(   16, 19,  66), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    3,  5,  66),
+    ASC_TREE_NODE(   41, 15,  67), ASC_TREE_NODE(  361,  9,  68), ASC_TREE_NODE(  916,  9,  69), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    6,  5,  67), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(   96, 10,  67), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  348,  2,  64), ASC_TREE_NODE(    3, 15,  65), ASC_TREE_NODE( 1662, 14,  66),
+    ASC_TREE_NODE(   53, 10,  67), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   91, 17,  63), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(   19,  8,  55), ASC_TREE_NODE(  561, 14,  56), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE( 1113, 14,  56),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  573, 14,  55), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  379,  3,  54), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(   22, 16,  53), ASC_TREE_NODE( 1235,  3,  54), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   39,  4,  47), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE( 1653,  3,  47), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   17,  6,  47), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE( 1462, 11,  43), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   17,  7,  43), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   44,  4,  40),
+    ASC_TREE_NODE(    2, 16,  41), ASC_TREE_NODE(    2,  3,  42), ASC_TREE_NODE(  988,  0,  43), ASC_TREE_NODE(   46, 18,  44),
+    ASC_TREE_NODE(   57,  4,  45), ASC_TREE_NODE(   20,  4,  46), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    4,  7,  45), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE( 3496, 11,  45), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(   46, 16,  45), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   22, 19,  44),
+    ASC_TREE_NODE( 1606, 14,  45), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    9, 19,  38), ASC_TREE_NODE(   33,  4,  39), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE( 1861,  3,  21), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  346,  0,  19), ASC_TREE_NODE( 3743, 11,  20),
+    ASC_TREE_NODE(  113, 18,  21), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1,  6,  17), ASC_TREE_NODE(   12, 19,  18),
+    ASC_TREE_NODE(17420, 11,  19), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(  120, 18,  19), ASC_TREE_NODE(   35, 18,  20),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(  676,  3,  19), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   11,  8,  12),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(   36,  4,  12), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(  393, 14,   7), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    8,  8,   6),
+    ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(    1, 20,   0),
+    ASC_TREE_NODE(    0, 20,   0), ASC_TREE_NODE(    1, 20,   0), ASC_TREE_NODE(   19,  7,   1), ASC_TREE_NODE(    0, 20,   0),
+    ASC_TREE_NODE(    1, 20,   0),
+};
@@ -0,0 +1,199 @@
+#!/usr/bin/env python3
+# Copyright (c) 2020 Intel Corporation
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in all
+# copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+# SOFTWARE.
+
+"""Convert the scene change random forest in src/tree.cpp into src/tree_table.cpp.
+
+Every SCDetect<N> function of tree.cpp is a binary tree of
+    if (feature < thr) {...} else if (feature >= thr) {...}
+splits ending in "return 0/1". Each tree is laid out in level order, the
+two children of a split are adjacent and follow the parent at a short offset,
+so a tree is walked with node += offset + (value >= threshold). The offset
+of a leaf is 0, it stays in place until the walk of the whole forest ends.
+
+Usage: asc_tree_gen.py [tree.cpp [tree_table.cpp]]
+"""
+
+import os
+import re
+import sys
+
+# Feature order of ASCTreeFeature in include/tree.h (SCDetectRF argument order).
+FEATURES = [
+    'diffMVdiffVal', 'RsCsDiff', 'MVDiff', 'Rs', 'AFD',
+    'CsDiff', 'diffTSC', 'TSC', 'gchDC', 'diffRsCsdiff',
+    'posBalance', 'SC', 'TSCindex', 'Scindex', 'Cs',
+    'diffAFD', 'negBalance', 'ssDCval', 'refDCval', 'RsDiff',
+]
+SIGNED = {'diffMVdiffVal', 'diffTSC', 'diffRsCsdiff', 'diffAFD'}
+LEAF = len(FEATURES)
+# node is packed to mfxU32: threshold (mfxI16) | feature << 16 | child offset << 21
+MIN_THRESHOLD = -32767
+MAX_THRESHOLD = 32767
+OFFSET_BITS = 11
+MAX_OFFSET = (1 << OFFSET_BITS) - 1
+
+RE_FUNC = re.compile(r'^bool (SCDetect[0-9A-F]+)\(')
+RE_IF = re.compile(r'^(else )?if \((\w+) (<|>=) (-?\d+)\) \{$')
+RE_RET = re.compile(r'^return ([01]);$')
+
+
+class Node(object):
+    def __init__(self, feature=LEAF, threshold=0, left=None, right=None):
+        self.feature = feature
+        self.threshold = threshold
+        self.children = (left, right) if left else ()
+
+
+def parse_tree(lines, pos):
+    """Parse one split or leaf starting at lines[pos], return (node, next pos)."""
+    m = RE_RET.match(lines[pos])
+    if m:
+        return Node(threshold=int(m.group(1))), pos + 1
+
+    m = RE_IF.match(lines[pos])
+    if not m or m.group(1) or m.group(3) != '<':
+        raise ValueError('unexpected line %d: %s' % (pos, lines[pos]))
+    name, thr = m.group(2), int(m.group(4))
+    left, pos = parse_tree(lines, pos + 1)
+    if lines[pos] != '}':
+        raise ValueError('unclosed "if" at line %d' % pos)
+
+    m = RE_IF.match(lines[pos + 1])
+    if not m or not m.group(1) or m.group(3) != '>=' or m.group(2) != name or int(m.group(4)) != thr:
+        raise ValueError('split at line %d is not "%s < %d / %s >= %d"' % (pos + 1, name, thr, name, thr))
+    right, pos = parse_tree(lines, pos + 2)
+    if lines[pos] != '}':
+        raise ValueError('unclosed "else if" at line %d' % pos)
+
+    if name not in FEATURES:
+        raise ValueError('unknown feature %s' % name)
+    # unsigned features are compared as clamped mfxI32, which is exact only for non negative thresholds
+    if name not in SIGNED and thr < 0:
+        raise ValueError('negative threshold %d for unsigned feature %s' % (thr, name))
+    return Node(FEATURES.index(name), thr, left, right), pos + 1
+
+
+def parse_forest(path):
+    with open(path) as f:
+        lines = [l.strip() for l in f]
+    lines = [l for l in lines if l and not l.startswith('//')]
+
+    trees = []
+    pos = 0
+    while pos < len(lines):
+        m = RE_FUNC.match(lines[pos])
+        if not m:
+            pos += 1
+            continue
+        root, pos = parse_tree(lines, pos + 1)
+        # tree.cpp closes every function with an unreachable "return 0;"
+        if RE_RET.match(lines[pos]):
+            pos += 1
+        if lines[pos] != '}':
+            raise ValueError('%s is not a single tree' % m.group(1))
+        trees.append((m.group(1), root))
+    return trees
+
+
+def layout(trees):
+    """Level order layout of every tree, trees are stored one after another."""
+    table = []
+    roots = []
+    for name, root in trees:
+        base = len(table)
+        order = []
+        index = {}
+        level = [root]
+        while level:
+            for node in level:
+                index[id(node)] = base + len(order)
+                order.append(node)
+            level = [child for node in level for child in node.children]
+
+        for node in order:
+            pos = index[id(node)]
+            if node.children:
+                left = index[id(node.children[0])]
+                assert index[id(node.children[1])] == left + 1
+                table.append((node.threshold, node.feature, left - pos))
+            else:
+                table.append((node.threshold, LEAF, 0))
+        roots.append(base)
+
+    for thr, feature, offset in table:
+        if not (MIN_THRESHOLD <= thr <= MAX_THRESHOLD):
+            raise ValueError('threshold %d does not fit mfxI16' % thr)
+        if offset > MAX_OFFSET:
+            raise ValueError('child offset %d does not fit %d bits' % (offset, OFFSET_BITS))
+    return table, roots
+
+
+def max_depth(node):
+    return 1 + max([max_depth(c) for c in node.children] or [0])
+
+
+def write_table(path, trees, table, roots):
+    license = []
+    with open(__file__) as f:
+        for l in f.readlines()[1:]:
+            if not l.startswith('#'):
+                break
+            license.append('//' + l[1:])
+
+    out = []
+    out.extend(license)
+    out.append('\n')
+    out.append('// Generated by tools/asc_tree_gen.py from src/tree.cpp, do not edit.\n')
+    out.append('\n')
+    out.append('#include "../include/tree.h"\n')
+    out.append('\n')
+    out.append('static_assert(ASC_TREE_COUNT == %d, "tree.h is out of sync with tree_table.cpp");\n' % len(trees))
+    out.append('static_assert(ASC_TREE_NODE_COUNT == %d, "tree.h is out of sync with tree_table.cpp");\n' % len(table))
+    out.append('static_assert(ASC_TREE_DEPTH == %d, "tree.h is out of sync with tree_table.cpp");\n' % max(max_depth(r) for _, r in trees))
+    out.append('\n')
+    out.append('const mfxU16 ASC_TREE_ROOT[ASC_TREE_COUNT] =\n{\n')
+    for i in range(0, len(roots), 8):
+        out.append('   ' + ''.join(' %5d,' % r for r in roots[i:i + 8]) + '\n')
+    out.append('};\n')
+    out.append('\n')
+    out.append('// ASC_TREE_NODE(threshold, feature, offset)\n')
+    out.append('const mfxU32 ASC_TREE_NODES[ASC_TREE_NODE_COUNT] =\n{\n')
+    for i in range(0, len(table), 4):
+        out.append('   ' + ''.join(' ASC_TREE_NODE(%5d, %2d, %3d),' % n for n in table[i:i + 4]) + '\n')
+    out.append('};\n')
+
+    with open(path, 'w') as f:
+        f.write(''.join(out))
+
+
+def main():
+    root = os.path.join(os.path.dirname(os.path.abspath(__file__)), '..')
+    src = sys.argv[1] if len(sys.argv) > 1 else os.path.join(root, 'src', 'tree.cpp')
+    dst = sys.argv[2] if len(sys.argv) > 2 else os.path.join(root, 'src', 'tree_table.cpp')
+
+    trees = parse_forest(src)
+    table, roots = layout(trees)
+    write_table(dst, trees, table, roots)
+    print('%s: %d trees, %d nodes' % (os.path.normpath(dst), len(trees), len(table)))
+
+
+if __name__ == '__main__':
+    main()
@@ -21,6 +21,8 @@
 #ifndef _LIBMFX_ALLOCATOR_H_
 #define _LIBMFX_ALLOCATOR_H_
 
+#include <map>
+#include <mutex>
 #include <vector>
 #include "mfxvideo.h"
 
@@ -53,10 +55,46 @@ namespace mfxDefaultAllocator
     };
 }
 
+// Process wide cache of the system memory blocks behind the internal buffers
+// and frames. Blocks are rounded up to size classes and kept on free lists,
+// so Init/Reset/Close cycles of sessions reuse them instead of going through
+// the heap. Returned memory is 64 byte aligned.
+class mfxBufferPool
+{
+public:
+    static mfxBufferPool& Instance();
+
+    // bZero - the block must be zeroed, freshly mapped pages are not touched
+    void* Alloc(size_t nbytes, bool bZero);
+    void  Free(void* ptr);
+
+    ~mfxBufferPool();
+
+private:
+    struct Block
+    {
+        size_t  size;   // size class, header included
+        mfxU32  mapped; // allocated with mmap
+    };
+
+    mfxBufferPool();
+    mfxBufferPool(const mfxBufferPool&) = delete;
+    mfxBufferPool& operator=(const mfxBufferPool&) = delete;
+
+    static size_t GetClassSize(size_t nbytes);
+    static Block* AllocBlock(size_t size, bool& bZeroed);
+    static void   FreeBlock(Block* block);
+
+    std::mutex                            m_guard;
+    std::map<size_t, std::vector<Block*>> m_free;   // by size class
+    size_t                                m_cached; // bytes on the free lists
+};
+
 class mfxWideBufferAllocator
 {
 public:
     std::vector<mfxDefaultAllocator::BufferStruct*> m_bufHdl;
+    std::vector<mfxU32>                             m_freeHdl; // released slots of m_bufHdl
     mfxWideBufferAllocator(void);
     ~mfxWideBufferAllocator(void);
     mfxBufferAllocator bufferAllocator;
@@ -269,6 +269,7 @@ protected:
 
     API_1_19_Adapter                           m_API_1_19;
 
+    CoreMetrics                                m_metrics;
 
     mfxU16                                     m_deviceId;
 
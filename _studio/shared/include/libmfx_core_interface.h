@@ -24,6 +24,9 @@
 #include "mfx_common.h"
 #include <mfxvideo++int.h>
 
+#include <atomic>
+#include <chrono>
+
 // {1F5BB140-6BB4-416e-81FF-4A8C030FBDC6}
 static const
 MFX_GUID  MFXIVideoCORE_GUID =
@@ -111,6 +114,10 @@ static const MFX_GUID MFXICORE_GT_CONFIG_GUID =
 static const MFX_GUID MFXIFEIEnabled_GUID =
 { 0x7df28d19, 0x889a, 0x45c1,{ 0xaa, 0x5, 0xa4, 0xf7, 0xef, 0xae, 0x95, 0x28 } };
 
+// {4A2D6C71-0B8E-4F3A-A5D2-7E91C3B05F68}
+static const MFX_GUID MFXICORE_METRICS_GUID =
+{ 0x4a2d6c71, 0x0b8e, 0x4f3a,{ 0xa5, 0xd2, 0x7e, 0x91, 0xc3, 0xb0, 0x5f, 0x68 } };
+
 // Try to obtain required interface
 // Declare a template to query an interface
 template <class T> inline
@@ -266,6 +273,43 @@ struct CMEnabledCoreInterface
     virtual ~CMEnabledCoreInterface() {}
 };
 
+// Load counters of the core reported by MFXVideoCORE_GetMetrics. Writers are
+// on the hot path, so the counters are relaxed atomics without any ordering.
+struct CoreMetrics
+{
+    static const MFX_GUID & getGuid()
+    {
+        return MFXICORE_METRICS_GUID;
+    }
+
+    // surfaces of the decoders' frame allocators
+    std::atomic<mfxI32> surfacesInUse{0};
+    std::atomic<mfxI32> surfacesTotal{0};
+    // DoFastCopyExtended calls, time is in nanoseconds
+    std::atomic<mfxU64> copyCalls{0};
+    std::atomic<mfxU64> copyTime{0};
+
+    // Accounts one copy on the scope exit
+    class CopyScope
+    {
+    public:
+        CopyScope(CoreMetrics &metrics)
+            : m_metrics(metrics)
+            , m_start(std::chrono::steady_clock::now())
+        {}
+
+        ~CopyScope()
+        {
+            auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - m_start);
+            m_metrics.copyCalls.fetch_add(1, std::memory_order_relaxed);
+            m_metrics.copyTime.fetch_add(elapsed.count(), std::memory_order_relaxed);
+        }
+
+    private:
+        CoreMetrics &m_metrics;
+        std::chrono::steady_clock::time_point m_start;
+    };
+};
 
 #endif // __LIBMFX_CORE_INTERFACE_H__
 /* EOF */
@@ -29,6 +29,7 @@
 //#define MFX_TRACE_ENABLE_ITT
 //#define MFX_TRACE_ENABLE_TEXTLOG
 //#define MFX_TRACE_ENABLE_STAT
+//#define MFX_TRACE_ENABLE_CHROME
 
 #if (defined(LINUX32) || defined(ANDROID)) && defined(MFX_TRACE_ENABLE_ITT) && !defined(MFX_TRACE_ENABLE_FTRACE)
     // Accompany ITT trace with ftrace. This combination is used by VTune.
@@ -42,7 +43,7 @@
     #define MFX_TRACE_ENABLE_REFLECT
 #endif
 
-#if defined(MFX_TRACE_ENABLE_TEXTLOG) || defined(MFX_TRACE_ENABLE_STAT) || defined(MFX_TRACE_ENABLE_ITT) || defined(MFX_TRACE_ENABLE_FTRACE)
+#if defined(MFX_TRACE_ENABLE_TEXTLOG) || defined(MFX_TRACE_ENABLE_STAT) || defined(MFX_TRACE_ENABLE_ITT) || defined(MFX_TRACE_ENABLE_FTRACE) || defined(MFX_TRACE_ENABLE_CHROME)
 #define MFX_TRACE_ENABLE
 #endif
 
@@ -84,6 +85,7 @@ enum
 
     MFX_TRACE_OUTPUT_ITT    = 0x10,
     MFX_TRACE_OUTPUT_FTRACE = 0x20,
+    MFX_TRACE_OUTPUT_CHROME = 0x40,
     // special keys
     MFX_TRACE_OUTPUT_ALL     = 0xFFFFFFFF,
     MFX_TRACE_OUTPUT_REG     = MFX_TRACE_OUTPUT_ALL // output mode should be read from registry
@@ -347,6 +349,11 @@ mfxTraceU32 MFXTrace_EndTask(mfxTraceStaticHandle *static_handle,
 #define MFX_LTRACE_BUFFER(_level, _buffer) \
     MFX_LTRACE_BUFFER_S(_level, #_buffer, _buffer, sizeof(*_buffer)) \
 
+// counter track of the given series (pointer), drawn by the outputs which support it
+// and printed as a regular message by the others
+#define MFX_LTRACE_COUNTER(_level, _name, _series, _value) \
+    MFX_LTRACE_2(_level, "^Counter^" _name, "%p %d", _series, _value)
+
 #define MFX_LTRACE_GUID(_level, _guid) \
     MFX_LTRACE((MFX_TRACE_PARAMS, _level, #_guid " = ", \
                MFX_TRACE_FORMAT_GUID, \
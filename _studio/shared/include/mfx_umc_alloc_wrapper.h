@@ -21,6 +21,7 @@
 #ifndef _MFX_ALLOC_WRAPPER_H_
 #define _MFX_ALLOC_WRAPPER_H_
 
+#include <atomic>
 #include <vector>
 #include <memory> // unique_ptr
 
@@ -31,6 +32,8 @@
 
 #include "mfxvideo++int.h"
 
+struct CoreMetrics;
+
 #define MFX_UMC_MAX_ALLOC_SIZE 128
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -139,6 +142,15 @@ public:
     };
 
 protected:
+    // std::atomic which can be kept in the containers, copying is not atomic
+    template <class T>
+    struct CopyableAtomic : std::atomic<T>
+    {
+        CopyableAtomic(T value = T()) : std::atomic<T>(value) {}
+        CopyableAtomic(const CopyableAtomic& other) : std::atomic<T>(other.load()) {}
+        CopyableAtomic& operator=(const CopyableAtomic& other) { this->store(other.load()); return *this; }
+    };
+
     struct  surf_descr
     {
         surf_descr(mfxFrameSurface1* FrameSurface, bool isUsed):FrameSurface(FrameSurface),
@@ -149,14 +161,117 @@ protected:
                      isUsed(false)
         {
         };
-        mfxFrameSurface1* FrameSurface;
-        bool              isUsed;
+        CopyableAtomic<mfxFrameSurface1*> FrameSurface; // read by FindSurface without the lock
+        bool                              isUsed;
+    };
+
+    // Append only storage, elements never move. So they are accessed without
+    // the lock while the array grows under it, only clear() and shrinking
+    // require that nobody uses the elements.
+    template <class T>
+    class StableArray
+    {
+    public:
+        StableArray() : m_size(0) {}
+
+        mfxU32 size() const { return m_size.load(std::memory_order_acquire); }
+
+        T&       operator[](size_t index)       { return m_chunks[index >> CHUNK_BITS][index & (CHUNK_SIZE - 1)]; }
+        const T& operator[](size_t index) const { return m_chunks[index >> CHUNK_BITS][index & (CHUNK_SIZE - 1)]; }
+
+        void resize(size_t size)
+        {
+            mfxU32 current = m_size.load(std::memory_order_relaxed);
+            for (size_t i = size; i < current; i++)
+                (*this)[i] = T();
+
+            Reserve(size);
+            m_size.store((mfxU32)size, std::memory_order_release);
+        }
+
+        void push_back(const T& value)
+        {
+            mfxU32 current = m_size.load(std::memory_order_relaxed);
+            Reserve(current + 1);
+            (*this)[current] = value;
+            m_size.store(current + 1, std::memory_order_release);
+        }
+
+        void clear()
+        {
+            m_size.store(0, std::memory_order_release);
+            for (auto& chunk : m_chunks)
+                chunk.reset();
+        }
+
+    private:
+        static const size_t CHUNK_BITS = 5;
+        static const size_t CHUNK_SIZE = 1 << CHUNK_BITS;
+        static const size_t MAX_CHUNKS = 256;
+
+        void Reserve(size_t size)
+        {
+            if (size > CHUNK_SIZE * MAX_CHUNKS)
+                throw std::bad_alloc();
+
+            for (size_t i = 0; i < (size + CHUNK_SIZE - 1) >> CHUNK_BITS; i++)
+            {
+                if (!m_chunks[i])
+                    m_chunks[i].reset(new T[CHUNK_SIZE]());
+            }
+        }
+
+        std::unique_ptr<T[]> m_chunks[MAX_CHUNKS];
+        std::atomic<mfxU32>  m_size;
+    };
+
+    // Pointer to index hash. Inserts are done under the lock, lookups are
+    // not. Keys are never removed, so the found index has to be verified;
+    // the tables replaced on growth are kept till Clear() for the readers.
+    class SurfaceIndex
+    {
+    public:
+        SurfaceIndex();
+
+        void   Insert(const void* key, mfxI32 index);
+        mfxI32 Find(const void* key) const;
+        void   Clear();
+
+    private:
+        struct Entry
+        {
+            std::atomic<const void*> key;
+            std::atomic<mfxI32>      index;
+        };
+
+        struct Table
+        {
+            mfxU32                   mask;
+            mfxU32                   used;
+            std::unique_ptr<Entry[]> entries;
+        };
+
+        static mfxU32 Hash(const void* key);
+        static void   Place(Table& table, const void* key, mfxI32 index);
+
+        std::atomic<Table*>                 m_table;
+        std::vector<std::unique_ptr<Table>> m_tables; // current and replaced ones
     };
 
     virtual UMC::Status Free(UMC::FrameMemID mid);
 
     virtual mfxI32 AddSurface(mfxFrameSurface1 *surface);
 
+    // Keeps m_surfaceIndex in sync, all not null surfaces are set with it
+    void SetExtSurface(mfxU32 index, mfxFrameSurface1 *surface);
+
+    // Adds MemId of the internal surface to the lookups
+    void IndexSurface(mfxU32 index);
+    mfxI32 FindSurfaceByMemId(mfxMemId memId, bool isOpaq);
+
+    // Publish the surface counters to the core metrics
+    void UpdateMetrics(mfxI32 surfacesInUse, mfxI32 surfacesTotal);
+
     class InternalFrameData
     {
         class FrameRefInfo
@@ -165,7 +280,7 @@ protected:
             FrameRefInfo();
             void Reset();
 
-            mfxU32 m_referenceCounter;
+            CopyableAtomic<mfxU32> m_referenceCounter;
         };
 
         typedef std::pair<mfxFrameSurface1, UMC::FrameData> FrameInfo;
@@ -178,6 +293,11 @@ protected:
         mfxU32 IncreaseRef(mfxU32 index);
         mfxU32 DecreaseRef(mfxU32 index);
 
+        // Change the counter only if it does not leave or reach 0, these
+        // changes are done under the lock as the surface is allocated or freed
+        bool TryIncreaseRef(mfxU32 index);
+        bool TryDecreaseRef(mfxU32 index);
+
         bool IsValidMID(mfxU32 index) const;
 
         void AddNewFrame(mfx_UMC_FrameAllocator * alloc, mfxFrameSurface1 *surface, UMC::VideoDataInfo * info);
@@ -189,16 +309,25 @@ protected:
 
         void Resize(mfxU32 size);
 
+        // Free mask: a set bit is a hint the surface is not locked
+        void   SetFree(mfxU32 index, bool isFree);
+        mfxI32 FindFree();
+
     private:
-        std::vector<FrameInfo>  m_frameData;
-        std::vector<FrameRefInfo>  m_frameDataRefs;
+        StableArray<FrameInfo>              m_frameData;
+        StableArray<FrameRefInfo>           m_frameDataRefs;
+        StableArray<CopyableAtomic<mfxU64>> m_freeMask;
     };
 
     InternalFrameData m_frameDataInternal;
 
-    std::vector<surf_descr> m_extSurfaces;
+    StableArray<surf_descr> m_extSurfaces;
 
-    mfxI32        m_curIndex;
+    SurfaceIndex  m_memIdIndex;       // MemId of the internal surfaces
+    SurfaceIndex  m_mappedMemIdIndex; // the same, mapped with VideoCORE::MapIdx
+    SurfaceIndex  m_surfaceIndex;     // m_extSurfaces[].FrameSurface
+
+    std::atomic<mfxI32> m_curIndex;
 
     bool m_IsUseExternalFrames;
     bool m_sfcVideoPostProcessing;
@@ -213,6 +342,10 @@ protected:
 
     bool       m_isSWDecode;
     mfxU16     m_IOPattern;
+
+    CoreMetrics *m_pMetrics;
+    mfxI32       m_surfacesInUse;
+    mfxI32       m_surfacesTotal;
 };
 
 
@@ -86,6 +86,8 @@ enum {
     MFX_EXTBUFF_ENCTOOLS = MFX_MAKEFOURCC('E', 'E', 'T', 'L'),
     MFX_EXTBUFF_ENCTOOLS_DEVICE = MFX_MAKEFOURCC('E', 'T', 'E', 'D'),
     MFX_EXTBUFF_ENCTOOLS_ALLOCATOR = MFX_MAKEFOURCC('E', 'T', 'E', 'A'),
+    MFX_EXTBUFF_ENCTOOLS_ASYNC = MFX_MAKEFOURCC('E', 'T', 'A', 'S'),
+    MFX_EXTBUFF_ENCTOOLS_SHARED = MFX_MAKEFOURCC('E', 'T', 'S', 'H'),
     MFX_EXTBUFF_ENCTOOLS_FRAME_TO_ANALYZE = MFX_MAKEFOURCC('E', 'F', 'T', 'A'),
     MFX_EXTBUFF_ENCTOOLS_HINT_SCENE_CHANGE = MFX_MAKEFOURCC('E', 'H', 'S', 'C'),
     MFX_EXTBUFF_ENCTOOLS_HINT_GOP = MFX_MAKEFOURCC('E', 'H', 'G', 'O'),
@@ -198,6 +200,40 @@ MFX_PACK_END()
 
 #define MFX_ENCTOOLS_CTRL_EXTALLOCATOR_VERSION MFX_STRUCT_VERSION(1, 0)
 
+/* With AsyncAnalysis ON Submit only queues the frame to analyze, the analysis runs on
+   a worker thread and Query waits up to timeout for the result of the frame. The surface
+   is copied, its frame data has to stay valid until the result of the frame is queried. */
+MFX_PACK_BEGIN_USUAL_STRUCT()
+typedef struct {
+    mfxExtBuffer       Header;
+    mfxStructVersion   Version;
+    mfxU16             reserved[3];
+    mfxU16             AsyncAnalysis;     /* tri-state option, OFF by default */
+    mfxU16             reserved2[7];
+} mfxEncToolsCtrlExtAsync;
+MFX_PACK_END()
+
+#define MFX_ENCTOOLS_CTRL_EXTASYNC_VERSION MFX_STRUCT_VERSION(1, 0)
+
+/* SharedAnalysis is an mfxEncTools created by MFXVideoENCODE_CreateEncTools and initialized
+   with the same GOP structure (e.g. the top rendition of an ABR ladder). The instance then
+   takes the scene change, GOP and reference hints from it instead of downscaling and analyzing
+   the frames itself, frames submitted to it for analysis are ignored. The BRC stays per instance.
+   The shared instance is initialized first and closed last, its Close returns
+   MFX_ERR_UNDEFINED_BEHAVIOR while other instances use it. Every instance (the shared one
+   included) discards each frame, the analysis of the frame is dropped after the last Discard. */
+MFX_PACK_BEGIN_STRUCT_W_PTR()
+typedef struct {
+    mfxExtBuffer       Header;
+    mfxStructVersion   Version;
+    mfxU16             reserved[3];
+    mfxHDL             SharedAnalysis;    /* mfxEncTools* */
+    mfxU32             reserved2[4];
+} mfxEncToolsCtrlExtShared;
+MFX_PACK_END()
+
+#define MFX_ENCTOOLS_CTRL_EXTSHARED_VERSION MFX_STRUCT_VERSION(1, 0)
+
 MFX_PACK_BEGIN_STRUCT_W_PTR()
 typedef struct {
     mfxStructVersion  Version;
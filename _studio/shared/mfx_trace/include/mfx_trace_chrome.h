@@ -0,0 +1,74 @@
+// Copyright (c) 2020 Intel Corporation
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef __MFX_TRACE_CHROME_H__
+#define __MFX_TRACE_CHROME_H__
+
+#include "mfx_trace.h"
+
+#ifdef MFX_TRACE_ENABLE_CHROME
+
+/*------------------------------------------------------------------------------*/
+
+// trace registry options and parameters
+#define MFX_TRACE_CHROME_REG_FILE_NAME MFX_TRACE_STRING("ChromeTrace")
+
+// Chrome trace event format (chrome://tracing, ui.perfetto.dev): tasks become
+// begin/end slices per thread, task ids (MFX_AUTO_LTRACE_WITHID) and the
+// "^Child^of" parent ids of scheduler tasks become flow arrows, "^Session^"
+// and "^Counter^" messages become slice arguments and counter tracks.
+// Events are collected in per-thread buffers and written when a buffer
+// fills up, its thread exits or tracing is closed.
+
+/*------------------------------------------------------------------------------*/
+
+mfxTraceU32 MFXTraceChrome_Init();
+
+mfxTraceU32 MFXTraceChrome_SetLevel(mfxTraceChar* category,
+                               mfxTraceLevel level);
+
+mfxTraceU32 MFXTraceChrome_DebugMessage(mfxTraceStaticHandle *static_handle,
+                                   const char *file_name, mfxTraceU32 line_num,
+                                   const char *function_name,
+                                   mfxTraceChar* category, mfxTraceLevel level,
+                                   const char *message,
+                                   const char *format, ...);
+
+mfxTraceU32 MFXTraceChrome_vDebugMessage(mfxTraceStaticHandle *static_handle,
+                                    const char *file_name, mfxTraceU32 line_num,
+                                    const char *function_name,
+                                    mfxTraceChar* category, mfxTraceLevel level,
+                                    const char *message,
+                                    const char *format, va_list args);
+
+mfxTraceU32 MFXTraceChrome_BeginTask(mfxTraceStaticHandle *static_handle,
+                                const char *file_name, mfxTraceU32 line_num,
+                                const char *function_name,
+                                mfxTraceChar* category, mfxTraceLevel level,
+                                const char *task_name, mfxTraceTaskHandle *task_handle,
+                                const void *task_params);
+
+mfxTraceU32 MFXTraceChrome_EndTask(mfxTraceStaticHandle *static_handle,
+                              mfxTraceTaskHandle *task_handle);
+
+mfxTraceU32 MFXTraceChrome_Close(void);
+
+#endif // #ifdef MFX_TRACE_ENABLE_CHROME
+#endif // #ifndef __MFX_TRACE_CHROME_H__
@@ -31,6 +31,8 @@
 #define MFX_TRACE_STAT_REG_FILE_NAME MFX_TRACE_STRING("Statistic")
 #define MFX_TRACE_STAT_REG_SUPPRESS  MFX_TRACE_STRING("StatisticSuppress")
 #define MFX_TRACE_STAT_REG_PERMIT    MFX_TRACE_STRING("StatisticPermit")
+#define MFX_TRACE_STAT_REG_HISTOGRAM MFX_TRACE_STRING("StatisticHistogram")
+#define MFX_TRACE_STAT_REG_HISTOGRAM_PERIOD MFX_TRACE_STRING("StatisticHistogramPeriod")
 
 // defines suppresses of the output (where applicable)
 enum
@@ -41,6 +43,18 @@ enum
     MFX_TRACE_STAT_SUPPRESS_LEVEL         = 0x08
 };
 
+// latency percentiles of a trace point, times are in nanoseconds
+typedef struct
+{
+    const char* function_name;
+    const char* task_name;
+    mfxTraceU64 count;
+    mfxTraceU64 p50;
+    mfxTraceU64 p99;
+    mfxTraceU64 p999;
+    mfxTraceU64 max;
+} mfxTraceStatHistogram;
+
 /*------------------------------------------------------------------------------*/
 
 mfxTraceU32 MFXTraceStat_Init();
@@ -74,5 +88,17 @@ mfxTraceU32 MFXTraceStat_EndTask(mfxTraceStaticHandle *static_handle,
 
 mfxTraceU32 MFXTraceStat_Close(void);
 
+// Histogram snapshot for MFXVideoCORE_GetMetrics, available with
+// StatisticHistogram=1. Copies up to *num_items trace points to items and
+// sets *num_items to the number of trace points with samples. With reset the
+// counting starts over, samples recorded while the snapshot is taken may be lost.
+// The names stay valid after MFXTraceStat_Close, until the library is unloaded.
+mfxTraceU32 MFXTraceStat_GetHistograms(mfxTraceStatHistogram* items,
+                                       mfxTraceU32* num_items,
+                                       mfxTraceU32 reset);
+
+// prints the histograms to the statistic file, on close and periodically
+mfxTraceU32 MFXTraceStat_DumpHistograms(mfxTraceU32 reset);
+
 #endif // #ifdef MFX_TRACE_ENABLE_STAT
 #endif // #ifndef __MFX_TRACE_STAT_H__
@@ -37,6 +37,7 @@ extern "C"
 #include "mfx_trace_stat.h"
 #include "mfx_trace_itt.h"
 #include "mfx_trace_ftrace.h"
+#include "mfx_trace_chrome.h"
 }
 #include <stdlib.h>
 #include <string.h>
@@ -151,6 +152,19 @@ mfxTraceAlgorithm g_TraceAlgorithms[] =
         MFXTraceFtrace_Close
     },
 #endif
+#ifdef MFX_TRACE_ENABLE_CHROME
+    {
+        0,
+        MFX_TRACE_OUTPUT_CHROME,
+        MFXTraceChrome_Init,
+        MFXTraceChrome_SetLevel,
+        MFXTraceChrome_DebugMessage,
+        MFXTraceChrome_vDebugMessage,
+        MFXTraceChrome_BeginTask,
+        MFXTraceChrome_EndTask,
+        MFXTraceChrome_Close
+    },
+#endif
 };
 
 /*------------------------------------------------------------------------------*/
@@ -237,6 +251,9 @@ mfxTraceU32 MFXTrace_Init()
 #if defined(MFX_TRACE_ENABLE_FTRACE)
     g_OutputMode |= MFX_TRACE_OUTPUT_FTRACE;
 #endif
+#if defined(MFX_TRACE_ENABLE_CHROME)
+    g_OutputMode |= MFX_TRACE_OUTPUT_CHROME;
+#endif
 
     if (vm_interlocked_inc32(&g_refCounter) != 1)
     {
@@ -0,0 +1,442 @@
+// Copyright (c) 2020 Intel Corporation
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "mfx_trace.h"
+
+#ifdef MFX_TRACE_ENABLE_CHROME
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <vector>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/syscall.h>
+
+extern "C"
+{
+#include "mfx_trace_utils.h"
+#include "mfx_trace_chrome.h"
+}
+
+#define MFX_TRACE_CHROME_PATH_TO_TEMP_LOG MFX_TRACE_STRING("/tmp/mfxlib_trace.json")
+
+/*------------------------------------------------------------------------------*/
+
+namespace
+{
+
+enum
+{
+    CHROME_NAME_LENGTH   = 64,
+    CHROME_CAT_LENGTH    = 24,
+    CHROME_TEXT_LENGTH   = 64,
+    CHROME_BUFFER_EVENTS = 1024,
+    CHROME_MAX_DEPTH     = 64,
+    CHROME_NO_EVENT      = 0xFFFFFFFF
+};
+
+struct ChromeEvent
+{
+    mfxTraceU64 ts;       // ns since MFXTraceChrome_Init
+    mfxTraceU64 id;       // task id of a slice, flow id, counter series
+    mfxTraceU64 session;
+    long long   value;    // counter value
+    mfxTraceU32 parent;   // parent task id of a slice
+    char        ph;       // event type as in the trace event format
+    char        name[CHROME_NAME_LENGTH];
+    char        cat[CHROME_CAT_LENGTH];
+    char        text[CHROME_TEXT_LENGTH];
+};
+
+struct ChromeThreadBuffer
+{
+    std::mutex  guard;    // owner thread vs. MFXTraceChrome_Close, never contended otherwise
+    mfxTraceU32 tid;
+    mfxTraceU32 count;
+    mfxTraceU32 depth;
+    mfxTraceU32 open[CHROME_MAX_DEPTH]; // buffer index of the open slices, CHROME_NO_EVENT once written
+    ChromeEvent events[CHROME_BUFFER_EVENTS];
+};
+
+static std::mutex   g_chromeGuard; // file and the list of buffers
+static FILE*        g_chromeFile = NULL;
+static std::atomic<bool> g_chromeOpened(false); // g_chromeFile != NULL, read without the lock
+static bool         g_chromeFirstEvent = true;
+static mfxTraceU32  g_chromePid = 0;
+static std::chrono::steady_clock::time_point g_chromeStart;
+static std::vector<std::shared_ptr<ChromeThreadBuffer> > g_chromeBuffers;
+static mfxTraceChar g_chromeFileName[MAX_PATH] = MFX_TRACE_CHROME_PATH_TO_TEMP_LOG;
+
+void chrome_copy(char* dst, size_t size, const char* src)
+{
+    if (!src) src = "";
+    snprintf(dst, size, "%s", src);
+}
+
+void chrome_write_string(FILE* file, const char* str)
+{
+    fputc('"', file);
+    for (; *str; ++str)
+    {
+        unsigned char c = (unsigned char)*str;
+        if (c == '"' || c == '\\') fprintf(file, "\\%c", c);
+        else if (c < 0x20)         fprintf(file, "\\u%04x", c);
+        else                       fputc(c, file);
+    }
+    fputc('"', file);
+}
+
+void chrome_write_event(FILE* file, mfxTraceU32 tid, const ChromeEvent& e)
+{
+    fprintf(file, "%s{\"ph\":\"%c\",\"pid\":%u,\"tid\":%u,\"ts\":%llu.%03llu",
+        g_chromeFirstEvent ? "" : ",\n", e.ph, g_chromePid, tid, e.ts / 1000, e.ts % 1000);
+    g_chromeFirstEvent = false;
+
+    switch (e.ph)
+    {
+    case 'B':
+        fprintf(file, ",\"name\":");
+        chrome_write_string(file, e.name);
+        fprintf(file, ",\"cat\":");
+        chrome_write_string(file, e.cat);
+        fprintf(file, ",\"args\":{\"id\":%llu,\"parent\":%u,\"session\":\"0x%llx\"}}", e.id, e.parent, e.session);
+        break;
+    case 'i':
+        fprintf(file, ",\"s\":\"t\",\"name\":");
+        chrome_write_string(file, e.name);
+        fprintf(file, ",\"cat\":");
+        chrome_write_string(file, e.cat);
+        fprintf(file, ",\"args\":{\"value\":");
+        chrome_write_string(file, e.text);
+        fprintf(file, "}}");
+        break;
+    case 's':
+    case 't':
+        // flows bind to the enclosing slice of the thread
+        fprintf(file, ",\"name\":\"task\",\"cat\":\"task\",\"id\":%llu%s}", e.id, e.ph == 't' ? ",\"bp\":\"e\"" : "");
+        break;
+    case 'C':
+        fprintf(file, ",\"name\":");
+        chrome_write_string(file, e.name);
+        fprintf(file, ",\"id\":\"0x%llx\",\"args\":{\"value\":%lld}}", e.id, e.value);
+        break;
+    case 'M':
+        fprintf(file, ",\"name\":\"thread_name\",\"args\":{\"name\":");
+        chrome_write_string(file, e.text);
+        fprintf(file, "}}");
+        break;
+    default: // 'E'
+        fprintf(file, "}");
+        break;
+    }
+}
+
+// buffer.guard must be held
+void chrome_flush(ChromeThreadBuffer& buffer)
+{
+    {
+        std::lock_guard<std::mutex> lock(g_chromeGuard);
+        if (g_chromeFile)
+        {
+            for (mfxTraceU32 i = 0; i < buffer.count; ++i)
+                chrome_write_event(g_chromeFile, buffer.tid, buffer.events[i]);
+        }
+    }
+    buffer.count = 0;
+    for (mfxTraceU32 i = 0; i < buffer.depth && i < CHROME_MAX_DEPTH; ++i)
+        buffer.open[i] = CHROME_NO_EVENT;
+}
+
+struct ChromeThreadHolder
+{
+    std::shared_ptr<ChromeThreadBuffer> buffer;
+
+    ~ChromeThreadHolder()
+    {
+        if (!buffer) return;
+        {
+            std::lock_guard<std::mutex> lock(buffer->guard);
+            chrome_flush(*buffer);
+        }
+        std::lock_guard<std::mutex> lock(g_chromeGuard);
+        for (size_t i = 0; i < g_chromeBuffers.size(); ++i)
+        {
+            if (g_chromeBuffers[i] == buffer)
+            {
+                g_chromeBuffers.erase(g_chromeBuffers.begin() + i);
+                break;
+            }
+        }
+    }
+};
+
+ChromeThreadBuffer& chrome_get_buffer()
+{
+    static thread_local ChromeThreadHolder holder;
+
+    if (!holder.buffer)
+    {
+        holder.buffer = std::make_shared<ChromeThreadBuffer>();
+        holder.buffer->tid   = (mfxTraceU32)syscall(SYS_gettid);
+        holder.buffer->count = 0;
+        holder.buffer->depth = 0;
+
+        std::lock_guard<std::mutex> lock(g_chromeGuard);
+        g_chromeBuffers.push_back(holder.buffer);
+    }
+    return *holder.buffer;
+}
+
+// buffer.guard must be held, returned event has its time stamp set
+ChromeEvent& chrome_add_event(ChromeThreadBuffer& buffer, char ph)
+{
+    if (buffer.count == CHROME_BUFFER_EVENTS)
+        chrome_flush(buffer);
+
+    ChromeEvent& e = buffer.events[buffer.count++];
+    memset(&e, 0, sizeof(e));
+    e.ph = ph;
+    e.ts = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - g_chromeStart).count();
+    return e;
+}
+
+// innermost open slice of the thread if it is still in the buffer
+ChromeEvent* chrome_open_slice(ChromeThreadBuffer& buffer)
+{
+    if (!buffer.depth || buffer.depth > CHROME_MAX_DEPTH)
+        return NULL;
+    mfxTraceU32 idx = buffer.open[buffer.depth - 1];
+    return (idx == CHROME_NO_EVENT) ? NULL : &buffer.events[idx];
+}
+
+} // namespace
+
+/*------------------------------------------------------------------------------*/
+
+extern "C"
+{
+
+mfxTraceU32 MFXTraceChrome_GetRegistryParams(void)
+{
+    FILE* conf_file = mfx_trace_open_conf_file(MFX_TRACE_CONFIG);
+
+    if (!conf_file) return 1;
+    mfx_trace_get_conf_string(conf_file,
+                              MFX_TRACE_CHROME_REG_FILE_NAME,
+                              g_chromeFileName,
+                              sizeof(g_chromeFileName));
+    fclose(conf_file);
+    return 0;
+}
+
+/*------------------------------------------------------------------------------*/
+
+mfxTraceU32 MFXTraceChrome_Init()
+{
+    mfxTraceU32 sts = 0;
+
+    sts = MFXTraceChrome_Close();
+    if (!sts) sts = MFXTraceChrome_GetRegistryParams();
+    if (!sts)
+    {
+        std::lock_guard<std::mutex> lock(g_chromeGuard);
+
+        g_chromeFile = mfx_trace_tfopen(g_chromeFileName, MFX_TRACE_STRING("w"));
+        if (!g_chromeFile) return 1;
+
+        fprintf(g_chromeFile, "[\n");
+        g_chromeFirstEvent = true;
+        g_chromePid        = (mfxTraceU32)getpid();
+        g_chromeStart      = std::chrono::steady_clock::now();
+        g_chromeOpened     = true;
+    }
+    return sts;
+}
+
+/*------------------------------------------------------------------------------*/
+
+mfxTraceU32 MFXTraceChrome_Close(void)
+{
+    std::vector<std::shared_ptr<ChromeThreadBuffer> > buffers;
+    {
+        std::lock_guard<std::mutex> lock(g_chromeGuard);
+        if (!g_chromeFile) return 0;
+        g_chromeOpened = false;
+        buffers = g_chromeBuffers;
+    }
+
+    for (size_t i = 0; i < buffers.size(); ++i)
+    {
+        std::lock_guard<std::mutex> lock(buffers[i]->guard);
+        chrome_flush(*buffers[i]);
+    }
+
+    std::lock_guard<std::mutex> lock(g_chromeGuard);
+    fprintf(g_chromeFile, "\n]\n");
+    fclose(g_chromeFile);
+    g_chromeFile = NULL;
+    return 0;
+}
+
+/*------------------------------------------------------------------------------*/
+
+mfxTraceU32 MFXTraceChrome_SetLevel(mfxTraceChar* /*category*/, mfxTraceLevel /*level*/)
+{
+    return 1;
+}
+
+/*------------------------------------------------------------------------------*/
+
+mfxTraceU32 MFXTraceChrome_DebugMessage(mfxTraceStaticHandle* static_handle,
+                                   const char *file_name, mfxTraceU32 line_num,
+                                   const char *function_name,
+                                   mfxTraceChar* category, mfxTraceLevel level,
+                                   const char *message, const char *format, ...)
+{
+    mfxTraceU32 res = 0;
+    va_list args;
+
+    va_start(args, format);
+    res = MFXTraceChrome_vDebugMessage(static_handle,
+                                       file_name , line_num,
+                                       function_name,
+                                       category, level,
+                                       message, format, args);
+    va_end(args);
+    return res;
+}
+
+/*------------------------------------------------------------------------------*/
+
+mfxTraceU32 MFXTraceChrome_vDebugMessage(mfxTraceStaticHandle* /*static_handle*/,
+                                    const char * /*file_name*/, mfxTraceU32 /*line_num*/,
+                                    const char *function_name,
+                                    mfxTraceChar* category, mfxTraceLevel /*level*/,
+                                    const char *message,
+                                    const char *format, va_list args)
+{
+    if (!g_chromeOpened) return 1;
+
+    char text[CHROME_TEXT_LENGTH] = {0};
+    if (format)
+    {
+        vsnprintf(text, sizeof(text), format, args);
+    }
+    if (!message) message = function_name ? function_name : "";
+
+    ChromeThreadBuffer& buffer = chrome_get_buffer();
+    std::lock_guard<std::mutex> lock(buffer.guard);
+
+    if (!strcmp(message, "^Child^of"))
+    {
+        mfxTraceU32 parent = (mfxTraceU32)strtoul(text, NULL, 10);
+        ChromeEvent* slice = chrome_open_slice(buffer);
+        if (slice) slice->parent = parent;
+
+        chrome_add_event(buffer, 't').id = parent;
+        return 0;
+    }
+    if (!strcmp(message, "^Session^"))
+    {
+        ChromeEvent* slice = chrome_open_slice(buffer);
+        if (slice)
+        {
+            slice->session = strtoull(text, NULL, 16);
+            return 0;
+        }
+    }
+    if (!strncmp(message, "^Counter^", 9))
+    {
+        // "<series> <value>"
+        const char* value = strrchr(text, ' ');
+        ChromeEvent& e = chrome_add_event(buffer, 'C');
+        chrome_copy(e.name, sizeof(e.name), message + 9);
+        e.id    = strtoull(text, NULL, 16);
+        e.value = value ? strtoll(value + 1, NULL, 10) : 0;
+        return 0;
+    }
+
+    ChromeEvent& e = chrome_add_event(buffer, 'i');
+    chrome_copy(e.name, sizeof(e.name), message);
+    chrome_copy(e.cat, sizeof(e.cat), category ? category : "mfx");
+    chrome_copy(e.text, sizeof(e.text), text);
+    return 0;
+}
+
+/*------------------------------------------------------------------------------*/
+
+mfxTraceU32 MFXTraceChrome_BeginTask(mfxTraceStaticHandle * /*static_handle*/,
+                                const char * /*file_name*/, mfxTraceU32 /*line_num*/,
+                                const char *function_name,
+                                mfxTraceChar* category, mfxTraceLevel /*level*/,
+                                const char *task_name, mfxTraceTaskHandle * /*handle*/,
+                                const void *task_params)
+{
+    if (!g_chromeOpened) return 1;
+
+    const char* name = task_name ? task_name : function_name;
+    mfxTraceU32 id = task_params ? *(const mfxTraceU32*)task_params : 0;
+
+    ChromeThreadBuffer& buffer = chrome_get_buffer();
+    std::lock_guard<std::mutex> lock(buffer.guard);
+
+    if (name && !strncmp(name, "ThreadName=", 11))
+    {
+        chrome_copy(chrome_add_event(buffer, 'M').text, CHROME_TEXT_LENGTH, name + 11);
+    }
+
+    ChromeEvent& e = chrome_add_event(buffer, 'B');
+    chrome_copy(e.name, sizeof(e.name), name);
+    chrome_copy(e.cat, sizeof(e.cat), category ? category : "mfx");
+    e.id = id;
+
+    if (buffer.depth < CHROME_MAX_DEPTH)
+        buffer.open[buffer.depth] = buffer.count - 1;
+    buffer.depth++;
+
+    if (id)
+    {
+        // scheduler tasks of this call point back with "^Child^of"
+        chrome_add_event(buffer, 's').id = id;
+    }
+    return 0;
+}
+
+/*------------------------------------------------------------------------------*/
+
+mfxTraceU32 MFXTraceChrome_EndTask(mfxTraceStaticHandle * /*static_handle*/,
+                              mfxTraceTaskHandle * /*handle*/)
+{
+    if (!g_chromeOpened) return 1;
+
+    ChromeThreadBuffer& buffer = chrome_get_buffer();
+    std::lock_guard<std::mutex> lock(buffer.guard);
+
+    if (buffer.depth) buffer.depth--;
+    chrome_add_event(buffer, 'E');
+    return 0;
+}
+
+} // extern "C"
+#endif // #ifdef MFX_TRACE_ENABLE_CHROME
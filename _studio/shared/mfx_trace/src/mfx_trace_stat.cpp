@@ -21,6 +21,13 @@
 #include "mfx_trace.h"
 
 #ifdef MFX_TRACE_ENABLE_STAT
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
 extern "C"
 {
 #include "mfx_trace_utils.h"
@@ -51,16 +58,22 @@ mfxTraceU32 MFXTraceStat_PrintInfo(mfxTraceStaticHandle* static_handle);
 #define FORMAT_HDR_FILE_NAME FORMAT_FILE_NAME
 #define FORMAT_HDR_LINE_NUM  ": %s"
 
+#define FORMAT_HIST_STAT     "%10.3f, %10.3f, %10.3f, %10.3f, %8llu"
+#define FORMAT_HDR_HIST_STAT "%10s, %10s, %10s, %10s, %8s"
+
 /*------------------------------------------------------------------------------*/
 
 typedef mfxTraceU64 mfxTraceTick;
 
 #if defined(LINUX32)
-#include <sys/time.h>
+#include <time.h>
 
 #define MFX_TRACE_TIME_MHZ 1000000
 #endif
 
+// task handles keep nanoseconds, the totals are accumulated in MFX_TRACE_TIME_MHZ ticks
+#define MFX_TRACE_NS_PER_TICK (1000000000 / MFX_TRACE_TIME_MHZ)
+
 /*------------------------------------------------------------------------------*/
 
 static mfxTraceTick mfx_trace_get_frequency(void)
@@ -68,18 +81,227 @@ static mfxTraceTick mfx_trace_get_frequency(void)
     return (mfxTraceTick)MFX_TRACE_TIME_MHZ;
 }
 
-static mfxTraceTick mfx_trace_get_tick(void)
+static mfxTraceU64 mfx_trace_get_ns(void)
 {
-    struct timeval tv;
+    struct timespec ts;
 
-    gettimeofday(&tv, NULL);
-    return (mfxTraceTick)tv.tv_sec * (mfxTraceTick)MFX_TRACE_TIME_MHZ + (mfxTraceTick)tv.tv_usec;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (mfxTraceU64)ts.tv_sec * 1000000000 + (mfxTraceU64)ts.tv_nsec;
 }
 
 #define mfx_trace_get_time(T,S,F) ((double)(__INT64)((T)-(S))/(double)(__INT64)(F))
 
 /*------------------------------------------------------------------------------*/
 
+// Latency histograms: log-linear buckets over nanoseconds, values below
+// 2*MFX_TRACE_HIST_SUB_COUNT are exact, above that every power of 2 is split
+// into MFX_TRACE_HIST_SUB_COUNT buckets (~3% error). Each thread records into
+// its own histograms without locks, they are merged at dump time.
+#define MFX_TRACE_HIST_SUB_BITS  5
+#define MFX_TRACE_HIST_SUB_COUNT (1 << MFX_TRACE_HIST_SUB_BITS)
+#define MFX_TRACE_HIST_MAX_BITS  42 // longer calls (> ~73 min) go to the last bucket
+#define MFX_TRACE_HIST_BUCKETS   ((MFX_TRACE_HIST_MAX_BITS - MFX_TRACE_HIST_SUB_BITS + 1) * MFX_TRACE_HIST_SUB_COUNT)
+
+static inline mfxTraceU32 mfx_trace_hist_index(mfxTraceU64 ns)
+{
+    if (ns >> MFX_TRACE_HIST_MAX_BITS) ns = ((mfxTraceU64)1 << MFX_TRACE_HIST_MAX_BITS) - 1;
+
+    mfxTraceU32 msb   = 63 - __builtin_clzll(ns | 1);
+    mfxTraceU32 shift = (msb > MFX_TRACE_HIST_SUB_BITS) ? msb - MFX_TRACE_HIST_SUB_BITS : 0;
+
+    return shift * MFX_TRACE_HIST_SUB_COUNT + (mfxTraceU32)(ns >> shift);
+}
+
+// highest value which falls into the bucket
+static inline mfxTraceU64 mfx_trace_hist_value(mfxTraceU32 index)
+{
+    if (index < 2 * MFX_TRACE_HIST_SUB_COUNT) return index;
+
+    mfxTraceU32 shift = index / MFX_TRACE_HIST_SUB_COUNT - 1;
+    mfxTraceU64 sub   = index - shift * MFX_TRACE_HIST_SUB_COUNT;
+
+    return ((sub + 1) << shift) - 1;
+}
+
+struct mfxStatHistogram
+{
+    mfxTraceStaticHandle*    handle;
+    mfxStatHistogram*        next;
+    std::atomic<mfxTraceU64> max;
+    std::atomic<mfxTraceU32> counts[MFX_TRACE_HIST_BUCKETS];
+
+    explicit mfxStatHistogram(mfxTraceStaticHandle* h) : handle(h), next(NULL), max(0)
+    {
+        for (mfxTraceU32 i = 0; i < MFX_TRACE_HIST_BUCKETS; ++i) counts[i] = 0;
+    }
+};
+
+// Histograms of one thread. Only the owner thread writes them, so the counters
+// are updated with plain relaxed loads and stores. The list is only ever
+// prepended, the dump walks it concurrently with the owner.
+struct mfxStatThreadTable
+{
+    std::atomic<mfxStatHistogram*> head;
+    std::atomic<mfxTraceU32>       generation; // of g_StatHistGeneration the counters belong to
+    std::unordered_map<mfxTraceStaticHandle*, mfxStatHistogram*> index; // owner only
+
+    mfxStatThreadTable() : head(NULL), generation(0) {}
+
+    ~mfxStatThreadTable()
+    {
+        mfxStatHistogram* hist = head;
+        while (hist)
+        {
+            mfxStatHistogram* next = hist->next;
+            delete hist;
+            hist = next;
+        }
+    }
+};
+
+// merged counters of a trace point
+struct mfxStatHistogramSum
+{
+    mfxTraceU64              max;
+    std::vector<mfxTraceU64> counts;
+
+    mfxStatHistogramSum() : max(0), counts(MFX_TRACE_HIST_BUCKETS, 0) {}
+};
+
+typedef std::unordered_map<mfxTraceStaticHandle*, mfxStatHistogramSum> mfxStatHistogramMap;
+
+static std::mutex                       g_StatHistGuard;      // tables list and retired counters, never taken per call
+static std::vector<mfxStatThreadTable*> g_StatHistTables;
+static mfxStatHistogramMap              g_StatHistRetired;    // counters of the exited threads
+static std::atomic<mfxTraceU32>         g_StatHistGeneration(1); // incremented on reset
+static mfxTraceU32                      g_StatHistogram = 0;  // histograms are collected
+static mfxTraceU32                      g_StatHistPeriod = 0; // ms between the periodic dumps, 0 - dump on close only
+
+// periodic dumps are written by their own thread, off the traced calls
+static std::thread                      g_StatHistDumper;
+static std::mutex                       g_StatHistDumperGuard;
+static std::condition_variable          g_StatHistDumperWake;
+static bool                             g_StatHistDumperStop = false;
+
+// g_StatHistGuard must be held
+static void mfx_trace_hist_merge(mfxStatHistogramMap& sum, mfxStatThreadTable& table)
+{
+    if (table.generation.load(std::memory_order_acquire) != g_StatHistGeneration) return;
+
+    for (mfxStatHistogram* hist = table.head.load(std::memory_order_acquire); hist; hist = hist->next)
+    {
+        mfxStatHistogramSum& item = sum[hist->handle];
+        mfxTraceU64 max = hist->max.load(std::memory_order_relaxed);
+
+        if (max > item.max) item.max = max;
+        for (mfxTraceU32 i = 0; i < MFX_TRACE_HIST_BUCKETS; ++i)
+            item.counts[i] += hist->counts[i].load(std::memory_order_relaxed);
+    }
+}
+
+struct mfxStatThreadHolder
+{
+    mfxStatThreadTable* table;
+
+    mfxStatThreadHolder() : table(NULL) {}
+
+    ~mfxStatThreadHolder()
+    {
+        if (!table) return;
+
+        std::lock_guard<std::mutex> lock(g_StatHistGuard);
+        mfx_trace_hist_merge(g_StatHistRetired, *table);
+        for (size_t i = 0; i < g_StatHistTables.size(); ++i)
+        {
+            if (g_StatHistTables[i] == table)
+            {
+                g_StatHistTables.erase(g_StatHistTables.begin() + i);
+                break;
+            }
+        }
+        delete table;
+    }
+};
+
+static void mfx_trace_hist_add(mfxTraceStaticHandle* static_handle, mfxTraceU64 ns)
+{
+    static thread_local mfxStatThreadHolder holder;
+
+    if (!holder.table)
+    {
+        holder.table = new mfxStatThreadTable;
+        holder.table->generation = g_StatHistGeneration.load();
+
+        std::lock_guard<std::mutex> lock(g_StatHistGuard);
+        g_StatHistTables.push_back(holder.table);
+    }
+    mfxStatThreadTable& table = *holder.table;
+
+    // reset is applied by the owner, so it never races with the counting below
+    mfxTraceU32 generation = g_StatHistGeneration.load(std::memory_order_relaxed);
+    if (table.generation.load(std::memory_order_relaxed) != generation)
+    {
+        for (mfxStatHistogram* hist = table.head.load(std::memory_order_relaxed); hist; hist = hist->next)
+        {
+            hist->max.store(0, std::memory_order_relaxed);
+            for (mfxTraceU32 i = 0; i < MFX_TRACE_HIST_BUCKETS; ++i)
+                hist->counts[i].store(0, std::memory_order_relaxed);
+        }
+        table.generation.store(generation, std::memory_order_release);
+    }
+
+    mfxStatHistogram*& hist = table.index[static_handle];
+    if (!hist)
+    {
+        hist = new mfxStatHistogram(static_handle);
+        hist->next = table.head.load(std::memory_order_relaxed);
+        table.head.store(hist, std::memory_order_release);
+    }
+
+    std::atomic<mfxTraceU32>& count = hist->counts[mfx_trace_hist_index(ns)];
+    count.store(count.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    if (ns > hist->max.load(std::memory_order_relaxed))
+        hist->max.store(ns, std::memory_order_relaxed);
+}
+
+// g_StatHistGuard must be held
+static void mfx_trace_hist_reset(void)
+{
+    g_StatHistRetired.clear();
+    ++g_StatHistGeneration;
+}
+
+static mfxTraceU64 mfx_trace_hist_percentile(const mfxStatHistogramSum& item, mfxTraceU64 total, double q)
+{
+    mfxTraceU64 rank = (mfxTraceU64)ceil(q * (double)total), sum = 0;
+
+    if (!rank) rank = 1;
+    for (mfxTraceU32 i = 0; i < MFX_TRACE_HIST_BUCKETS; ++i)
+    {
+        sum += item.counts[i];
+        // the top bucket is reported as the exact maximum
+        if (sum >= rank) return (sum == total) ? item.max : mfx_trace_hist_value(i);
+    }
+    return item.max;
+}
+
+static void mfx_trace_hist_fill(mfxTraceStatHistogram& dst, mfxTraceStaticHandle* static_handle, const mfxStatHistogramSum& item)
+{
+    mfxTraceU64 total = 0;
+
+    for (mfxTraceU32 i = 0; i < MFX_TRACE_HIST_BUCKETS; ++i) total += item.counts[i];
+
+    dst.function_name = static_handle->sd3.str;
+    dst.task_name     = static_handle->sd4.str;
+    dst.count         = total;
+    dst.p50           = mfx_trace_hist_percentile(item, total, 0.5);
+    dst.p99           = mfx_trace_hist_percentile(item, total, 0.99);
+    dst.p999          = mfx_trace_hist_percentile(item, total, 0.999);
+    dst.max           = item.max;
+}
+
+/*------------------------------------------------------------------------------*/
+
 #define MFX_TRACE_STAT_NUM_OF_STAT_ITEMS 100
 
 class mfxStatGlobalHandle
@@ -102,6 +324,8 @@ public:
             free(m_pStatTable);
             m_pStatTable = NULL;
         }
+        for (char* task_name : m_TaskNames) free(task_name);
+        m_TaskNames.clear();
     };
 
     mfxTraceU32 AddItem(mfxTraceStaticHandle* pStatHandle)
@@ -125,6 +349,7 @@ public:
             m_pStatTable[m_StatTableIndex] = pStatHandle;
             ++m_StatTableIndex;
         }
+        if (pStatHandle->sd4.str) m_TaskNames.push_back(pStatHandle->sd4.str);
         return 0;
     };
 
@@ -136,11 +361,6 @@ public:
         for (i = 0; i < m_StatTableIndex; ++i)
         {
             MFXTraceStat_PrintInfo(m_pStatTable[i]);
-            if (m_pStatTable[i]->sd4.str)
-            {
-                free(m_pStatTable[i]->sd4.str);
-                m_pStatTable[i]->sd4.str = NULL;
-            }
         }
         m_StatTableIndex = 0;
     };
@@ -149,6 +369,9 @@ protected:
     mfxTraceU32 m_StatTableIndex;
     mfxTraceU32 m_StatTableSize;
     mfxTraceStaticHandle** m_pStatTable;
+    // task names are returned by MFXTraceStat_GetHistograms, they are freed
+    // when the library is unloaded
+    std::vector<char*> m_TaskNames;
 };
 
 /*------------------------------------------------------------------------------*/
@@ -190,6 +413,18 @@ mfxTraceU32 MFXTraceStat_GetRegistryParams(void)
     {
         g_StatSuppress &= ~value;
     }
+    if (!mfx_trace_get_conf_dword(conf_file,
+                                  MFX_TRACE_STAT_REG_HISTOGRAM,
+                                  &value))
+    {
+        g_StatHistogram = value;
+    }
+    if (!mfx_trace_get_conf_dword(conf_file,
+                                  MFX_TRACE_STAT_REG_HISTOGRAM_PERIOD,
+                                  &value))
+    {
+        g_StatHistPeriod = value;
+    }
     fclose(conf_file);
     return 0;
 }
@@ -197,6 +432,19 @@ mfxTraceU32 MFXTraceStat_GetRegistryParams(void)
 
 /*------------------------------------------------------------------------------*/
 
+static void MFXTraceStat_DumpHistogramsPeriodically(void)
+{
+    std::unique_lock<std::mutex> lock(g_StatHistDumperGuard);
+    std::chrono::milliseconds period(g_StatHistPeriod);
+
+    while (!g_StatHistDumperWake.wait_for(lock, period, [] { return g_StatHistDumperStop; }))
+    {
+        lock.unlock();
+        MFXTraceStat_DumpHistograms(1);
+        lock.lock();
+    }
+}
+
 mfxTraceU32 MFXTraceStat_Init()
 {
     mfxTraceU32 sts = 0;
@@ -208,6 +456,12 @@ mfxTraceU32 MFXTraceStat_Init()
         if (!mfx_trace_tcmp(g_mfxTraceStatFileName, MFX_TRACE_STRING("stdout"))) g_mfxTraceStatFile = stdout;
         else g_mfxTraceStatFile = mfx_trace_tfopen(g_mfxTraceStatFileName, MFX_TRACE_STRING("a"));
         if (!g_mfxTraceStatFile) return 1;
+
+        if (g_StatHistogram && g_StatHistPeriod)
+        {
+            g_StatHistDumperStop = false;
+            g_StatHistDumper = std::thread(MFXTraceStat_DumpHistogramsPeriodically);
+        }
     }
     return sts;
 }
@@ -216,6 +470,18 @@ mfxTraceU32 MFXTraceStat_Init()
 
 mfxTraceU32 MFXTraceStat_Close(void)
 {
+    if (g_StatHistDumper.joinable())
+    {
+        {
+            std::lock_guard<std::mutex> lock(g_StatHistDumperGuard);
+            g_StatHistDumperStop = true;
+        }
+        g_StatHistDumperWake.notify_all();
+        g_StatHistDumper.join();
+    }
+
+    // task names stay allocated until the library is unloaded
+    if (g_StatHistogram) MFXTraceStat_DumpHistograms(1);
     g_StatGlobalHandle.Close();
     if (g_mfxTraceStatFile)
     {
@@ -226,6 +492,8 @@ mfxTraceU32 MFXTraceStat_Close(void)
     g_StatSuppress = MFX_TRACE_STAT_SUPPRESS_FILE_NAME |
                      MFX_TRACE_STAT_SUPPRESS_LINE_NUM |
                      MFX_TRACE_STAT_SUPPRESS_LEVEL;
+    g_StatHistogram   = 0;
+    g_StatHistPeriod  = 0;
     return 0;
 }
 
@@ -396,6 +664,86 @@ mfxTraceU32 MFXTraceStat_PrintInfo(mfxTraceStaticHandle* static_handle)
 
 /*------------------------------------------------------------------------------*/
 
+// g_StatHistGuard must be held
+static void MFXTraceStat_CollectHistograms(mfxStatHistogramMap& sum)
+{
+    sum = g_StatHistRetired;
+    for (size_t i = 0; i < g_StatHistTables.size(); ++i)
+        mfx_trace_hist_merge(sum, *g_StatHistTables[i]);
+}
+
+mfxTraceU32 MFXTraceStat_GetHistograms(mfxTraceStatHistogram* items,
+                                       mfxTraceU32* num_items,
+                                       mfxTraceU32 reset)
+{
+    if (!g_StatHistogram || !num_items) return 1;
+    if (!items && *num_items) return 1;
+
+    mfxStatHistogramMap sum;
+    mfxTraceU32 i = 0;
+
+    std::lock_guard<std::mutex> lock(g_StatHistGuard);
+    MFXTraceStat_CollectHistograms(sum);
+    if (reset) mfx_trace_hist_reset();
+
+    for (mfxStatHistogramMap::const_iterator it = sum.begin(); it != sum.end(); ++it)
+    {
+        if (i < *num_items) mfx_trace_hist_fill(items[i], it->first, it->second);
+        ++i;
+    }
+    *num_items = i;
+    return 0;
+}
+
+mfxTraceU32 MFXTraceStat_DumpHistograms(mfxTraceU32 reset)
+{
+    if (!g_mfxTraceStatFile || !g_StatHistogram) return 1;
+
+    mfxStatHistogramMap sum;
+    std::vector<mfxTraceStatHistogram> items;
+    {
+        std::lock_guard<std::mutex> lock(g_StatHistGuard);
+        MFXTraceStat_CollectHistograms(sum);
+        if (reset) mfx_trace_hist_reset();
+
+        // names are read under the lock, Close() releases them after the dump
+        items.resize(sum.size());
+        mfxTraceU32 i = 0;
+        for (mfxStatHistogramMap::const_iterator it = sum.begin(); it != sum.end(); ++it, ++i)
+            mfx_trace_hist_fill(items[i], it->first, it->second);
+    }
+    if (items.empty()) return 0;
+
+    char str[MFX_TRACE_MAX_LINE_LENGTH] = {0}, *p_str = str;
+    size_t len = MFX_TRACE_MAX_LINE_LENGTH;
+
+    p_str = mfx_trace_sprintf(p_str, len, FORMAT_HDR_FN_NAME, "Function name");
+    p_str = mfx_trace_sprintf(p_str, len, FORMAT_HDR_TASK_NAME, "Task name");
+    p_str = mfx_trace_sprintf(p_str, len, FORMAT_HDR_HIST_STAT, "p50, us", "p99, us", "p99.9, us", "max, us", "Number");
+    p_str = mfx_trace_sprintf(p_str, len, "\n");
+    fprintf(g_mfxTraceStatFile, "%s", str);
+
+    for (size_t i = 0; i < items.size(); ++i)
+    {
+        const mfxTraceStatHistogram& item = items[i];
+
+        p_str = str;
+        len = MFX_TRACE_MAX_LINE_LENGTH;
+        p_str = mfx_trace_sprintf(p_str, len, FORMAT_FN_NAME, item.function_name ? item.function_name : "");
+        p_str = mfx_trace_sprintf(p_str, len, FORMAT_TASK_NAME, item.task_name ? item.task_name : "");
+        p_str = mfx_trace_sprintf(p_str, len, FORMAT_HIST_STAT,
+                                  item.p50 / 1000.0, item.p99 / 1000.0, item.p999 / 1000.0, item.max / 1000.0,
+                                  (unsigned long long)item.count);
+        p_str = mfx_trace_sprintf(p_str, len, "\n");
+        fprintf(g_mfxTraceStatFile, "%s", str);
+    }
+    fflush(g_mfxTraceStatFile);
+
+    return 0;
+}
+
+/*------------------------------------------------------------------------------*/
+
 mfxTraceU32 MFXTraceStat_BeginTask(mfxTraceStaticHandle *static_handle,
                               const char *file_name, mfxTraceU32 line_num,
                               const char *function_name,
@@ -420,7 +768,7 @@ mfxTraceU32 MFXTraceStat_BeginTask(mfxTraceStaticHandle *static_handle,
         }
         else static_handle->sd4.str = NULL;
     }
-    task_handle->sd1.tick = mfx_trace_get_tick();
+    task_handle->sd1.tick = mfx_trace_get_ns();
 
     return 0;
 }
@@ -435,12 +783,15 @@ mfxTraceU32 MFXTraceStat_EndTask(mfxTraceStaticHandle *static_handle,
     mfxTraceChar* category = NULL;
     mfxTraceLevel level = MFX_TRACE_LEVEL_DEFAULT;
     mfxTraceTick time = 0;
+    mfxTraceU64 ns = mfx_trace_get_ns() - task_handle->sd1.tick;
 
     category      = static_handle->category;
     level         = static_handle->level;
 
+    if (g_StatHistogram) mfx_trace_hist_add(static_handle, ns);
+
     ++(static_handle->sd5.uint32);
-    time = mfx_trace_get_tick() - task_handle->sd1.tick;
+    time = ns / MFX_TRACE_NS_PER_TICK;
     static_handle->sd6.tick += time;
     static_handle->sd7.tick += time*time;
 
@@ -49,16 +49,22 @@ std::string mfx_trace_get_value(FILE* file, const char* pName)
     char line[MAX_PATH] = {0}, *s = nullptr;
     std::string str, str_name(pName);
 
+    // keys may come in any order and one may be a prefix of another
+    // ("Statistic" and "StatisticHistogram"), so look from the start for the whole name
+    rewind(file);
     while ((s = fgets(line, MAX_PATH,  file)))
     {
         str = s;
 
-        size_t pos = str.find(str_name);
-        if (pos != std::string::npos)
-        {
-            pos += str_name.size();
-            return trim_string(str.substr(pos));
-        }
+        size_t pos = str.find_first_not_of(" \t");
+        if (pos == std::string::npos || str.compare(pos, str_name.size(), str_name))
+            continue;
+
+        pos += str_name.size();
+        if (pos < str.size() && !strchr(" \t=", str[pos]))
+            continue;
+
+        return trim_string(str.substr(pos));
     }
 
     return std::string("");
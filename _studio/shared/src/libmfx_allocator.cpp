@@ -25,6 +25,10 @@
 #include "mfx_utils.h"
 #include "mfx_common.h"
 
+#if defined(LINUX32) || defined(LINUX64)
+#include <sys/mman.h>
+#endif
+
 #define ALIGN32(X) (((mfxU32)((X)+31)) & (~ (mfxU32)31))
 #define ID_BUFFER MFX_MAKEFOURCC('B','U','F','F')
 #define ID_FRAME  MFX_MAKEFOURCC('F','R','M','E')
@@ -33,6 +37,167 @@
 
 #define DEFAULT_ALIGNMENT_SIZE 64
 
+// header in front of the pool blocks, keeps the payload aligned
+#define POOL_HEADER_SIZE 64
+#define POOL_PAGE_SIZE   4096
+// larger blocks are mapped directly, the pages of a fresh mapping are zero
+#define POOL_MMAP_THRESHOLD (256 * 1024)
+#define POOL_HUGE_PAGE_SIZE (2 * 1024 * 1024)
+// freed blocks over this limit go back to the system
+#ifndef MFX_BUFFER_POOL_MAX_CACHED
+#define MFX_BUFFER_POOL_MAX_CACHED (128 * 1024 * 1024)
+#endif
+
+mfxBufferPool& mfxBufferPool::Instance()
+{
+    static mfxBufferPool pool;
+    return pool;
+}
+
+mfxBufferPool::mfxBufferPool()
+    : m_cached(0)
+{
+}
+
+mfxBufferPool::~mfxBufferPool()
+{
+    for (auto& list : m_free)
+    {
+        for (Block* block : list.second)
+            FreeBlock(block);
+    }
+}
+
+size_t mfxBufferPool::GetClassSize(size_t nbytes)
+{
+    size_t size = nbytes + POOL_HEADER_SIZE;
+
+    if (size <= POOL_PAGE_SIZE)
+        return mfx::align2_value(size, DEFAULT_ALIGNMENT_SIZE);
+
+    // 8 classes per power of 2, up to 12.5% is wasted
+    size_t step = POOL_PAGE_SIZE;
+    while ((step << 4) <= size)
+        step <<= 1;
+    size = mfx::align2_value(size, step);
+
+#if defined(MFX_ENABLE_HUGEPAGE_ALLOC)
+    if (size >= POOL_HUGE_PAGE_SIZE)
+        size = mfx::align2_value(size, POOL_HUGE_PAGE_SIZE);
+#endif
+    return size;
+}
+
+mfxBufferPool::Block* mfxBufferPool::AllocBlock(size_t size, bool& bZeroed)
+{
+    void* ptr = nullptr;
+    bool  mapped = false;
+
+#if defined(LINUX32) || defined(LINUX64)
+    if (size >= POOL_MMAP_THRESHOLD)
+    {
+#if defined(MFX_ENABLE_HUGEPAGE_ALLOC)
+        if (size >= POOL_HUGE_PAGE_SIZE)
+        {
+            // fails if no huge pages are reserved, transparent ones are asked for then
+            ptr = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+            if (ptr == MAP_FAILED)
+            {
+                ptr = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+                if (ptr != MAP_FAILED)
+                    madvise(ptr, size, MADV_HUGEPAGE);
+            }
+        }
+        else
+#endif
+            ptr = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+        if (ptr == MAP_FAILED)
+            ptr = nullptr;
+        mapped = !!ptr;
+    }
+
+    if (!ptr && posix_memalign(&ptr, DEFAULT_ALIGNMENT_SIZE, size))
+        ptr = nullptr;
+#else
+    ptr = _aligned_malloc(size, DEFAULT_ALIGNMENT_SIZE);
+#endif
+
+    if (!ptr)
+        return nullptr;
+
+    Block* block  = (Block*)ptr;
+    block->size   = size;
+    block->mapped = mapped;
+    bZeroed       = mapped;
+    return block;
+}
+
+void mfxBufferPool::FreeBlock(Block* block)
+{
+#if defined(LINUX32) || defined(LINUX64)
+    if (block->mapped)
+        munmap(block, block->size);
+    else
+        free(block);
+#else
+    _aligned_free(block);
+#endif
+}
+
+void* mfxBufferPool::Alloc(size_t nbytes, bool bZero)
+{
+    size_t size  = GetClassSize(nbytes);
+    Block* block = nullptr;
+    bool bZeroed = false;
+
+    {
+        std::lock_guard<std::mutex> guard(m_guard);
+
+        auto it = m_free.find(size);
+        if (it != m_free.end() && !it->second.empty())
+        {
+            block = it->second.back();
+            it->second.pop_back();
+            m_cached -= size;
+        }
+    }
+
+    if (!block)
+    {
+        block = AllocBlock(size, bZeroed);
+        if (!block)
+            return nullptr;
+    }
+
+    mfxU8* ptr = (mfxU8*)block + POOL_HEADER_SIZE;
+    if (bZero && !bZeroed)
+        memset(ptr, 0, nbytes);
+
+    return ptr;
+}
+
+void mfxBufferPool::Free(void* ptr)
+{
+    if (!ptr)
+        return;
+
+    Block* block = (Block*)((mfxU8*)ptr - POOL_HEADER_SIZE);
+
+    {
+        std::lock_guard<std::mutex> guard(m_guard);
+
+        if (m_cached + block->size <= MFX_BUFFER_POOL_MAX_CACHED)
+        {
+            m_free[block->size].push_back(block);
+            m_cached += block->size;
+            return;
+        }
+    }
+
+    FreeBlock(block);
+}
+
 // Implementation of Internal allocators
 mfxStatus mfxDefaultAllocator::AllocBuffer(mfxHDL pthis, mfxU32 nbytes, mfxU16 type, mfxHDL *mid)
 {
@@ -41,24 +206,40 @@ mfxStatus mfxDefaultAllocator::AllocBuffer(mfxHDL pthis, mfxU32 nbytes, mfxU16 t
     if(!mid)
         return MFX_ERR_NULL_PTR;
     mfxU32 header_size = ALIGN32(sizeof(BufferStruct));
-    mfxU8 *buffer_ptr=(mfxU8 *)malloc(header_size + nbytes + DEFAULT_ALIGNMENT_SIZE);
+    mfxU8 *buffer_ptr=(mfxU8 *)mfxBufferPool::Instance().Alloc(header_size + nbytes + DEFAULT_ALIGNMENT_SIZE, true);
 
     if (!buffer_ptr)
         return MFX_ERR_MEMORY_ALLOC;
 
-    memset(buffer_ptr, 0, header_size + nbytes);
-
     BufferStruct *bs=(BufferStruct *)buffer_ptr;
     bs->allocator = pthis;
     bs->id = ID_BUFFER;
     bs->type = type;
     bs->nbytes = nbytes;
 
-    // save index
+    // save index, slots of the freed buffers are reused
     {
         mfxWideBufferAllocator* pBA = (mfxWideBufferAllocator*)pthis;
-        pBA->m_bufHdl.push_back(bs);
-        *mid = (mfxHDL) pBA->m_bufHdl.size();
+        try
+        {
+            if (!pBA->m_freeHdl.empty())
+            {
+                mfxU32 index = pBA->m_freeHdl.back();
+                pBA->m_freeHdl.pop_back();
+                pBA->m_bufHdl[index - 1] = bs;
+                *mid = (mfxHDL)(size_t)index;
+            }
+            else
+            {
+                pBA->m_bufHdl.push_back(bs);
+                *mid = (mfxHDL) pBA->m_bufHdl.size();
+            }
+        }
+        catch (...)
+        {
+            mfxBufferPool::Instance().Free(bs);
+            return MFX_ERR_MEMORY_ALLOC;
+        }
     }
 
     return MFX_ERR_NONE;
@@ -87,6 +268,8 @@ mfxStatus mfxDefaultAllocator::LockBuffer(mfxHDL pthis, mfxHDL mid, mfxU8 **ptr)
             (index == 0))
             return MFX_ERR_INVALID_HANDLE;
         bs = pBA->m_bufHdl[index - 1];
+        if (!bs)
+            return MFX_ERR_INVALID_HANDLE;
     }
     catch (...)
     {
@@ -107,11 +290,12 @@ mfxStatus mfxDefaultAllocator::UnlockBuffer(mfxHDL pthis, mfxHDL mid)
         BufferStruct *bs;
         size_t index = midToSizeT(mid);
         mfxWideBufferAllocator* pBA = (mfxWideBufferAllocator*)pthis;
-        if (index > pBA->m_bufHdl.size())
+        if ((index > pBA->m_bufHdl.size())||
+            (index == 0))
             return MFX_ERR_INVALID_HANDLE;
 
         bs = pBA->m_bufHdl[index - 1];
-        if (bs->id!=ID_BUFFER)
+        if (!bs || bs->id!=ID_BUFFER)
             return MFX_ERR_INVALID_HANDLE;
     }
     catch (...)
@@ -130,15 +314,19 @@ mfxStatus mfxDefaultAllocator::FreeBuffer(mfxHDL pthis, mfxMemId mid)
         BufferStruct *bs;
         size_t index = midToSizeT(mid);
         mfxWideBufferAllocator* pBA = (mfxWideBufferAllocator*)pthis;
-        if (index > pBA->m_bufHdl.size())
+        if ((index > pBA->m_bufHdl.size())||
+            (index == 0))
             return MFX_ERR_INVALID_HANDLE;
 
         bs = pBA->m_bufHdl[index - 1];
-        if (bs->id!=ID_BUFFER)
+        if (!bs || bs->id!=ID_BUFFER)
             return MFX_ERR_INVALID_HANDLE;
-        if (bs->id!=ID_BUFFER)
-            return MFX_ERR_INVALID_HANDLE;
-        free(bs);
+
+        // the slot is given to the next allocation
+        bs->id = 0;
+        pBA->m_bufHdl[index - 1] = nullptr;
+        pBA->m_freeHdl.push_back((mfxU32)index);
+        mfxBufferPool::Instance().Free(bs);
         return MFX_ERR_NONE;
     }
     catch (...)
@@ -19,6 +19,8 @@
 // SOFTWARE.
 
 #include <assert.h>
+#include <algorithm>
+#include <vector>
 
 #include <mfx_scheduler_core.h>
 #include <libmfx_core_interface.h>
@@ -33,6 +35,13 @@
 
 #include "vm_sys_info.h"
 
+#ifdef MFX_TRACE_ENABLE_STAT
+extern "C"
+{
+#include "mfx_trace_stat.h"
+}
+#endif
+
 using namespace std;
 //
 // THE OTHER CORE FUNCTIONS HAVE IMPLICIT IMPLEMENTATION
@@ -67,6 +76,86 @@ mfxStatus MFXVideoCORE_QueryPlatform(mfxSession session, mfxPlatform* platform)
     }
 }
 
+#if (MFX_VERSION >= MFX_VERSION_NEXT)
+mfxStatus MFXVideoCORE_GetMetrics(mfxSession session, mfxSessionMetrics *metrics)
+{
+    MFX_CHECK(session,                MFX_ERR_INVALID_HANDLE);
+    MFX_CHECK(session->m_pCORE.get(), MFX_ERR_NOT_INITIALIZED);
+    MFX_CHECK(session->m_pScheduler,  MFX_ERR_NOT_INITIALIZED);
+    MFX_CHECK_NULL_PTR1(metrics);
+    MFX_CHECK(metrics->Latencies || !metrics->NumLatencies, MFX_ERR_NULL_PTR);
+
+    mfxTraceLatency *latencies    = metrics->Latencies;
+    mfxU32           numLatencies = metrics->NumLatencies;
+    bool             reset        = metrics->ResetLatencies == MFX_CODINGOPTION_ON;
+
+    *metrics = {};
+    metrics->Latencies = latencies;
+
+    try
+    {
+        MFXIScheduler3 *pScheduler = reinterpret_cast<MFXIScheduler3 *>(session->m_pScheduler->QueryInterface(MFXIScheduler3_GUID));
+        if (pScheduler)
+        {
+            MFX_SCHEDULER_METRICS schedMetrics = {};
+            mfxStatus sts = pScheduler->GetMetrics(&schedMetrics);
+            pScheduler->Release();
+            MFX_CHECK_STS(sts);
+
+            for (mfxU32 i = 0; i < MFX_PRIORITY_NUMBER; i++)
+                metrics->QueueDepth[i] = schedMetrics.queueDepth[i];
+            metrics->NumThreads     = schedMetrics.numberOfThreads;
+            metrics->TasksCompleted = schedMetrics.tasksCompleted;
+            metrics->TaskCalls      = schedMetrics.taskCalls;
+            metrics->TaskTime       = schedMetrics.taskTime;
+        }
+
+        CoreMetrics *pCoreMetrics = QueryCoreInterface<CoreMetrics>(session->m_pCORE.get());
+        if (pCoreMetrics)
+        {
+            mfxI32 surfacesInUse = pCoreMetrics->surfacesInUse.load(std::memory_order_relaxed);
+            mfxI32 surfacesTotal = pCoreMetrics->surfacesTotal.load(std::memory_order_relaxed);
+
+            metrics->SurfacesInUse = (mfxU32)std::max(surfacesInUse, 0);
+            metrics->SurfacesTotal = (mfxU32)std::max(surfacesTotal, 0);
+            metrics->CopyCalls     = pCoreMetrics->copyCalls.load(std::memory_order_relaxed);
+            metrics->CopyTime      = pCoreMetrics->copyTime.load(std::memory_order_relaxed) / 1000;
+        }
+
+#ifdef MFX_TRACE_ENABLE_STAT
+        // the histograms of the statistic trace, shared by all sessions
+        std::vector<mfxTraceStatHistogram> items(numLatencies);
+        mfxTraceU32 numItems = numLatencies;
+
+        if (!MFXTraceStat_GetHistograms(items.data(), &numItems, reset))
+        {
+            for (mfxU32 i = 0; i < std::min(numItems, numLatencies); i++)
+            {
+                latencies[i] = {};
+                latencies[i].FunctionName = items[i].function_name;
+                latencies[i].TaskName     = items[i].task_name;
+                latencies[i].Count        = items[i].count;
+                latencies[i].P50          = items[i].p50;
+                latencies[i].P99          = items[i].p99;
+                latencies[i].P999         = items[i].p999;
+                latencies[i].Max          = items[i].max;
+            }
+            metrics->NumLatencies = numItems;
+        }
+#else
+        (void)numLatencies;
+        (void)reset;
+#endif
+
+        return MFX_ERR_NONE;
+    }
+    catch (...)
+    {
+        MFX_RETURN(MFX_ERR_UNKNOWN);
+    }
+}
+#endif
+
 
 mfxStatus CommonCORE::API_1_19_Adapter::QueryPlatform(mfxPlatform* platform)
 {
@@ -1428,6 +1517,8 @@ mfxStatus CommonCORE::DoFastCopyExtended(mfxFrameSurface1 *pDst, mfxFrameSurface
     // up mutex
     UMC::AutomaticUMCMutex guard(m_guard);
 
+    CoreMetrics::CopyScope copyScope(m_metrics);
+
     mfxStatus sts;
 
     sts = CheckFrameData(pSrc);
@@ -1717,6 +1808,11 @@ void* CommonCORE::QueryCoreInterface(const MFX_GUID &guid)
         return &m_API_1_19;
     }
 
+    if (MFXICORE_METRICS_GUID == guid)
+    {
+        return &m_metrics;
+    }
+
     return nullptr;
 }
 
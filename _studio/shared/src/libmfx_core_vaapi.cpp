@@ -1116,6 +1116,8 @@ mfxStatus VAAPIVideoCORE_T<Base>::DoFastCopyExtended(
     mfxFrameSurface1* pDst,
     mfxFrameSurface1* pSrc)
 {
+    CoreMetrics::CopyScope copyScope(this->m_metrics);
+
     mfxStatus sts;
     mfxU8* srcPtr;
     mfxU8* dstPtr;
@@ -73,6 +73,10 @@
         MSDK_STATIC_ASSERT_STRUCT_SIZE(mfxInitParam              ,80   )
         MSDK_STATIC_ASSERT_STRUCT_SIZE(mfxExtThreadsParam        ,132  )
         MSDK_STATIC_ASSERT_STRUCT_SIZE(mfxPlatform               ,32   )
+#if (MFX_VERSION >= MFX_VERSION_NEXT)
+        MSDK_STATIC_ASSERT_STRUCT_SIZE(mfxSessionMetrics         ,128  )
+        MSDK_STATIC_ASSERT_STRUCT_SIZE(mfxTraceLatency           ,72   )
+#endif
     #elif defined(LINUX32)
         MSDK_STATIC_ASSERT_STRUCT_SIZE(mfxExtBuffer              ,8    )
         MSDK_STATIC_ASSERT_STRUCT_SIZE(mfxVersion                ,4    )
@@ -80,6 +84,10 @@
         MSDK_STATIC_ASSERT_STRUCT_SIZE(mfxInitParam              ,68   )
         MSDK_STATIC_ASSERT_STRUCT_SIZE(mfxExtThreadsParam        ,132  )
         MSDK_STATIC_ASSERT_STRUCT_SIZE(mfxPlatform               ,32   )
+#if (MFX_VERSION >= MFX_VERSION_NEXT)
+        MSDK_STATIC_ASSERT_STRUCT_SIZE(mfxSessionMetrics         ,124  )
+        MSDK_STATIC_ASSERT_STRUCT_SIZE(mfxTraceLatency           ,64   )
+#endif
     #endif
 #endif //defined (__MFXCOMMON_H__)
 
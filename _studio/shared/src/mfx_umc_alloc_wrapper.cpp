@@ -107,6 +107,110 @@ UMC::Status mfx_UMC_MemAllocator::DeallocateMem(UMC::MemID )
 ////////////////////////////////////////////////////////////////////////////////////////////////
 // mfx_UMC_FrameAllocator implementation
 ////////////////////////////////////////////////////////////////////////////////////////////////
+static inline mfxU32 CountTrailingZeros(mfxU64 value)
+{
+#if defined(__GNUC__)
+    return (mfxU32)__builtin_ctzll(value);
+#else
+    mfxU32 count = 0;
+    for (; !(value & 1); value >>= 1)
+        count++;
+    return count;
+#endif
+}
+
+mfx_UMC_FrameAllocator::SurfaceIndex::SurfaceIndex()
+    : m_table(nullptr)
+{
+}
+
+mfxU32 mfx_UMC_FrameAllocator::SurfaceIndex::Hash(const void* key)
+{
+    // MemIds may be small integers as well as pointers
+    mfxU64 value = (mfxU64)(size_t)key;
+    value ^= value >> 33;
+    value *= 0xff51afd7ed558ccdULL;
+    value ^= value >> 33;
+    return (mfxU32)value;
+}
+
+void mfx_UMC_FrameAllocator::SurfaceIndex::Place(Table& table, const void* key, mfxI32 index)
+{
+    for (mfxU32 i = Hash(key);; i++)
+    {
+        Entry& entry = table.entries[i & table.mask];
+        const void* current = entry.key.load(std::memory_order_relaxed);
+
+        if (current == key)
+        {
+            entry.index.store(index, std::memory_order_release);
+            return;
+        }
+        if (!current)
+        {
+            // the index is visible to whoever sees the key
+            entry.index.store(index, std::memory_order_relaxed);
+            entry.key.store(key, std::memory_order_release);
+            table.used++;
+            return;
+        }
+    }
+}
+
+void mfx_UMC_FrameAllocator::SurfaceIndex::Insert(const void* key, mfxI32 index)
+{
+    if (!key)
+        return;
+
+    Table* table = m_table.load(std::memory_order_relaxed);
+
+    if (!table || (table->used + 1) * 2 > table->mask + 1)
+    {
+        // the readers of the old table still find the old keys there
+        std::unique_ptr<Table> grown(new Table);
+        grown->mask = table ? table->mask * 2 + 1 : 63;
+        grown->used = 0;
+        grown->entries.reset(new Entry[grown->mask + 1]());
+
+        for (mfxU32 i = 0; table && i <= table->mask; i++)
+        {
+            const void* current = table->entries[i].key.load(std::memory_order_relaxed);
+            if (current)
+                Place(*grown, current, table->entries[i].index.load(std::memory_order_relaxed));
+        }
+
+        table = grown.get();
+        m_tables.push_back(std::move(grown));
+        m_table.store(table, std::memory_order_release);
+    }
+
+    Place(*table, key, index);
+}
+
+mfxI32 mfx_UMC_FrameAllocator::SurfaceIndex::Find(const void* key) const
+{
+    Table* table = m_table.load(std::memory_order_acquire);
+    if (!table || !key)
+        return -1;
+
+    for (mfxU32 i = Hash(key);; i++)
+    {
+        const Entry& entry = table->entries[i & table->mask];
+        const void* current = entry.key.load(std::memory_order_acquire);
+
+        if (current == key)
+            return entry.index.load(std::memory_order_acquire);
+        if (!current)
+            return -1;
+    }
+}
+
+void mfx_UMC_FrameAllocator::SurfaceIndex::Clear()
+{
+    m_table.store(nullptr, std::memory_order_release);
+    m_tables.clear();
+}
+
 mfx_UMC_FrameAllocator::InternalFrameData::FrameRefInfo::FrameRefInfo()
     : m_referenceCounter(0)
 {
@@ -145,6 +249,7 @@ void mfx_UMC_FrameAllocator::InternalFrameData::Close()
 {
     m_frameData.clear();
     m_frameDataRefs.clear();
+    m_freeMask.clear();
 }
 
 void mfx_UMC_FrameAllocator::InternalFrameData::ResetFrameData(mfxU32 index)
@@ -160,6 +265,47 @@ void mfx_UMC_FrameAllocator::InternalFrameData::Resize(mfxU32 size)
 {
     m_frameData.resize(size);
     m_frameDataRefs.resize(size);
+    m_freeMask.resize((size + 63) / 64);
+
+    for (mfxU32 i = 0; i < size; i++)
+        SetFree(i, true);
+}
+
+void mfx_UMC_FrameAllocator::InternalFrameData::SetFree(mfxU32 index, bool isFree)
+{
+    mfxU64 bit = 1ULL << (index % 64);
+
+    if (isFree)
+        m_freeMask[index / 64].fetch_or(bit, std::memory_order_release);
+    else
+        m_freeMask[index / 64].fetch_and(~bit, std::memory_order_release);
+}
+
+mfxI32 mfx_UMC_FrameAllocator::InternalFrameData::FindFree()
+{
+    mfxU32 size = GetSize();
+
+    for (mfxU32 word = 0; word < m_freeMask.size(); word++)
+    {
+        for (mfxU64 bits = m_freeMask[word].load(std::memory_order_acquire); bits; bits &= bits - 1)
+        {
+            mfxU32 index = word * 64 + CountTrailingZeros(bits);
+            if (index < size && !m_frameData[index].first.Data.Locked)
+                return index;
+        }
+    }
+
+    // surfaces may be released behind the allocator, VideoCORE::DecreaseReference
+    for (mfxU32 i = 0; i < size; i++)
+    {
+        if (!m_frameData[i].first.Data.Locked)
+        {
+            SetFree(i, true);
+            return i;
+        }
+    }
+
+    return -1;
 }
 
 mfxU32 mfx_UMC_FrameAllocator::InternalFrameData::IncreaseRef(mfxU32 index)
@@ -168,8 +314,7 @@ mfxU32 mfx_UMC_FrameAllocator::InternalFrameData::IncreaseRef(mfxU32 index)
         throw std::exception();
 
     FrameRefInfo * frameRef = &m_frameDataRefs[index];
-    frameRef->m_referenceCounter++;
-    return frameRef->m_referenceCounter;
+    return ++frameRef->m_referenceCounter;
 }
 
 mfxU32 mfx_UMC_FrameAllocator::InternalFrameData::DecreaseRef(mfxU32 index)
@@ -178,8 +323,37 @@ mfxU32 mfx_UMC_FrameAllocator::InternalFrameData::DecreaseRef(mfxU32 index)
         throw std::exception();
 
     FrameRefInfo * frameRef = &m_frameDataRefs[index];
-    frameRef->m_referenceCounter--;
-    return frameRef->m_referenceCounter;
+    return --frameRef->m_referenceCounter;
+}
+
+bool mfx_UMC_FrameAllocator::InternalFrameData::TryIncreaseRef(mfxU32 index)
+{
+    if (!IsValidMID(index))
+        throw std::exception();
+
+    CopyableAtomic<mfxU32> & counter = m_frameDataRefs[index].m_referenceCounter;
+    for (mfxU32 current = counter.load(); current > 0;)
+    {
+        if (counter.compare_exchange_weak(current, current + 1))
+            return true;
+    }
+
+    return false;
+}
+
+bool mfx_UMC_FrameAllocator::InternalFrameData::TryDecreaseRef(mfxU32 index)
+{
+    if (!IsValidMID(index))
+        throw std::exception();
+
+    CopyableAtomic<mfxU32> & counter = m_frameDataRefs[index].m_referenceCounter;
+    for (mfxU32 current = counter.load(); current > 1;)
+    {
+        if (counter.compare_exchange_weak(current, current - 1))
+            return true;
+    }
+
+    return false;
 }
 
 void mfx_UMC_FrameAllocator::InternalFrameData::Reset()
@@ -195,6 +369,11 @@ void mfx_UMC_FrameAllocator::InternalFrameData::Reset()
     {
         m_frameDataRefs[i].Reset();
     }
+
+    for (mfxU32 i = 0; i < m_frameData.size(); i++)
+    {
+        SetFree(i, true);
+    }
 }
 
 mfxU32 mfx_UMC_FrameAllocator::InternalFrameData::GetSize() const
@@ -221,6 +400,10 @@ void mfx_UMC_FrameAllocator::InternalFrameData::AddNewFrame(mfx_UMC_FrameAllocat
 
     // set correct width & height to planes
     frameData->Init(info, (UMC::FrameMemID)index, alloc);
+
+    if (m_freeMask.size() < (index + 64) / 64)
+        m_freeMask.push_back(CopyableAtomic<mfxU64>());
+    SetFree(index, true);
 }
 
 
@@ -233,6 +416,9 @@ mfx_UMC_FrameAllocator::mfx_UMC_FrameAllocator()
     , m_externalFramesResponse(0)
     , m_isSWDecode(false)
     , m_IOPattern(0)
+    , m_pMetrics(0)
+    , m_surfacesInUse(0)
+    , m_surfacesTotal(0)
 {
 }
 
@@ -357,15 +543,17 @@ UMC::Status mfx_UMC_FrameAllocator::InitMfx(UMC::FrameAllocatorParams *,
 
             // set correct width & height to planes
             frameData.Init(&m_info, (UMC::FrameMemID)i, this);
+
+            IndexSurface(i);
         }
     }
-    else
-    {
-        m_extSurfaces.reserve(response->NumFrameActual);
-    }
 
     mfxCore->SetWrapper(this);
 
+    UpdateMetrics(0, 0);
+    m_pMetrics = QueryCoreInterface<CoreMetrics>(mfxCore);
+    UpdateMetrics(0, m_frameDataInternal.GetSize());
+
     return UMC::UMC_OK;
 }
 
@@ -377,9 +565,65 @@ UMC::Status mfx_UMC_FrameAllocator::Close()
     Reset();
     m_frameDataInternal.Close();
     m_extSurfaces.clear();
+    m_memIdIndex.Clear();
+    m_mappedMemIdIndex.Clear();
+    m_surfaceIndex.Clear();
+    UpdateMetrics(0, 0);
     return UMC::UMC_OK;
 }
 
+void mfx_UMC_FrameAllocator::SetExtSurface(mfxU32 index, mfxFrameSurface1 *surface)
+{
+    m_extSurfaces[index].FrameSurface = surface;
+    m_surfaceIndex.Insert(surface, index);
+}
+
+void mfx_UMC_FrameAllocator::IndexSurface(mfxU32 index)
+{
+    mfxMemId memId = m_frameDataInternal.GetSurface(index).Data.MemId;
+    if (!memId)
+        return;
+
+    m_memIdIndex.Insert(memId, index);
+    m_mappedMemIdIndex.Insert(m_pCore->MapIdx(memId), index);
+}
+
+mfxI32 mfx_UMC_FrameAllocator::FindSurfaceByMemId(mfxMemId memId, bool isOpaq)
+{
+    mfxI32 index = isOpaq ? m_memIdIndex.Find(memId) : m_mappedMemIdIndex.Find(memId);
+    if (index == -1)
+        return -1;
+
+    mfxMemId indexed = m_frameDataInternal.GetSurface(index).Data.MemId;
+    if ((isOpaq ? indexed : m_pCore->MapIdx(indexed)) == memId)
+        return index;
+
+    // the surface was changed after it was indexed
+    for (mfxU32 i = 0; i < m_frameDataInternal.GetSize(); i++)
+    {
+        indexed = m_frameDataInternal.GetSurface(i).Data.MemId;
+        if ((isOpaq ? indexed : m_pCore->MapIdx(indexed)) == memId)
+            return i;
+    }
+
+    return -1;
+}
+
+void mfx_UMC_FrameAllocator::UpdateMetrics(mfxI32 surfacesInUse, mfxI32 surfacesTotal)
+{
+    // the core sums the deltas of all allocators
+    if (m_pMetrics)
+    {
+        if (surfacesInUse != m_surfacesInUse)
+            m_pMetrics->surfacesInUse.fetch_add(surfacesInUse - m_surfacesInUse, std::memory_order_relaxed);
+        if (surfacesTotal != m_surfacesTotal)
+            m_pMetrics->surfacesTotal.fetch_add(surfacesTotal - m_surfacesTotal, std::memory_order_relaxed);
+    }
+
+    m_surfacesInUse = surfacesInUse;
+    m_surfacesTotal = surfacesTotal;
+}
+
 void mfx_UMC_FrameAllocator::SetExternalFramesResponse(mfxFrameAllocResponse *response)
 {
     m_externalFramesResponse = 0;
@@ -404,7 +648,7 @@ UMC::Status mfx_UMC_FrameAllocator::Reset()
     {
         if (m_extSurfaces[i].isUsed)
         {
-            sts = m_pCore->DecreaseReference(&m_extSurfaces[i].FrameSurface->Data);
+            sts = m_pCore->DecreaseReference(&m_extSurfaces[i].FrameSurface.load()->Data);
             if (sts < MFX_ERR_NONE)
                 return UMC::UMC_ERR_FAILED;
             m_extSurfaces[i].isUsed = false;
@@ -418,6 +662,8 @@ UMC::Status mfx_UMC_FrameAllocator::Reset()
         m_extSurfaces.clear();
     }
 
+    UpdateMetrics(0, m_frameDataInternal.GetSize());
+
     return UMC::UMC_OK;
 }
 
@@ -493,11 +739,13 @@ UMC::Status mfx_UMC_FrameAllocator::Alloc(UMC::FrameMemID *pNewMemID, const UMC:
     if (sts < MFX_ERR_NONE)
         return UMC::UMC_ERR_FAILED;
 
+    m_frameDataInternal.SetFree(index, false);
+
     if ((m_IsUseExternalFrames) || (m_sfcVideoPostProcessing))
     {
         if (m_extSurfaces[index].FrameSurface)
         {
-            sts = m_pCore->IncreaseReference(&m_extSurfaces[index].FrameSurface->Data);
+            sts = m_pCore->IncreaseReference(&m_extSurfaces[index].FrameSurface.load()->Data);
             if (sts < MFX_ERR_NONE)
                 return UMC::UMC_ERR_FAILED;
 
@@ -508,6 +756,8 @@ UMC::Status mfx_UMC_FrameAllocator::Alloc(UMC::FrameMemID *pNewMemID, const UMC:
     m_frameDataInternal.ResetFrameData(index);
     m_curIndex = -1;
 
+    UpdateMetrics(m_surfacesInUse + 1, m_frameDataInternal.GetSize());
+
     if (passed.width > allocated.width ||
         passed.height > allocated.height)
     {
@@ -519,6 +769,7 @@ UMC::Status mfx_UMC_FrameAllocator::Alloc(UMC::FrameMemID *pNewMemID, const UMC:
 
 const UMC::FrameData* mfx_UMC_FrameAllocator::Lock(UMC::FrameMemID mid)
 {
+    // sets the plane pointers of the shared frame data
     UMC::AutomaticUMCMutex guard(m_guard);
 
     mfxU32 index = (mfxU32)mid;
@@ -549,7 +800,7 @@ const UMC::FrameData* mfx_UMC_FrameAllocator::Lock(UMC::FrameMemID mid)
         }
         else
         {
-            data = &m_extSurfaces[index].FrameSurface->Data;
+            data = &m_extSurfaces[index].FrameSurface.load()->Data;
         }
     }
     else
@@ -608,7 +859,7 @@ const UMC::FrameData* mfx_UMC_FrameAllocator::Lock(UMC::FrameMemID mid)
         {
             if (m_IsUseExternalFrames)
             {
-                m_pCore->UnlockExternalFrame(m_extSurfaces[index].FrameSurface->Data.MemId);
+                m_pCore->UnlockExternalFrame(m_extSurfaces[index].FrameSurface.load()->Data.MemId);
             }
             else
             {
@@ -635,7 +886,7 @@ UMC::Status mfx_UMC_FrameAllocator::Unlock(UMC::FrameMemID mid)
     {
         mfxStatus sts;
         if (m_IsUseExternalFrames)
-            sts = m_pCore->UnlockExternalFrame(m_extSurfaces[index].FrameSurface->Data.MemId);
+            sts = m_pCore->UnlockExternalFrame(m_extSurfaces[index].FrameSurface.load()->Data.MemId);
         else
             sts = m_pCore->UnlockFrame(internal_surface.Data.MemId);
 
@@ -648,12 +899,15 @@ UMC::Status mfx_UMC_FrameAllocator::Unlock(UMC::FrameMemID mid)
 
 UMC::Status mfx_UMC_FrameAllocator::IncreaseReference(UMC::FrameMemID mid)
 {
-    UMC::AutomaticUMCMutex guard(m_guard);
-
     mfxU32 index = (mfxU32)mid;
     if (!m_frameDataInternal.IsValidMID(index))
         return UMC::UMC_ERR_FAILED;
 
+    if (m_frameDataInternal.TryIncreaseRef(index))
+        return UMC::UMC_OK;
+
+    // 0 -> 1 must not overtake the Free() of the last reference
+    UMC::AutomaticUMCMutex guard(m_guard);
     m_frameDataInternal.IncreaseRef(index);
 
     return UMC::UMC_OK;
@@ -661,12 +915,15 @@ UMC::Status mfx_UMC_FrameAllocator::IncreaseReference(UMC::FrameMemID mid)
 
 UMC::Status mfx_UMC_FrameAllocator::DecreaseReference(UMC::FrameMemID mid)
 {
-    UMC::AutomaticUMCMutex guard(m_guard);
-
     mfxU32 index = (mfxU32)mid;
     if (!m_frameDataInternal.IsValidMID(index))
         return UMC::UMC_ERR_FAILED;
 
+    if (m_frameDataInternal.TryDecreaseRef(index))
+        return UMC::UMC_OK;
+
+    // the last reference is released with the surface, under the lock
+    UMC::AutomaticUMCMutex guard(m_guard);
     mfxU32 refCounter = m_frameDataInternal.DecreaseRef(index);
     if (!refCounter)
     {
@@ -689,11 +946,16 @@ UMC::Status mfx_UMC_FrameAllocator::Free(UMC::FrameMemID mid)
     if (sts < MFX_ERR_NONE)
         return UMC::UMC_ERR_FAILED;
 
+    if (!m_frameDataInternal.GetSurface(index).Data.Locked)
+        m_frameDataInternal.SetFree(index, true);
+
+    UpdateMetrics(m_surfacesInUse ? m_surfacesInUse - 1 : 0, m_frameDataInternal.GetSize());
+
     if ((m_IsUseExternalFrames) || (m_sfcVideoPostProcessing))
     {
         if (m_extSurfaces[index].FrameSurface)
         {
-            sts = m_pCore->DecreaseReference(&m_extSurfaces[index].FrameSurface->Data);
+            sts = m_pCore->DecreaseReference(&m_extSurfaces[index].FrameSurface.load()->Data);
             if (sts < MFX_ERR_NONE)
                 return UMC::UMC_ERR_FAILED;
         }
@@ -785,17 +1047,17 @@ mfxStatus mfx_UMC_FrameAllocator::SetCurrentMFXSurface(mfxFrameSurface1 *surf, b
             {
                 /* new surface */
                 m_curIndex = i;
-                m_extSurfaces[m_curIndex].FrameSurface = surf;
+                SetExtSurface(i, surf);
                 break;
             }
             if ( (NULL != m_extSurfaces[i].FrameSurface) &&
-                  (0 == m_extSurfaces[i].FrameSurface->Data.Locked) &&
-                  (m_extSurfaces[i].FrameSurface->Data.MemId == surf->Data.MemId) &&
+                  (0 == m_extSurfaces[i].FrameSurface.load()->Data.Locked) &&
+                  (m_extSurfaces[i].FrameSurface.load()->Data.MemId == surf->Data.MemId) &&
                   (0 == m_frameDataInternal.GetSurface(i).Data.Locked) )
             {
                 /* surfaces filled already */
                 m_curIndex = i;
-                m_extSurfaces[m_curIndex].FrameSurface = surf;
+                SetExtSurface(i, surf);
                 break;
             }
         } // for (mfxU32 i = 0; i < m_extSurfaces.size(); i++)
@@ -807,7 +1069,7 @@ mfxStatus mfx_UMC_FrameAllocator::SetCurrentMFXSurface(mfxFrameSurface1 *surf, b
         if (m_curIndex != -1)
         {
             mfxFrameSurface1 &internalSurf = m_frameDataInternal.GetSurface(m_curIndex);
-            m_extSurfaces[m_curIndex].FrameSurface = surf;
+            SetExtSurface(m_curIndex, surf);
             if (internalSurf.Data.Locked) // surface was locked yet
             {
                 m_curIndex = -1;
@@ -820,7 +1082,7 @@ mfxStatus mfx_UMC_FrameAllocator::SetCurrentMFXSurface(mfxFrameSurface1 *surf, b
         {
             m_curIndex = AddSurface(surf);
             if (m_curIndex != -1)
-                m_extSurfaces[m_curIndex].FrameSurface = surf;
+                SetExtSurface(m_curIndex, surf);
         }
     }
 
@@ -838,21 +1100,17 @@ mfxI32 mfx_UMC_FrameAllocator::AddSurface(mfxFrameSurface1 *surface)
 
     if (surface->Data.MemId && !m_isSWDecode)
     {
-        mfxU32 i;
-        for (i = 0; i < m_extSurfaces.size(); i++)
-        {
-            if (surface->Data.MemId == m_pCore->MapIdx(m_frameDataInternal.GetSurface(i).Data.MemId))
-            {
-                m_extSurfaces[i].FrameSurface = surface;
-                index = i;
-                break;
-            }
-        }
+        index = FindSurfaceByMemId(surface->Data.MemId, false);
+        if (index != -1 && (mfxU32)index < m_extSurfaces.size())
+            SetExtSurface(index, surface);
+        else
+            index = -1;
     }
     else
     {
         m_extSurfaces.push_back(surf_descr(surface,false));
         index = (mfxI32)(m_extSurfaces.size() - 1);
+        m_surfaceIndex.Insert(surface, index);
     }
 
     switch (surface->Info.FourCC)
@@ -881,6 +1139,7 @@ mfxI32 mfx_UMC_FrameAllocator::AddSurface(mfxFrameSurface1 *surface)
     if (m_IsUseExternalFrames && m_isSWDecode)
     {
         m_frameDataInternal.AddNewFrame(this, surface, &m_info);
+        IndexSurface(m_frameDataInternal.GetSize() - 1);
     }
 
     return index;
@@ -888,8 +1147,7 @@ mfxI32 mfx_UMC_FrameAllocator::AddSurface(mfxFrameSurface1 *surface)
 
 mfxI32 mfx_UMC_FrameAllocator::FindSurface(mfxFrameSurface1 *surf, bool isOpaq)
 {
-    UMC::AutomaticUMCMutex guard(m_guard);
-
+    // no lock: the lookups are lock-free and the surfaces never move
     if (!surf)
         return -1;
 
@@ -897,18 +1155,19 @@ mfxI32 mfx_UMC_FrameAllocator::FindSurface(mfxFrameSurface1 *surf, bool isOpaq)
 
     if (data->MemId && m_IsUseExternalFrames)
     {
-        mfxMemId sMemId;
-        for (mfxU32 i = 0; i < m_frameDataInternal.GetSize(); i++)
-        {
-            mfxMemId memId = m_frameDataInternal.GetSurface(i).Data.MemId;
-            sMemId = isOpaq == true ? memId : m_pCore->MapIdx(memId);
-            if (sMemId == data->MemId)
-            {
-                return i;
-            }
-        }
+        mfxI32 index = FindSurfaceByMemId(data->MemId, isOpaq);
+        if (index != -1)
+            return index;
     }
 
+    mfxI32 index = m_surfaceIndex.Find(surf);
+    if (index == -1)
+        return -1;
+
+    if ((mfxU32)index < m_extSurfaces.size() && m_extSurfaces[index].FrameSurface == surf)
+        return index;
+
+    // the surface was moved to another slot or released after it was indexed
     for (mfxU32 i = 0; i < m_extSurfaces.size(); i++)
     {
         if (m_extSurfaces[i].FrameSurface == surf)
@@ -922,31 +1181,21 @@ mfxI32 mfx_UMC_FrameAllocator::FindSurface(mfxFrameSurface1 *surf, bool isOpaq)
 
 mfxI32 mfx_UMC_FrameAllocator::FindFreeSurface()
 {
-    UMC::AutomaticUMCMutex guard(m_guard);
+    mfxI32 curIndex = m_curIndex;
 
     if ((m_IsUseExternalFrames) || (m_sfcVideoPostProcessing))
     {
-        return m_curIndex;
+        return curIndex;
     }
 
-    if (m_curIndex != -1)
-        return m_curIndex;
-
-    for (mfxU32 i = 0; i < m_frameDataInternal.GetSize(); i++)
-    {
-        if (!m_frameDataInternal.GetSurface(i).Data.Locked)
-        {
-            return i;
-        }
-    }
+    if (curIndex != -1)
+        return curIndex;
 
-    return -1;
+    return m_frameDataInternal.FindFree();
 }
 
 mfxFrameSurface1 * mfx_UMC_FrameAllocator::GetInternalSurface(UMC::FrameMemID index)
 {
-    UMC::AutomaticUMCMutex guard(m_guard);
-
     if (m_IsUseExternalFrames)
     {
         return 0;
@@ -964,15 +1213,13 @@ mfxFrameSurface1 * mfx_UMC_FrameAllocator::GetInternalSurface(UMC::FrameMemID in
 
 mfxFrameSurface1 * mfx_UMC_FrameAllocator::GetSurfaceByIndex(UMC::FrameMemID index)
 {
-    UMC::AutomaticUMCMutex guard(m_guard);
-
     if (index < 0)
         return 0;
 
     if (!m_frameDataInternal.IsValidMID((mfxU32)index))
         return 0;
 
-    return m_IsUseExternalFrames ? m_extSurfaces[index].FrameSurface : &m_frameDataInternal.GetSurface(index);
+    return m_IsUseExternalFrames ? m_extSurfaces[index].FrameSurface.load() : &m_frameDataInternal.GetSurface(index);
 }
 
 void mfx_UMC_FrameAllocator::SetSfcPostProcessingFlag(bool flagToSet)
@@ -999,7 +1246,7 @@ mfxFrameSurface1 * mfx_UMC_FrameAllocator::GetSurface(UMC::FrameMemID index, mfx
         if (sts < MFX_ERR_NONE)
             return 0;
 
-        m_extSurfaces[index].FrameSurface = surface;
+        SetExtSurface(index, surface);
     }
 
     return surface;
@@ -1071,7 +1318,7 @@ mfxStatus mfx_UMC_FrameAllocator::PrepareToOutput(mfxFrameSurface1 *surface_work
         return MFX_ERR_UNSUPPORTED;
     }
     surface.Info.FourCC = surface_work->Info.FourCC;
-    surface.Info.Shift = m_IsUseExternalFrames ? m_extSurfaces[index].FrameSurface->Info.Shift : m_frameDataInternal.GetSurface(index).Info.Shift;
+    surface.Info.Shift = m_IsUseExternalFrames ? m_extSurfaces[index].FrameSurface.load()->Info.Shift : m_frameDataInternal.GetSurface(index).Info.Shift;
 
     //Performance issue. We need to unlock mutex to let decoding thread run async.
     guard.Unlock();
@@ -114,6 +114,8 @@ UMC::Status mfx_UMC_FrameAllocator_D3D_Converter::InitMfx(UMC::FrameAllocatorPar
 
             // set correct width & height to planes
             frameData.Init(&m_info, (UMC::FrameMemID)i, this);
+
+            IndexSurface(i);
         }
     }
 
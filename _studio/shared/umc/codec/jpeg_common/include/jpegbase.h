@@ -26,6 +26,10 @@
 #include "umc_defs.h"
 #include "vm_strings.h"
 
+#ifdef JPEG_ENABLE_STAGE_PROFILING
+#include <chrono>
+#endif
+
 #ifdef _DEBUG
 #define ENABLE_TRACING
 #endif
@@ -136,6 +140,19 @@ typedef enum _JPEG_THREADING_MODE
 
 } JTMODE;
 
+typedef enum _JPEG_STAGE
+{
+  JSTAGE_HUFFMAN  = 0, // entropy decoding/encoding
+  JSTAGE_DCT      = 1, // (inverse) DCT with quantization, lossless prediction
+  JSTAGE_SAMPLING = 2, // chroma up/down sampling
+  JSTAGE_COLOR    = 3, // color conversion
+  JSTAGE_COPY     = 4, // copy of the planar image to/from the MCU buffers
+
+  // Number of profiled stages
+  JSTAGE_MAX
+
+} JSTAGE;
+
 typedef enum _JPEG_COLOR
 {
   JC_UNKNOWN = 0,
@@ -348,6 +365,41 @@ public:
 
 };
 
+// Accumulates the time spent in a codec stage. The codec sources are built
+// with JPEG_ENABLE_STAGE_PROFILING by the jpeg_bench tool only, the library
+// itself compiles JPEG_STAGE_TIMER() to nothing.
+#ifdef JPEG_ENABLE_STAGE_PROFILING
+class CJPEGStageTimer
+{
+public:
+  explicit CJPEGStageTimer(uint64_t* pTime)
+    : m_pTime(pTime)
+    , m_start(std::chrono::steady_clock::now())
+  {}
+
+  ~CJPEGStageTimer()
+  {
+    *m_pTime += (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+      std::chrono::steady_clock::now() - m_start).count();
+  }
+
+  CJPEGStageTimer(const CJPEGStageTimer&) = delete;
+  CJPEGStageTimer& operator=(const CJPEGStageTimer&) = delete;
+
+private:
+  uint64_t* m_pTime;
+  std::chrono::steady_clock::time_point m_start;
+};
+
+#define JPEG_STAGE_TIMER(stage) \
+  CJPEGStageTimer stageTimer(&m_stage_time[stage])
+
+#else
+
+#define JPEG_STAGE_TIMER(stage)
+
+#endif
+
 enum ChromaType
 {
     CHROMA_TYPE_YUV400         = 0, // (grayscale image)
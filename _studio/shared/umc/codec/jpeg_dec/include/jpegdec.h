@@ -27,6 +27,19 @@
 
 class CBaseStreamInput;
 
+// Synchronization of the progressive scans decoded by different threads
+// into a shared coefficient buffer. MCU rows are counted from the top.
+class CJPEGProgressiveSync
+{
+public:
+  virtual ~CJPEGProgressiveSync(void) {}
+
+  // wait until the scans the current one depends on have decoded the MCU row
+  virtual JERRCODE WaitMCURow(uint32_t rowMCU) = 0;
+  // the current scan has decoded MCU rows [0, numRows)
+  virtual void MCURowsDone(uint32_t numRows) = 0;
+};
+
 class CJPEGDecoder : public CJPEGDecoderBase
 {
 public:
@@ -83,10 +96,15 @@ public:
     int      dstPrecision = 16);
 
   JERRCODE ReadPictureHeaders(void);
-  // Read the whole image data
+  // Read the whole image data, not progressive ones
   JERRCODE ReadData(void);
   // Read only VLC NAL data unit. Don't you mind my using h264 slang ? :)
   JERRCODE ReadData(uint32_t restartNum, uint32_t restartsToDecode);
+  // Read one progressive scan into the external coefficient buffer
+  JERRCODE ReadScanProgressive(int16_t* pCoefs, CJPEGProgressiveSync* pSync);
+  // Inverse DCT and color conversion of MCU rows [firstRow, lastRow) of the
+  // progressive image, after all scans covering these rows are decoded
+  JERRCODE ReconstructProgressive(int16_t* pCoefs, uint32_t firstRow, uint32_t lastRow);
 
   void SetInColor(JCOLOR color)        { m_jpeg_color = color; }
   void SetDCTType(int dct_type)        { m_use_qdct = dct_type; }
@@ -142,6 +160,12 @@ public:
   int      m_num_threads;
   int      m_sof_find;
 
+  // progress notification for the multithreaded progressive decoding
+  CJPEGProgressiveSync* m_progressive_sync;
+
+  // nanoseconds spent in each JSTAGE, see JPEG_STAGE_TIMER()
+  uint64_t   m_stage_time[JSTAGE_MAX];
+
 
   IMAGE                       m_dst;
   CJPEGDecoderHuffmanState    m_state;
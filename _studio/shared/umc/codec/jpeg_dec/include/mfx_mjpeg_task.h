@@ -81,6 +81,10 @@ public:
     // The field position in interlaced case
     mfxU32 fieldPos;
 
+    // The picture is progressive, its pieces are the scans followed by the
+    // row bands to reconstruct
+    bool isProgressive;
+
 protected:
     // Close the object
     void Close(void);
@@ -115,6 +119,11 @@ public:
     // Reset the task, drop all counters
     void Reset(void);
 
+    // Check if the tasks initialized for the old parameters may decode the
+    // frames of the new ones
+    static inline
+    bool IsSameSetup(const mfxVideoParam &oldPar, const mfxVideoParam &newPar);
+
     // Add a picture to the task
     mfxStatus AddPicture(UMC::MediaDataEx *pSrcData, const mfxU32  fieldPos);
 
@@ -163,6 +172,21 @@ protected:
 // Inline members
 //
 
+inline
+bool CJpegTask::IsSameSetup(const mfxVideoParam &oldPar, const mfxVideoParam &newPar)
+{
+    // the decoders are set up with the frame size and the output format
+    return (oldPar.mfx.FrameInfo.Width == newPar.mfx.FrameInfo.Width) &&
+           (oldPar.mfx.FrameInfo.Height == newPar.mfx.FrameInfo.Height) &&
+           (oldPar.mfx.FrameInfo.FourCC == newPar.mfx.FrameInfo.FourCC) &&
+           (oldPar.mfx.FrameInfo.PicStruct == newPar.mfx.FrameInfo.PicStruct) &&
+           (oldPar.mfx.Rotation == newPar.mfx.Rotation) &&
+           (oldPar.mfx.JPEGChromaFormat == newPar.mfx.JPEGChromaFormat) &&
+           (oldPar.mfx.JPEGColorFormat == newPar.mfx.JPEGColorFormat);
+
+} // bool CJpegTask::IsSameSetup(const mfxVideoParam &oldPar, const mfxVideoParam &newPar)
+
+
 inline
 mfxU32 CJpegTask::NumPicCollected(void) const
 {
@@ -50,9 +50,14 @@ namespace UMC
 
 enum
 {
-    JPEG_MAX_THREADS = 4
+    JPEG_MAX_THREADS = 4,
+    // Number of row bands the progressive picture is reconstructed by
+    JPEG_PROGRESSIVE_BANDS = 2 * JPEG_MAX_THREADS
 };
 
+// Shared state of the progressive picture decoded by several threads
+struct JpegProgressiveState;
+
 class MJPEGVideoDecoderMFX : public MJPEGVideoDecoderBaseMFX
 {
 public:
@@ -124,6 +129,25 @@ protected:
                        const mfxU32 restartsToDecode,
                        const mfxU32 threadNum);
 
+    // Set the decoder's destination to the frame or the field
+    Status SetDecoderDestination(const mfxU32 fieldNum, const mfxU32 threadNum);
+
+    // Decode a scan or reconstruct a row band of the progressive picture
+    Status DecodeProgressivePiece(const CJpegTask &task,
+                                  const mfxU32 picNum,
+                                  const mfxU32 pieceNum,
+                                  const mfxU32 threadNum);
+
+    // Decode the picture header and the tables preceding the scan
+    Status DecodeScanTables(const CJpegTaskBuffer &picBuffer,
+                            const mfxU32 scanNum,
+                            const mfxU32 threadNum);
+
+    // Parse the scans headers and allocate the coefficient buffer
+    Status PrepareProgressive(JpegProgressiveState &state,
+                              const CJpegTaskBuffer &picBuffer,
+                              const mfxU32 threadNum);
+
     Status _DecodeHeader(const uint8_t* pBuf, size_t buflen, int32_t* nUsedBytes, const uint32_t threadNum);
 
     int32_t                  m_frameNo;
@@ -141,6 +165,11 @@ protected:
 
     // Pointer to the last buffer decoded. It is required to check if header was already decoded.
     const CJpegTaskBuffer *m_pLastPicBuffer[JPEG_MAX_THREADS];
+    // The last progressive scan which tables were decoded
+    mfxU32 m_lastTablesScan[JPEG_MAX_THREADS];
+
+    // Progressive pictures state, one per field
+    std::unique_ptr<JpegProgressiveState> m_progressive[2];
 
     double                  m_local_frame_time;
     double                  m_local_delta_frame_time;
@@ -48,6 +48,7 @@ CJPEGDecoder::CJPEGDecoder(void)
     : m_dst()
 {
   Reset();
+  memset(m_stage_time, 0, sizeof(m_stage_time));
   return;
 } // ctor
 
@@ -155,6 +156,7 @@ void CJPEGDecoder::Reset(void)
 
   m_use_qdct               = 0;
   m_sof_find               = 0;
+  m_progressive_sync       = 0;
 
   return;
 } // CJPEGDecoder::Reset(void)
@@ -561,7 +563,7 @@ JERRCODE CJPEGDecoder::ParseSOF2(void)
     return JPEG_ERR_SOF_DATA;
   }
 
-  for(i = 0; i < m_jpeg_ncomp; i++)
+  for(m_nblock = 0, i = 0; i < m_jpeg_ncomp; i++)
   {
     curr_comp = &m_ccomp[i];
 
@@ -819,7 +821,14 @@ JERRCODE CJPEGDecoder::ParseRST(void)
 JERRCODE CJPEGDecoder::ParseData()
 {
     int32_t i;
-    JERRCODE jerr = Init();
+    JERRCODE jerr;
+
+    // progressive pictures are decoded with ReadScanProgressive() and
+    // ReconstructProgressive(), the serial path can't write NV12
+    if(JPEG_PROGRESSIVE == m_jpeg_mode)
+      return JPEG_NOT_IMPLEMENTED;
+
+    jerr = Init();
     if(JPEG_OK != jerr)
     {
       return jerr;
@@ -837,81 +846,6 @@ JERRCODE CJPEGDecoder::ParseData()
       }
       break;
 
-    case JPEG_PROGRESSIVE:
-      {
-        jerr = DecodeScanProgressive();
-
-        m_ac_scans_completed = 0;
-        for(i = 0; i < m_jpeg_ncomp; i++)
-        {
-          m_ac_scans_completed += m_ccomp[i].m_ac_scan_completed;
-        }
-
-        if(JPEG_OK != jerr ||
-          (m_dc_scan_completed != 0 && m_ac_scans_completed == m_jpeg_ncomp))
-        {
-          int16_t* pMCUBuf;
-          for(i = 0; i < (int) m_numyMCU; i++)
-          {
-            pMCUBuf = m_block_buffer + (i* m_numxMCU * DCTSIZE2* m_nblock);
-
-            switch (m_jpeg_dct_scale)
-            {
-              case JD_1_1:
-              {
-                  jerr = ReconstructMCURowBL8x8(pMCUBuf, 0, m_numxMCU);
-              }
-              break;
-
-              case JD_1_2:
-              {
-                jerr = ReconstructMCURowBL8x8To4x4(pMCUBuf, 0, m_numxMCU);
-              }
-              break;
-
-              case JD_1_4:
-              {
-                jerr = ReconstructMCURowBL8x8To2x2(pMCUBuf, 0, m_numxMCU);
-              }
-              break;
-
-              case JD_1_8:
-              {
-                jerr = ReconstructMCURowBL8x8To1x1(pMCUBuf, 0, m_numxMCU);
-              }
-              break;
-
-              default:
-                break;
-            }
-            if(JPEG_OK != jerr)
-              return jerr;
-            if(JD_PIXEL == m_dst.order) // pixel by pixel order
-            {
-              jerr = UpSampling(i, 0, m_numxMCU);
-              if(JPEG_OK != jerr)
-                return jerr;
-
-             jerr = ColorConvert(i, 0, m_numxMCU);
-              if(JPEG_OK != jerr)
-                return jerr;
-            }
-            else          // plane order
-            {
-              if(m_jpeg_precision == 8)
-              {
-                jerr = ProcessBuffer(i);
-                if(JPEG_OK != jerr)
-                  return jerr;
-              }
-              else
-                return JPEG_NOT_IMPLEMENTED; //not support 16-bit PLANE image
-            }
-          }
-        }
-      }
-      break;
-
     case JPEG_LOSSLESS:
       if(m_curr_scan->ncomps == m_jpeg_ncomp)
       {
@@ -1102,13 +1036,12 @@ JERRCODE CJPEGDecoder::ParseJPEGBitStream(JOPERATION op)
       return JPEG_NOT_IMPLEMENTED;
 
     case JM_SOF2:
-      //jerr = ParseSOF2();
-      //if(JPEG_OK != jerr)
-      //{
-      //  return jerr;
-      //}
-      //break;
-      return JPEG_NOT_IMPLEMENTED;
+      jerr = ParseSOF2();
+      if(JPEG_OK != jerr)
+      {
+        return jerr;
+      }
+      break;
 
     case JM_SOF3:
       //jerr = ParseSOF3();
@@ -1421,6 +1354,8 @@ uint32_t JPEG_BPP[JC_MAX] =
 
 JERRCODE CJPEGDecoder::ColorConvert(uint32_t rowMCU, uint32_t colMCU, uint32_t maxMCU)
 {
+  JPEG_STAGE_TIMER(JSTAGE_COLOR);
+
   int       cc_h;
   mfxSize  roi;
   int status;
@@ -1704,6 +1639,8 @@ JERRCODE CJPEGDecoder::ColorConvert(uint32_t rowMCU, uint32_t colMCU, uint32_t m
 
 JERRCODE CJPEGDecoder::UpSampling(uint32_t rowMCU, uint32_t colMCU, uint32_t maxMCU)
 {
+  JPEG_STAGE_TIMER(JSTAGE_SAMPLING);
+
   int i, j, k, n, c;
   int need_upsampling;
   CJPEGColorComponent* curr_comp;
@@ -2223,6 +2160,8 @@ JERRCODE CJPEGDecoder::UpSampling(uint32_t rowMCU, uint32_t colMCU, uint32_t max
 
 JERRCODE CJPEGDecoder::ProcessBuffer(int nMCURow, int thread_id)
 {
+  JPEG_STAGE_TIMER(JSTAGE_COPY);
+
   int                  c;
   int                  yPadd = 0;
   int                  srcStep = 0;
@@ -2331,6 +2270,8 @@ JERRCODE CJPEGDecoder::ProcessBuffer(int nMCURow, int thread_id)
 
 JERRCODE CJPEGDecoder::DecodeHuffmanMCURowBL(int16_t* pMCUBuf, uint32_t colMCU, uint32_t maxMCU)
 {
+  JPEG_STAGE_TIMER(JSTAGE_HUFFMAN);
+
   int       n, k, l;
   uint32_t j;
   int       srcLen;
@@ -2399,6 +2340,8 @@ JERRCODE CJPEGDecoder::DecodeHuffmanMCURowBL(int16_t* pMCUBuf, uint32_t colMCU,
 
 JERRCODE CJPEGDecoder::DecodeHuffmanMCURowLS(int16_t* pMCUBuf)
 {
+  JPEG_STAGE_TIMER(JSTAGE_HUFFMAN);
+
   int       c;
   uint8_t*    src;
   int16_t*   dst[4];
@@ -2511,6 +2454,8 @@ JERRCODE CJPEGDecoder::ReconstructMCURowBL8x8_NxN(int16_t* pMCUBuf,
                                                   uint32_t colMCU,
                                                   uint32_t maxMCU)
 {
+  JPEG_STAGE_TIMER(JSTAGE_DCT);
+
   int       c, k, l, curr_lnz;
   uint32_t mcu_col;
   uint8_t*    lnz     = 0;
@@ -2607,6 +2552,8 @@ JERRCODE CJPEGDecoder::ReconstructMCURowBL8x8(int16_t* pMCUBuf,
                                               uint32_t colMCU,
                                               uint32_t maxMCU)
 {
+  JPEG_STAGE_TIMER(JSTAGE_DCT);
+
     int       c, k, l;
   uint32_t mcu_col;
   uint8_t*    dst     = 0;
@@ -2675,6 +2622,8 @@ JERRCODE CJPEGDecoder::ReconstructMCURowBL8x8To4x4(int16_t* pMCUBuf,
                                                    uint32_t colMCU,
                                                    uint32_t maxMCU)
 {
+  JPEG_STAGE_TIMER(JSTAGE_DCT);
+
   int       c, k, l;
   uint32_t mcu_col;
   uint8_t*    dst     = 0;
@@ -2780,6 +2729,8 @@ JERRCODE CJPEGDecoder::ReconstructMCURowBL8x8To2x2(int16_t* pMCUBuf,
                                                    uint32_t colMCU,
                                                    uint32_t maxMCU)
 {
+  JPEG_STAGE_TIMER(JSTAGE_DCT);
+
   int       c, k, l;
   uint32_t mcu_col;
   uint8_t*    dst     = 0;
@@ -2885,6 +2836,8 @@ JERRCODE CJPEGDecoder::ReconstructMCURowBL8x8To1x1(int16_t* pMCUBuf,
                                                    uint32_t colMCU,
                                                    uint32_t maxMCU)
 {
+  JPEG_STAGE_TIMER(JSTAGE_DCT);
+
   int       c, k, l;
   uint32_t mcu_col;
   uint8_t*    dst     = 0;
@@ -2981,6 +2934,8 @@ JERRCODE CJPEGDecoder::ReconstructMCURowEX(int16_t* pMCUBuf,
                                            uint32_t colMCU,
                                            uint32_t maxMCU)
 {
+  JPEG_STAGE_TIMER(JSTAGE_DCT);
+
   int       c, k, l;
   uint32_t mcu_col;
   uint16_t*   dst = 0;
@@ -3056,6 +3011,8 @@ JERRCODE CJPEGDecoder::ReconstructMCURowLS(
   int     nMCURow,
   int     thread_id)
 {
+  JPEG_STAGE_TIMER(JSTAGE_DCT);
+
   int       n;
   int       dstStep;
   int16_t*   ptr;
@@ -3701,6 +3658,8 @@ JERRCODE CJPEGDecoder::DecodeScanBaselineIN_P(void)
 
 JERRCODE CJPEGDecoder::DecodeScanBaselineNI(void)
 {
+  JPEG_STAGE_TIMER(JSTAGE_HUFFMAN);
+
   int       i, j, k, l, c;
   int       srcLen;
   int       currPos;
@@ -3842,6 +3801,8 @@ JERRCODE CJPEGDecoder::DecodeScanBaselineNI(void)
 
 JERRCODE CJPEGDecoder::DecodeScanProgressive(void)
 {
+  JPEG_STAGE_TIMER(JSTAGE_HUFFMAN);
+
   int       i, j, k, n, l, c;
   int       srcLen;
   int       currPos;
@@ -3866,6 +3827,13 @@ JERRCODE CJPEGDecoder::DecodeScanProgressive(void)
     // AC scan
     for(i = 0; i < (int) m_numyMCU; i++)
     {
+      if(m_progressive_sync)
+      {
+        jerr = m_progressive_sync->WaitMCURow(i);
+        if(JPEG_OK != jerr)
+          return jerr;
+      }
+
       for(k = 0; k < m_ccomp[m_curr_comp_no].m_vsampling; k++)
       {
         if(i*m_ccomp[m_curr_comp_no].m_vsampling*8 + k*8 >= m_jpeg_height)
@@ -3948,6 +3916,9 @@ JERRCODE CJPEGDecoder::DecodeScanProgressive(void)
           } // for m_hsampling
         } // for m_numxMCU
       } // for m_vsampling
+
+      if(m_progressive_sync)
+        m_progressive_sync->MCURowsDone(i + 1);
     } // for m_numyMCU
 
     if(m_al == 0 && m_se == 63)
@@ -3960,6 +3931,13 @@ JERRCODE CJPEGDecoder::DecodeScanProgressive(void)
     // DC scan
     for(i = 0; i < (int) m_numyMCU; i++)
     {
+      if(m_progressive_sync)
+      {
+        jerr = m_progressive_sync->WaitMCURow(i);
+        if(JPEG_OK != jerr)
+          return jerr;
+      }
+
       for(j = 0; j < (int) m_numxMCU; j++)
       {
         if(m_curr_scan->jpeg_restart_interval)
@@ -4042,6 +4020,9 @@ JERRCODE CJPEGDecoder::DecodeScanProgressive(void)
         }
         m_restarts_to_go --;
       } // for m_numxMCU
+
+      if(m_progressive_sync)
+        m_progressive_sync->MCURowsDone(i + 1);
     } // for m_numyMCU
 
     if(m_al == 0)
@@ -4101,6 +4082,8 @@ JERRCODE CJPEGDecoder::DecodeScanLosslessIN(void)
 
 JERRCODE CJPEGDecoder::DecodeScanLosslessNI(void)
 {
+  JPEG_STAGE_TIMER(JSTAGE_HUFFMAN);
+
   int       i, j, n, v, h;
   uint8_t*    src;
   int       srcLen;
@@ -4334,6 +4317,143 @@ JERRCODE CJPEGDecoder::ReadData(uint32_t restartNum, uint32_t restartsToDecode)
 
 } // CJPEGDecoder::ReadData(uint32_t restartNum)
 
+JERRCODE CJPEGDecoder::ReadScanProgressive(int16_t* pCoefs, CJPEGProgressiveSync* pSync)
+{
+    int16_t* pOwnBuffer = m_block_buffer;
+    JERRCODE jerr = JPEG_OK;
+
+    if (JPEG_PROGRESSIVE != m_jpeg_mode || 0 == pCoefs)
+    {
+        return JPEG_ERR_PARAMS;
+    }
+
+    m_marker = JM_NONE;
+
+    // find the start of the scan
+    jerr = NextMarker(&m_marker);
+    if (JPEG_OK != jerr)
+    {
+        return jerr;
+    }
+
+    if (JM_SOS != m_marker)
+    {
+        return JPEG_ERR_SOS_DATA;
+    }
+
+    jerr = ParseSOS(JO_READ_DATA);
+    if (JPEG_OK != jerr)
+    {
+        return jerr;
+    }
+
+    // all scans of the image are decoded into the same coefficient buffer,
+    // the decoder's own buffer is not allocated for them. Such a decoder is
+    // not supposed to decode the progressive image with ReadData() then.
+    m_block_buffer = pCoefs;
+
+    jerr = Init();
+    if (JPEG_OK == jerr)
+    {
+        m_restarts_to_go   = m_curr_scan->jpeg_restart_interval;
+        m_next_restart_num = 0;
+
+        m_progressive_sync = pSync;
+        jerr = DecodeScanProgressive();
+        m_progressive_sync = 0;
+    }
+
+    m_block_buffer = pOwnBuffer;
+
+    return jerr;
+
+} // CJPEGDecoder::ReadScanProgressive()
+
+JERRCODE CJPEGDecoder::ReconstructProgressive(int16_t* pCoefs, uint32_t firstRow, uint32_t lastRow)
+{
+    int16_t* pOwnBuffer = m_block_buffer;
+    JSCAN*   pScan = m_curr_scan;
+    JSCAN    frameScan;
+    JERRCODE jerr = JPEG_OK;
+
+    if (JPEG_PROGRESSIVE != m_jpeg_mode || 0 == pCoefs)
+    {
+        return JPEG_ERR_PARAMS;
+    }
+
+    m_block_buffer = pCoefs;
+    jerr = Init();
+    m_block_buffer = pOwnBuffer;
+    if (JPEG_OK != jerr)
+    {
+        return jerr;
+    }
+
+    // the coefficients are laid out as the MCUs of an interleaved scan
+    // of all components, reconstruct them the same way
+    frameScan = *pScan;
+    frameScan.jpeg_restart_interval = 0;
+    frameScan.min_h_factor = 1;
+    frameScan.min_v_factor = 1;
+    frameScan.numxMCU      = m_numxMCU;
+    frameScan.numyMCU      = m_numyMCU;
+    frameScan.mcuWidth     = m_mcuWidth;
+    frameScan.mcuHeight    = m_mcuHeight;
+    frameScan.xPadding     = m_xPadding;
+    frameScan.yPadding     = m_yPadding;
+    frameScan.ncomps       = m_jpeg_ncomp;
+    frameScan.first_comp   = 0;
+
+    for (int c = 0; c < m_jpeg_ncomp; c++)
+    {
+        m_ccomp[c].m_scan_hsampling = m_ccomp[c].m_hsampling;
+        m_ccomp[c].m_scan_vsampling = m_ccomp[c].m_vsampling;
+    }
+
+    m_curr_scan = &frameScan;
+
+    for (uint32_t rowMCU = firstRow; rowMCU < lastRow && rowMCU < m_numyMCU; rowMCU++)
+    {
+        int16_t* pMCUBuf = pCoefs + rowMCU * m_numxMCU * DCTSIZE2 * m_nblock;
+
+        switch (m_jpeg_dct_scale)
+        {
+        default:
+        case JD_1_1:
+            jerr = ReconstructMCURowBL8x8(pMCUBuf, 0, m_numxMCU);
+            break;
+
+        case JD_1_2:
+            jerr = ReconstructMCURowBL8x8To4x4(pMCUBuf, 0, m_numxMCU);
+            break;
+
+        case JD_1_4:
+            jerr = ReconstructMCURowBL8x8To2x2(pMCUBuf, 0, m_numxMCU);
+            break;
+
+        case JD_1_8:
+            jerr = ReconstructMCURowBL8x8To1x1(pMCUBuf, 0, m_numxMCU);
+            break;
+        }
+
+        if (JPEG_OK != jerr)
+            break;
+
+        jerr = UpSampling(rowMCU, 0, m_numxMCU);
+        if (JPEG_OK != jerr)
+            break;
+
+        jerr = ColorConvert(rowMCU, 0, m_numxMCU);
+        if (JPEG_OK != jerr)
+            break;
+    }
+
+    m_curr_scan = pScan;
+
+    return jerr;
+
+} // CJPEGDecoder::ReconstructProgressive()
+
 JERRCODE CJPEGDecoder::ReadPictureHeaders(void)
 {
     return JPEG_OK;
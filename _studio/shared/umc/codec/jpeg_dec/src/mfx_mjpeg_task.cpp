@@ -24,6 +24,7 @@
 
 #include <umc_mjpeg_mfx_decode.h>
 #include <jpegbase.h>
+#include <algorithm>
 
 #include <mfx_common_decode_int.h>
 
@@ -37,6 +38,7 @@ CJpegTaskBuffer::CJpegTaskBuffer(void)
     fieldPos = 0;
     numScans = 0;
     timeStamp = 0;
+    isProgressive = false;
 } // CJpegTaskBuffer::CJpegTaskBuffer(void)
 
 CJpegTaskBuffer::~CJpegTaskBuffer(void)
@@ -175,6 +177,8 @@ void CJpegTask::Reset(void)
         m_pics[i]->scanSize.clear();
         m_pics[i]->scanTablesOffset.clear();
         m_pics[i]->scanTablesSize.clear();
+
+        m_pics[i]->isProgressive = false;
     }
 
     m_numPic = 0;
@@ -193,6 +197,7 @@ mfxStatus CJpegTask::AddPicture(UMC::MediaDataEx *pSrcData,
     mfxStatus     mfxRes;
     size_t        imageHeaderSize;
     Ipp32u        marker;
+    bool          isProgressive;
 
     // we strongly need auxilary data
     if (NULL == pAuxData)
@@ -213,8 +218,9 @@ mfxStatus CJpegTask::AddPicture(UMC::MediaDataEx *pSrcData,
     m_pics[m_numPic]->pieceSize.resize(maxNumPieces);
     m_pics[m_numPic]->pieceRSTOffset.resize(maxNumPieces);
 
-    // allocates vectors for scans parameters
-    maxNumScans = MAX_SCANS_PER_FRAME;
+    // allocates vectors for scans parameters. A progressive picture may
+    // have more scans than a baseline one.
+    maxNumScans = std::max<Ipp32u>(MAX_SCANS_PER_FRAME, pAuxData->count + 1);
     m_pics[m_numPic]->scanOffset.resize(maxNumScans);
     m_pics[m_numPic]->scanSize.resize(maxNumScans);
     m_pics[m_numPic]->scanTablesOffset.resize(maxNumScans);
@@ -224,6 +230,7 @@ mfxStatus CJpegTask::AddPicture(UMC::MediaDataEx *pSrcData,
     imageHeaderSize = 0;
     numPieces = 0;
     numScans = 0;
+    isProgressive = false;
     for (i = 0; i < pAuxData->count; i += 1)
     {
         size_t chunkSize;
@@ -237,6 +244,11 @@ mfxStatus CJpegTask::AddPicture(UMC::MediaDataEx *pSrcData,
 
         m_pics[m_numPic]->pieceRSTOffset[numPieces] = pAuxData->values[i] >> 8;
 
+        if (JM_SOF2 == marker)
+        {
+            isProgressive = true;
+        }
+
         // some data
         if (JM_SOS == marker)
         {
@@ -262,6 +274,11 @@ mfxStatus CJpegTask::AddPicture(UMC::MediaDataEx *pSrcData,
                 m_pics[m_numPic]->scanTablesSize[numScans] += chunkSize;
             }
         }
+        else if ((JM_RST0 <= marker) && (JM_RST7 >= marker) && isProgressive && 0 != numScans)
+        {
+            // progressive scans are decoded as a whole
+            m_pics[m_numPic]->scanSize[numScans - 1] += chunkSize;
+        }
         else if ((JM_RST0 <= marker) && (JM_RST7 >= marker))
         {
             // fill the chunks with the current chunk data
@@ -276,6 +293,13 @@ mfxStatus CJpegTask::AddPicture(UMC::MediaDataEx *pSrcData,
         }
     }
 
+    // every scan of the progressive picture is a piece, and the
+    // reconstruction is split into row bands, see DecodePicture
+    if (isProgressive && numScans)
+    {
+        numPieces = numScans + UMC::JPEG_PROGRESSIVE_BANDS;
+    }
+
     // copy the data
     if(m_pics[m_numPic]->bufSize < srcSize)
         return MFX_ERR_NOT_ENOUGH_BUFFER;
@@ -286,6 +310,7 @@ mfxStatus CJpegTask::AddPicture(UMC::MediaDataEx *pSrcData,
     m_pics[m_numPic]->numScans = numScans;
     m_pics[m_numPic]->numPieces = numPieces;
     m_pics[m_numPic]->fieldPos = fieldPos;
+    m_pics[m_numPic]->isProgressive = isProgressive;
 
     // increment the number of pictures collected
     m_numPic += 1;
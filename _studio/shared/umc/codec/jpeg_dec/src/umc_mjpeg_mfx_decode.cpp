@@ -22,6 +22,9 @@
 #if defined (MFX_ENABLE_MJPEG_VIDEO_DECODE) && defined(MFX_ENABLE_SW_FALLBACK)
 #include <string.h>
 #include <assert.h>
+#include <algorithm>
+#include <mutex>
+#include <condition_variable>
 #include "umc_video_data.h"
 #include "umc_mjpeg_mfx_decode.h"
 #include "membuffin.h"
@@ -32,6 +35,94 @@
 namespace UMC
 {
 
+struct JpegProgressiveState
+{
+    // Parameters of a scan, which are required to run it concurrently
+    struct Scan
+    {
+        // mask of components of the scan
+        uint32_t compMask;
+        // spectral selection
+        uint32_t ss;
+        uint32_t se;
+        // previous scans refining the same coefficients
+        std::vector<uint32_t> deps;
+    };
+
+    std::mutex guard;
+    std::condition_variable rowsDoneEvent;
+
+    // the scans headers are parsed, the coefficients buffer is allocated
+    bool prepared = false;
+    // some scan failed, waiting threads have to give up
+    bool failed = false;
+
+    std::vector<int16_t> coefs;
+    std::vector<Scan> scans;
+    // the number of MCU rows decoded by every scan
+    std::vector<uint32_t> rowsDone;
+    uint32_t numyMCU = 0;
+
+    // Returns true if all the scans have decoded the first numRows MCU rows
+    bool RowsDone(const std::vector<uint32_t> &scanList, uint32_t numRows) const
+    {
+        return std::all_of(scanList.begin(), scanList.end(),
+                           [&](uint32_t s) { return rowsDone[s] >= numRows; });
+    }
+
+    void Fail(void)
+    {
+        {
+            std::lock_guard<std::mutex> lock(guard);
+            failed = true;
+        }
+        rowsDoneEvent.notify_all();
+    }
+};
+
+namespace
+{
+
+// A scan waits for the scans refining the same coefficients, so the
+// coefficients are updated in the bitstream order row by row
+class JpegProgressiveScanSync : public CJPEGProgressiveSync
+{
+public:
+    JpegProgressiveScanSync(JpegProgressiveState &state, uint32_t scanNum)
+        : m_state(state)
+        , m_scanNum(scanNum)
+    {
+    }
+
+    JERRCODE WaitMCURow(uint32_t rowMCU) override
+    {
+        const std::vector<uint32_t> &deps = m_state.scans[m_scanNum].deps;
+
+        if (deps.empty())
+            return JPEG_OK;
+
+        std::unique_lock<std::mutex> lock(m_state.guard);
+        m_state.rowsDoneEvent.wait(lock, [&] { return m_state.failed || m_state.RowsDone(deps, rowMCU + 1); });
+
+        return m_state.failed ? JPEG_ERR_INTERNAL : JPEG_OK;
+    }
+
+    void MCURowsDone(uint32_t numRows) override
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_state.guard);
+            m_state.rowsDone[m_scanNum] = numRows;
+        }
+        m_state.rowsDoneEvent.notify_all();
+    }
+
+private:
+    JpegProgressiveState &m_state;
+    const uint32_t m_scanNum;
+};
+
+} // namespace
+
 MJPEGVideoDecoderMFX::MJPEGVideoDecoderMFX(void)
 {
     m_IsInit      = false;
@@ -52,6 +143,12 @@ MJPEGVideoDecoderMFX::MJPEGVideoDecoderMFX(void)
     m_frameAllocator = 0;
 
     std::fill(std::begin(m_pLastPicBuffer), std::end(m_pLastPicBuffer), nullptr);
+    std::fill(std::begin(m_lastTablesScan), std::end(m_lastTablesScan), 0);
+
+    for (auto& state: m_progressive)
+    {
+        state.reset(new JpegProgressiveState);
+    }
 
     m_framePrecision = 0;
     m_frameChannels = 0;
@@ -392,6 +489,13 @@ Status MJPEGVideoDecoderMFX::DecodeHeader(MediaData* in)
 
 Status MJPEGVideoDecoderMFX::AllocateFrame()
 {
+    // forget the previous progressive pictures, the buffers are reused
+    for (auto& state: m_progressive)
+    {
+        state->prepared = false;
+        state->failed = false;
+    }
+
     mfxSize size;
     size.height = m_DecoderParams.info.disp_clip_info.height;
     size.width = m_DecoderParams.info.disp_clip_info.width;
@@ -570,6 +674,17 @@ Status MJPEGVideoDecoderMFX::DecodePicture(const CJpegTask &task,
     }
     const CJpegTaskBuffer &picBuffer = task.GetPictureBuffer(picNum);
 
+    if (picBuffer.isProgressive)
+    {
+        umcRes = DecodeProgressivePiece(task, picNum, pieceNum, threadNumber);
+        if (UMC_OK != umcRes)
+        {
+            task.surface_out->Data.Corrupted = 1;
+        }
+
+        return umcRes;
+    }
+
     // check if there is a need to decode the header
     if (m_pLastPicBuffer[threadNumber] != &picBuffer)
     {
@@ -655,6 +770,253 @@ Status MJPEGVideoDecoderMFX::DecodePicture(const CJpegTask &task,
 
 } // Status MJPEGVideoDecoderMFX::DecodePicture(const CJpegTask &task,
 
+Status MJPEGVideoDecoderMFX::DecodeScanTables(const CJpegTaskBuffer &picBuffer,
+                                              const mfxU32 scanNum,
+                                              const mfxU32 threadNum)
+{
+    Status umcRes = UMC_OK;
+    mfxU32 i;
+
+    // tables of the later scans replace the previous ones, so the header is
+    // to be decoded again to go back
+    if (m_pLastPicBuffer[threadNum] != &picBuffer ||
+        m_lastTablesScan[threadNum] > scanNum)
+    {
+        int32_t nUsedBytes = 0;
+
+        umcRes = _DecodeHeader((uint8_t *) picBuffer.pBuf,
+                               picBuffer.imageHeaderSize + picBuffer.scanSize[0],
+                               &nUsedBytes, threadNum);
+        if (UMC_OK != umcRes)
+        {
+            return umcRes;
+        }
+        // save the pointer to the last decoded picture
+        m_pLastPicBuffer[threadNum] = &picBuffer;
+        m_lastTablesScan[threadNum] = 0;
+
+        // all the progressive scans share the first scan's parameters
+        m_dec[threadNum]->m_curr_scan = &m_dec[threadNum]->m_scans[0];
+    }
+
+    for (i = m_lastTablesScan[threadNum] + 1; i <= scanNum; i += 1)
+    {
+        if (picBuffer.scanTablesOffset[i] != 0)
+        {
+            int32_t nUsedBytes = 0;
+
+            umcRes = _DecodeHeader((uint8_t *) picBuffer.pBuf + picBuffer.scanTablesOffset[i],
+                                   picBuffer.scanTablesSize[i] + picBuffer.scanSize[i],
+                                   &nUsedBytes, threadNum);
+            if (UMC_OK != umcRes)
+            {
+                return umcRes;
+            }
+        }
+    }
+    m_lastTablesScan[threadNum] = scanNum;
+
+    return UMC_OK;
+
+} // Status MJPEGVideoDecoderMFX::DecodeScanTables(const CJpegTaskBuffer &picBuffer,
+
+Status MJPEGVideoDecoderMFX::PrepareProgressive(JpegProgressiveState &state,
+                                                const CJpegTaskBuffer &picBuffer,
+                                                const mfxU32 threadNum)
+{
+    const CJPEGDecoder &dec = *m_dec[threadNum];
+    const uint32_t allComps = (1u << dec.m_jpeg_ncomp) - 1;
+    mfxU32 s, t;
+
+    if (0 == picBuffer.numScans || 0 == dec.m_numxMCU || 0 == dec.m_numyMCU)
+    {
+        return UMC_ERR_INVALID_STREAM;
+    }
+
+    state.scans.resize(picBuffer.numScans);
+    state.rowsDone.assign(picBuffer.numScans, 0);
+    state.numyMCU = dec.m_numyMCU;
+
+    for (s = 0; s < picBuffer.numScans; s += 1)
+    {
+        JpegProgressiveState::Scan &scan = state.scans[s];
+        const uint8_t *pSOS = picBuffer.pBuf + picBuffer.scanOffset[s];
+        const size_t sosSize = picBuffer.scanSize[s];
+        size_t pos = 0;
+        uint32_t numComps, c;
+
+        // FF DA, length, Ns, Ns * (Cs, Td/Ta), Ss, Se, Ah/Al
+        while (pos + 1 < sosSize && !(0xFF == pSOS[pos] && JM_SOS == pSOS[pos + 1]))
+        {
+            pos += 1;
+        }
+        if (pos + 5 > sosSize)
+        {
+            return UMC_ERR_INVALID_STREAM;
+        }
+        numComps = pSOS[pos + 4];
+        pos += 5;
+        if (0 == numComps || pos + 2 * numComps + 3 > sosSize)
+        {
+            return UMC_ERR_INVALID_STREAM;
+        }
+
+        scan.compMask = 0;
+        for (c = 0; c < numComps; c += 1)
+        {
+            int32_t comp;
+
+            for (comp = 0; comp < dec.m_jpeg_ncomp; comp += 1)
+            {
+                if (dec.m_ccomp[comp].m_id == pSOS[pos + 2 * c])
+                    break;
+            }
+            if (comp == dec.m_jpeg_ncomp)
+            {
+                return UMC_ERR_INVALID_STREAM;
+            }
+            scan.compMask |= 1u << comp;
+        }
+        pos += 2 * numComps;
+
+        scan.ss = pSOS[pos];
+        scan.se = pSOS[pos + 1];
+
+        // the decoder handles the interleaved DC scans of all components and
+        // the AC scans of a single component only
+        if ((0 == scan.ss && (0 != scan.se || allComps != scan.compMask)) ||
+            (0 != scan.ss && (1 != numComps || scan.ss > scan.se)))
+        {
+            return UMC_ERR_UNSUPPORTED;
+        }
+
+        // the scan refines the coefficients of the intersecting scans before
+        scan.deps.clear();
+        for (t = 0; t < s; t += 1)
+        {
+            const JpegProgressiveState::Scan &prev = state.scans[t];
+
+            if ((prev.compMask & scan.compMask) &&
+                prev.ss <= scan.se && scan.ss <= prev.se)
+            {
+                scan.deps.push_back(t);
+            }
+        }
+    }
+
+    state.coefs.assign((size_t) dec.m_numxMCU * dec.m_numyMCU * dec.m_nblock * DCTSIZE2, 0);
+    state.prepared = true;
+
+    return UMC_OK;
+
+} // Status MJPEGVideoDecoderMFX::PrepareProgressive(JpegProgressiveState &state,
+
+Status MJPEGVideoDecoderMFX::DecodeProgressivePiece(const CJpegTask &task,
+                                                    const mfxU32 picNum,
+                                                    const mfxU32 pieceNum,
+                                                    const mfxU32 threadNum)
+{
+    const CJpegTaskBuffer &picBuffer = task.GetPictureBuffer(picNum);
+    Status umcRes = UMC_OK;
+    JERRCODE jerr = JPEG_OK;
+
+    if (picNum >= sizeof(m_progressive) / sizeof(m_progressive[0]) || 0 == picBuffer.numScans)
+    {
+        return UMC_ERR_FAILED;
+    }
+    JpegProgressiveState &state = *m_progressive[picNum];
+
+    // scans go first, the row bands follow them
+    const bool isScan = (pieceNum < picBuffer.numScans);
+    const mfxU32 scanNum = isScan ? pieceNum : (picBuffer.numScans - 1);
+
+    umcRes = DecodeScanTables(picBuffer, scanNum, threadNum);
+
+    // the first thread parses the scans headers
+    if (UMC_OK == umcRes)
+    {
+        std::lock_guard<std::mutex> lock(state.guard);
+
+        if (state.failed)
+        {
+            return UMC_ERR_FAILED;
+        }
+        if (!state.prepared)
+        {
+            umcRes = PrepareProgressive(state, picBuffer, threadNum);
+        }
+    }
+
+    if (UMC_OK == umcRes && isScan)
+    {
+        JpegProgressiveScanSync sync(state, scanNum);
+
+        jerr = m_dec[threadNum]->SetSource(picBuffer.pBuf + picBuffer.scanOffset[scanNum],
+                                           picBuffer.scanSize[scanNum]);
+        if (JPEG_OK == jerr)
+        {
+            jerr = m_dec[threadNum]->ReadScanProgressive(state.coefs.data(), &sync);
+        }
+        if (JPEG_OK == jerr)
+        {
+            // the scan may stop early on broken data, don't stall the others
+            sync.MCURowsDone(state.numyMCU);
+        }
+        if (JPEG_OK != jerr)
+        {
+            umcRes = UMC_ERR_FAILED;
+        }
+    }
+    else if (UMC_OK == umcRes)
+    {
+        const mfxU32 band = pieceNum - picBuffer.numScans;
+        const mfxU32 rowsPerBand = (state.numyMCU + JPEG_PROGRESSIVE_BANDS - 1) / JPEG_PROGRESSIVE_BANDS;
+        const mfxU32 firstRow = band * rowsPerBand;
+        const mfxU32 lastRow = std::min(firstRow + rowsPerBand, state.numyMCU);
+
+        if (firstRow >= lastRow)
+        {
+            return UMC_OK;
+        }
+
+        // the rows have to be complete in all the scans
+        {
+            std::vector<uint32_t> allScans(picBuffer.numScans);
+            for (mfxU32 s = 0; s < picBuffer.numScans; s += 1)
+            {
+                allScans[s] = s;
+            }
+
+            std::unique_lock<std::mutex> lock(state.guard);
+            state.rowsDoneEvent.wait(lock, [&] { return state.failed || state.RowsDone(allScans, lastRow); });
+
+            if (state.failed)
+            {
+                return UMC_ERR_FAILED;
+            }
+        }
+
+        umcRes = SetDecoderDestination(picBuffer.fieldPos, threadNum);
+        if (UMC_OK == umcRes)
+        {
+            jerr = m_dec[threadNum]->ReconstructProgressive(state.coefs.data(), firstRow, lastRow);
+            if (JPEG_OK != jerr)
+            {
+                umcRes = UMC_ERR_FAILED;
+            }
+        }
+    }
+
+    // release the threads waiting for this piece
+    if (UMC_OK != umcRes)
+    {
+        state.Fail();
+    }
+
+    return umcRes;
+
+} // Status MJPEGVideoDecoderMFX::DecodeProgressivePiece(const CJpegTask &task,
+
 Status MJPEGVideoDecoderMFX::PostProcessing(double pts)
 {
     VideoData rotatedFrame;
@@ -1025,6 +1387,26 @@ Status MJPEGVideoDecoderMFX::DecodePiece(const mfxU32 fieldNum,
                                          const mfxU32 restartNum,
                                          const mfxU32 restartsToDecode,
                                          const mfxU32 threadNum)
+{
+    JERRCODE jerr = JPEG_OK;
+
+    Status umcRes = SetDecoderDestination(fieldNum, threadNum);
+    if (UMC_OK != umcRes)
+        return umcRes;
+
+    jerr = m_dec[threadNum]->ReadData(restartNum, restartsToDecode);
+
+    if(JPEG_ERR_BUFF == jerr)
+        return UMC_ERR_NOT_ENOUGH_DATA;
+
+    if(JPEG_OK != jerr)
+        return UMC_ERR_FAILED;
+
+    return UMC_OK;
+
+} // Status MJPEGVideoDecoderMFX::DecodePiece(const mfxU32 fieldNum,
+
+Status MJPEGVideoDecoderMFX::SetDecoderDestination(const mfxU32 fieldNum, const mfxU32 threadNum)
 {
     int32_t   dstPlaneStep[4];
     uint8_t*   pDstPlane[4];
@@ -1109,20 +1491,12 @@ Status MJPEGVideoDecoderMFX::DecodePiece(const mfxU32 fieldNum,
         return UMC_ERR_FAILED;
     }
 
-    if(JPEG_OK != jerr)
-        return UMC_ERR_FAILED;
-
-    jerr = m_dec[threadNum]->ReadData(restartNum, restartsToDecode);
-
-    if(JPEG_ERR_BUFF == jerr)
-        return UMC_ERR_NOT_ENOUGH_DATA;
-
     if(JPEG_OK != jerr)
         return UMC_ERR_FAILED;
 
     return UMC_OK;
 
-} // Status MJPEGVideoDecoderMFX::DecodePiece(const mfxU32 fieldNum,
+} // Status MJPEGVideoDecoderMFX::SetDecoderDestination(const mfxU32 fieldNum, const mfxU32 threadNum)
 
 void MJPEGVideoDecoderMFX::SetFrameAllocator(FrameAllocator * frameAllocator)
 {
@@ -163,6 +163,9 @@ public:
   bool     IsACTableInited();
   bool     IsDCTableInited();
 
+  // nanoseconds spent in each JSTAGE, see JPEG_STAGE_TIMER()
+  uint64_t m_stage_time[JSTAGE_MAX];
+
 protected:
   IMAGE      m_src;
 
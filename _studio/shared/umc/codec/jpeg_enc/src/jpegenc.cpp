@@ -105,6 +105,7 @@ CJPEGEncoder::CJPEGEncoder(void) : m_src()
   m_BitStreamOutT = NULL;
   m_lastDC = NULL;
 
+  memset(m_stage_time, 0, sizeof(m_stage_time));
 
   return;
 } // ctor
@@ -2110,6 +2111,8 @@ JERRCODE CJPEGEncoder::Init(void)
 
 JERRCODE CJPEGEncoder::ColorConvert(uint32_t rowMCU, uint32_t colMCU, uint32_t maxMCU/*int nMCURow, int thread_id*/)
 {
+  JPEG_STAGE_TIMER(JSTAGE_COLOR);
+
   int       cc_h;
   int       srcStep;
   int       convert = 0;
@@ -2597,6 +2600,8 @@ JERRCODE CJPEGEncoder::ColorConvert(uint32_t rowMCU, uint32_t colMCU, uint32_t m
 
 JERRCODE CJPEGEncoder::DownSampling(uint32_t rowMCU, uint32_t colMCU, uint32_t maxMCU/*int nMCURow, int thread_id*/)
 {
+  JPEG_STAGE_TIMER(JSTAGE_SAMPLING);
+
   int i, j, k;
   int cc_h;
   CJPEGColorComponent* curr_comp;
@@ -2746,6 +2751,8 @@ JERRCODE CJPEGEncoder::DownSampling(uint32_t rowMCU, uint32_t colMCU, uint32_t m
 
 JERRCODE CJPEGEncoder::ProcessBuffer(uint32_t rowMCU, uint32_t colMCU, uint32_t maxMCU)//(int nMCURow, int thread_id)
 {
+  JPEG_STAGE_TIMER(JSTAGE_COPY);
+
   int                  i, j, c;
   int                  copyHeight;
   int                  yPadd   = 0;
@@ -2855,6 +2862,8 @@ JERRCODE CJPEGEncoder::ProcessBuffer(uint32_t rowMCU, uint32_t colMCU, uint32_t
 
 JERRCODE CJPEGEncoder::TransformMCURowBL(int16_t* pMCUBuf, uint32_t colMCU, uint32_t maxMCU/*int     thread_id*/)
 {
+  JPEG_STAGE_TIMER(JSTAGE_DCT);
+
   int c;
   int vs;
   int hs;
@@ -2908,6 +2917,8 @@ JERRCODE CJPEGEncoder::TransformMCURowEX(
   int16_t* pMCUBuf,
   int     thread_id)
 {
+  JPEG_STAGE_TIMER(JSTAGE_DCT);
+
   int c;
   int vs;
   int hs;
@@ -2965,6 +2976,8 @@ JERRCODE CJPEGEncoder::TransformMCURowLS(int16_t* /*pMCUBuf*/, int /*nMCURow*/,
 
 JERRCODE CJPEGEncoder::EncodeHuffmanMCURowBL(int16_t* pMCUBuf, uint32_t colMCU, uint32_t maxMCU)
 {
+  JPEG_STAGE_TIMER(JSTAGE_HUFFMAN);
+
   int                    c;
   int                    vs;
   int                    hs;
@@ -3636,6 +3649,8 @@ JERRCODE CJPEGEncoder::EncodeScan(
   int Ah,
   int Al)
 {
+  JPEG_STAGE_TIMER(JSTAGE_HUFFMAN);
+
   int  i;
   int  j;
   int  k;
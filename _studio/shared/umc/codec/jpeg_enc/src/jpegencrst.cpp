@@ -159,6 +159,8 @@ JERRCODE CJPEGEncoder::ProcessRestart(
 
 JERRCODE CJPEGEncoder::EncodeHuffmanMCURowBL_RSTI(int16_t* pMCUBuf, int thread_id)
 {
+  JPEG_STAGE_TIMER(JSTAGE_HUFFMAN);
+
   int                    c;
   int                    vs;
   int                    hs;
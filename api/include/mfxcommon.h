@@ -204,6 +204,54 @@ typedef struct {
 } mfxPlatform;
 MFX_PACK_END()
 
+#if (MFX_VERSION >= MFX_VERSION_NEXT)
+/* Latency percentiles of a trace point of the library, in nanoseconds. The
+   names stay valid while the library is loaded. */
+MFX_PACK_BEGIN_STRUCT_W_PTR()
+typedef struct {
+    const char* FunctionName;
+    const char* TaskName;
+    mfxU64  Count;
+    mfxU64  P50;
+    mfxU64  P99;
+    mfxU64  P999;
+    mfxU64  Max;
+    mfxU32  reserved[4];
+} mfxTraceLatency;
+MFX_PACK_END()
+
+/* Load counters of the session, times are in microseconds. The scheduler
+   counters are shared by the joined sessions. */
+MFX_PACK_BEGIN_STRUCT_W_PTR()
+typedef struct {
+    mfxU32  QueueDepth[3];      /* not completed tasks, indexed by mfxPriority */
+    mfxU32  NumThreads;         /* working threads of the scheduler */
+    mfxU64  TasksCompleted;     /* tasks completed or failed since the initialization */
+    mfxU64  TaskCalls;          /* calls of the task routines */
+    mfxU64  TaskTime;           /* time spent in the task routines by all threads */
+    mfxU32  SurfacesInUse;      /* internal decoder surfaces holding frames */
+    mfxU32  SurfacesTotal;      /* internal decoder surfaces */
+    mfxU64  CopyCalls;          /* frame copies done by the core */
+    mfxU64  CopyTime;           /* time spent in the frame copies */
+    mfxTraceLatency *Latencies; /* in: receives the trace point latencies of the process, can be NULL */
+    mfxU32  NumLatencies;       /* in: size of Latencies, out: number of the trace points with samples */
+    mfxU16  ResetLatencies;     /* in: MFX_CODINGOPTION_ON starts the latency counting over */
+    mfxU16  reserved1;
+    mfxU32  reserved[12];
+} mfxSessionMetrics;
+MFX_PACK_END()
+
+/* SyncOperationMulti wait modes */
+enum {
+    MFX_SYNC_WAIT_ANY = 0,  /* return when at least one sync point is done */
+    MFX_SYNC_WAIT_ALL = 1   /* return when all sync points are done */
+};
+
+/* Completion callback of a sync point, called by the SDK thread which
+   completed the operation */
+typedef void (MFX_CDECL *mfxSyncPointCallback)(mfxHDL pthis, mfxSyncPoint syncp, mfxStatus status);
+#endif
+
 #ifdef __cplusplus
 }
 #endif /* __cplusplus */
@@ -142,4 +142,10 @@
 #define MFXVideoCORE_QueryPlatform       disp_MFXVideoCORE_QueryPlatform
 #define MFXVideoUSER_GetPlugin           disp_MFXVideoUSER_GetPlugin
 
+// API 1.35 functions
+
+#define MFXVideoCORE_GetMetrics          disp_MFXVideoCORE_GetMetrics
+#define MFXVideoCORE_SyncOperationMulti  disp_MFXVideoCORE_SyncOperationMulti
+#define MFXVideoCORE_SetSyncPointCallback disp_MFXVideoCORE_SetSyncPointCallback
+
 #endif 
\ No newline at end of file
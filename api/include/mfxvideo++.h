@@ -54,8 +54,15 @@ public:
     virtual mfxStatus SetHandle(mfxHandleType type, mfxHDL hdl) { return MFXVideoCORE_SetHandle(m_session, type, hdl); }
     virtual mfxStatus GetHandle(mfxHandleType type, mfxHDL *hdl) { return MFXVideoCORE_GetHandle(m_session, type, hdl); }
     virtual mfxStatus QueryPlatform(mfxPlatform* platform) { return MFXVideoCORE_QueryPlatform(m_session, platform); }
+#if (MFX_VERSION >= MFX_VERSION_NEXT)
+    virtual mfxStatus GetMetrics(mfxSessionMetrics *metrics) { return MFXVideoCORE_GetMetrics(m_session, metrics); }
+#endif
 
     virtual mfxStatus SyncOperation(mfxSyncPoint syncp, mfxU32 wait) { return MFXVideoCORE_SyncOperation(m_session, syncp, wait); }
+#if (MFX_VERSION >= MFX_VERSION_NEXT)
+    virtual mfxStatus SyncOperationMulti(mfxSyncPoint *syncp, mfxU32 count, mfxU16 mode, mfxU32 wait, mfxStatus *status) { return MFXVideoCORE_SyncOperationMulti(m_session, syncp, count, mode, wait, status); }
+    virtual mfxStatus SetSyncPointCallback(mfxSyncPoint syncp, mfxSyncPointCallback callback, mfxHDL pthis) { return MFXVideoCORE_SetSyncPointCallback(m_session, syncp, callback, pthis); }
+#endif
 
     virtual mfxStatus DoWork() { return MFXDoWork(m_session); }
 
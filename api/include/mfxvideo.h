@@ -59,6 +59,11 @@ mfxStatus MFX_CDECL MFXVideoCORE_SetHandle(mfxSession session, mfxHandleType typ
 mfxStatus MFX_CDECL MFXVideoCORE_GetHandle(mfxSession session, mfxHandleType type, mfxHDL *hdl);
 mfxStatus MFX_CDECL MFXVideoCORE_QueryPlatform(mfxSession session, mfxPlatform* platform);
 mfxStatus MFX_CDECL MFXVideoCORE_SyncOperation(mfxSession session, mfxSyncPoint syncp, mfxU32 wait);
+#if (MFX_VERSION >= MFX_VERSION_NEXT)
+mfxStatus MFX_CDECL MFXVideoCORE_GetMetrics(mfxSession session, mfxSessionMetrics *metrics);
+mfxStatus MFX_CDECL MFXVideoCORE_SyncOperationMulti(mfxSession session, mfxSyncPoint *syncp, mfxU32 count, mfxU16 mode, mfxU32 wait, mfxStatus *status);
+mfxStatus MFX_CDECL MFXVideoCORE_SetSyncPointCallback(mfxSession session, mfxSyncPoint syncp, mfxSyncPointCallback callback, mfxHDL pthis);
+#endif
 
 /* VideoENCODE */
 mfxStatus MFX_CDECL MFXVideoENCODE_Query(mfxSession session, mfxVideoParam *in, mfxVideoParam *out);
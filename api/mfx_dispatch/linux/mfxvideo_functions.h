@@ -146,3 +146,13 @@ FUNCTION(mfxStatus, MFXVideoCORE_QueryPlatform, (mfxSession session, mfxPlatform
 FUNCTION(mfxStatus, MFXVideoUSER_GetPlugin, (mfxSession session, mfxU32 type, mfxPlugin *par), (session, type, par))
 
 #undef API_VERSION
+
+#if (MFX_VERSION >= MFX_VERSION_NEXT)
+#define API_VERSION {{35, 1}}
+
+FUNCTION(mfxStatus, MFXVideoCORE_GetMetrics, (mfxSession session, mfxSessionMetrics *metrics), (session, metrics))
+FUNCTION(mfxStatus, MFXVideoCORE_SyncOperationMulti, (mfxSession session, mfxSyncPoint *syncp, mfxU32 count, mfxU16 mode, mfxU32 wait, mfxStatus *status), (session, syncp, count, mode, wait, status))
+FUNCTION(mfxStatus, MFXVideoCORE_SetSyncPointCallback, (mfxSession session, mfxSyncPoint syncp, mfxSyncPointCallback callback, mfxHDL pthis), (session, syncp, callback, pthis))
+
+#undef API_VERSION
+#endif
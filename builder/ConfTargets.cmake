@@ -32,6 +32,11 @@ if (ENABLE_STAT)
   append("-DMFX_TRACE_ENABLE_STAT" CMAKE_CXX_FLAGS)
 endif()
 
+if (ENABLE_CHROME_TRACE)
+  append("-DMFX_TRACE_ENABLE_CHROME" CMAKE_C_FLAGS)
+  append("-DMFX_TRACE_ENABLE_CHROME" CMAKE_CXX_FLAGS)
+endif()
+
 option( MFX_ENABLE_KERNELS "Build with advanced media kernels support?" ON )
 if(CMAKE_SIZEOF_VOID_P EQUAL 8)
   option( MFX_ENABLE_SW_FALLBACK "Enabled software fallback for codecs?" ON )
@@ -73,6 +78,9 @@ option( MFX_ENABLE_ENCTOOLS "Enabled EncTools?" OFF)
 #if ON, enables adaptive encoding tools, part of EncTools, provided as libaenc.a binary; experimental feature
 option( MFX_ENABLE_AENC "Enabled AENC extension?" OFF)
 
+#if ON, large internal system memory buffers and frames are backed by huge pages (Linux)
+option( MFX_ENABLE_HUGEPAGE_ALLOC "Use huge pages for internal system memory?" OFF)
+
 option( MFX_ENABLE_USER_DECODE "Enabled user decode plugins?" ON)
 option( MFX_ENABLE_USER_ENCODE "Enabled user encode plugins?" ON)
 option( MFX_ENABLE_USER_ENC "Enabled user ENC plugins?" ON)
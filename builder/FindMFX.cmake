@@ -92,6 +92,16 @@ else( )
 endif()
 
 set( API_VERSION "${major_vers}.${minor_vers}")
+
+# Functions of the next API version are compiled only when MFX_VERSION reaches
+# MFX_VERSION_NEXT, so their version script nodes are linked only then as well
+get_mfx_version(api_major_vers api_minor_vers)
+math(EXPR api_next_version "${api_major_vers} * 1000 + ${api_minor_vers} + 1")
+if( API_USE_LATEST OR (DEFINED version_number AND NOT version_number LESS api_next_version) )
+  set( MFX_API_NEXT TRUE )
+else()
+  set( MFX_API_NEXT FALSE )
+endif()
 if (NOT API_FLAGS STREQUAL "")
     add_definitions(${API_FLAGS})
 endif()
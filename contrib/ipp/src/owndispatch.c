@@ -0,0 +1,102 @@
+// Copyright (c) 2020 Intel Corporation
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+/*
+//
+//  Purpose:
+//    Runtime selection of the kernels code paths
+//
+//  Contents:
+//    mfxownSetDispatchLevel
+//
+*/
+
+#include "precomp.h"
+#include "owndispatch.h"
+
+/* the library is built for SSE4.2, so these are the ones before the load */
+OwnDispatchTable mfxownDispatchTable = {
+    ownDispatchSSE42,
+    mfxownDCTQuantFwd8x8LS_JPEG_8u16s_C1R_y8,
+    mfxownRGBToYCbCr_JPEG_8u_C4P3R,
+    mfxowniCopy8uas,
+    mfxownRangeMapping_VC1_8u_C1R_y8
+};
+
+static OwnDispatchLevel ownDetectLevel( void )
+{
+#if defined(_ARCH_EM64T)
+    if( __builtin_cpu_supports("avx2") )
+        return ownDispatchAVX2;
+    if( __builtin_cpu_supports("sse4.2") )
+        return ownDispatchSSE42;
+#endif
+    return ownDispatchC;
+}
+
+static void ownFillTable( OwnDispatchLevel level )
+{
+    OwnDispatchTable* tbl = &mfxownDispatchTable;
+
+    switch( level )
+    {
+#if defined(_ARCH_EM64T)
+    case ownDispatchAVX2:
+        tbl->DCTQuantFwd8x8LS_JPEG_8u16s_C1R = mfxownDCTQuantFwd8x8LS_JPEG_8u16s_C1R_l9;
+        tbl->RGBToYCbCr_JPEG_8u_C4P3R        = mfxownRGBToYCbCr_JPEG_8u_C4P3R_l9;
+        tbl->Copy8u                          = mfxowniCopy8u_l9;
+        tbl->RangeMapping_VC1_8u_C1R         = mfxownRangeMapping_VC1_8u_C1R_l9;
+        break;
+
+    case ownDispatchSSE42:
+        tbl->DCTQuantFwd8x8LS_JPEG_8u16s_C1R = mfxownDCTQuantFwd8x8LS_JPEG_8u16s_C1R_y8;
+        tbl->RGBToYCbCr_JPEG_8u_C4P3R        = mfxownRGBToYCbCr_JPEG_8u_C4P3R;
+        tbl->Copy8u                          = mfxowniCopy8uas;
+        tbl->RangeMapping_VC1_8u_C1R         = mfxownRangeMapping_VC1_8u_C1R_y8;
+        break;
+#endif
+
+    default:
+        level = ownDispatchC;
+        tbl->DCTQuantFwd8x8LS_JPEG_8u16s_C1R = mfxownDCTQuantFwd8x8LS_JPEG_8u16s_C1R_cn;
+        tbl->RGBToYCbCr_JPEG_8u_C4P3R        = mfxownRGBToYCbCr_JPEG_8u_C4P3R_cn;
+        tbl->Copy8u                          = mfxowniCopy8u_cn;
+        tbl->RangeMapping_VC1_8u_C1R         = mfxownRangeMapping_VC1_8u_C1R_cn;
+        break;
+    }
+
+    tbl->level = level;
+}
+
+/* the table is filled before any library function may be called */
+__attribute__((constructor))
+static void ownInitDispatchTable( void )
+{
+    ownFillTable( ownDetectLevel() );
+}
+
+OwnDispatchLevel mfxownSetDispatchLevel( OwnDispatchLevel level )
+{
+    OwnDispatchLevel maxLevel = ownDetectLevel();
+
+    ownFillTable( (level < maxLevel) ? level : maxLevel );
+
+    return mfxownDispatchTable.level;
+}
@@ -0,0 +1,104 @@
+// Copyright (c) 2020 Intel Corporation
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+/*
+//
+//  Purpose:
+//    Runtime selection of the kernels code paths
+//
+*/
+
+#ifndef __OWNDISPATCH_H__
+#define __OWNDISPATCH_H__
+
+#ifndef __OWNDEFS_H__
+#include "owndefs.h"
+#endif
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* Code paths of the dispatched kernels, from the slowest one */
+typedef enum {
+    ownDispatchC     = 0, /* plain C, no CPU requirements                  */
+    ownDispatchSSE42 = 1, /* Intel SSE4.2, the code the library is built for */
+    ownDispatchAVX2  = 2  /* Intel AVX2                                    */
+} OwnDispatchLevel;
+
+/*
+    The table is filled once at the library load from the CPU features,
+    the public functions call the kernels through it.
+*/
+typedef struct _OwnDispatchTable {
+    OwnDispatchLevel level;
+
+    void (*DCTQuantFwd8x8LS_JPEG_8u16s_C1R)(
+        const Ipp8u* pSrc, int srcStep, Ipp16s* pDst, const Ipp16u* pQuantFwdTable);
+    void (*RGBToYCbCr_JPEG_8u_C4P3R)(
+        const Ipp8u* pBGR, int bgrStep, Ipp8u* pYCC[3], int yccStep, IppiSize roiSize);
+    void (*Copy8u)(
+        const Ipp8u* pSrc, int srcStep, Ipp8u* pDst, int dstStep, int width, int height);
+    void (*RangeMapping_VC1_8u_C1R)(
+        const Ipp8u* pSrc, int srcStep, Ipp8u* pDst, int dstStep, int width, int height, int rangeMapParam);
+} OwnDispatchTable;
+
+extern OwnDispatchTable mfxownDispatchTable;
+
+/*
+    Selects the code path not above the CPU capabilities, returns the one
+    selected. It is not thread safe, intended for validation and benchmarks.
+*/
+extern OwnDispatchLevel mfxownSetDispatchLevel( OwnDispatchLevel level );
+
+/* kernels of all the code paths */
+extern void mfxownDCTQuantFwd8x8LS_JPEG_8u16s_C1R_cn(
+    const Ipp8u* pSrc, int srcStep, Ipp16s* pDst, const Ipp16u* pQuantFwdTable);
+extern void mfxownDCTQuantFwd8x8LS_JPEG_8u16s_C1R_y8(
+    const Ipp8u* pSrc, int srcStep, Ipp16s* pDst, const Ipp16u* pQuantFwdTable);
+extern void mfxownDCTQuantFwd8x8LS_JPEG_8u16s_C1R_l9(
+    const Ipp8u* pSrc, int srcStep, Ipp16s* pDst, const Ipp16u* pQuantFwdTable);
+
+extern void mfxownRGBToYCbCr_JPEG_8u_C4P3R_cn(
+    const Ipp8u* pBGR, int bgrStep, Ipp8u* pYCC[3], int yccStep, IppiSize roiSize);
+extern void mfxownRGBToYCbCr_JPEG_8u_C4P3R(
+    const Ipp8u* pBGR, int bgrStep, Ipp8u* pYCC[3], int yccStep, IppiSize roiSize);
+extern void mfxownRGBToYCbCr_JPEG_8u_C4P3R_l9(
+    const Ipp8u* pBGR, int bgrStep, Ipp8u* pYCC[3], int yccStep, IppiSize roiSize);
+
+extern void mfxowniCopy8u_cn(
+    const Ipp8u* pSrc, int srcStep, Ipp8u* pDst, int dstStep, int width, int height);
+extern void mfxowniCopy8uas(
+    const Ipp8u* pSrc, int srcStep, Ipp8u* pDst, int dstStep, int width, int height);
+extern void mfxowniCopy8u_l9(
+    const Ipp8u* pSrc, int srcStep, Ipp8u* pDst, int dstStep, int width, int height);
+
+extern void mfxownRangeMapping_VC1_8u_C1R_cn(
+    const Ipp8u* pSrc, int srcStep, Ipp8u* pDst, int dstStep, int width, int height, int rangeMapParam);
+extern void mfxownRangeMapping_VC1_8u_C1R_y8(
+    const Ipp8u* pSrc, int srcStep, Ipp8u* pDst, int dstStep, int width, int height, int rangeMapParam);
+extern void mfxownRangeMapping_VC1_8u_C1R_l9(
+    const Ipp8u* pSrc, int srcStep, Ipp8u* pDst, int dstStep, int width, int height, int rangeMapParam);
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* __OWNDISPATCH_H__ */
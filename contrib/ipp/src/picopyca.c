@@ -73,9 +73,11 @@
 //         (M7) mfxiCopy_32f_C4P4R (W7)         mfxiCopy_32f_P4C4R (W7)   (M7)
 //
 */
+#include <string.h>
 #include "precomp.h"
 #include "owni.h"
 #include "ippcore.h"
+#include "owndispatch.h"
 
 #if (_IPPLRB >= _IPPLRB_B1)
 #if  defined(_REF_LIB)
@@ -520,6 +522,25 @@ void mfxowniCopy_32s_AC4C3R(const Ipp32s* pSrc, int srcStep, Ipp32s* pDst, int d
 #endif
 
 
+/*
+    Lib = cn
+    Caller = mfxiCopy_8u_C1R, mfxiCopy_16s_C1R
+*/
+void mfxowniCopy8u_cn( const Ipp8u* pSrc, int srcStep, Ipp8u *pDst, int dstStep, int width, int height )
+{
+    int h;
+
+    if( (srcStep == dstStep) && (srcStep == width) ) {
+       width *= height;
+       height = 1;
+    }
+
+    for( h = 0; h < height; h++ ) {
+        memcpy( pDst, pSrc, width );
+        pSrc += srcStep, pDst += dstStep;
+    }
+}
+
 /*******************************************************************/
 #if (_IPP_ARCH != _IPP_ARCH_XSC)
 IPPFUN ( IppStatus, mfxiCopy_8u_C1R,
@@ -553,7 +574,7 @@ IPPFUN ( IppStatus, mfxiCopy_8u_C1R,
       mfxowniCopy8u_cn( pSrc, srcStep, pDst, dstStep, roiSize.width, roiSize.height );
     }  
   #else
-    mfxowniCopy8uas( pSrc, srcStep, pDst, dstStep, roiSize.width, roiSize.height );
+    mfxownDispatchTable.Copy8u( pSrc, srcStep, pDst, dstStep, roiSize.width, roiSize.height );
   #endif
 #else
 
@@ -635,7 +656,7 @@ IPPFUN ( IppStatus, mfxiCopy_16s_C1R,
       mfxowniCopy8u_cn( (Ipp8u*)pSrc, srcStep, (Ipp8u*)pDst, dstStep, roiSize.width*2, roiSize.height );
     }  
   #else
-    mfxowniCopy8uas( (Ipp8u*)pSrc, srcStep, (Ipp8u*)pDst, dstStep, roiSize.width*2, roiSize.height );
+    mfxownDispatchTable.Copy8u( (const Ipp8u*)pSrc, srcStep, (Ipp8u*)pDst, dstStep, roiSize.width*2, roiSize.height );
   #endif
 #else
 
@@ -0,0 +1,75 @@
+// Copyright (c) 2020 Intel Corporation
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+/*
+//
+//  Purpose:
+//    Image copy, AVX2 code path
+//
+//  Contents:
+//    mfxowniCopy8u_l9
+//
+*/
+
+#include "precomp.h"
+#include "owni.h"
+
+#if defined(_ARCH_EM64T)
+
+#include <string.h>
+#include <immintrin.h>
+
+/*
+    Lib = L9
+    Caller = mfxiCopy_8u_C1R, mfxiCopy_16s_C1R
+*/
+extern void mfxowniCopy8u_l9( const Ipp8u* pSrc, int srcStep, Ipp8u* pDst, int dstStep, int width, int height )
+{
+    int h, w;
+
+    if( (srcStep == dstStep) && (srcStep == width) ) {
+       width *= height;
+       height = 1;
+    }
+
+    for( h = 0; h < height; h++ ) {
+        for( w = 0; w + 128 <= width; w += 128 ) {
+            __m256i t0 = _mm256_loadu_si256( (const __m256i*)(pSrc + w) );
+            __m256i t1 = _mm256_loadu_si256( (const __m256i*)(pSrc + w + 32) );
+            __m256i t2 = _mm256_loadu_si256( (const __m256i*)(pSrc + w + 64) );
+            __m256i t3 = _mm256_loadu_si256( (const __m256i*)(pSrc + w + 96) );
+            _mm256_storeu_si256( (__m256i*)(pDst + w),      t0 );
+            _mm256_storeu_si256( (__m256i*)(pDst + w + 32), t1 );
+            _mm256_storeu_si256( (__m256i*)(pDst + w + 64), t2 );
+            _mm256_storeu_si256( (__m256i*)(pDst + w + 96), t3 );
+        }
+        for( ; w + 32 <= width; w += 32 ) {
+            _mm256_storeu_si256( (__m256i*)(pDst + w), _mm256_loadu_si256( (const __m256i*)(pSrc + w) ) );
+        }
+        if( w < width ) {
+            memcpy( pDst + w, pSrc + w, width - w );
+        }
+        pSrc += srcStep, pDst += dstStep;
+    }
+
+    _mm256_zeroupper();
+}
+
+#endif /* _ARCH_EM64T */
@@ -36,11 +36,12 @@
 #define CLIP(x) ((x < 0) ? 0 : ((x > 255) ? 255 : x))
 
 #if ( _IPP >= _IPP_V8 )||( _IPP32E >= _IPP32E_U8 )
-extern void mfxownRGBToYCbCr_JPEG_8u_C4P3R(
-const Ipp8u* pBGR, int bgrStep, Ipp8u* pYCC[3], int yccStep, IppiSize roiSize);
 extern void mfxownYCbCrToBGR_JPEG_8u_P3C4R(
 const Ipp8u* pYCC[3],int yccStep,Ipp8u* pBGR,int bgrStep,IppiSize roiSize, Ipp8u aval,int orger);
 #endif
+#ifndef __OWNDISPATCH_H__
+#include "owndispatch.h"
+#endif
 #define kRCr 0x000166e8
 #define kGCr 0x0000b6d1
 #define kGCb 0x00005819
@@ -52,6 +53,79 @@ const Ipp8u* pYCC[3],int yccStep,Ipp8u* pBGR,int bgrStep,IppiSize roiSize, Ipp8u
 
 /* ---------------------- library functions definitions -------------------- */
 
+/* coefficients of mfxownRGBToYCbCr_JPEG_8u_C4P3R, applied to 16 bit words */
+#define iRY  0x00001323
+#define iGY  0x00002591
+#define iBY  0x0000074c
+#define iRu  0x00000acd
+#define iGu  0x00001533
+#define iBu  0x00002000
+#define iGv  0x00001acc
+#define iBv  0x00000534
+
+#define MULHI(x, k) ((Ipp32u)((x) * (k)) >> 16)
+#define SAT_U16(x)  (((x) > 0xffff) ? 0xffff : (x))
+#define SAT_S16(x)  (((x) > IPP_MAX_16S) ? IPP_MAX_16S : (((x) < IPP_MIN_16S) ? IPP_MIN_16S : (x)))
+
+/*
+    Lib = cn
+    Caller = mfxiRGBToYCbCr_JPEG_8u_C4P3R
+
+    Scalar version of the SSE code path, the output is bit exact with it:
+    the 16 bit arithmetic of its 8 and 16 pixels blocks, then the 32 bit
+    rounding of its last (width & 7) pixels.
+*/
+extern void mfxownRGBToYCbCr_JPEG_8u_C4P3R_cn(
+const Ipp8u* pBGR, int bgrStep, Ipp8u* pYCC[3], int yccStep, IppiSize roiSize)
+{
+  int h, w;
+  int width8 = roiSize.width & ~0x07;
+
+  for( h = 0; h < roiSize.height; h ++ )
+  {
+    const Ipp8u* src  = pBGR    + h * bgrStep;
+    Ipp8u*       dsty = pYCC[0] + h * yccStep;
+    Ipp8u*       dstu = pYCC[1] + h * yccStep;
+    Ipp8u*       dstv = pYCC[2] + h * yccStep;
+
+    for( w = 0; w < width8; w ++ )
+    {
+      Ipp32u r = (Ipp32u)src[0] << 8, g = (Ipp32u)src[1] << 8, b = (Ipp32u)src[2] << 8;
+      Ipp32u y;
+      Ipp32s c;
+      src += 4;
+
+      y = SAT_U16(MULHI(r, iRY) + MULHI(g, iGY));
+      y = SAT_U16(y + MULHI(b, iBY));
+      y = SAT_U16(y + 0x20) >> 6;
+      dsty[w] = (Ipp8u)((y > 255) ? 255 : y);
+
+      r >>= 1; g >>= 1; b >>= 1;
+
+      /* Cb */
+      c = (Ipp16s)(MULHI(b, iBu) - (Ipp16s)(MULHI(r, iRu) + MULHI(g, iGu)));
+      c = (Ipp16s)((Ipp16u)SAT_S16(c + 0x1010) >> 5);
+      dstu[w] = (Ipp8u)((c < 0) ? 0 : ((c > 255) ? 255 : c));
+
+      /* Cr */
+      c = (Ipp16s)(MULHI(r, iBu) - (Ipp16s)(MULHI(g, iGv) + MULHI(b, iBv)));
+      c = (Ipp16s)((Ipp16u)(Ipp16s)(c + 0x1010) >> 5);
+      dstv[w] = (Ipp8u)((c < 0) ? 0 : ((c > 255) ? 255 : c));
+    }
+
+    for( ; w < roiSize.width; w ++ )
+    {
+      int r = src[0], g = src[1], b = src[2];
+      src += 4;
+
+      dsty[w] = (Ipp8u)(( iRY * r + iGY * g + iBY * b + 0x002000) >> 14 );
+      dstu[w] = (Ipp8u)((-iRu * r - iGu * g + iBu * b + 0x201000) >> 14 ); /* Cb */
+      dstv[w] = (Ipp8u)(( iBu * r - iGv * g - iBv * b + 0x201000) >> 14 ); /* Cr */
+    }
+  }
+}
+
+/* the code path is selected at runtime, see owndispatch.c */
 IPPFUN(IppStatus, mfxiRGBToYCbCr_JPEG_8u_C4P3R,(
 const Ipp8u* pBGR, int bgrStep, Ipp8u* pYCC[3], int yccStep, IppiSize roiSize))
 {
@@ -59,36 +133,9 @@ const Ipp8u* pBGR, int bgrStep, Ipp8u* pYCC[3], int yccStep, IppiSize roiSize))
   IPP_BAD_PTR3_RET( pYCC[0], pYCC[1], pYCC[2]);
   IPP_BADARG_RET((roiSize.width < 2 || roiSize.height < 1), ippStsSizeErr);
   IPP_BADARG_RET(( bgrStep == 0 || yccStep == 0), ippStsStepErr);
-#if ( _IPP >= _IPP_V8 )||( _IPP32E >= _IPP32E_U8 )
-  mfxownRGBToYCbCr_JPEG_8u_C4P3R( pBGR, bgrStep, pYCC, yccStep, roiSize);
-#else
-  {
-     int h,w;
-     int width = roiSize.width;
-     Ipp8u* pDstU = pYCC[1];
-     Ipp8u* pDstV = pYCC[2];
-     int height = roiSize.height;
 
-     for( h = 0; h < height; h ++ )
-     {
-        const Ipp8u* src;
-        Ipp8u* dsty,*dstu,*dstv;
-        src  = pBGR   + h * bgrStep;
-        dsty = pYCC[0]+ h * yccStep;
-        dstu = pDstU  + h * yccStep;
-        dstv = pDstV  + h * yccStep;
-        for( w = 0; w < width; w ++ )
-        {
-           int g,r,b;
-           b = src[2];g = src[1];r = src[0];
-           src += 4;
-           *dsty++ = ( Ipp8u )(( iRY * r + iGY * g + iBY * b + 0x0008000) >> 16 );
-           *dstu++ = ( Ipp8u )((-iRu * r - iGu * g + iBu * b + 0x0804000) >> 16 ); /* Cb */
-           *dstv++ = ( Ipp8u )(( iBu * r - iGv * g - iBv * b + 0x0804000) >> 16 ); /* Cr */
-        }
-     }
-  }
-#endif
+  mfxownDispatchTable.RGBToYCbCr_JPEG_8u_C4P3R( pBGR, bgrStep, pYCC, yccStep, roiSize);
+
   return ippStsNoErr;
 }
 
@@ -0,0 +1,164 @@
+// Copyright (c) 2020 Intel Corporation
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+/*M*
+//
+//     Purpose : IPPI Color Space Conversion, AVX2 code path
+//
+*M*/
+
+#include "precomp.h"
+#include <immintrin.h>
+#include "ownj.h"
+
+#if defined(_ARCH_EM64T)
+
+#define iRY  0x00001323
+#define iGY  0x00002591
+#define iBY  0x0000074c
+#define iRu  0x00000acd
+#define iGu  0x00001533
+#define iBu  0x00002000
+#define iGv  0x00001acc
+#define iBv  0x00000534
+
+extern void mfxownRGBToYCbCr_JPEG_8u_C4P3R(
+  const Ipp8u* pBGR, int bgrStep, Ipp8u* pYCC[3], int yccStep, IppiSize roiSize);
+
+static __inline __m256i ownLoad2x128(const Ipp8u* lo, const Ipp8u* hi)
+{
+    return _mm256_inserti128_si256(_mm256_castsi128_si256(_mm_loadu_si128((const __m128i*)lo)),
+                                   _mm_loadu_si128((const __m128i*)hi), 1);
+}
+
+/*
+    Lib = L9
+    Caller = mfxiRGBToYCbCr_JPEG_8u_C4P3R
+
+    Each 128-bit lane runs the same arithmetic as mfxownRGBToYCbCr_JPEG_8u_C4P3R
+    over its own group of 16 pixels (lane 0 - pixels 0..15, lane 1 - 16..31),
+    so the output is bit exact with the SSE code path. The right strip which
+    is not a multiple of 32 pixels is passed to the SSE code.
+*/
+extern void mfxownRGBToYCbCr_JPEG_8u_C4P3R_l9(
+  const Ipp8u* pBGR, int bgrStep, Ipp8u* pYCC[3], int yccStep, IppiSize roiSize)
+{
+    int h, w;
+    int width32 = roiSize.width & ~0x1f;
+    __m256i eZero = _mm256_setzero_si256();
+    __m256i kYr  = _mm256_set1_epi16( iRY );
+    __m256i kYg  = _mm256_set1_epi16( iGY );
+    __m256i kYb  = _mm256_set1_epi16( iBY );
+    __m256i k16  = _mm256_set1_epi32(0x00200020);
+    __m256i k128 = _mm256_set1_epi32(0x01010101<<4);
+    __m256i kRu  = _mm256_set1_epi16( iRu );
+    __m256i kGu  = _mm256_set1_epi16( iGu );
+    __m256i kBu  = _mm256_set1_epi16( iBu );
+    __m256i kGv  = _mm256_set1_epi16( iGv );
+    __m256i kBv  = _mm256_set1_epi16( iBv );
+    const __m256i sHf = _mm256_set_epi32( 0x0f0b0703,0x0e0a0602,0x0d090501,0x0c080400,
+                                          0x0f0b0703,0x0e0a0602,0x0d090501,0x0c080400 );
+
+    for( h = 0; h < roiSize.height; h ++ )
+    {
+        const Ipp8u* src  = pBGR    + h * bgrStep;
+        Ipp8u*       dsty = pYCC[0] + h * yccStep;
+        Ipp8u*       dstu = pYCC[1] + h * yccStep;
+        Ipp8u*       dstv = pYCC[2] + h * yccStep;
+
+        for( w = 0; w < width32; w += 32 )
+        {
+            __m256i t0, t1, t2, t3, eR, eB, eG, eY, eY1, eY0, eU, eV;
+            __m256i eR1, eB1, eG1;
+            __m256i mB, mG, mR;
+            t0 = ownLoad2x128( src,      src + 64 );
+            t1 = ownLoad2x128( src + 16, src + 80 );
+            t2 = ownLoad2x128( src + 32, src + 96 );
+            t3 = ownLoad2x128( src + 48, src + 112 );
+            t0 = _mm256_shuffle_epi8( t0, sHf );
+            t1 = _mm256_shuffle_epi8( t1, sHf );
+            t2 = _mm256_shuffle_epi8( t2, sHf );
+            t3 = _mm256_shuffle_epi8( t3, sHf );
+            src += 128;
+            eV = mR = _mm256_unpacklo_epi32( t0, t1);
+            mG = _mm256_unpacklo_epi32( t2, t3);
+            mR = _mm256_unpacklo_epi64( mR, mG);
+            mG = _mm256_unpackhi_epi64( eV, mG);
+            mB = _mm256_unpackhi_epi32( t0, t1);
+            t2 = _mm256_unpackhi_epi32( t2, t3);
+            mB = _mm256_unpacklo_epi64( mB, t2);
+            eR = _mm256_unpacklo_epi8( eZero, mR );
+            eG = _mm256_unpacklo_epi8( eZero, mG );
+            eB = _mm256_unpacklo_epi8( eZero, mB );
+            /* Y */
+            eY = _mm256_adds_epu16( _mm256_mulhi_epu16( eR, kYr), _mm256_mulhi_epu16( eG, kYg));
+            eY = _mm256_adds_epu16( eY, _mm256_mulhi_epu16( eB, kYb));
+            eY0= _mm256_srli_epi16(_mm256_adds_epu16( eY, k16 ), 6);
+            eR1 = _mm256_unpackhi_epi8( eZero, mR );
+            eG1 = _mm256_unpackhi_epi8( eZero, mG );
+            eB1 = _mm256_unpackhi_epi8( eZero, mB );
+            eY = _mm256_adds_epu16( _mm256_mulhi_epu16( eR1, kYr), _mm256_mulhi_epu16( eG1, kYg));
+            eY = _mm256_adds_epu16( eY, _mm256_mulhi_epu16( eB1, kYb));
+            eY1= _mm256_srli_epi16(_mm256_adds_epu16( eY, k16 ), 6);
+            _mm256_storeu_si256((__m256i*)dsty, _mm256_packus_epi16( eY0, eY1 ));
+            eR = _mm256_srli_epi16( eR,  1 );
+            eG = _mm256_srli_epi16( eG,  1 );
+            eB = _mm256_srli_epi16( eB,  1 );
+            eR1= _mm256_srli_epi16( eR1, 1 );
+            eG1= _mm256_srli_epi16( eG1, 1 );
+            eB1= _mm256_srli_epi16( eB1, 1 );
+            dsty += 32;
+            /* Cb */
+            eY = _mm256_add_epi16( _mm256_mulhi_epu16( eR, kRu), _mm256_mulhi_epu16( eG, kGu));
+            eY = _mm256_sub_epi16( _mm256_mulhi_epu16( eB, kBu), eY);
+            eU = _mm256_srli_epi16(_mm256_adds_epi16( eY, k128), 5 );
+            eY = _mm256_add_epi16( _mm256_mulhi_epu16( eR1, kRu), _mm256_mulhi_epu16( eG1, kGu));
+            eY = _mm256_sub_epi16( _mm256_mulhi_epu16( eB1, kBu), eY);
+            eY0 = _mm256_srli_epi16(_mm256_adds_epi16( eY, k128), 5 );
+            _mm256_storeu_si256((__m256i*)dstu, _mm256_packus_epi16( eU, eY0 ));
+            dstu += 32;
+            /* Cr */
+            eY = _mm256_add_epi16( _mm256_mulhi_epu16( eG, kGv), _mm256_mulhi_epu16( eB, kBv));
+            eY = _mm256_sub_epi16( _mm256_mulhi_epu16( eR, kBu), eY);
+            eV = _mm256_srli_epi16(_mm256_add_epi16( eY, k128), 5 );
+            eY = _mm256_add_epi16( _mm256_mulhi_epu16( eG1, kGv), _mm256_mulhi_epu16( eB1, kBv));
+            eY = _mm256_sub_epi16( _mm256_mulhi_epu16( eR1, kBu), eY);
+            eY0 = _mm256_srli_epi16(_mm256_add_epi16( eY, k128), 5 );
+            _mm256_storeu_si256((__m256i*)dstv, _mm256_packus_epi16( eV, eY0 ));
+            dstv += 32;
+        }
+    }
+
+    if( roiSize.width > width32 )
+    {
+        Ipp8u*   pTail[3];
+        IppiSize roiTail;
+
+        pTail[0] = pYCC[0] + width32;
+        pTail[1] = pYCC[1] + width32;
+        pTail[2] = pYCC[2] + width32;
+        roiTail.width  = roiSize.width - width32;
+        roiTail.height = roiSize.height;
+
+        mfxownRGBToYCbCr_JPEG_8u_C4P3R( pBGR + width32 * 4, bgrStep, pTail, yccStep, roiTail );
+    }
+}
+
+#endif /* _ARCH_EM64T */
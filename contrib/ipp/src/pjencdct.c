@@ -40,9 +40,8 @@
 #include "pjquant.h"
 #endif
 
-#if ((_IPP>=_IPP_H9)||(_IPP32E>=_IPP32E_L9))
-extern void mfxownDCTQuantFwd8x8LS_JPEG_8u16s_C1R(const Ipp8u* pSrc, int srcStep,
-        Ipp16s* pDst, const Ipp16u* pQuantFwdTable);
+#ifndef __OWNDISPATCH_H__
+#include "owndispatch.h"
 #endif
 
 #if IPPJ_QNT_OPT || (_IPPXSC >= _IPPXSC_S2)
@@ -58,6 +57,101 @@ ASMAPI(void, mfxownsMul_16u16s_PosSfs, (const Ipp16u*, const Ipp16s*, Ipp16s*, i
 
 /* ---------------------- library functions definitions -------------------- */
 
+/*
+    Lib = cn
+    Caller = mfxiDCTQuantFwd8x8LS_JPEG_8u16s_C1R
+
+    Same integer arithmetic as mfxownDCTQuantFwd8x8LS_JPEG_8u16s_C1R_l9,
+    so both code paths give the same output.
+*/
+#define CONST_BITS 15
+#define PASS1_BITS 4
+
+static const Ipp16s cDct[8][8] = {
+  { 11585,  11585,  11585,  11585,  11585,  11585,  11585,  11585 },
+  { 16069,  13623,   9102,   3196,  -3196,  -9102, -13623, -16069 },
+  { 15137,   6270,  -6270, -15137, -15137,  -6270,   6270,  15137 },
+  { 13623,  -3196, -16069,  -9102,   9102,  16069,   3196, -13623 },
+  { 11585, -11585, -11585,  11585,  11585, -11585, -11585,  11585 },
+  {  9102, -16069,   3196,  13623, -13623,  -3196,  16069,  -9102 },
+  {  6270, -15137,  15137,  -6270,  -6270,  15137, -15137,   6270 },
+  {  3196,  -9102,  13623, -16069,  16069, -13623,   9102,  -3196 }
+};
+
+static Ipp16s ownSat_32s16s(Ipp32s x)
+{
+  return (Ipp16s)((x > IPP_MAX_16S) ? IPP_MAX_16S : ((x < IPP_MIN_16S) ? IPP_MIN_16S : x));
+}
+
+extern void mfxownDCTQuantFwd8x8LS_JPEG_8u16s_C1R_cn(
+  const Ipp8u*  pSrc,
+        int     srcStep,
+        Ipp16s* pDst,
+  const Ipp16u* pQuantFwdTable)
+{
+  int    i, u, k;
+  Ipp16s x[8];
+  Ipp16s row[8][8];
+
+  /* level shift and row pass */
+  for(i = 0; i < 8; i++)
+  {
+    for(k = 0; k < 8; k++)
+      x[k] = (Ipp16s)(pSrc[i*srcStep + k] - 128);
+
+    for(u = 0; u < 8; u++)
+    {
+      Ipp32s s = 0;
+      for(k = 0; k < 8; k++)
+        s += x[k] * cDct[u][k];
+
+      row[i][u] = ownSat_32s16s((s + (1 << (CONST_BITS - PASS1_BITS - 1))) >> (CONST_BITS - PASS1_BITS));
+    }
+  }
+
+  /* column pass and quantization, round half to even */
+  for(i = 0; i < 8; i++)
+  {
+    for(u = 0; u < 8; u++)
+    {
+      Ipp32s s = 0;
+      for(k = 0; k < 8; k++)
+        s += row[k][u] * cDct[i][k];
+
+      s = (s + (1 << (CONST_BITS + PASS1_BITS - 1))) >> (CONST_BITS + PASS1_BITS);
+      s = (Ipp32s)((Ipp32u)s * pQuantFwdTable[i*8 + u]);
+      s = (s + (1 << (QUANT_BITS - 1)) - 1 + ((s >> QUANT_BITS) & 1)) >> QUANT_BITS;
+
+      pDst[i*8 + u] = ownSat_32s16s(s);
+    }
+  }
+
+  return;
+} /* mfxownDCTQuantFwd8x8LS_JPEG_8u16s_C1R_cn() */
+
+#if IPPJ_QNT_OPT
+/*
+    Lib = Y8
+    Caller = mfxiDCTQuantFwd8x8LS_JPEG_8u16s_C1R
+
+    The asm transform rounds differently from the C and L9 ones, the
+    coefficients may be one quantization step away.
+*/
+extern void mfxownDCTQuantFwd8x8LS_JPEG_8u16s_C1R_y8(
+  const Ipp8u*  pSrc,
+        int     srcStep,
+        Ipp16s* pDst,
+  const Ipp16u* pQuantFwdTable)
+{
+  mfxownpj_Sub128_8x8_8u16s(pSrc,srcStep,pDst);
+  mfxdct_8x8_fwd_16s(pDst,pDst);
+  mfxownsMul_16u16s_PosSfs(pQuantFwdTable,(Ipp16s*)pDst,pDst,DCTSIZE2,QUANT_BITS);
+
+  return;
+} /* mfxownDCTQuantFwd8x8LS_JPEG_8u16s_C1R_y8() */
+#endif
+
+
 /* ///////////////////////////////////////////////////////////////////////////
 //  Name:
 //    mfxiDCTQuantFwd8x8LS_JPEG_8u16s_C1R
@@ -75,6 +169,7 @@ ASMAPI(void, mfxownsMul_16u16s_PosSfs, (const Ipp16u*, const Ipp16s*, Ipp16s*, i
 //    IppStatus
 //
 //  Notes:
+//    the code path is selected at runtime, see owndispatch.c
 //
 */
 
@@ -88,29 +183,7 @@ IPPFUN(IppStatus, mfxiDCTQuantFwd8x8LS_JPEG_8u16s_C1R, (
   IPP_BAD_STEP_RET(srcStep)
   IPP_BAD_PTR1_RET(pQuantFwdTable)
 
-#if ((_IPP>=_IPP_H9)||(_IPP32E>=_IPP32E_L9))
-    mfxownDCTQuantFwd8x8LS_JPEG_8u16s_C1R(pSrc, srcStep, pDst, pQuantFwdTable);
-#else
-#if IPPJ_QNT_OPT || (_IPPXSC >= _IPPXSC_S2)
-  {
-    mfxownpj_Sub128_8x8_8u16s(pSrc,srcStep,pDst);
-    mfxdct_8x8_fwd_16s(pDst,pDst);
-#if IPPJ_QNT_OPT
-    mfxownsMul_16u16s_PosSfs(pQuantFwdTable,(Ipp16s*)pDst,pDst,DCTSIZE2,QUANT_BITS);
-#else
-    mfxownps_Mul_16u16s_Sfs(pQuantFwdTable,(Ipp16s*)pDst,pDst,DCTSIZE2,QUANT_BITS);
-#endif
-  }
-#else
-  {
-    IppiSize roi = { 8, 8 };
-
-    mfxownpj_Sub128_JPEG_8u16s_C1R(pSrc,srcStep,pDst,8*sizeof(Ipp16s),roi);
-    mfxiDCT8x8Fwd_16s_C1I(pDst);
-    mfxsMul_16u16s_Sfs(pQuantFwdTable,pDst,pDst,DCTSIZE2,QUANT_BITS);
-  }
-#endif
-#endif
+  mfxownDispatchTable.DCTQuantFwd8x8LS_JPEG_8u16s_C1R(pSrc, srcStep, pDst, pQuantFwdTable);
 
   return ippStsNoErr;
 } /* mfxiDCTQuantFwd8x8LS_JPEG_8u16s_C1R() */
@@ -0,0 +1,146 @@
+// Copyright (c) 2020 Intel Corporation
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+/*
+//
+//  Purpose:
+//    DCT+quantization+level shift (Forward transform), AVX2 code path
+//
+//  Contents:
+//    mfxownDCTQuantFwd8x8LS_JPEG_8u16s_C1R_l9
+//
+*/
+
+#include "precomp.h"
+
+#ifndef __OWNJ_H__
+#include "ownj.h"
+#endif
+#ifndef __PJQUANT_H__
+#include "pjquant.h"
+#endif
+
+#if defined(_ARCH_EM64T)
+
+#include <immintrin.h>
+
+/*
+//  The transform is done as two matrix products Y = X * C' and Z = C * Y
+//  with 1/2*C(u)*cos((2x+1)*u*PI/16) coefficients in Q15. The row pass keeps
+//  PASS1_BITS of extra precision, the column pass removes it, so the output
+//  matches the scaling of mfxdct_8x8_fwd_16s.
+*/
+#define CONST_BITS 15
+#define PASS1_BITS 4
+
+static const Ipp16s cDct[8][8] = {
+  { 11585,  11585,  11585,  11585,  11585,  11585,  11585,  11585 },
+  { 16069,  13623,   9102,   3196,  -3196,  -9102, -13623, -16069 },
+  { 15137,   6270,  -6270, -15137, -15137,  -6270,   6270,  15137 },
+  { 13623,  -3196, -16069,  -9102,   9102,  16069,   3196, -13623 },
+  { 11585, -11585, -11585,  11585,  11585, -11585, -11585,  11585 },
+  {  9102, -16069,   3196,  13623, -13623,  -3196,  16069,  -9102 },
+  {  6270, -15137,  15137,  -6270,  -6270,  15137, -15137,   6270 },
+  {  3196,  -9102,  13623, -16069,  16069, -13623,   9102,  -3196 }
+};
+
+/* row pass: pairs (cDct[u][2k], cDct[u][2k+1]) for u = 0..7 */
+static const Ipp16s cDctRow[4][16] = {
+  {  11585,  11585,  16069,  13623,  15137,   6270,  13623,  -3196,  11585, -11585,   9102, -16069,   6270, -15137,   3196,  -9102 },
+  {  11585,  11585,   9102,   3196,  -6270, -15137, -16069,  -9102, -11585,  11585,   3196,  13623,  15137,  -6270,  13623, -16069 },
+  {  11585,  11585,  -3196,  -9102, -15137,  -6270,   9102,  16069,  11585, -11585, -13623,  -3196,  -6270,  15137,  16069, -13623 },
+  {  11585,  11585, -13623, -16069,   6270,  15137,   3196, -13623, -11585,  11585,  16069,  -9102, -15137,   6270,   9102,  -3196 }
+};
+
+
+/*
+    Lib = L9
+    Caller = mfxiDCTQuantFwd8x8LS_JPEG_8u16s_C1R
+*/
+extern void mfxownDCTQuantFwd8x8LS_JPEG_8u16s_C1R_l9(
+  const Ipp8u*  pSrc,
+        int     srcStep,
+        Ipp16s* pDst,
+  const Ipp16u* pQuantFwdTable)
+{
+  int i, k;
+  __m128i row[8];
+  __m256i col[4];
+  __m256i kRow[4];
+
+  const __m128i k128  = _mm_set1_epi16(128);
+  const __m256i kRnd1 = _mm256_set1_epi32(1 << (CONST_BITS - PASS1_BITS - 1));
+  const __m256i kRnd2 = _mm256_set1_epi32(1 << (CONST_BITS + PASS1_BITS - 1));
+  const __m256i kRndQ = _mm256_set1_epi32((1 << (QUANT_BITS - 1)) - 1);
+  const __m256i kOne  = _mm256_set1_epi32(1);
+
+  for(k = 0; k < 4; k++)
+    kRow[k] = _mm256_loadu_si256((const __m256i*)cDctRow[k]);
+
+  /* level shift and row pass */
+  for(i = 0; i < 8; i++)
+  {
+    __m128i x = _mm_sub_epi16(_mm_cvtepu8_epi16(_mm_loadl_epi64((const __m128i*)(pSrc + i*srcStep))), k128);
+    __m256i r = _mm256_broadcastsi128_si256(x);
+    __m256i s;
+
+    s = _mm256_madd_epi16(_mm256_shuffle_epi32(r, 0x00), kRow[0]);
+    s = _mm256_add_epi32(s, _mm256_madd_epi16(_mm256_shuffle_epi32(r, 0x55), kRow[1]));
+    s = _mm256_add_epi32(s, _mm256_madd_epi16(_mm256_shuffle_epi32(r, 0xaa), kRow[2]));
+    s = _mm256_add_epi32(s, _mm256_madd_epi16(_mm256_shuffle_epi32(r, 0xff), kRow[3]));
+    s = _mm256_srai_epi32(_mm256_add_epi32(s, kRnd1), CONST_BITS - PASS1_BITS);
+
+    row[i] = _mm_packs_epi32(_mm256_castsi256_si128(s), _mm256_extracti128_si256(s, 1));
+  }
+
+  /* interleave row pairs for the column pass */
+  for(k = 0; k < 4; k++)
+  {
+    __m128i lo = _mm_unpacklo_epi16(row[2*k], row[2*k+1]);
+    __m128i hi = _mm_unpackhi_epi16(row[2*k], row[2*k+1]);
+    col[k] = _mm256_inserti128_si256(_mm256_castsi128_si256(lo), hi, 1);
+  }
+
+  /* column pass and quantization */
+  for(i = 0; i < 8; i++)
+  {
+    __m256i c = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i*)cDct[i]));
+    __m256i s, q;
+
+    s = _mm256_madd_epi16(col[0], _mm256_shuffle_epi32(c, 0x00));
+    s = _mm256_add_epi32(s, _mm256_madd_epi16(col[1], _mm256_shuffle_epi32(c, 0x55)));
+    s = _mm256_add_epi32(s, _mm256_madd_epi16(col[2], _mm256_shuffle_epi32(c, 0xaa)));
+    s = _mm256_add_epi32(s, _mm256_madd_epi16(col[3], _mm256_shuffle_epi32(c, 0xff)));
+    s = _mm256_srai_epi32(_mm256_add_epi32(s, kRnd2), CONST_BITS + PASS1_BITS);
+
+    /* round half to even, same as mfxownsMul_16u16s_PosSfs */
+    q = _mm256_cvtepu16_epi32(_mm_loadu_si128((const __m128i*)(pQuantFwdTable + i*8)));
+    s = _mm256_mullo_epi32(s, q);
+    q = _mm256_and_si256(_mm256_srai_epi32(s, QUANT_BITS), kOne);
+    s = _mm256_srai_epi32(_mm256_add_epi32(_mm256_add_epi32(s, kRndQ), q), QUANT_BITS);
+
+    _mm_storeu_si128((__m128i*)(pDst + i*8),
+      _mm_packs_epi32(_mm256_castsi256_si128(s), _mm256_extracti128_si256(s, 1)));
+  }
+
+  return;
+} /* mfxownDCTQuantFwd8x8LS_JPEG_8u16s_C1R_l9() */
+
+#endif /* _ARCH_EM64T */
@@ -36,72 +36,66 @@
 
 #define VC1_CLIP(x) (!(x&~255)?x:(x<0?0:255))
 
-#if (_IPP >= _IPP_W7) || (_IPP32E >= _IPP32E_M7)
-#ifndef imp_mfxiRangeMapping_VC1_8u_C1R
-#define imp_mfxiRangeMapping_VC1_8u_C1R
-IPPFUN(IppStatus, mfxiRangeMapping_VC1_8u_C1R ,(Ipp8u* pSrc, Ipp32s srcStep,
-                             Ipp8u* pDst, Ipp32s dstStep,
-                             IppiSize roiSize, Ipp32s rangeMapParam))
+#ifndef __OWNDISPATCH_H__
+#include "owndispatch.h"
+#endif
+
+/*
+    Lib = cn
+    Caller = mfxiRangeMapping_VC1_8u_C1R
+*/
+extern void mfxownRangeMapping_VC1_8u_C1R_cn(const Ipp8u* pSrc, int srcStep,
+                                             Ipp8u* pDst, int dstStep,
+                                             int width, int height, int rangeMapParam)
 {
     Ipp32s i=0;
     Ipp32s j=0;
     Ipp32s temp;
 
-    IPP_BAD_PTR2_RET(pSrc,pDst);
-    IPP_BAD_RANGE_RET(rangeMapParam, 0, 7);
-
-    if( (roiSize.height<=0) || (roiSize.width<=0))
-        return ippStsNoErr;
-
-    if((roiSize.width>>3<<3 != roiSize.width) || (roiSize.width>srcStep) || ((roiSize.width>dstStep))){
-        for (i = 0; i < roiSize.height; i++)
+    for (i = 0; i < height; i++)
+    {
+        for (j = 0; j < width; j++)
         {
-            for (j = 0; j < roiSize.width; j++)
-            {
-                temp = pSrc[i*srcStep+j];
+            temp = pSrc[i*srcStep+j];
 
-                temp = (temp - 128)*(rangeMapParam+9)+4;
-                temp = temp>>3;
-                temp = temp+128;
-                pDst[i*dstStep+j] = (Ipp8u)VC1_CLIP(temp);
-             }
-        }
-    } else {
-        mfxrangemapping_vc1_sse2(pSrc,srcStep,pDst,dstStep,(roiSize.height),(roiSize.width>>3),rangeMapParam);
+            temp = (temp - 128)*(rangeMapParam+9)+4;
+            temp = temp>>3;
+            temp = temp+128;
+            pDst[i*dstStep+j] = (Ipp8u)VC1_CLIP(temp);
+         }
     }
+}
 
-    return ippStsNoErr;
+#if (_IPP >= _IPP_W7) || (_IPP32E >= _IPP32E_M7)
+/*
+    Lib = Y8
+    Caller = mfxiRangeMapping_VC1_8u_C1R
+*/
+extern void mfxownRangeMapping_VC1_8u_C1R_y8(const Ipp8u* pSrc, int srcStep,
+                                             Ipp8u* pDst, int dstStep,
+                                             int width, int height, int rangeMapParam)
+{
+    if((width>>3<<3 != width) || (width>srcStep) || ((width>dstStep))){
+        mfxownRangeMapping_VC1_8u_C1R_cn(pSrc,srcStep,pDst,dstStep,width,height,rangeMapParam);
+    } else {
+        mfxrangemapping_vc1_sse2((Ipp8u*)pSrc,srcStep,pDst,dstStep,height,(width>>3),rangeMapParam);
+    }
 }
-#endif //#ifndef imp_mfxiRangeMapping_VC1_8u_C1R
 #endif //#if (_IPP >= _IPP_W7) || (_IPP32E >= _IPP32E_M7)
 
-#ifndef imp_mfxiRangeMapping_VC1_8u_C1R
-#define imp_mfxiRangeMapping_VC1_8u_C1R
-
+/* the code path is selected at runtime, see owndispatch.c */
 IPPFUN(IppStatus, mfxiRangeMapping_VC1_8u_C1R ,(Ipp8u* pSrc, Ipp32s srcStep,
                              Ipp8u* pDst, Ipp32s dstStep,
                              IppiSize roiSize, Ipp32s rangeMapParam))
 {
-    Ipp32s i=0;
-    Ipp32s j=0;
-    Ipp32s temp;
-
     IPP_BAD_PTR2_RET(pSrc,pDst);
     IPP_BAD_RANGE_RET(rangeMapParam, 0, 7);
 
-    for (i = 0; i < roiSize.height; i++)
-    {
-        for (j = 0; j < roiSize.width; j++)
-        {
-            temp = pSrc[i*srcStep+j];
+    if( (roiSize.height<=0) || (roiSize.width<=0))
+        return ippStsNoErr;
+
+    mfxownDispatchTable.RangeMapping_VC1_8u_C1R(pSrc,srcStep,pDst,dstStep,
+                                                roiSize.width,roiSize.height,rangeMapParam);
 
-            temp = (temp - 128)*(rangeMapParam+9)+4;
-            temp = temp>>3;
-            temp = temp+128;
-            pDst[i*dstStep+j] = (Ipp8u)VC1_CLIP(temp);
-         }
-    }
     return ippStsNoErr;
 }
-#endif //#ifndef imp_mfxiRangeMapping_VC1_8u_C1R
-
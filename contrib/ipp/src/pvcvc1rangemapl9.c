@@ -0,0 +1,88 @@
+// Copyright (c) 2020 Intel Corporation
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+/*
+//
+//  Description:
+//      VC1 Range Map transformation, AVX2 code path
+//
+//  Contents:
+//    mfxownRangeMapping_VC1_8u_C1R_l9
+//
+*/
+
+#include "precomp.h"
+#include "ownvc.h"
+
+#if defined(_ARCH_EM64T)
+
+#include <immintrin.h>
+
+extern void mfxownRangeMapping_VC1_8u_C1R_cn(const Ipp8u* pSrc, int srcStep,
+                                             Ipp8u* pDst, int dstStep,
+                                             int width, int height, int rangeMapParam);
+
+/*
+    Lib = L9
+    Caller = mfxiRangeMapping_VC1_8u_C1R
+
+    ((x - 128)*(rangeMapParam + 9) + 4) >> 3 + 128 fits 16 bits, packus
+    does the clipping. The right strip which is not a multiple of 32 pixels
+    is passed to the C code.
+*/
+extern void mfxownRangeMapping_VC1_8u_C1R_l9(const Ipp8u* pSrc, int srcStep,
+                                             Ipp8u* pDst, int dstStep,
+                                             int width, int height, int rangeMapParam)
+{
+    int h, w;
+    int width32 = width & ~0x1f;
+    const __m256i eZero = _mm256_setzero_si256();
+    const __m256i k128  = _mm256_set1_epi16(128);
+    const __m256i k4    = _mm256_set1_epi16(4);
+    const __m256i kMul  = _mm256_set1_epi16((short)(rangeMapParam + 9));
+
+    for (h = 0; h < height; h++)
+    {
+        const Ipp8u* src = pSrc + h * srcStep;
+        Ipp8u*       dst = pDst + h * dstStep;
+
+        for (w = 0; w < width32; w += 32)
+        {
+            __m256i s  = _mm256_loadu_si256((const __m256i*)(src + w));
+            __m256i lo = _mm256_sub_epi16(_mm256_unpacklo_epi8(s, eZero), k128);
+            __m256i hi = _mm256_sub_epi16(_mm256_unpackhi_epi8(s, eZero), k128);
+
+            lo = _mm256_add_epi16(_mm256_mullo_epi16(lo, kMul), k4);
+            hi = _mm256_add_epi16(_mm256_mullo_epi16(hi, kMul), k4);
+            lo = _mm256_add_epi16(_mm256_srai_epi16(lo, 3), k128);
+            hi = _mm256_add_epi16(_mm256_srai_epi16(hi, 3), k128);
+
+            _mm256_storeu_si256((__m256i*)(dst + w), _mm256_packus_epi16(lo, hi));
+        }
+    }
+
+    if (width > width32)
+    {
+        mfxownRangeMapping_VC1_8u_C1R_cn(pSrc + width32, srcStep, pDst + width32, dstStep,
+                                         width - width32, height, rangeMapParam);
+    }
+}
+
+#endif /* _ARCH_EM64T */
@@ -0,0 +1,260 @@
+// Copyright (c) 2020 Intel Corporation
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "asc_test_main.h"
+#include "asc.h"
+#include "asc_batch.h"
+#include "asc_defs.h"
+
+#include <algorithm>
+#include <vector>
+
+// The CPU backend: ASC initialized without a CmDevice and fed with system memory frames
+
+static const int WIDTH  = 640;
+static const int HEIGHT = 360;
+static const int PITCH  = 704;
+
+// Scene 0 is a checkerboard panning right, scene 1 a diagonal texture
+// starting at frame cut. The last frames fade to black, which turns on gain correction.
+static void MakeFrame(std::vector<mfxU8> &frame, int width, int height, int pitch, int n, int cut, int fade, std::mt19937 &rnd)
+{
+    int gain = n >= fade ? (n - fade + 1) * 25 : 0;
+    for (int y = 0; y < height; y++)
+    {
+        for (int x = 0; x < width; x++)
+        {
+            int X = x + 3 * n;
+            int v = n < cut ? (((X / 16 + y / 16) & 1) ? 180 : 60) : ((X * 7 + y * 3 + (X * y >> 9)) & 255);
+            v += (int)(rnd() % 9) - 4 - gain;
+            frame[y * pitch + x] = (mfxU8)std::min(std::max(v, 0), 255);
+        }
+    }
+}
+
+struct FrameResult
+{
+    mfxU32 shot, pdist;
+    mfxI32 spatial, temporal;
+    bool   ltr, repeated, filter, denoise;
+
+    bool operator==(const FrameResult &r) const
+    {
+        return shot == r.shot && pdist == r.pdist && spatial == r.spatial && temporal == r.temporal
+            && ltr == r.ltr && repeated == r.repeated && filter == r.filter && denoise == r.denoise;
+    }
+};
+
+static std::vector<FrameResult> RunClip(mfxU32 numThreads, int frames, int cut, int fade,
+    ns_asc::ASCMotionSearch_Mode mode = ns_asc::ASCFull_Search)
+{
+    std::vector<FrameResult> res;
+    std::vector<mfxU8> frame(PITCH * HEIGHT);
+    std::mt19937 rnd(ASC_TEST_SEED);
+
+    ns_asc::ASC asc;
+    EXPECT_EQ(MFX_ERR_NONE, asc.Init(WIDTH, HEIGHT, PITCH, MFX_PICSTRUCT_PROGRESSIVE, nullptr));
+    EXPECT_EQ(MFX_ERR_NONE, asc.SetNumThreads(numThreads));
+    EXPECT_EQ(numThreads, asc.GetNumThreads());
+    EXPECT_EQ(MFX_ERR_NONE, asc.SetMotionSearchMode(mode));
+
+    for (int n = 0; n < frames; n++)
+    {
+        MakeFrame(frame, WIDTH, HEIGHT, PITCH, n, cut, fade, rnd);
+        EXPECT_EQ(MFX_ERR_NONE, asc.PutFrameProgressive(frame.data(), PITCH));
+
+        FrameResult r = {};
+        r.shot     = asc.Get_frame_shot_Decision();
+        r.pdist    = asc.Get_PDist_advice();
+        r.spatial  = asc.Get_frame_Spatial_complexity();
+        r.temporal = asc.Get_frame_Temporal_complexity();
+        r.ltr      = asc.Get_LTR_advice();
+        r.repeated = asc.Get_RepeatedFrame_advice();
+        r.filter   = asc.Get_Filter_advice();
+        r.denoise  = asc.Get_intra_frame_denoise_recommendation();
+        res.push_back(r);
+    }
+    asc.Close();
+    return res;
+}
+
+TEST(ASCCpu, DetectsSceneChangeWithoutCmDevice)
+{
+    std::vector<FrameResult> res = RunClip(1, 20, 10, 20);
+
+    for (int n = 0; n < (int)res.size(); n++)
+        EXPECT_EQ(n == 10 ? 1u : 0u, res[n].shot) << "frame " << n;
+}
+
+TEST(ASCCpu, ThreadsMatchSingleThread)
+{
+    std::vector<FrameResult> ref = RunClip(1, 24, 8, 16);
+
+    for (mfxU32 numThreads = 2; numThreads <= ASC_MAX_THREADS; numThreads++)
+    {
+        std::vector<FrameResult> res = RunClip(numThreads, 24, 8, 16);
+        for (size_t n = 0; n < ref.size(); n++)
+            EXPECT_TRUE(ref[n] == res[n]) << numThreads << " threads, frame " << n;
+    }
+}
+
+TEST(ASCCpu, PredictiveSearch)
+{
+    std::vector<FrameResult> ref = RunClip(1, 20, 10, 20, ns_asc::ASCPredictive_Search);
+    for (int n = 0; n < (int)ref.size(); n++)
+        EXPECT_EQ(n == 10 ? 1u : 0u, ref[n].shot) << "frame " << n;
+
+    // the predictors come from blocks the wavefront has finished, threads do not change the result
+    std::vector<FrameResult> res = RunClip(4, 20, 10, 20, ns_asc::ASCPredictive_Search);
+    for (size_t n = 0; n < ref.size(); n++)
+        EXPECT_TRUE(ref[n] == res[n]) << "frame " << n;
+
+    ns_asc::ASC asc;
+    EXPECT_EQ(MFX_ERR_NOT_INITIALIZED, asc.SetMotionSearchMode(ns_asc::ASCPredictive_Search));
+}
+
+TEST(ASCCpu, NumThreads)
+{
+    ns_asc::ASC asc;
+    EXPECT_EQ(1u, asc.GetNumThreads());
+
+    EXPECT_EQ(MFX_ERR_NONE, asc.SetNumThreads(0));
+    EXPECT_GE(asc.GetNumThreads(), 1u);
+    EXPECT_LE(asc.GetNumThreads(), (mfxU32)ASC_MAX_THREADS);
+
+    EXPECT_EQ(MFX_ERR_NONE, asc.SetNumThreads(ASC_MAX_THREADS + 5));
+    EXPECT_EQ((mfxU32)ASC_MAX_THREADS, asc.GetNumThreads());
+
+    EXPECT_EQ(MFX_ERR_NONE, asc.SetNumThreads(1));
+    EXPECT_EQ(1u, asc.GetNumThreads());
+}
+
+struct BatchStream
+{
+    ns_asc::ASCStreamParam par;
+    int cut;
+};
+
+static const BatchStream BATCH[] =
+{
+    { { 640, 360, 704, MFX_PICSTRUCT_PROGRESSIVE },  5 },
+    { { 352, 288, 352, MFX_PICSTRUCT_PROGRESSIVE },  9 },
+    { { 720, 480, 768, MFX_PICSTRUCT_FIELD_TFF },    7 },
+    { { 1280, 720, 1280, MFX_PICSTRUCT_PROGRESSIVE }, 3 },
+};
+static const mfxU32 BATCH_STREAMS = sizeof(BATCH) / sizeof(BATCH[0]);
+static const int BATCH_FRAMES = 14;
+
+// shot decisions of every stream analysed on its own
+static std::vector<std::vector<mfxU32> > RunStreams()
+{
+    std::vector<std::vector<mfxU32> > res(BATCH_STREAMS);
+    for (mfxU32 s = 0; s < BATCH_STREAMS; s++)
+    {
+        const ns_asc::ASCStreamParam &par = BATCH[s].par;
+        std::vector<mfxU8> frame(par.Pitch * par.Height);
+        std::mt19937 rnd(ASC_TEST_SEED + s);
+
+        ns_asc::ASC asc;
+        EXPECT_EQ(MFX_ERR_NONE, asc.Init(par.Width, par.Height, par.Pitch, par.PicStruct, nullptr));
+        for (int n = 0; n < BATCH_FRAMES; n++)
+        {
+            MakeFrame(frame, par.Width, par.Height, par.Pitch, n, BATCH[s].cut, BATCH_FRAMES, rnd);
+            if (par.PicStruct == MFX_PICSTRUCT_PROGRESSIVE)
+                EXPECT_EQ(MFX_ERR_NONE, asc.PutFrameProgressive(frame.data(), par.Pitch));
+            else
+                EXPECT_EQ(MFX_ERR_NONE, asc.PutFrameInterlaced(frame.data(), par.Pitch));
+            res[s].push_back(asc.Get_frame_shot_Decision());
+        }
+        asc.Close();
+    }
+    return res;
+}
+
+TEST(ASCCpu, BatchMatchesSingleStreams)
+{
+    std::vector<std::vector<mfxU32> > ref = RunStreams();
+    EXPECT_EQ(1u, ref[0][BATCH[0].cut]);
+
+    ns_asc::ASCStreamParam par[BATCH_STREAMS];
+    for (mfxU32 s = 0; s < BATCH_STREAMS; s++)
+        par[s] = BATCH[s].par;
+
+    for (mfxU32 numThreads : { 1u, 3u })
+    {
+        ns_asc::ASCBatch batch;
+        ASSERT_EQ(MFX_ERR_NONE, batch.Init(BATCH_STREAMS, par, numThreads));
+        EXPECT_EQ(BATCH_STREAMS, batch.GetNumStreams());
+
+        std::vector<std::vector<mfxU8> > frames(BATCH_STREAMS);
+        std::vector<std::mt19937> rnd;
+        for (mfxU32 s = 0; s < BATCH_STREAMS; s++)
+        {
+            frames[s].resize(par[s].Pitch * par[s].Height);
+            rnd.emplace_back(ASC_TEST_SEED + s);
+        }
+
+        for (int n = 0; n < BATCH_FRAMES; n++)
+        {
+            // streams in reverse order, the batch must not depend on it
+            ns_asc::ASCBatchFrame in[BATCH_STREAMS] = {};
+            for (mfxU32 s = 0; s < BATCH_STREAMS; s++)
+            {
+                MakeFrame(frames[s], par[s].Width, par[s].Height, par[s].Pitch, n, BATCH[s].cut, BATCH_FRAMES, rnd[s]);
+                in[BATCH_STREAMS - 1 - s].stream = s;
+                in[BATCH_STREAMS - 1 - s].frame  = frames[s].data();
+            }
+            ASSERT_EQ(MFX_ERR_NONE, batch.PutFrames(BATCH_STREAMS, in));
+
+            for (mfxU32 i = 0; i < BATCH_STREAMS; i++)
+            {
+                EXPECT_EQ(MFX_ERR_NONE, in[i].sts);
+                EXPECT_EQ(ref[in[i].stream][n], in[i].shotDecision)
+                    << numThreads << " threads, stream " << in[i].stream << ", frame " << n;
+                EXPECT_EQ(in[i].shotDecision, batch.GetStream(in[i].stream)->Get_frame_shot_Decision());
+            }
+        }
+        batch.Close();
+    }
+}
+
+TEST(ASCCpu, BatchRejectsBadFrames)
+{
+    ns_asc::ASCStreamParam par[2] = { BATCH[0].par, BATCH[1].par };
+    std::vector<mfxU8> frame(par[0].Pitch * par[0].Height);
+
+    ns_asc::ASCBatch batch;
+    ns_asc::ASCBatchFrame in[2] = {};
+    EXPECT_EQ(MFX_ERR_NOT_INITIALIZED, batch.PutFrames(1, in));
+    ASSERT_EQ(MFX_ERR_NONE, batch.Init(2, par, 2));
+
+    in[0].frame = frame.data();
+    in[1].frame = frame.data();
+    EXPECT_EQ(MFX_ERR_INVALID_VIDEO_PARAM, batch.PutFrames(2, in));
+
+    in[1].stream = 2;
+    EXPECT_EQ(MFX_ERR_INVALID_VIDEO_PARAM, batch.PutFrames(2, in));
+
+    in[1].stream = 1;
+    in[1].frame = nullptr;
+    EXPECT_EQ(MFX_ERR_NULL_PTR, batch.PutFrames(2, in));
+
+    EXPECT_EQ(nullptr, batch.GetStream(2));
+}
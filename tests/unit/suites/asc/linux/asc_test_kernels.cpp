@@ -0,0 +1,330 @@
+// Copyright (c) 2020 Intel Corporation
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "asc_test_main.h"
+#include "cpu_detect.h"
+#include "asc_c_impl.h"
+#include "asc_sse4_impl.h"
+#include "asc_avx2_impl.h"
+#include "asc_avx512_impl.h"
+
+#include <algorithm>
+#include <climits>
+#include <vector>
+
+// Every SIMD kernel of the ASC dispatch table must give the same result as its _C version.
+// Variants the CPU can not run are skipped.
+
+template <class Func>
+struct Variant
+{
+    const char *name;
+    bool        available;
+    Func        func;
+};
+
+#define ASC_VARIANT(func, isa, available) { #isa, (available), func ## _ ## isa }
+
+// Picture with a margin on every side, the margin is random too, so reads
+// past the picture do not change results of a correct kernel
+struct Picture
+{
+    static const int MARGIN = 64;
+
+    std::vector<mfxU8> buf;
+    int width, height, pitch;
+
+    Picture(int w, int h, int p = 0)
+        : buf(), width(w), height(h), pitch(p ? p : w)
+    {
+        buf.resize((height + 2 * MARGIN) * (pitch + 2 * MARGIN));
+    }
+
+    mfxU8 *Data() { return &buf[MARGIN * (pitch + 2 * MARGIN) + MARGIN]; }
+    int Stride() const { return pitch + 2 * MARGIN; }
+
+    // values in [0, range), small ranges give flat pictures and a lot of equal SADs
+    void Random(std::mt19937 &rnd, int range = 256)
+    {
+        for (auto &v : buf)
+            v = (mfxU8)(rnd() % range);
+    }
+
+    // copy of src with noise of [-noise, noise], histogram bins get filled
+    void Noisy(const Picture &src, std::mt19937 &rnd, int noise)
+    {
+        for (size_t i = 0; i < buf.size(); i++)
+            buf[i] = (mfxU8)std::min(std::max(src.buf[i] + (int)(rnd() % (2 * noise + 1)) - noise, 0), 255);
+    }
+};
+
+static bool SSE4() { return !!CpuFeature_SSE41(); }
+static bool AVX2() { return !!CpuFeature_AVX2(); }
+static bool AVX512() { return !!CpuFeature_AVX512BW(); }
+
+TEST(ASCKernels, RsCsCalc_4x4)
+{
+    const Variant<decltype(&RsCsCalc_4x4_C)> variants[] = {
+        ASC_VARIANT(RsCsCalc_4x4, SSE4, SSE4()),
+        ASC_VARIANT(RsCsCalc_4x4, AVX2, AVX2()),
+        ASC_VARIANT(RsCsCalc_4x4, AVX512, AVX512()),
+    };
+    std::mt19937 rnd(ASC_TEST_SEED);
+
+    for (int wblocks = 3; wblocks <= 45; wblocks++)
+    {
+        for (int hblocks = 3; hblocks <= 6; hblocks++)
+        {
+            Picture pic(4 * wblocks, 4 * hblocks, 4 * wblocks + (int)(rnd() % 8));
+            pic.Random(rnd);
+
+            std::vector<mfxU16> rsRef(wblocks * hblocks, 0xabcd), csRef(rsRef);
+            RsCsCalc_4x4_C(pic.Data(), pic.Stride(), wblocks, hblocks, rsRef.data(), csRef.data());
+
+            for (auto &v : variants)
+            {
+                if (!v.available)
+                    continue;
+                std::vector<mfxU16> rs(wblocks * hblocks, 0xabcd), cs(rs);
+                v.func(pic.Data(), pic.Stride(), wblocks, hblocks, rs.data(), cs.data());
+                EXPECT_EQ(rsRef, rs) << v.name << " " << wblocks << "x" << hblocks;
+                EXPECT_EQ(csRef, cs) << v.name << " " << wblocks << "x" << hblocks;
+            }
+        }
+    }
+}
+
+TEST(ASCKernels, RsCsCalc_bound)
+{
+    const Variant<decltype(&RsCsCalc_bound_C)> variants[] = {
+        ASC_VARIANT(RsCsCalc_bound, AVX2, AVX2()),
+        ASC_VARIANT(RsCsCalc_bound, AVX512, AVX512()),
+    };
+    std::mt19937 rnd(ASC_TEST_SEED);
+
+    for (int wblocks = 1; wblocks <= 40; wblocks++)
+    {
+        for (int hblocks = 1; hblocks <= 40; hblocks += 3)
+        {
+            // full 16 bit range, the frame sums wrap around
+            std::vector<mfxU16> rs(wblocks * hblocks), cs(rs);
+            for (size_t i = 0; i < rs.size(); i++)
+            {
+                rs[i] = (mfxU16)rnd();
+                cs[i] = (mfxU16)rnd();
+            }
+
+            std::vector<mfxU16> rscsRef(rs.size() + 1, 0xabcd);
+            mfxU32 rsRef = 0, csRef = 0;
+            RsCsCalc_bound_C(rs.data(), cs.data(), rscsRef.data(), &rsRef, &csRef, wblocks, hblocks);
+
+            for (auto &v : variants)
+            {
+                if (!v.available)
+                    continue;
+                std::vector<mfxU16> rscs(rs.size() + 1, 0xabcd);
+                mfxU32 rsFrame = 0, csFrame = 0;
+                v.func(rs.data(), cs.data(), rscs.data(), &rsFrame, &csFrame, wblocks, hblocks);
+                EXPECT_EQ(rscsRef, rscs) << v.name << " " << wblocks << "x" << hblocks;
+                EXPECT_EQ(rsRef, rsFrame) << v.name << " " << wblocks << "x" << hblocks;
+                EXPECT_EQ(csRef, csFrame) << v.name << " " << wblocks << "x" << hblocks;
+            }
+        }
+    }
+}
+
+TEST(ASCKernels, RsCsCalc_diff)
+{
+    const Variant<decltype(&RsCsCalc_diff_C)> variants[] = {
+        ASC_VARIANT(RsCsCalc_diff, AVX2, AVX2()),
+        ASC_VARIANT(RsCsCalc_diff, AVX512, AVX512()),
+    };
+    std::mt19937 rnd(ASC_TEST_SEED);
+
+    for (int wblocks = 1; wblocks <= 40; wblocks++)
+    {
+        for (int hblocks = 1; hblocks <= 40; hblocks += 3)
+        {
+            std::vector<mfxU16> rs0(wblocks * hblocks), cs0(rs0), rs1(rs0), cs1(rs0);
+            for (size_t i = 0; i < rs0.size(); i++)
+            {
+                rs0[i] = (mfxU16)rnd();
+                cs0[i] = (mfxU16)rnd();
+                rs1[i] = (mfxU16)rnd();
+                cs1[i] = (mfxU16)rnd();
+            }
+
+            mfxU32 rsRef = 0, csRef = 0;
+            RsCsCalc_diff_C(rs0.data(), cs0.data(), rs1.data(), cs1.data(), wblocks, hblocks, &rsRef, &csRef);
+
+            for (auto &v : variants)
+            {
+                if (!v.available)
+                    continue;
+                mfxU32 rsDiff = 0, csDiff = 0;
+                v.func(rs0.data(), cs0.data(), rs1.data(), cs1.data(), wblocks, hblocks, &rsDiff, &csDiff);
+                EXPECT_EQ(rsRef, rsDiff) << v.name << " " << wblocks << "x" << hblocks;
+                EXPECT_EQ(csRef, csDiff) << v.name << " " << wblocks << "x" << hblocks;
+            }
+        }
+    }
+}
+
+TEST(ASCKernels, ImageDiffHistogram)
+{
+    const Variant<decltype(&ImageDiffHistogram_C)> variants[] = {
+        ASC_VARIANT(ImageDiffHistogram, SSE4, SSE4()),
+        ASC_VARIANT(ImageDiffHistogram, AVX2, AVX2()),
+        ASC_VARIANT(ImageDiffHistogram, AVX512, AVX512()),
+    };
+    std::mt19937 rnd(ASC_TEST_SEED);
+
+    for (int width = 1; width <= 200; width++)
+    {
+        const int noise[] = { 3, 20, 255 };
+        Picture src(width, 1 + width % 5, width + (int)(rnd() % 8)), ref(src);
+        src.Random(rnd);
+        ref.Noisy(src, rnd, noise[width % 3]);
+
+        mfxI32 histRef[5];
+        mfxI64 srcDCRef = 0, refDCRef = 0;
+        ImageDiffHistogram_C(src.Data(), ref.Data(), src.Stride(), width, src.height, histRef, &srcDCRef, &refDCRef);
+
+        for (auto &v : variants)
+        {
+            // the SSE4 loop runs 16 pixels at least
+            if (!v.available || (v.func == ImageDiffHistogram_SSE4 && width < 16))
+                continue;
+            mfxI32 hist[5] = {};
+            mfxI64 srcDC = 0, refDC = 0;
+            v.func(src.Data(), ref.Data(), src.Stride(), width, src.height, hist, &srcDC, &refDC);
+            EXPECT_EQ(std::vector<mfxI32>(histRef, histRef + 5), std::vector<mfxI32>(hist, hist + 5)) << v.name << " width " << width;
+            EXPECT_EQ(srcDCRef, srcDC) << v.name << " width " << width;
+            EXPECT_EQ(refDCRef, refDC) << v.name << " width " << width;
+        }
+    }
+}
+
+TEST(ASCKernels, GainOffset)
+{
+    const Variant<decltype(&GainOffset_C)> variants[] = {
+        ASC_VARIANT(GainOffset, AVX2, AVX2()),
+        ASC_VARIANT(GainOffset, AVX512, AVX512()),
+    };
+    std::mt19937 rnd(ASC_TEST_SEED);
+    const mfxI16 gains[] = { 0, 1, -1, 17, -17, 200, -200, 255, -255, 300, -300, SHRT_MAX, SHRT_MIN };
+
+    for (int width = 1; width <= 150; width++)
+    {
+        Picture src(width, 3, width + (int)(rnd() % 8));
+        src.Random(rnd);
+
+        for (mfxI16 gain : gains)
+        {
+            Picture dstRef(src);
+            pmfxU8 pSrcRef = src.Data(), pDstRef = dstRef.Data();
+            GainOffset_C(&pSrcRef, &pDstRef, (mfxU16)width, (mfxU16)src.height, (mfxU16)src.Stride(), gain);
+
+            for (auto &v : variants)
+            {
+                if (!v.available)
+                    continue;
+                Picture dst(src);
+                pmfxU8 pSrc = src.Data(), pDst = dst.Data();
+                v.func(&pSrc, &pDst, (mfxU16)width, (mfxU16)src.height, (mfxU16)src.Stride(), gain);
+                EXPECT_EQ(dstRef.buf, dst.buf) << v.name << " width " << width << " gain " << gain;
+                EXPECT_EQ(dst.Data(), pSrc) << v.name;
+            }
+        }
+    }
+}
+
+TEST(ASCKernels, Calc_RaCa_pic)
+{
+    const Variant<decltype(&Calc_RaCa_pic_C)> variants[] = {
+        ASC_VARIANT(Calc_RaCa_pic, SSE4, SSE4()),
+        ASC_VARIANT(Calc_RaCa_pic, AVX2, AVX2()),
+        ASC_VARIANT(Calc_RaCa_pic, AVX512, AVX512()),
+    };
+    std::mt19937 rnd(ASC_TEST_SEED);
+
+    for (int width = 9; width <= 200; width++)
+    {
+        for (int height = 9; height <= 21; height += 3)
+        {
+            Picture pic(width, height, width + (int)(rnd() % 8));
+            pic.Random(rnd);
+
+            mfxF64 rscsRef = 0;
+            Calc_RaCa_pic_C(pic.Data(), width, height, pic.Stride(), rscsRef);
+
+            for (auto &v : variants)
+            {
+                if (!v.available)
+                    continue;
+                mfxF64 rscs = -1;
+                EXPECT_EQ(MFX_ERR_NONE, v.func(pic.Data(), width, height, pic.Stride(), rscs));
+                EXPECT_EQ(rscsRef, rscs) << v.name << " " << width << "x" << height;
+            }
+        }
+    }
+}
+
+TEST(ASCKernels, ME_SAD_8x8_Block_Search)
+{
+    const Variant<decltype(&ME_SAD_8x8_Block_Search_C)> variants[] = {
+        ASC_VARIANT(ME_SAD_8x8_Block_Search, SSE4, SSE4()),
+        ASC_VARIANT(ME_SAD_8x8_Block_Search, AVX2, AVX2()),
+        ASC_VARIANT(ME_SAD_8x8_Block_Search, AVX512, AVX512()),
+    };
+    std::mt19937 rnd(ASC_TEST_SEED);
+
+    for (int xrange = 1; xrange <= 40; xrange++)
+    {
+        for (int yrange = 1; yrange <= 20; yrange++)
+        {
+            // flat pictures have many equal SADs, the first one in raster order must win
+            const int range[] = { 2, 4, 256 };
+            Picture src(8, 8, 64), ref(xrange + 8, yrange + 8, 64);
+            src.Random(rnd, range[(xrange + yrange) % 3]);
+            ref.Random(rnd, range[(xrange + yrange) % 3]);
+
+            const mfxU16 initial[] = { USHRT_MAX, (mfxU16)(rnd() % 400) };
+            for (mfxU16 init : initial)
+            {
+                mfxU16 sadRef = init;
+                int xRef = -1, yRef = -1;
+                ME_SAD_8x8_Block_Search_C(src.Data(), ref.Data(), src.Stride(), xrange, yrange, &sadRef, &xRef, &yRef);
+
+                for (auto &v : variants)
+                {
+                    if (!v.available)
+                        continue;
+                    mfxU16 sad = init;
+                    int x = -1, y = -1;
+                    v.func(src.Data(), ref.Data(), src.Stride(), xrange, yrange, &sad, &x, &y);
+                    EXPECT_EQ(sadRef, sad) << v.name << " range " << xrange << "x" << yrange;
+                    EXPECT_EQ(xRef, x) << v.name << " range " << xrange << "x" << yrange;
+                    EXPECT_EQ(yRef, y) << v.name << " range " << xrange << "x" << yrange;
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,239 @@
+// Copyright (c) 2020 Intel Corporation
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "asc_test_main.h"
+#include "tree.h"
+#include "cpu_detect.h"
+#include "asc_avx2_impl.h"
+#include "asc_avx512_impl.h"
+
+#include <algorithm>
+#include <climits>
+#include <vector>
+
+// Arguments of SCDetectRF in declaration order
+struct TreeInput
+{
+    mfxI32 diffMVdiffVal;
+    mfxU32 RsCsDiff, MVDiff, Rs, AFD, CsDiff;
+    mfxI32 diffTSC;
+    mfxU32 TSC, gchDC;
+    mfxI32 diffRsCsdiff;
+    mfxU32 posBalance, SC, TSCindex, Scindex, Cs;
+    mfxI32 diffAFD;
+    mfxU32 negBalance, ssDCval, refDCval, RsDiff;
+
+    void Set(mfxU32 feature, mfxI64 val)
+    {
+        switch (feature)
+        {
+        case ASC_TREE_diffMVdiffVal: diffMVdiffVal = (mfxI32)val; break;
+        case ASC_TREE_RsCsDiff:      RsCsDiff      = (mfxU32)val; break;
+        case ASC_TREE_MVDiff:        MVDiff        = (mfxU32)val; break;
+        case ASC_TREE_Rs:            Rs            = (mfxU32)val; break;
+        case ASC_TREE_AFD:           AFD           = (mfxU32)val; break;
+        case ASC_TREE_CsDiff:        CsDiff        = (mfxU32)val; break;
+        case ASC_TREE_diffTSC:       diffTSC       = (mfxI32)val; break;
+        case ASC_TREE_TSC:           TSC           = (mfxU32)val; break;
+        case ASC_TREE_gchDC:         gchDC         = (mfxU32)val; break;
+        case ASC_TREE_diffRsCsdiff:  diffRsCsdiff  = (mfxI32)val; break;
+        case ASC_TREE_posBalance:    posBalance    = (mfxU32)val; break;
+        case ASC_TREE_SC:            SC            = (mfxU32)val; break;
+        case ASC_TREE_TSCindex:      TSCindex      = (mfxU32)val; break;
+        case ASC_TREE_Scindex:       Scindex       = (mfxU32)val; break;
+        case ASC_TREE_Cs:            Cs            = (mfxU32)val; break;
+        case ASC_TREE_diffAFD:       diffAFD       = (mfxI32)val; break;
+        case ASC_TREE_negBalance:    negBalance    = (mfxU32)val; break;
+        case ASC_TREE_ssDCval:       ssDCval       = (mfxU32)val; break;
+        case ASC_TREE_refDCval:      refDCval      = (mfxU32)val; break;
+        case ASC_TREE_RsDiff:        RsDiff        = (mfxU32)val; break;
+        }
+    }
+
+    static bool IsSigned(mfxU32 feature)
+    {
+        return feature == ASC_TREE_diffMVdiffVal || feature == ASC_TREE_diffTSC
+            || feature == ASC_TREE_diffRsCsdiff  || feature == ASC_TREE_diffAFD;
+    }
+
+    // values of the same magnitude, range is picked per input so small thresholds get hit too
+    void Random(std::mt19937 &rnd)
+    {
+        static const mfxI64 ranges[] = { 16, 128, 1024, 40000, 0x7fffffff };
+        mfxI64 range = ranges[rnd() % (sizeof(ranges) / sizeof(ranges[0]))];
+        for (mfxU32 f = 0; f < ASC_TREE_LEAF; f++)
+        {
+            mfxI64 val = (mfxI64)(rnd() % (mfxU64)range);
+            Set(f, IsSigned(f) && (rnd() & 1) ? -val : val);
+        }
+    }
+
+    bool Ref(mfxU8 control) const
+    {
+        return SCDetectRF_Ref(diffMVdiffVal, RsCsDiff, MVDiff, Rs, AFD, CsDiff, diffTSC, TSC, gchDC, diffRsCsdiff,
+            posBalance, SC, TSCindex, Scindex, Cs, diffAFD, negBalance, ssDCval, refDCval, RsDiff, control);
+    }
+
+    bool Table(mfxU8 control) const
+    {
+        return SCDetectRF(diffMVdiffVal, RsCsDiff, MVDiff, Rs, AFD, CsDiff, diffTSC, TSC, gchDC, diffRsCsdiff,
+            posBalance, SC, TSCindex, Scindex, Cs, diffAFD, negBalance, ssDCval, refDCval, RsDiff, control);
+    }
+
+    void Features(mfxI32 feature[ASC_TREE_FEATURE_SLOTS]) const
+    {
+        SCDetectRF_Features(feature, diffMVdiffVal, RsCsDiff, MVDiff, Rs, AFD, CsDiff, diffTSC, TSC, gchDC, diffRsCsdiff,
+            posBalance, SC, TSCindex, Scindex, Cs, diffAFD, negBalance, ssDCval, refDCval, RsDiff);
+    }
+};
+
+// The decision is sum > RF_DECISION_LEVEL + control, so going over every control level
+// compares the number of votes, not only the final decision
+static void ExpectSameVotes(const TreeInput &in)
+{
+    for (mfxU32 control = 0; control <= ASC_TREE_COUNT; control++)
+    {
+        ASSERT_EQ(in.Ref((mfxU8)control), in.Table((mfxU8)control)) << "control " << control;
+    }
+}
+
+TEST(ASCTree, TableMatchesTreeOnRandomInput)
+{
+    std::mt19937 rnd(ASC_TEST_SEED);
+    TreeInput in = {};
+
+    for (int i = 0; i < 20000; i++)
+    {
+        in.Random(rnd);
+        ASSERT_NO_FATAL_FAILURE(ExpectSameVotes(in)) << "input " << i;
+    }
+}
+
+// Every split is reached by an input built from the constraints on the path from its root,
+// then its feature is set to both sides of the threshold
+TEST(ASCTree, TableMatchesTreeAtEveryThreshold)
+{
+    std::vector<mfxI32> parent(ASC_TREE_NODE_COUNT, -1);
+    for (mfxU32 i = 0; i < ASC_TREE_NODE_COUNT; i++)
+    {
+        mfxU32 node = ASC_TREE_NODES[i];
+        if (ASC_TREE_NODE_FEATURE(node) == ASC_TREE_LEAF)
+            continue;
+        parent[i + ASC_TREE_NODE_OFFSET(node)]     = i;
+        parent[i + ASC_TREE_NODE_OFFSET(node) + 1] = i;
+    }
+
+    std::mt19937 rnd(ASC_TEST_SEED);
+    TreeInput in = {};
+
+    for (mfxU32 i = 0; i < ASC_TREE_NODE_COUNT; i++)
+    {
+        mfxU32 node = ASC_TREE_NODES[i];
+        mfxU32 feature = ASC_TREE_NODE_FEATURE(node);
+        if (feature == ASC_TREE_LEAF)
+            continue;
+
+        // [lo, hi) of every feature on the way to node i
+        mfxI64 lo[ASC_TREE_LEAF], hi[ASC_TREE_LEAF];
+        for (mfxU32 f = 0; f < ASC_TREE_LEAF; f++)
+        {
+            lo[f] = TreeInput::IsSigned(f) ? INT_MIN : 0;
+            hi[f] = TreeInput::IsSigned(f) ? (mfxI64)INT_MAX + 1 : (mfxI64)UINT_MAX + 1;
+        }
+        for (mfxI32 child = i, p = parent[i]; p >= 0; child = p, p = parent[p])
+        {
+            mfxU32 split = ASC_TREE_NODES[p];
+            mfxU32 f = ASC_TREE_NODE_FEATURE(split);
+            mfxI32 thr = ASC_TREE_NODE_THRESHOLD(split);
+            if (child == p + (mfxI32)ASC_TREE_NODE_OFFSET(split))
+                hi[f] = std::min<mfxI64>(hi[f], thr);
+            else
+                lo[f] = std::max<mfxI64>(lo[f], thr);
+        }
+
+        mfxI32 thr = ASC_TREE_NODE_THRESHOLD(node);
+        for (mfxI64 val = thr - 1; val <= thr; val++)
+        {
+            if (val < lo[feature] || val >= hi[feature])
+                continue;
+            for (mfxU32 f = 0; f < ASC_TREE_LEAF; f++)
+            {
+                mfxI64 range = std::min<mfxI64>(hi[f] - lo[f], 1024);
+                in.Set(f, lo[f] + (mfxI64)(rnd() % (mfxU64)range));
+            }
+            in.Set(feature, val);
+            ASSERT_NO_FATAL_FAILURE(ExpectSameVotes(in)) << "node " << i << " value " << val;
+        }
+    }
+}
+
+TEST(ASCTree, TableMatchesTreeOnExtremeValues)
+{
+    const mfxI64 extremes[] = { 0, 1, 0x7fff, 0x8000, INT_MAX, (mfxI64)INT_MAX + 1, UINT_MAX, -1, -0x8000, -0x8001, INT_MIN };
+    std::mt19937 rnd(ASC_TEST_SEED);
+    TreeInput in = {};
+
+    for (mfxU32 f = 0; f < ASC_TREE_LEAF; f++)
+    {
+        for (mfxI64 val : extremes)
+        {
+            for (int i = 0; i < 16; i++)
+            {
+                in.Random(rnd);
+                in.Set(f, val);
+                ASSERT_NO_FATAL_FAILURE(ExpectSameVotes(in)) << "feature " << f << " value " << val;
+            }
+        }
+    }
+}
+
+TEST(ASCTree, VotesAVX2MatchC)
+{
+    if (!CpuFeature_AVX2())
+        return;
+
+    std::mt19937 rnd(ASC_TEST_SEED);
+    TreeInput in = {};
+    mfxI32 feature[ASC_TREE_FEATURE_SLOTS];
+
+    for (int i = 0; i < 20000; i++)
+    {
+        in.Random(rnd);
+        in.Features(feature);
+        ASSERT_EQ(SCDetectRF_Votes_C(feature), SCDetectRF_Votes_AVX2(feature)) << "input " << i;
+    }
+}
+
+TEST(ASCTree, VotesAVX512MatchC)
+{
+    if (!CpuFeature_AVX512BW())
+        return;
+
+    std::mt19937 rnd(ASC_TEST_SEED);
+    TreeInput in = {};
+    mfxI32 feature[ASC_TREE_FEATURE_SLOTS];
+
+    for (int i = 0; i < 20000; i++)
+    {
+        in.Random(rnd);
+        in.Features(feature);
+        ASSERT_EQ(SCDetectRF_Votes_C(feature), SCDetectRF_Votes_AVX512(feature)) << "input " << i;
+    }
+}
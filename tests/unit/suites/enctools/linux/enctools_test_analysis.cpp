@@ -0,0 +1,474 @@
+// Copyright (c) 2020 Intel Corporation
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "enctools_test_main.h"
+#include "mfx_enctools.h"
+
+#if defined(MFX_ENABLE_AENC)
+
+#include <random>
+
+// The scene change analysis of EncTools in the asynchronous (mfxEncToolsCtrlExtAsync) and
+// shared (mfxEncToolsCtrlExtShared) modes, on system memory frames.
+
+static mfxEncToolsCtrl AnalysisCtrl(mfxU16 width = 320, mfxU16 height = 240)
+{
+    mfxEncToolsCtrl ctrl = {};
+    ctrl.CodecId                 = MFX_CODEC_AVC;
+    ctrl.FrameInfo.Width         = width;
+    ctrl.FrameInfo.Height        = height;
+    ctrl.FrameInfo.CropW         = width;
+    ctrl.FrameInfo.CropH         = height;
+    ctrl.FrameInfo.FourCC        = MFX_FOURCC_NV12;
+    ctrl.FrameInfo.ChromaFormat  = MFX_CHROMAFORMAT_YUV420;
+    ctrl.FrameInfo.PicStruct     = MFX_PICSTRUCT_PROGRESSIVE;
+    ctrl.FrameInfo.FrameRateExtN = 30;
+    ctrl.FrameInfo.FrameRateExtD = 1;
+    ctrl.IOPattern               = MFX_IOPATTERN_IN_SYSTEM_MEMORY;
+    ctrl.MaxGopSize              = 64;
+    ctrl.MaxGopRefDist           = 8;
+    ctrl.MaxIDRDist              = 64;
+    return ctrl;
+}
+
+static mfxExtEncToolsConfig AnalysisConfig()
+{
+    mfxExtEncToolsConfig config = {};
+    config.Header.BufferId = MFX_EXTBUFF_ENCTOOLS_CONFIG;
+    config.Header.BufferSz = sizeof(config);
+    config.AdaptiveI       = MFX_CODINGOPTION_ON;
+    config.AdaptiveB       = MFX_CODINGOPTION_ON;
+    return config;
+}
+
+// NV12 frames, a new scene every sceneLength frames
+class Frames
+{
+public:
+    Frames(mfxU32 count, mfxU32 sceneLength, mfxU16 width = 320, mfxU16 height = 240)
+        : m_width(width)
+        , m_height(height)
+        , m_data(count)
+    {
+        std::mt19937 rnd(0x36);
+
+        for (mfxU32 i = 0; i < count; i++)
+        {
+            mfxU32 scene = i / sceneLength;
+            m_data[i].resize(width * height * 3 / 2);
+
+            // a textured scene moving by a pixel per frame
+            for (mfxU32 y = 0; y < height; y++)
+                for (mfxU32 x = 0; x < width; x++)
+                    m_data[i][y * width + x] = (mfxU8)(((x + i) * (scene + 3) / 4 + y * (7 - scene % 5)) ^ (rnd() & 7));
+            for (mfxU32 j = width * height; j < m_data[i].size(); j++)
+                m_data[i][j] = (mfxU8)(128 + 16 * (scene % 3));
+        }
+    }
+
+    mfxFrameSurface1 Surface(mfxU32 i)
+    {
+        mfxFrameSurface1 surface = {};
+        surface.Info.FourCC = MFX_FOURCC_NV12;
+        surface.Info.Width  = m_width;
+        surface.Info.Height = m_height;
+        surface.Info.CropW  = m_width;
+        surface.Info.CropH  = m_height;
+        surface.Data.Pitch  = m_width;
+        surface.Data.Y      = m_data[i % m_data.size()].data();
+        surface.Data.UV     = surface.Data.Y + m_width * m_height;
+        return surface;
+    }
+
+protected:
+    mfxU16 m_width;
+    mfxU16 m_height;
+    std::vector<std::vector<mfxU8>> m_data;
+};
+
+static mfxStatus SubmitFrame(EncTools &et, mfxFrameSurface1 surface, mfxU32 displayOrder)
+{
+    mfxEncToolsFrameToAnalyze frame = {};
+    frame.Header.BufferId = MFX_EXTBUFF_ENCTOOLS_FRAME_TO_ANALYZE;
+    frame.Header.BufferSz = sizeof(frame);
+    frame.Surface         = &surface;
+
+    mfxExtBuffer *ext[] = { &frame.Header };
+    mfxEncToolsTaskParam par = {};
+    par.DisplayOrder = displayOrder;
+    par.ExtParam     = ext;
+    par.NumExtParam  = 1;
+
+    // the synchronous analysis needs more data until its lookahead is filled, as the encoder does
+    mfxStatus sts = et.Submit(&par);
+    return sts == MFX_ERR_MORE_DATA ? MFX_ERR_NONE : sts;
+}
+
+static mfxStatus QueryGop(EncTools &et, mfxU32 displayOrder, mfxU32 timeOut, mfxEncToolsHintPreEncodeGOP &gop)
+{
+    gop = {};
+    gop.Header.BufferId = MFX_EXTBUFF_ENCTOOLS_HINT_GOP;
+    gop.Header.BufferSz = sizeof(gop);
+
+    mfxExtBuffer *ext[] = { &gop.Header };
+    mfxEncToolsTaskParam par = {};
+    par.DisplayOrder = displayOrder;
+    par.ExtParam     = ext;
+    par.NumExtParam  = 1;
+
+    return et.Query(&par, timeOut);
+}
+
+struct GopHint
+{
+    mfxU16 FrameType;
+    mfxI16 QPDelta;
+    mfxU16 MiniGopSize;
+
+    bool operator==(GopHint const & other) const
+    {
+        return FrameType == other.FrameType && QPDelta == other.QPDelta && MiniGopSize == other.MiniGopSize;
+    }
+};
+
+static std::ostream & operator<<(std::ostream &os, GopHint const & hint)
+{
+    return os << "type " << hint.FrameType << " qp delta " << hint.QPDelta << " minigop " << hint.MiniGopSize;
+}
+
+// submits all the frames, then queries and discards them in display order
+static std::vector<GopHint> Analyze(EncTools &et, Frames &frames, mfxU32 count)
+{
+    std::vector<GopHint> hints;
+
+    for (mfxU32 i = 0; i < count; i++)
+        EXPECT_EQ(MFX_ERR_NONE, SubmitFrame(et, frames.Surface(i), i)) << "frame " << i;
+
+    for (mfxU32 i = 0; i < count; i++)
+    {
+        mfxEncToolsHintPreEncodeGOP gop;
+        EXPECT_EQ(MFX_ERR_NONE, QueryGop(et, i, UINT_MAX, gop)) << "frame " << i;
+        EXPECT_EQ(MFX_ERR_NONE, et.Discard(i)) << "frame " << i;
+        hints.push_back({ gop.FrameType, gop.QPDelta, gop.MiniGopSize });
+    }
+
+    return hints;
+}
+
+class AnalysisEncTools : public EncTools
+{
+public:
+    mfxStatus Init(bool bAsync, mfxEncToolsCtrl ctrl = AnalysisCtrl(), EncTools *pShared = nullptr)
+    {
+        m_async = {};
+        m_async.Header.BufferId = MFX_EXTBUFF_ENCTOOLS_ASYNC;
+        m_async.Header.BufferSz = sizeof(m_async);
+        m_async.AsyncAnalysis   = (mfxU16)(bAsync ? MFX_CODINGOPTION_ON : MFX_CODINGOPTION_OFF);
+
+        m_sharedTools = {};
+        m_sharedTools.Context = pShared;
+
+        m_shared = {};
+        m_shared.Header.BufferId = MFX_EXTBUFF_ENCTOOLS_SHARED;
+        m_shared.Header.BufferSz = sizeof(m_shared);
+        m_shared.SharedAnalysis  = pShared ? &m_sharedTools : nullptr;
+
+        m_ext[0] = &m_async.Header;
+        m_ext[1] = &m_shared.Header;
+        ctrl.ExtParam    = m_ext;
+        ctrl.NumExtParam = 2;
+
+        mfxExtEncToolsConfig config = AnalysisConfig();
+        return EncTools::Init(&config, &ctrl);
+    }
+
+    mfxStatus Reset()
+    {
+        mfxEncToolsCtrl ctrl = AnalysisCtrl();
+        ctrl.ExtParam    = m_ext;
+        ctrl.NumExtParam = 2;
+
+        mfxExtEncToolsConfig config = AnalysisConfig();
+        return EncTools::Reset(&config, &ctrl);
+    }
+
+protected:
+    mfxEncToolsCtrlExtAsync  m_async;
+    mfxEncToolsCtrlExtShared m_shared;
+    mfxEncTools              m_sharedTools;
+    mfxExtBuffer            *m_ext[2];
+};
+
+TEST(EncToolsAsync, SameHintsAsSync)
+{
+    const mfxU32 count = 60;
+    Frames frames(count, 20);
+
+    AnalysisEncTools sync, async;
+    ASSERT_EQ(MFX_ERR_NONE, sync.Init(false));
+    ASSERT_EQ(MFX_ERR_NONE, async.Init(true));
+
+    std::vector<GopHint> ref = Analyze(sync, frames, count);
+    // Discard runs while the worker still analyzes the frames after it
+    EXPECT_EQ(ref, Analyze(async, frames, count));
+
+    // the scene changes are found
+    EXPECT_TRUE(ref[20].FrameType & MFX_FRAMETYPE_I);
+    EXPECT_TRUE(ref[40].FrameType & MFX_FRAMETYPE_I);
+
+    EXPECT_EQ(MFX_ERR_NONE, async.Close());
+    EXPECT_EQ(MFX_ERR_NONE, sync.Close());
+}
+
+TEST(EncToolsAsync, QueryTimesOutWhileFramesArePending)
+{
+    // large frames, the worker is far behind the submission
+    const mfxU32 count = 100;
+    Frames frames(4, 4, 1280, 720);
+
+    AnalysisEncTools et;
+    ASSERT_EQ(MFX_ERR_NONE, et.Init(true, AnalysisCtrl(1280, 720)));
+
+    for (mfxU32 i = 0; i < count; i++)
+        ASSERT_EQ(MFX_ERR_NONE, SubmitFrame(et, frames.Surface(i), i));
+
+    mfxEncToolsHintPreEncodeGOP gop;
+    EXPECT_EQ(MFX_WRN_IN_EXECUTION, QueryGop(et, count / 2, 0, gop));
+    EXPECT_EQ(MFX_WRN_IN_EXECUTION, QueryGop(et, count / 2, 1, gop));
+
+    // the lookahead is flushed at the end of the queue, the frames go out in display order
+    for (mfxU32 i = 0; i < count; i++)
+    {
+        ASSERT_EQ(MFX_ERR_NONE, QueryGop(et, i, UINT_MAX, gop)) << "frame " << i;
+        ASSERT_EQ(MFX_ERR_NONE, et.Discard(i)) << "frame " << i;
+    }
+
+    EXPECT_EQ(MFX_ERR_NONE, et.Close());
+}
+
+TEST(EncToolsAsync, DiscardedFrameIsDropped)
+{
+    const mfxU32 count = 30;
+    Frames frames(count, 30);
+
+    AnalysisEncTools et;
+    ASSERT_EQ(MFX_ERR_NONE, et.Init(true));
+
+    for (mfxU32 i = 0; i < count; i++)
+        ASSERT_EQ(MFX_ERR_NONE, SubmitFrame(et, frames.Surface(i), i));
+
+    // waits for the analysis of the frame, the frames after it are still queued
+    EXPECT_EQ(MFX_ERR_NONE, et.Discard(0));
+
+    mfxEncToolsHintPreEncodeGOP gop;
+    for (mfxU32 i = 1; i < count; i++)
+        ASSERT_EQ(MFX_ERR_NONE, QueryGop(et, i, UINT_MAX, gop)) << "frame " << i;
+    EXPECT_EQ(MFX_ERR_INCOMPATIBLE_VIDEO_PARAM, QueryGop(et, 0, UINT_MAX, gop));
+
+    EXPECT_EQ(MFX_ERR_NONE, et.Close());
+}
+
+TEST(EncToolsAsync, WorkerErrorIsReported)
+{
+    Frames frames(4, 4);
+
+    AnalysisEncTools et;
+    ASSERT_EQ(MFX_ERR_NONE, et.Init(true));
+    ASSERT_EQ(MFX_ERR_NONE, SubmitFrame(et, frames.Surface(0), 0));
+
+    // the worker fails to drop a frame it never analyzed
+    EXPECT_EQ(MFX_ERR_NONE, et.Discard(100));
+
+    mfxEncToolsHintPreEncodeGOP gop;
+    EXPECT_EQ(MFX_ERR_INCOMPATIBLE_VIDEO_PARAM, QueryGop(et, 0, UINT_MAX, gop));
+    EXPECT_EQ(MFX_ERR_INCOMPATIBLE_VIDEO_PARAM, SubmitFrame(et, frames.Surface(1), 1));
+
+    // a new stream starts without the error
+    EXPECT_EQ(MFX_ERR_NONE, et.Reset());
+    EXPECT_EQ(MFX_ERR_NONE, SubmitFrame(et, frames.Surface(0), 0));
+    EXPECT_EQ(MFX_ERR_NONE, QueryGop(et, 0, UINT_MAX, gop));
+
+    EXPECT_EQ(MFX_ERR_NONE, et.Close());
+}
+
+TEST(EncToolsAsync, CloseDropsPendingFrames)
+{
+    const mfxU32 count = 100;
+    Frames frames(4, 4, 1280, 720);
+
+    AnalysisEncTools et;
+    ASSERT_EQ(MFX_ERR_NONE, et.Init(true, AnalysisCtrl(1280, 720)));
+
+    for (mfxU32 i = 0; i < count; i++)
+        ASSERT_EQ(MFX_ERR_NONE, SubmitFrame(et, frames.Surface(i), i));
+    EXPECT_EQ(MFX_ERR_NONE, et.Close());
+
+    // the worker starts again
+    ASSERT_EQ(MFX_ERR_NONE, et.Init(true, AnalysisCtrl(1280, 720)));
+    ASSERT_EQ(MFX_ERR_NONE, SubmitFrame(et, frames.Surface(0), 0));
+
+    mfxEncToolsHintPreEncodeGOP gop;
+    EXPECT_EQ(MFX_ERR_NONE, QueryGop(et, 0, UINT_MAX, gop));
+    EXPECT_EQ(MFX_ERR_NONE, et.Close());
+}
+
+TEST(EncToolsAsync, ResetDrainsPendingFrames)
+{
+    const mfxU32 count = 60;
+    Frames frames(count, 20);
+
+    AnalysisEncTools ref, et;
+    ASSERT_EQ(MFX_ERR_NONE, ref.Init(false));
+    ASSERT_EQ(MFX_ERR_NONE, et.Init(true));
+
+    for (mfxU32 i = 0; i < 10; i++)
+        ASSERT_EQ(MFX_ERR_NONE, SubmitFrame(et, frames.Surface(i), i));
+    EXPECT_EQ(MFX_ERR_NONE, et.Reset());
+
+    // the analysis starts over, still on the worker
+    EXPECT_EQ(Analyze(ref, frames, count), Analyze(et, frames, count));
+
+    EXPECT_EQ(MFX_ERR_NONE, et.Close());
+    EXPECT_EQ(MFX_ERR_NONE, ref.Close());
+}
+
+TEST(EncToolsShared, AttachChecksTheSharedInstance)
+{
+    AnalysisEncTools shared, user;
+
+    // not initialized yet
+    EXPECT_EQ(MFX_ERR_UNDEFINED_BEHAVIOR, user.Init(false, AnalysisCtrl(), &shared));
+
+    ASSERT_EQ(MFX_ERR_NONE, shared.Init(false));
+
+    // itself
+    EXPECT_EQ(MFX_ERR_UNDEFINED_BEHAVIOR, user.Init(false, AnalysisCtrl(), &user));
+
+    // another GOP structure
+    mfxEncToolsCtrl ctrl = AnalysisCtrl();
+    ctrl.MaxGopRefDist = 4;
+    EXPECT_EQ(MFX_ERR_INCOMPATIBLE_VIDEO_PARAM, user.Init(false, ctrl, &shared));
+
+    // another resolution
+    EXPECT_EQ(MFX_ERR_NONE, user.Init(false, AnalysisCtrl(640, 480), &shared));
+
+    mfxExtEncToolsConfig config = {};
+    EXPECT_EQ(MFX_ERR_NONE, user.GetActiveConfig(&config));
+    EXPECT_EQ(MFX_CODINGOPTION_ON, config.AdaptiveI);
+    EXPECT_EQ(MFX_CODINGOPTION_ON, config.AdaptiveB);
+
+    EXPECT_EQ(MFX_ERR_NONE, user.Close());
+    EXPECT_EQ(MFX_ERR_NONE, shared.Close());
+}
+
+TEST(EncToolsShared, CloseFailsWhileInUse)
+{
+    const mfxU32 count = 20;
+    Frames frames(count, 20);
+
+    AnalysisEncTools shared, user;
+    ASSERT_EQ(MFX_ERR_NONE, shared.Init(true));
+    ASSERT_EQ(MFX_ERR_NONE, user.Init(false, AnalysisCtrl(), &shared));
+
+    EXPECT_EQ(MFX_ERR_UNDEFINED_BEHAVIOR, shared.Close());
+
+    // the analysis goes on
+    for (mfxU32 i = 0; i < count; i++)
+        ASSERT_EQ(MFX_ERR_NONE, SubmitFrame(shared, frames.Surface(i), i));
+
+    mfxEncToolsHintPreEncodeGOP gop;
+    EXPECT_EQ(MFX_ERR_NONE, QueryGop(shared, 0, UINT_MAX, gop));
+    EXPECT_EQ(MFX_ERR_NONE, QueryGop(user, 0, UINT_MAX, gop));
+
+    EXPECT_EQ(MFX_ERR_NONE, user.Close());
+    EXPECT_EQ(MFX_ERR_NONE, shared.Close());
+}
+
+TEST(EncToolsShared, UsersGetTheSameHints)
+{
+    const mfxU32 count = 40;
+    Frames frames(count, 20);
+
+    AnalysisEncTools shared, user;
+    ASSERT_EQ(MFX_ERR_NONE, shared.Init(true));
+    ASSERT_EQ(MFX_ERR_NONE, user.Init(false, AnalysisCtrl(640, 480), &shared));
+
+    // a user waits for the frame, it does not flush the analysis
+    mfxEncToolsHintPreEncodeGOP gop, userGop;
+    EXPECT_EQ(MFX_WRN_IN_EXECUTION, QueryGop(user, 0, 10, gop));
+
+    for (mfxU32 i = 0; i < count; i++)
+    {
+        ASSERT_EQ(MFX_ERR_NONE, SubmitFrame(shared, frames.Surface(i), i));
+        // ignored, the shared instance analyzes the frames
+        ASSERT_EQ(MFX_ERR_NONE, SubmitFrame(user, frames.Surface(i), i));
+    }
+
+    for (mfxU32 i = 0; i < count; i++)
+    {
+        ASSERT_EQ(MFX_ERR_NONE, QueryGop(shared, i, UINT_MAX, gop));
+        ASSERT_EQ(MFX_ERR_NONE, QueryGop(user, i, UINT_MAX, userGop));
+        EXPECT_EQ(gop.FrameType, userGop.FrameType) << "frame " << i;
+        EXPECT_EQ(gop.QPDelta, userGop.QPDelta) << "frame " << i;
+        EXPECT_EQ(gop.MiniGopSize, userGop.MiniGopSize) << "frame " << i;
+
+        EXPECT_EQ(MFX_ERR_NONE, shared.Discard(i));
+        EXPECT_EQ(MFX_ERR_NONE, user.Discard(i));
+    }
+
+    EXPECT_EQ(MFX_ERR_NONE, user.Close());
+    EXPECT_EQ(MFX_ERR_NONE, shared.Close());
+}
+
+TEST(EncToolsShared, FrameIsKeptUntilTheLastDiscard)
+{
+    const mfxU32 count = 20;
+    Frames frames(count, 20);
+
+    AnalysisEncTools shared, user1, user2;
+    ASSERT_EQ(MFX_ERR_NONE, shared.Init(false));
+    ASSERT_EQ(MFX_ERR_NONE, user1.Init(false, AnalysisCtrl(), &shared));
+    ASSERT_EQ(MFX_ERR_NONE, user2.Init(false, AnalysisCtrl(), &shared));
+
+    for (mfxU32 i = 0; i < count; i++)
+        ASSERT_EQ(MFX_ERR_NONE, SubmitFrame(shared, frames.Surface(i), i));
+
+    mfxEncToolsHintPreEncodeGOP gop;
+    ASSERT_EQ(MFX_ERR_NONE, QueryGop(shared, 0, UINT_MAX, gop));
+    ASSERT_EQ(MFX_ERR_NONE, QueryGop(shared, 1, UINT_MAX, gop));
+
+    EXPECT_EQ(MFX_ERR_NONE, shared.Discard(0));
+    EXPECT_EQ(MFX_ERR_NONE, user1.Discard(0));
+    EXPECT_EQ(MFX_ERR_NONE, QueryGop(user2, 0, 0, gop));
+    EXPECT_EQ(MFX_ERR_NONE, user2.Discard(0));
+    EXPECT_EQ(MFX_WRN_IN_EXECUTION, QueryGop(user1, 0, 0, gop));
+
+    // a detached user does not hold the frames back
+    EXPECT_EQ(MFX_ERR_NONE, shared.Discard(1));
+    EXPECT_EQ(MFX_ERR_NONE, user1.Discard(1));
+    EXPECT_EQ(MFX_ERR_NONE, QueryGop(user1, 1, 0, gop));
+    EXPECT_EQ(MFX_ERR_NONE, user2.Close());
+    EXPECT_EQ(MFX_WRN_IN_EXECUTION, QueryGop(user1, 1, 0, gop));
+
+    EXPECT_EQ(MFX_ERR_NONE, user1.Close());
+    EXPECT_EQ(MFX_ERR_NONE, shared.Close());
+}
+
+#endif // MFX_ENABLE_AENC
@@ -0,0 +1,229 @@
+// Copyright (c) 2020 Intel Corporation
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "enctools_test_main.h"
+#include "mfx_enctools_brc_defs.h"
+
+#include <random>
+
+// Bits of the last numFrames of sizes, frames before the first one count as 0
+static mfxU64 LastBits(std::vector<mfxU32> const & sizes, size_t numFrames)
+{
+    mfxU64 bits = 0;
+    for (size_t i = 0; i < numFrames && i < sizes.size(); i++)
+        bits += sizes[sizes.size() - 1 - i];
+    return bits;
+}
+
+TEST(FrameBitsHistory, InitFillsCapacity)
+{
+    FrameBitsHistory history(4, 100, 0);
+
+    EXPECT_EQ(4u, history.GetCapacity());
+    EXPECT_EQ(4u, history.GetCount());
+    EXPECT_EQ(0u, history.GetSum(0, false));
+    EXPECT_EQ(300u, history.GetSum(3, false));
+    EXPECT_EQ(400u, history.GetSum(4, false));
+    EXPECT_EQ(400u, history.GetSum(100, false));
+    EXPECT_EQ(400u, history.GetTotal(false));
+}
+
+TEST(FrameBitsHistory, SumsWrapAround)
+{
+    const mfxU32 capacity = 5;
+    FrameBitsHistory history(capacity, 0, 0);
+    std::vector<mfxU32> sizes;
+    std::mt19937 rnd(0x39);
+
+    // many times around the ring of capacity + 1 sums
+    for (int i = 0; i < 100; i++)
+    {
+        mfxU32 bits = rnd() % 100000;
+        history.Add(bits);
+        sizes.push_back(bits);
+
+        for (mfxU32 n = 0; n <= capacity; n++)
+            ASSERT_EQ(LastBits(sizes, n), history.GetSum(n, false)) << "frame " << i << " last " << n;
+    }
+    EXPECT_EQ(LastBits(sizes, sizes.size()), history.GetTotal(false));
+}
+
+TEST(FrameBitsHistory, MinBitsRaiseSmallFrames)
+{
+    FrameBitsHistory history(3, 0, 50);
+
+    history.Add(10);
+    history.Add(80);
+
+    EXPECT_EQ(90u, history.GetSum(2, false));
+    EXPECT_EQ(130u, history.GetSum(2, true));
+    // the initial frames are raised too
+    EXPECT_EQ(180u, history.GetSum(3, true));
+}
+
+TEST(FrameBitsHistory, ReplaceLastAfterWrapAround)
+{
+    FrameBitsHistory history(2, 0, 0);
+
+    for (mfxU32 i = 1; i <= 7; i++)
+        history.Add(i);
+
+    history.ReplaceLast(100);
+    history.ReplaceLast(20);
+
+    EXPECT_EQ(7u + 2u, history.GetCount());
+    EXPECT_EQ(20u, history.GetSum(1, false));
+    EXPECT_EQ(26u, history.GetSum(2, false));
+    EXPECT_EQ(21u + 20u, history.GetTotal(false));
+}
+
+TEST(FrameBitsHistory, InitResetsHistory)
+{
+    FrameBitsHistory history(4, 0, 0);
+
+    for (mfxU32 i = 0; i < 10; i++)
+        history.Add(1000);
+
+    history.Init(3, 7, 5);
+
+    EXPECT_EQ(3u, history.GetCapacity());
+    EXPECT_EQ(3u, history.GetCount());
+    EXPECT_EQ(21u, history.GetSum(3, false));
+    EXPECT_EQ(21u, history.GetTotal(false));
+
+    history.Add(1);
+    EXPECT_EQ(15u, history.GetSum(3, false));
+    EXPECT_EQ(19u, history.GetSum(3, true));
+}
+
+TEST(MultiWindowBitrate, EmptyWindowsAcceptTheLimit)
+{
+    MultiWindowBitrate windows;
+    windows.AddWindow(3, 1000);
+    windows.AddSegment(4, 700);
+
+    EXPECT_EQ(2u, windows.GetNumWindows());
+    EXPECT_EQ(0u, windows.GetWindowBits(0));
+    EXPECT_EQ(0u, windows.GetWindowBits(1));
+    EXPECT_EQ(700u, windows.GetMaxFrameSize());
+}
+
+TEST(MultiWindowBitrate, SeveralWindowsWrapAround)
+{
+    const mfxU32 size[]  = { 2, 5, 3 };
+    const mfxU64 limit[] = { 2000, 4000, 2500 };
+    const bool   segment[] = { false, false, true };
+
+    MultiWindowBitrate windows;
+    for (int w = 0; w < 3; w++)
+    {
+        if (segment[w])
+            windows.AddSegment(size[w], limit[w]);
+        else
+            windows.AddWindow(size[w], limit[w]);
+    }
+
+    std::vector<mfxU32> sizes;
+    std::mt19937 rnd(0x39);
+
+    for (mfxU32 order = 0; order < 50; order++)
+    {
+        mfxU32 bits = rnd() % 1000;
+        windows.UpdateFrame(bits, order);
+        sizes.push_back(bits);
+
+        mfxU64 maxFrameSize = UINT_MAX;
+        for (mfxU32 w = 0; w < 3; w++)
+        {
+            // a segment holds the frames since its first one
+            size_t inWindow = segment[w] ? (sizes.size() - 1) % size[w] + 1 : size[w];
+            ASSERT_EQ(LastBits(sizes, inWindow), windows.GetWindowBits(w)) << "frame " << order << " window " << w;
+
+            size_t before = segment[w] ? sizes.size() % size[w] : size[w] - 1;
+            mfxU64 bitsBefore = LastBits(sizes, before);
+            maxFrameSize = std::min(maxFrameSize, bitsBefore < limit[w] ? limit[w] - bitsBefore : 0);
+        }
+        ASSERT_EQ(maxFrameSize, windows.GetMaxFrameSize()) << "frame " << order;
+    }
+}
+
+TEST(MultiWindowBitrate, FullWindowAcceptsNothing)
+{
+    MultiWindowBitrate windows;
+    windows.AddWindow(3, 1000);
+
+    windows.UpdateFrame(600, 0);
+    windows.UpdateFrame(500, 1);
+    EXPECT_EQ(0u, windows.GetMaxFrameSize());
+
+    // the first frame leaves the window
+    windows.UpdateFrame(100, 2);
+    EXPECT_EQ(400u, windows.GetMaxFrameSize());
+}
+
+TEST(MultiWindowBitrate, RecodeReplacesLastFrame)
+{
+    MultiWindowBitrate windows;
+    windows.AddWindow(2, 1000);
+
+    windows.UpdateFrame(300, 0);
+    windows.UpdateFrame(900, 1);
+    windows.UpdateFrame(400, 1);
+
+    EXPECT_EQ(700u, windows.GetWindowBits(0));
+    EXPECT_EQ(600u, windows.GetMaxFrameSize());
+}
+
+TEST(MultiWindowBitrate, PlannedFramesMatchEncodedOnes)
+{
+    const mfxU32 planned[] = { 300, 50, 120, 700, 10, 250 };
+    const mfxU32 numPlanned = sizeof(planned) / sizeof(planned[0]);
+
+    MultiWindowBitrate windows;
+    windows.AddWindow(4, 1500);
+    windows.AddSegment(3, 1000);
+
+    for (mfxU32 order = 0; order < 5; order++)
+        windows.UpdateFrame(100 + 40 * order, order);
+
+    mfxU32 maxFrameSize[numPlanned];
+    windows.GetMaxFrameSizes(planned, numPlanned, maxFrameSize);
+
+    // each limit is the one after the frames before it are encoded with their plan
+    MultiWindowBitrate encoded = windows;
+    for (mfxU32 i = 0; i < numPlanned; i++)
+    {
+        EXPECT_EQ(encoded.GetMaxFrameSize(), maxFrameSize[i]) << "frame " << i;
+        encoded.UpdateFrame(planned[i], 5 + i);
+    }
+}
+
+TEST(MultiWindowBitrate, AddWindowResetsHistory)
+{
+    MultiWindowBitrate windows;
+    windows.AddWindow(2, 1000);
+    windows.UpdateFrame(800, 0);
+
+    windows.AddWindow(4, 3000);
+
+    EXPECT_EQ(0u, windows.GetWindowBits(0));
+    EXPECT_EQ(0u, windows.GetWindowBits(1));
+    EXPECT_EQ(1000u, windows.GetMaxFrameSize());
+}
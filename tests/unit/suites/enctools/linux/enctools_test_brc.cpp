@@ -0,0 +1,239 @@
+// Copyright (c) 2020 Intel Corporation
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "enctools_test_main.h"
+#include "mfx_enctools_brc.h"
+
+using namespace EncToolsBRC;
+
+static BRC_FrameStruct Frame(mfxU32 dispOrder)
+{
+    BRC_FrameStruct frame;
+    frame.dispOrder = dispOrder;
+    frame.encOrder  = dispOrder;
+    return frame;
+}
+
+TEST(BRCFrameStructRing, InitRoundsUpToPowerOfTwo)
+{
+    BRC_FrameStructRing ring;
+    EXPECT_EQ(nullptr, ring.Add(Frame(0)));
+
+    ring.Init(5);
+    EXPECT_EQ(8u, ring.Size());
+    EXPECT_EQ(nullptr, ring.Find(0));
+}
+
+TEST(BRCFrameStructRing, WrapsAroundReleasedFrames)
+{
+    BRC_FrameStructRing ring;
+    ring.Init(4);
+
+    for (mfxU32 i = 0; i < 64; i++)
+    {
+        ASSERT_NE(nullptr, ring.Add(Frame(i)));
+        ASSERT_NE(nullptr, ring.Find(i));
+        ring.Release(i);
+    }
+
+    EXPECT_EQ(4u, ring.Size());
+    EXPECT_NE(nullptr, ring.Find(63));
+    EXPECT_EQ(nullptr, ring.Find(59));
+}
+
+TEST(BRCFrameStructRing, ReleasedFrameStaysUntilTaken)
+{
+    BRC_FrameStructRing ring;
+    ring.Init(4);
+
+    ring.Add(Frame(1));
+    ring.Release(1);
+    EXPECT_NE(nullptr, ring.Find(1));
+
+    ring.Add(Frame(5));
+    EXPECT_EQ(nullptr, ring.Find(1));
+    EXPECT_EQ(4u, ring.Size());
+}
+
+TEST(BRCFrameStructRing, GrowsOnCollisionInFlight)
+{
+    BRC_FrameStructRing ring;
+    ring.Init(4);
+
+    ring.Add(Frame(0))->qp = 30;
+    ring.Add(Frame(4))->qp = 34;
+
+    EXPECT_EQ(8u, ring.Size());
+    ASSERT_NE(nullptr, ring.Find(0));
+    ASSERT_NE(nullptr, ring.Find(4));
+    EXPECT_EQ(30, ring.Find(0)->qp);
+    EXPECT_EQ(34, ring.Find(4)->qp);
+}
+
+TEST(BRCFrameStructRing, GrowsUntilNoCollisionIsLeft)
+{
+    BRC_FrameStructRing ring;
+    ring.Init(4);
+
+    // 0 and 16 share a slot in rings of 4, 8 and 16 frames
+    ring.Add(Frame(0))->qp = 30;
+    ring.Add(Frame(16))->qp = 46;
+
+    EXPECT_EQ(32u, ring.Size());
+    ASSERT_NE(nullptr, ring.Find(0));
+    ASSERT_NE(nullptr, ring.Find(16));
+    EXPECT_EQ(30, ring.Find(0)->qp);
+    EXPECT_EQ(46, ring.Find(16)->qp);
+}
+
+TEST(BRCFrameStructRing, SameFrameTakesItsSlot)
+{
+    BRC_FrameStructRing ring;
+    ring.Init(4);
+
+    ring.Add(Frame(2))->qp = 30;
+    ring.Add(Frame(2))->qp = 31;
+
+    EXPECT_EQ(4u, ring.Size());
+    EXPECT_EQ(31, ring.Find(2)->qp);
+}
+
+TEST(BRCFrameStructRing, ReserveKeepsFramesInFlight)
+{
+    BRC_FrameStructRing ring;
+    ring.Init(4);
+
+    for (mfxU32 i = 0; i < 4; i++)
+        ring.Add(Frame(i))->qp = 20 + i;
+    ring.Release(0);
+
+    ring.Reserve(16);
+    EXPECT_EQ(16u, ring.Size());
+    EXPECT_EQ(nullptr, ring.Find(0));
+    for (mfxU32 i = 1; i < 4; i++)
+    {
+        ASSERT_NE(nullptr, ring.Find(i));
+        EXPECT_EQ(mfxI32(20 + i), ring.Find(i)->qp);
+    }
+
+    // the ring never shrinks
+    ring.Reserve(2);
+    EXPECT_EQ(16u, ring.Size());
+}
+
+TEST(BRCFrameStructRing, ReinitDropsAllFrames)
+{
+    BRC_FrameStructRing ring;
+    ring.Init(4);
+    ring.Add(Frame(0));
+    ring.Add(Frame(4));
+
+    ring.Close();
+    EXPECT_EQ(0u, ring.Size());
+    EXPECT_EQ(nullptr, ring.Find(0));
+
+    // Reserve does not bring a closed ring back
+    ring.Reserve(8);
+    EXPECT_EQ(0u, ring.Size());
+
+    ring.Init(4);
+    EXPECT_EQ(4u, ring.Size());
+    EXPECT_EQ(nullptr, ring.Find(4));
+    EXPECT_NE(nullptr, ring.Add(Frame(4)));
+}
+
+class BRCTool : public BRC_EncTool
+{
+public:
+    mfxU32 RingSize() const { return m_FrameStruct.Size(); }
+};
+
+static mfxEncToolsCtrl BRCCtrl()
+{
+    mfxEncToolsCtrl ctrl = {};
+    ctrl.CodecId                 = MFX_CODEC_AVC;
+    ctrl.FrameInfo.Width         = 320;
+    ctrl.FrameInfo.Height        = 240;
+    ctrl.FrameInfo.CropW         = 320;
+    ctrl.FrameInfo.CropH         = 240;
+    ctrl.FrameInfo.FourCC        = MFX_FOURCC_NV12;
+    ctrl.FrameInfo.ChromaFormat  = MFX_CHROMAFORMAT_YUV420;
+    ctrl.FrameInfo.PicStruct     = MFX_PICSTRUCT_PROGRESSIVE;
+    ctrl.FrameInfo.FrameRateExtN = 30;
+    ctrl.FrameInfo.FrameRateExtD = 1;
+    ctrl.IOPattern               = MFX_IOPATTERN_IN_SYSTEM_MEMORY;
+    ctrl.MaxGopSize              = 32;
+    ctrl.MaxGopRefDist           = 1;
+    ctrl.MaxIDRDist              = 32;
+    ctrl.RateControlMethod       = MFX_RATECONTROL_CBR;
+    ctrl.TargetKbps              = 1000;
+    ctrl.MaxKbps                 = 1000;
+    ctrl.HRDConformance          = MFX_BRC_NO_HRD;
+    return ctrl;
+}
+
+// frames with hints only, e.g. dropped by the encoder, give their slots back on Discard
+TEST(BRCEncTool, DiscardReleasesHintOnlyFrames)
+{
+    BRCTool brc;
+    ASSERT_EQ(MFX_ERR_NONE, brc.Init(BRCCtrl()));
+    mfxU32 size = brc.RingSize();
+
+    mfxEncToolsHintPreEncodeGOP hints = {};
+    for (mfxU32 i = 0; i < 8 * size; i++)
+    {
+        ASSERT_EQ(MFX_ERR_NONE, brc.ReportGopHints(i, hints));
+        brc.Discard(i);
+    }
+    EXPECT_EQ(size, brc.RingSize());
+
+    // without Discard every frame stays in flight
+    for (mfxU32 i = 8 * size; i < 10 * size; i++)
+        ASSERT_EQ(MFX_ERR_NONE, brc.ReportGopHints(i, hints));
+    EXPECT_LE(2 * size, brc.RingSize());
+}
+
+TEST(BRCEncTool, EncodedFramesAreReleased)
+{
+    BRCTool brc;
+    ASSERT_EQ(MFX_ERR_NONE, brc.Init(BRCCtrl()));
+    mfxU32 size = brc.RingSize();
+
+    for (mfxU32 i = 0; i < 4 * size; i++)
+    {
+        mfxEncToolsBRCFrameParams frame = {};
+        frame.FrameType    = (i % 32) ? MFX_FRAMETYPE_P | MFX_FRAMETYPE_REF : MFX_FRAMETYPE_I | MFX_FRAMETYPE_IDR | MFX_FRAMETYPE_REF;
+        frame.EncodeOrder  = i;
+        ASSERT_EQ(MFX_ERR_NONE, brc.SetFrameStruct(i, frame));
+
+        mfxEncToolsBRCQuantControl qp = {};
+        ASSERT_EQ(MFX_ERR_NONE, brc.ProcessFrame(i, &qp));
+
+        mfxEncToolsBRCEncodeResult result = {};
+        result.CodedFrameSize = 1000000 / 8 / 30;
+        result.QpY            = qp.QpY;
+        ASSERT_EQ(MFX_ERR_NONE, brc.ReportEncResult(i, result));
+
+        mfxEncToolsBRCStatus status = {};
+        ASSERT_EQ(MFX_ERR_NONE, brc.UpdateFrame(i, &status));
+        ASSERT_EQ(MFX_BRC_OK, status.FrameStatus.BRCStatus);
+    }
+    EXPECT_EQ(size, brc.RingSize());
+}
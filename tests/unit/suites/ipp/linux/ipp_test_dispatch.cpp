@@ -0,0 +1,275 @@
+// Copyright (c) 2020 Intel Corporation
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "ipp_test_main.h"
+#include "owndispatch.h"
+#include "ippi.h"
+#include "ippj.h"
+#include "ippvc.h"
+
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+// The SIMD code paths of the IPP dispatch table must give the same result as
+// the C one. Code paths the CPU can not run are skipped.
+
+template <class Func>
+struct Variant
+{
+    const char *name;
+    bool        available;
+    Func        func;
+};
+
+static bool SSE42() { return !!__builtin_cpu_supports("sse4.2"); }
+static bool AVX2() { return !!__builtin_cpu_supports("avx2"); }
+
+TEST(IPPDispatch, RGBToYCbCr_JPEG_8u_C4P3R)
+{
+    const Variant<decltype(&mfxownRGBToYCbCr_JPEG_8u_C4P3R_cn)> variants[] = {
+        { "SSE4.2", SSE42(), mfxownRGBToYCbCr_JPEG_8u_C4P3R    },
+        { "AVX2",   AVX2(),  mfxownRGBToYCbCr_JPEG_8u_C4P3R_l9 },
+    };
+    std::mt19937 rnd(IPP_TEST_SEED);
+
+    // every tail of the 8, 16 and 32 pixels blocks
+    for (int width = 2; width <= 100; width++)
+    {
+        // odd steps make the SSE code path take its unaligned loop
+        for (int pad : { 0, 3 })
+        {
+            const int height = 3;
+            const int bgrStep = 4 * (width + pad);
+            const int yccStep = width + pad;
+            IppiSize roi = { width, height };
+
+            std::vector<Ipp8u> bgr(bgrStep * height);
+            for (auto &v : bgr)
+                v = (Ipp8u)rnd();
+
+            std::vector<Ipp8u> ref(3 * yccStep * height, 0xab);
+            Ipp8u *pRef[3] = { &ref[0], &ref[yccStep * height], &ref[2 * yccStep * height] };
+            mfxownRGBToYCbCr_JPEG_8u_C4P3R_cn(bgr.data(), bgrStep, pRef, yccStep, roi);
+
+            for (auto &v : variants)
+            {
+                if (!v.available)
+                    continue;
+                std::vector<Ipp8u> ycc(ref.size(), 0xab);
+                Ipp8u *pYCC[3] = { &ycc[0], &ycc[yccStep * height], &ycc[2 * yccStep * height] };
+                v.func(bgr.data(), bgrStep, pYCC, yccStep, roi);
+                EXPECT_EQ(ref, ycc) << v.name << " width " << width << " step " << yccStep;
+            }
+        }
+    }
+}
+
+TEST(IPPDispatch, DCTQuantFwd8x8LS_JPEG_8u16s_C1R)
+{
+    // The SSE4.2 transform is the original asm one, it rounds differently and
+    // may be one quantization step away. The C and AVX2 ones are bit exact.
+    const struct
+    {
+        const char *name;
+        bool        available;
+        decltype(&mfxownDCTQuantFwd8x8LS_JPEG_8u16s_C1R_cn) func;
+        int         maxDiff;
+    } variants[] = {
+        { "SSE4.2", SSE42(), mfxownDCTQuantFwd8x8LS_JPEG_8u16s_C1R_y8, 1 },
+        { "AVX2",   AVX2(),  mfxownDCTQuantFwd8x8LS_JPEG_8u16s_C1R_l9, 0 },
+    };
+    std::mt19937 rnd(IPP_TEST_SEED);
+
+    // the finest and the coarsest tables, and a random one
+    std::vector<Ipp8u> raw[3] = { std::vector<Ipp8u>(64, 1), std::vector<Ipp8u>(64, 255), std::vector<Ipp8u>(64) };
+    for (auto &v : raw[2])
+        v = (Ipp8u)(rnd() % 255 + 1);
+
+    for (auto &r : raw)
+    {
+        Ipp16u quant[64];
+        ASSERT_EQ(ippStsNoErr, mfxiQuantFwdTableInit_JPEG_8u16u(r.data(), quant));
+
+        for (int block = 0; block < 200; block++)
+        {
+            const int srcStep = (block & 1) ? 13 : 8;
+            std::vector<Ipp8u> src(8 * srcStep);
+            for (int y = 0; y < 8; y++)
+            {
+                for (int x = 0; x < srcStep; x++)
+                {
+                    // flat and checkerboard blocks give the largest coefficients
+                    Ipp8u &v = src[y * srcStep + x];
+                    switch (block)
+                    {
+                    case 0:  v = 0;                          break;
+                    case 1:  v = 255;                        break;
+                    case 2:  v = ((x ^ y) & 1) ? 255 : 0;    break;
+                    default: v = (Ipp8u)rnd();               break;
+                    }
+                }
+            }
+
+            Ipp16s ref[64];
+            mfxownDCTQuantFwd8x8LS_JPEG_8u16s_C1R_cn(src.data(), srcStep, ref, quant);
+
+            for (auto &v : variants)
+            {
+                if (!v.available)
+                    continue;
+                Ipp16s dst[64];
+                v.func(src.data(), srcStep, dst, quant);
+                for (int i = 0; i < 64; i++)
+                    EXPECT_LE(std::abs(ref[i] - dst[i]), v.maxDiff) << v.name << " block " << block << " coefficient " << i;
+            }
+        }
+    }
+}
+
+TEST(IPPDispatch, Copy8u)
+{
+    const Variant<decltype(&mfxowniCopy8u_cn)> variants[] = {
+        { "SSE4.2", SSE42(), mfxowniCopy8uas  },
+        { "AVX2",   AVX2(),  mfxowniCopy8u_l9 },
+    };
+    std::mt19937 rnd(IPP_TEST_SEED);
+
+    // every tail of the 32 and 128 bytes blocks
+    for (int width = 1; width <= 300; width++)
+    {
+        // without padding the rows are copied as one
+        for (int pad : { 0, 3 })
+        {
+            const int height = 3;
+            const int step = width + pad;
+
+            std::vector<Ipp8u> src(step * height);
+            for (auto &v : src)
+                v = (Ipp8u)rnd();
+
+            std::vector<Ipp8u> ref(src.size(), 0xab);
+            mfxowniCopy8u_cn(src.data(), step, ref.data(), step, width, height);
+
+            for (auto &v : variants)
+            {
+                if (!v.available)
+                    continue;
+                std::vector<Ipp8u> dst(ref.size(), 0xab);
+                v.func(src.data(), step, dst.data(), step, width, height);
+                EXPECT_EQ(ref, dst) << v.name << " width " << width << " step " << step;
+            }
+        }
+    }
+}
+
+TEST(IPPDispatch, RangeMapping_VC1_8u_C1R)
+{
+    const Variant<decltype(&mfxownRangeMapping_VC1_8u_C1R_cn)> variants[] = {
+        { "SSE4.2", SSE42(), mfxownRangeMapping_VC1_8u_C1R_y8 },
+        { "AVX2",   AVX2(),  mfxownRangeMapping_VC1_8u_C1R_l9 },
+    };
+    std::mt19937 rnd(IPP_TEST_SEED);
+
+    // the SSE code path takes widths multiple of 8, AVX2 leaves the 32 pixels tail to C
+    for (int width = 1; width <= 100; width++)
+    {
+        for (int pad : { 0, 3 })
+        {
+            const int height = 3;
+            const int step = width + pad;
+
+            std::vector<Ipp8u> src(step * height);
+            for (auto &v : src)
+                v = (Ipp8u)rnd();
+            // the ends of the range are clipped
+            src[0] = 0;
+            src[src.size() - 1] = 255;
+
+            for (int param = 0; param <= 7; param++)
+            {
+                std::vector<Ipp8u> ref(src.size(), 0xab);
+                mfxownRangeMapping_VC1_8u_C1R_cn(src.data(), step, ref.data(), step, width, height, param);
+
+                for (auto &v : variants)
+                {
+                    if (!v.available)
+                        continue;
+                    std::vector<Ipp8u> dst(ref.size(), 0xab);
+                    v.func(src.data(), step, dst.data(), step, width, height, param);
+                    EXPECT_EQ(ref, dst) << v.name << " width " << width << " step " << step << " param " << param;
+                }
+            }
+        }
+    }
+}
+
+// The public functions must call the code path the table is set to
+TEST(IPPDispatch, SetDispatchLevel)
+{
+    const OwnDispatchLevel initial = mfxownDispatchTable.level;
+    const OwnDispatchLevel levels[] = { ownDispatchC, ownDispatchSSE42, ownDispatchAVX2 };
+    const int width = 72, height = 8, step = 80;
+    std::mt19937 rnd(IPP_TEST_SEED);
+
+    std::vector<Ipp8u> src(step * height);
+    for (auto &v : src)
+        v = (Ipp8u)rnd();
+
+    Ipp8u raw[64];
+    Ipp16u quant[64];
+    for (auto &v : raw)
+        v = (Ipp8u)(rnd() % 255 + 1);
+    ASSERT_EQ(ippStsNoErr, mfxiQuantFwdTableInit_JPEG_8u16u(raw, quant));
+
+    Ipp16s refDct[64];
+    std::vector<Ipp8u> refCopy, refMap;
+
+    for (auto level : levels)
+    {
+        const OwnDispatchLevel selected = mfxownSetDispatchLevel(level);
+        EXPECT_LE(selected, level);
+        EXPECT_EQ(selected, mfxownDispatchTable.level);
+        if (selected != level)
+            continue;
+
+        Ipp16s dct[64];
+        std::vector<Ipp8u> copy(src.size(), 0xab), map(src.size(), 0xab);
+        IppiSize roi = { width, height };
+
+        EXPECT_EQ(ippStsNoErr, mfxiDCTQuantFwd8x8LS_JPEG_8u16s_C1R(src.data(), step, dct, quant));
+        EXPECT_EQ(ippStsNoErr, mfxiCopy_8u_C1R(src.data(), step, copy.data(), step, roi));
+        EXPECT_EQ(ippStsNoErr, mfxiRangeMapping_VC1_8u_C1R(src.data(), step, map.data(), step, roi, 5));
+
+        if (level == ownDispatchC)
+        {
+            memcpy(refDct, dct, sizeof(dct));
+            refCopy = copy;
+            refMap = map;
+            continue;
+        }
+        for (int i = 0; i < 64; i++)
+            EXPECT_LE(std::abs(refDct[i] - dct[i]), level == ownDispatchSSE42 ? 1 : 0) << "level " << level;
+        EXPECT_EQ(refCopy, copy) << "level " << level;
+        EXPECT_EQ(refMap, map) << "level " << level;
+    }
+
+    EXPECT_EQ(initial, mfxownSetDispatchLevel(initial));
+}
@@ -0,0 +1,209 @@
+// Copyright (c) 2020 Intel Corporation
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "jpeg_test_main.h"
+#include "jpegdec.h"
+
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+// Progressive pictures must decode to the same output as baseline ones with
+// the same quantized coefficients. The pairs in data/ were written by one
+// encoder from one image, only the scan structure differs.
+
+static std::vector<uint8_t> LoadFile(const char *name)
+{
+    std::ifstream in(std::string(JPEG_TEST_DATA_DIR "/") + name, std::ios::binary);
+    return std::vector<uint8_t>(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+}
+
+struct Picture
+{
+    int                  width;
+    int                  height;
+    int                  step[3];
+    uint8_t*             pDst[3];
+    std::vector<uint8_t> plane[3];
+};
+
+// NV12 for 4:2:0 sources, BGRA or planar YCbCr for 4:4:4 ones
+static JERRCODE SetDestination(CJPEGDecoder& dec, Picture& pic, JCOLOR dstColor)
+{
+    int planes = (JC_NV12 == dstColor) ? 2 : (JC_BGRA == dstColor) ? 1 : 3;
+
+    for (int c = 0; c < 3; c++)
+    {
+        int width  = (JC_BGRA == dstColor) ? pic.width * 4 : pic.width;
+        int height = (JC_NV12 == dstColor && 1 == c) ? (pic.height + 1) >> 1 : pic.height;
+
+        pic.step[c] = (c < planes) ? (width + 63) & ~63 : 0;
+        pic.plane[c].assign((size_t)pic.step[c] * height, 0);
+        pic.pDst[c] = (c < planes) ? pic.plane[c].data() : 0;
+    }
+
+    mfxSize size = { pic.width, pic.height };
+
+    if (JC_BGRA == dstColor)
+        return dec.SetDestination(pic.pDst[0], pic.step[0], size, 4, JC_BGRA, JS_444, 8);
+
+    return dec.SetDestination(pic.pDst, pic.step, size, 3, dstColor, (JC_NV12 == dstColor) ? JS_420 : JS_444, 8);
+}
+
+static JERRCODE DecodeBaseline(const std::vector<uint8_t>& stream, Picture& pic, JCOLOR dstColor)
+{
+    CJPEGDecoder dec;
+    int      channels, precision;
+    JCOLOR   color;
+    JSS      sampling;
+    JERRCODE jerr;
+
+    jerr = dec.SetSource(stream.data(), (int)stream.size());
+    if (JPEG_OK != jerr)
+        return jerr;
+
+    jerr = dec.ReadHeader(&pic.width, &pic.height, &channels, &color, &sampling, &precision);
+    if (JPEG_OK != jerr)
+        return jerr;
+
+    jerr = SetDestination(dec, pic, dstColor);
+    if (JPEG_OK != jerr)
+        return jerr;
+
+    return dec.ReadData();
+}
+
+// Scan by scan, as MJPEGVideoDecoderMFX does: every piece holds the tables
+// following the previous scan and one scan, the first one the frame header.
+static void SplitScans(const std::vector<uint8_t>& stream, std::vector<std::pair<size_t, size_t> >& scans)
+{
+    size_t pos = 2, start = 0;
+
+    while (pos + 4 <= stream.size() && 0xff == stream[pos] && JM_EOI != stream[pos + 1])
+    {
+        uint8_t marker = stream[pos + 1];
+
+        pos += 2 + ((stream[pos + 2] << 8) | stream[pos + 3]);
+
+        if (JM_SOS == marker)
+        {
+            // the encoder here writes no restart markers
+            while (pos + 1 < stream.size() && !(0xff == stream[pos] && 0 != stream[pos + 1]))
+                pos++;
+
+            scans.push_back(std::make_pair(start, pos - start));
+            start = pos;
+        }
+    }
+}
+
+static JERRCODE DecodeProgressive(const std::vector<uint8_t>& stream, Picture& pic, JCOLOR dstColor)
+{
+    std::vector<std::pair<size_t, size_t> > scans;
+    std::vector<int16_t> coefs;
+    CJPEGDecoder dec;
+    int      channels, precision;
+    JCOLOR   color;
+    JSS      sampling;
+    JERRCODE jerr;
+
+    SplitScans(stream, scans);
+    if (scans.size() < 2)
+        return JPEG_ERR_BAD_DATA;
+
+    for (size_t s = 0; s < scans.size(); s++)
+    {
+        jerr = dec.SetSource(stream.data() + scans[s].first, (int)scans[s].second);
+        if (JPEG_OK != jerr)
+            return jerr;
+
+        jerr = dec.ReadHeader(&pic.width, &pic.height, &channels, &color, &sampling, &precision);
+        if (JPEG_OK != jerr)
+            return jerr;
+
+        if (0 == s)
+        {
+            if (JPEG_PROGRESSIVE != dec.Mode())
+                return JPEG_ERR_BAD_DATA;
+
+            jerr = SetDestination(dec, pic, dstColor);
+            if (JPEG_OK != jerr)
+                return jerr;
+
+            coefs.assign((size_t)dec.m_numxMCU * dec.m_numyMCU * dec.m_nblock * DCTSIZE2, 0);
+        }
+
+        jerr = dec.ReadScanProgressive(coefs.data(), 0);
+        if (JPEG_OK != jerr)
+            return jerr;
+    }
+
+    return dec.ReconstructProgressive(coefs.data(), 0, dec.m_numyMCU);
+}
+
+static void ExpectSame(const Picture& ref, const Picture& pic)
+{
+    ASSERT_EQ(ref.width, pic.width);
+    ASSERT_EQ(ref.height, pic.height);
+
+    for (int c = 0; c < 3; c++)
+        EXPECT_TRUE(ref.plane[c] == pic.plane[c]) << "plane " << c;
+}
+
+static void CompareDecode(const char *baseline, const char *progressive, JCOLOR dstColor)
+{
+    std::vector<uint8_t> refStream = LoadFile(baseline);
+    std::vector<uint8_t> stream    = LoadFile(progressive);
+    ASSERT_FALSE(refStream.empty());
+    ASSERT_FALSE(stream.empty());
+
+    Picture ref, pic;
+    ASSERT_EQ(JPEG_OK, DecodeBaseline(refStream, ref, dstColor));
+    ASSERT_EQ(JPEG_OK, DecodeProgressive(stream, pic, dstColor));
+
+    ExpectSame(ref, pic);
+}
+
+TEST(JPEGProgressive, Decode420ToNV12)
+{
+    CompareDecode("baseline_420.jpg", "progressive_420.jpg", JC_NV12);
+}
+
+TEST(JPEGProgressive, Decode444ToBGRA)
+{
+    CompareDecode("baseline_444.jpg", "progressive_444.jpg", JC_BGRA);
+}
+
+TEST(JPEGProgressive, Decode444ToNV12)
+{
+    CompareDecode("baseline_444.jpg", "progressive_444.jpg", JC_NV12);
+}
+
+// The serial path has no progressive support, ReadData() must refuse it
+// instead of writing through an unset plane (the 4:2:0 file used to crash)
+TEST(JPEGProgressive, ReadDataIsRefused)
+{
+    std::vector<uint8_t> stream = LoadFile("progressive_420.jpg");
+    ASSERT_FALSE(stream.empty());
+
+    Picture pic;
+    EXPECT_EQ(JPEG_NOT_IMPLEMENTED, DecodeBaseline(stream, pic, JC_NV12));
+}
@@ -0,0 +1,99 @@
+// Copyright (c) 2020 Intel Corporation
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "jpeg_test_main.h"
+#include "mfx_mjpeg_task.h"
+
+#if defined (MFX_ENABLE_MJPEG_VIDEO_DECODE)
+
+// The SW MJPEG decoder keeps its free tasks over Reset only if they are set
+// up for the new parameters (VideoDECODEMJPEGBase_SW::Reset)
+
+static mfxVideoParam DecodeParams()
+{
+    mfxVideoParam par = {};
+    par.mfx.CodecId                = MFX_CODEC_JPEG;
+    par.mfx.FrameInfo.Width        = 1920;
+    par.mfx.FrameInfo.Height       = 1088;
+    par.mfx.FrameInfo.CropW        = 1920;
+    par.mfx.FrameInfo.CropH        = 1080;
+    par.mfx.FrameInfo.FourCC       = MFX_FOURCC_NV12;
+    par.mfx.FrameInfo.ChromaFormat = MFX_CHROMAFORMAT_YUV420;
+    par.mfx.FrameInfo.PicStruct    = MFX_PICSTRUCT_PROGRESSIVE;
+    par.mfx.JPEGChromaFormat       = MFX_CHROMAFORMAT_YUV420;
+    par.mfx.JPEGColorFormat        = MFX_JPEG_COLORFORMAT_YCbCr;
+    par.mfx.Rotation               = MFX_ROTATION_0;
+    return par;
+}
+
+TEST(JPEGTask, SameParamsKeepTasks)
+{
+    mfxVideoParam par = DecodeParams();
+    mfxVideoParam newPar = par;
+
+    // the crop and the stream properties the decoders do not depend on
+    newPar.mfx.FrameInfo.CropW = 1280;
+    newPar.mfx.FrameInfo.CropH = 720;
+    newPar.mfx.FrameInfo.FrameRateExtN = 60;
+    newPar.mfx.FrameInfo.FrameRateExtD = 1;
+    newPar.AsyncDepth = 8;
+
+    EXPECT_TRUE(CJpegTask::IsSameSetup(par, newPar));
+}
+
+TEST(JPEGTask, FrameSizeChangesTasks)
+{
+    mfxVideoParam par = DecodeParams();
+
+    mfxVideoParam newPar = par;
+    newPar.mfx.FrameInfo.Width = 1280;
+    EXPECT_FALSE(CJpegTask::IsSameSetup(par, newPar));
+
+    newPar = par;
+    newPar.mfx.FrameInfo.Height = 720;
+    EXPECT_FALSE(CJpegTask::IsSameSetup(par, newPar));
+}
+
+TEST(JPEGTask, OutputFormatChangesTasks)
+{
+    mfxVideoParam par = DecodeParams();
+
+    mfxVideoParam newPar = par;
+    newPar.mfx.FrameInfo.FourCC = MFX_FOURCC_RGB4;
+    EXPECT_FALSE(CJpegTask::IsSameSetup(par, newPar));
+
+    newPar = par;
+    newPar.mfx.FrameInfo.PicStruct = MFX_PICSTRUCT_FIELD_TFF;
+    EXPECT_FALSE(CJpegTask::IsSameSetup(par, newPar));
+
+    newPar = par;
+    newPar.mfx.Rotation = MFX_ROTATION_90;
+    EXPECT_FALSE(CJpegTask::IsSameSetup(par, newPar));
+
+    newPar = par;
+    newPar.mfx.JPEGChromaFormat = MFX_CHROMAFORMAT_YUV444;
+    EXPECT_FALSE(CJpegTask::IsSameSetup(par, newPar));
+
+    newPar = par;
+    newPar.mfx.JPEGColorFormat = MFX_JPEG_COLORFORMAT_RGB;
+    EXPECT_FALSE(CJpegTask::IsSameSetup(par, newPar));
+}
+
+#endif // MFX_ENABLE_MJPEG_VIDEO_DECODE
@@ -0,0 +1,210 @@
+// Copyright (c) 2020 Intel Corporation
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "scheduler_test_fixtures.h"
+
+// Records the calls of the completion callback
+struct CallbackRecord
+{
+    CallbackRecord()
+        : pScheduler(NULL)
+        , syncPoint(NULL)
+        , status(MFX_ERR_NONE)
+        , bGuardFree(false)
+        , pNextTask(NULL)
+        , nextSyncPoint(NULL)
+        , calls(0)
+    {
+    }
+
+    TestScheduler     *pScheduler;
+    mfxSyncPoint       syncPoint;
+    mfxStatus          status;
+    std::thread::id    threadId;
+    bool               bGuardFree;
+    // the task the callback adds, if any
+    TestTask          *pNextTask;
+    mfxSyncPoint       nextSyncPoint;
+    std::atomic<int>   calls;
+};
+
+static void MFX_CDECL RecordCallback(mfxHDL pthis, mfxSyncPoint syncPoint, mfxStatus status)
+{
+    CallbackRecord *pRecord = (CallbackRecord *) pthis;
+
+    pRecord->syncPoint = syncPoint;
+    pRecord->status = status;
+    pRecord->threadId = std::this_thread::get_id();
+
+    // other threads may take the guard for a moment, but the calling thread
+    // must not hold it
+    for (int i = 0; i < 100 && !pRecord->bGuardFree; i++)
+    {
+        if (pRecord->pScheduler && pRecord->pScheduler->m_guard.try_lock())
+        {
+            pRecord->pScheduler->m_guard.unlock();
+            pRecord->bGuardFree = true;
+        }
+        else
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
+
+    if (pRecord->pNextTask)
+    {
+        MFX_TASK task = {};
+        task.pOwner = pRecord->pNextTask;
+        task.entryPoint.pState = pRecord->pNextTask;
+        task.entryPoint.pParam = pRecord->pNextTask;
+        task.entryPoint.pRoutine = &TestTaskRoutine;
+        task.entryPoint.requiredNumThreads = 1;
+        task.threadingPolicy = MFX_TASK_THREADING_INTRA;
+        task.priority = MFX_PRIORITY_NORMAL;
+        pRecord->pScheduler->AddTask(task, &pRecord->nextSyncPoint);
+    }
+
+    pRecord->calls += 1;
+}
+
+TEST_F(SchedulerTest, CallbackFiresOnceWhenTaskIsDone)
+{
+    ASSERT_EQ(MFX_ERR_NONE, Initialize(4));
+
+    TestTask task(MFX_TASK_DONE, false);
+    CallbackRecord record;
+    mfxSyncPoint syncPoint = AddTask(task);
+    ASSERT_EQ(MFX_ERR_NONE, m_pScheduler->SetCompletionCallback(syncPoint, &RecordCallback, &record));
+    EXPECT_EQ(0, record.calls);
+
+    task.released = true;
+    ASSERT_TRUE(WaitFor([&record] { return 0 != record.calls; }));
+    EXPECT_EQ(syncPoint, record.syncPoint);
+    EXPECT_EQ(MFX_ERR_NONE, record.status);
+    EXPECT_NE(std::this_thread::get_id(), record.threadId);
+
+    // the next tasks do not call it again
+    TestTask next;
+    EXPECT_EQ(MFX_ERR_NONE, m_pScheduler->Synchronize(AddTask(next), 1000));
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    EXPECT_EQ(1, record.calls);
+}
+
+TEST_F(SchedulerTest, CallbackGetsStatusOfFailedTask)
+{
+    ASSERT_EQ(MFX_ERR_NONE, Initialize(4));
+
+    TestTask task(MFX_ERR_DEVICE_FAILED, false);
+    CallbackRecord record;
+    mfxSyncPoint syncPoint = AddTask(task);
+    ASSERT_EQ(MFX_ERR_NONE, m_pScheduler->SetCompletionCallback(syncPoint, &RecordCallback, &record));
+
+    task.released = true;
+    ASSERT_TRUE(WaitFor([&record] { return 0 != record.calls; }));
+    EXPECT_EQ(MFX_ERR_DEVICE_FAILED, record.status);
+}
+
+TEST_F(SchedulerTest, CallbackRunsOutOfGuard)
+{
+    ASSERT_EQ(MFX_ERR_NONE, Initialize(4));
+
+    TestTask task(MFX_TASK_DONE, false);
+    TestTask next;
+    CallbackRecord record;
+    record.pScheduler = m_pScheduler;
+    record.pNextTask = &next;
+    mfxSyncPoint syncPoint = AddTask(task);
+    ASSERT_EQ(MFX_ERR_NONE, m_pScheduler->SetCompletionCallback(syncPoint, &RecordCallback, &record));
+
+    task.released = true;
+    ASSERT_TRUE(WaitFor([&record] { return 0 != record.calls; }));
+    EXPECT_TRUE(record.bGuardFree);
+
+    // the callback may add the next task
+    ASSERT_NE(nullptr, record.nextSyncPoint);
+    EXPECT_EQ(MFX_ERR_NONE, m_pScheduler->Synchronize(record.nextSyncPoint, 1000));
+    EXPECT_EQ(1, next.calls);
+}
+
+TEST_F(SchedulerTest, CallbackOfDoneTaskFiresAtOnce)
+{
+    ASSERT_EQ(MFX_ERR_NONE, Initialize(4));
+
+    TestTask task;
+    CallbackRecord record;
+    record.pScheduler = m_pScheduler;
+    mfxSyncPoint syncPoint = AddTask(task);
+    ASSERT_EQ(MFX_ERR_NONE, m_pScheduler->Synchronize(syncPoint, 1000));
+
+    ASSERT_EQ(MFX_ERR_NONE, m_pScheduler->SetCompletionCallback(syncPoint, &RecordCallback, &record));
+    EXPECT_EQ(1, record.calls);
+    EXPECT_EQ(syncPoint, record.syncPoint);
+    EXPECT_EQ(MFX_ERR_NONE, record.status);
+    EXPECT_EQ(std::this_thread::get_id(), record.threadId);
+    EXPECT_TRUE(record.bGuardFree);
+}
+
+TEST_F(SchedulerTest, CallbackIsSetOncePerSyncPoint)
+{
+    ASSERT_EQ(MFX_ERR_NONE, Initialize(4));
+
+    TestTask task(MFX_TASK_DONE, false);
+    CallbackRecord first;
+    CallbackRecord second;
+    mfxSyncPoint syncPoint = AddTask(task);
+    ASSERT_EQ(MFX_ERR_NONE, m_pScheduler->SetCompletionCallback(syncPoint, &RecordCallback, &first));
+    EXPECT_EQ(MFX_ERR_UNDEFINED_BEHAVIOR, m_pScheduler->SetCompletionCallback(syncPoint, &RecordCallback, &second));
+
+    task.released = true;
+    ASSERT_TRUE(WaitFor([&first] { return 0 != first.calls; }));
+    EXPECT_EQ(0, second.calls);
+}
+
+TEST_F(SchedulerTest, CallbackRefusesInvalidParameters)
+{
+    TestTask task;
+    CallbackRecord record;
+    mfxSyncPoint unused = (mfxSyncPoint) (size_t) (MFX_MAX_NUMBER_TASK - 1);
+
+    EXPECT_EQ(MFX_ERR_NOT_INITIALIZED, m_pScheduler->SetCompletionCallback(unused, &RecordCallback, &record));
+
+    ASSERT_EQ(MFX_ERR_NONE, Initialize(4));
+    mfxSyncPoint syncPoint = AddTask(task);
+
+    EXPECT_EQ(MFX_ERR_NULL_PTR, m_pScheduler->SetCompletionCallback(NULL, &RecordCallback, &record));
+    EXPECT_EQ(MFX_ERR_NULL_PTR, m_pScheduler->SetCompletionCallback(syncPoint, NULL, &record));
+    EXPECT_EQ(MFX_ERR_NULL_PTR, m_pScheduler->SetCompletionCallback(unused, &RecordCallback, &record));
+
+    EXPECT_EQ(MFX_ERR_NONE, m_pScheduler->Synchronize(syncPoint, 1000));
+    EXPECT_EQ(0, record.calls);
+}
+
+TEST_F(SchedulerTest, CallbackIsRefusedInSingleThreadMode)
+{
+    ASSERT_EQ(MFX_ERR_NONE, Initialize(1, MFX_SINGLE_THREAD));
+
+    TestTask task;
+    CallbackRecord record;
+    mfxSyncPoint syncPoint = AddTask(task);
+
+    EXPECT_EQ(MFX_ERR_UNSUPPORTED, m_pScheduler->SetCompletionCallback(syncPoint, &RecordCallback, &record));
+    EXPECT_EQ(MFX_ERR_NONE, m_pScheduler->Synchronize(syncPoint, 1000));
+    EXPECT_EQ(0, record.calls);
+}
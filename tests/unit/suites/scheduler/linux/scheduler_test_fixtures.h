@@ -0,0 +1,131 @@
+// Copyright (c) 2020 Intel Corporation
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef SCHEDULER_TEST_FIXTURES_H
+#define SCHEDULER_TEST_FIXTURES_H
+
+#include "scheduler_test_main.h"
+#include <mfx_scheduler_core.h>
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+// Parameter of the test task, the routine marks the task started, waits
+// until it is released and returns the status
+struct TestTask
+{
+    explicit TestTask(mfxStatus sts = MFX_TASK_DONE, bool bReleased = true)
+        : status(sts)
+        , released(bReleased)
+        , started(false)
+        , calls(0)
+    {
+    }
+
+    std::atomic<mfxStatus> status;
+    std::atomic<bool>      released;
+    std::atomic<bool>      started;
+    std::atomic<int>       calls;
+};
+
+inline mfxStatus TestTaskRoutine(void *, void *pParam, mfxU32, mfxU32)
+{
+    TestTask *pTask = (TestTask *) pParam;
+
+    pTask->started = true;
+    while (!pTask->released)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    pTask->calls += 1;
+
+    return pTask->status;
+}
+
+// Polls the predicate for about a second
+template <class Predicate>
+inline bool WaitFor(Predicate predicate)
+{
+    for (int i = 0; i < 1000; i++)
+    {
+        if (predicate())
+            return true;
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    return predicate();
+}
+
+// Exposes the protected parts of the scheduler
+class TestScheduler : public mfxSchedulerCore
+{
+public:
+    using mfxSchedulerCore::ReuseThreads;
+    using mfxSchedulerCore::m_guard;
+};
+
+class SchedulerTest : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        m_pScheduler = new TestScheduler;
+    }
+
+    void TearDown() override
+    {
+        if (m_pScheduler)
+            m_pScheduler->Release();
+    }
+
+    static MFX_SCHEDULER_PARAM2 Param(mfxU32 numberOfThreads, mfxSchedulerFlags flags = MFX_SCHEDULER_DEFAULT)
+    {
+        MFX_SCHEDULER_PARAM2 param = {};
+        param.flags = flags;
+        param.numberOfThreads = numberOfThreads;
+        return param;
+    }
+
+    mfxStatus Initialize(mfxU32 numberOfThreads, mfxSchedulerFlags flags = MFX_SCHEDULER_DEFAULT)
+    {
+        MFX_SCHEDULER_PARAM2 param = Param(numberOfThreads, flags);
+        return m_pScheduler->Initialize2(&param);
+    }
+
+    mfxSyncPoint AddTask(TestTask &task)
+    {
+        MFX_TASK mfxTask = {};
+        mfxTask.pOwner = &task;
+        mfxTask.entryPoint.pState = &task;
+        mfxTask.entryPoint.pParam = &task;
+        mfxTask.entryPoint.pRoutine = &TestTaskRoutine;
+        mfxTask.entryPoint.requiredNumThreads = 1;
+        mfxTask.threadingPolicy = MFX_TASK_THREADING_INTRA;
+        mfxTask.priority = MFX_PRIORITY_NORMAL;
+
+        mfxSyncPoint syncPoint = NULL;
+        EXPECT_EQ(MFX_ERR_NONE, m_pScheduler->AddTask(mfxTask, &syncPoint));
+        return syncPoint;
+    }
+
+    TestScheduler *m_pScheduler;
+};
+
+#endif /* SCHEDULER_TEST_FIXTURES_H */
@@ -0,0 +1,198 @@
+// Copyright (c) 2020 Intel Corporation
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "scheduler_test_fixtures.h"
+#include <mfx_scheduler_pool.h>
+
+#include <stdlib.h>
+
+// Sets MFX_SCHEDULER_POOL_SIZE while the object lives, NULL unsets it
+class PoolSizeVariable
+{
+public:
+    explicit PoolSizeVariable(const char *value)
+    {
+        if (value)
+            setenv("MFX_SCHEDULER_POOL_SIZE", value, 1);
+        else
+            unsetenv("MFX_SCHEDULER_POOL_SIZE");
+    }
+
+    ~PoolSizeVariable()
+    {
+        unsetenv("MFX_SCHEDULER_POOL_SIZE");
+    }
+};
+
+TEST(SchedulerPool, SizeDefaultsWithoutVariable)
+{
+    PoolSizeVariable variable(NULL);
+    SchedulerPool pool;
+
+    EXPECT_EQ((size_t) MFX_SCHEDULER_POOL_SIZE, pool.Size());
+}
+
+TEST(SchedulerPool, SizeIsReadFromVariable)
+{
+    const char *values[] = { "0", "1", "64" };
+    const size_t sizes[] = { 0, 1, 64 };
+
+    for (size_t i = 0; i < sizeof(values) / sizeof(values[0]); i++)
+    {
+        PoolSizeVariable variable(values[i]);
+        SchedulerPool pool;
+
+        EXPECT_EQ(sizes[i], pool.Size()) << values[i];
+    }
+}
+
+TEST(SchedulerPool, InvalidSizeIsIgnored)
+{
+    const char *values[] = { "", "65", "-1", "4x", "x" };
+
+    for (const char *value : values)
+    {
+        PoolSizeVariable variable(value);
+        SchedulerPool pool;
+
+        EXPECT_EQ((size_t) MFX_SCHEDULER_POOL_SIZE, pool.Size()) << value;
+    }
+}
+
+TEST_F(SchedulerTest, PoolTakesParkedScheduler)
+{
+    PoolSizeVariable variable("2");
+    SchedulerPool pool;
+    ASSERT_EQ(MFX_ERR_NONE, Initialize(4));
+
+    TestTask task;
+    EXPECT_EQ(MFX_ERR_NONE, m_pScheduler->Synchronize(AddTask(task), 1000));
+
+    ASSERT_TRUE(pool.Park(m_pScheduler));
+    ASSERT_EQ(static_cast<MFXIUnknown *>(m_pScheduler), pool.Take(4));
+    EXPECT_EQ(nullptr, pool.Take(4));
+}
+
+TEST_F(SchedulerTest, PoolRefusesSharedScheduler)
+{
+    PoolSizeVariable variable("2");
+    SchedulerPool pool;
+    ASSERT_EQ(MFX_ERR_NONE, Initialize(4));
+
+    m_pScheduler->AddRef();
+    EXPECT_FALSE(pool.Park(m_pScheduler));
+    m_pScheduler->Release();
+}
+
+TEST_F(SchedulerTest, PoolRefusesBusyScheduler)
+{
+    PoolSizeVariable variable("2");
+    SchedulerPool pool;
+    ASSERT_EQ(MFX_ERR_NONE, Initialize(4));
+
+    TestTask task(MFX_TASK_DONE, false);
+    mfxSyncPoint syncPoint = AddTask(task);
+    EXPECT_FALSE(pool.Park(m_pScheduler));
+
+    task.released = true;
+    EXPECT_EQ(MFX_ERR_NONE, m_pScheduler->Synchronize(syncPoint, 1000));
+}
+
+TEST_F(SchedulerTest, PoolRefusesSingleThreadScheduler)
+{
+    PoolSizeVariable variable("2");
+    SchedulerPool pool;
+    ASSERT_EQ(MFX_ERR_NONE, Initialize(1, MFX_SINGLE_THREAD));
+
+    EXPECT_FALSE(pool.Park(m_pScheduler));
+}
+
+TEST_F(SchedulerTest, PoolKeepsAtMostItsSize)
+{
+    PoolSizeVariable variable("1");
+    SchedulerPool pool;
+    ASSERT_EQ(MFX_ERR_NONE, Initialize(2));
+
+    TestScheduler *pOther = new TestScheduler;
+    MFX_SCHEDULER_PARAM2 param = Param(2);
+    ASSERT_EQ(MFX_ERR_NONE, pOther->Initialize2(&param));
+
+    ASSERT_TRUE(pool.Park(m_pScheduler));
+    EXPECT_FALSE(pool.Park(pOther));
+    pOther->Release();
+
+    ASSERT_EQ(static_cast<MFXIUnknown *>(m_pScheduler), pool.Take(2));
+}
+
+TEST_F(SchedulerTest, PoolIsDisabledBySizeZero)
+{
+    PoolSizeVariable variable("0");
+    SchedulerPool pool;
+    ASSERT_EQ(MFX_ERR_NONE, Initialize(2));
+
+    EXPECT_FALSE(pool.Park(m_pScheduler));
+    EXPECT_EQ(nullptr, pool.Take(2));
+}
+
+TEST_F(SchedulerTest, PoolPrefersSameNumberOfThreads)
+{
+    PoolSizeVariable variable("2");
+    SchedulerPool pool;
+    ASSERT_EQ(MFX_ERR_NONE, Initialize(2));
+
+    TestScheduler *pOther = new TestScheduler;
+    MFX_SCHEDULER_PARAM2 param = Param(3);
+    ASSERT_EQ(MFX_ERR_NONE, pOther->Initialize2(&param));
+
+    ASSERT_TRUE(pool.Park(m_pScheduler));
+    ASSERT_TRUE(pool.Park(pOther));
+
+    // the scheduler parked first matches, the latest one is taken otherwise
+    ASSERT_EQ(static_cast<MFXIUnknown *>(m_pScheduler), pool.Take(2));
+    ASSERT_EQ(static_cast<MFXIUnknown *>(pOther), pool.Take(4));
+    EXPECT_EQ(nullptr, pool.Take(2));
+
+    pOther->Release();
+}
+
+TEST_F(SchedulerTest, PoolSchedulerIsReusedAfterClose)
+{
+    PoolSizeVariable variable("2");
+    SchedulerPool pool;
+    ASSERT_EQ(MFX_ERR_NONE, Initialize(4));
+
+    TestTask first;
+    EXPECT_EQ(MFX_ERR_NONE, m_pScheduler->Synchronize(AddTask(first), 1000));
+
+    // the session is closed and the next one takes the scheduler
+    ASSERT_TRUE(pool.Park(m_pScheduler));
+    ASSERT_EQ(static_cast<MFXIUnknown *>(m_pScheduler), pool.Take(4));
+    EXPECT_TRUE(m_pScheduler->ReuseThreads(Param(4)));
+    ASSERT_EQ(MFX_ERR_NONE, Initialize(4));
+
+    MFX_SCHEDULER_METRICS metrics = {};
+    ASSERT_EQ(MFX_ERR_NONE, m_pScheduler->GetMetrics(&metrics));
+    EXPECT_EQ(4u, metrics.numberOfThreads);
+    EXPECT_EQ(0u, metrics.tasksCompleted);
+
+    TestTask second;
+    EXPECT_EQ(MFX_ERR_NONE, m_pScheduler->Synchronize(AddTask(second), 1000));
+    EXPECT_EQ(1, second.calls);
+}
@@ -0,0 +1,108 @@
+// Copyright (c) 2020 Intel Corporation
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "scheduler_test_fixtures.h"
+
+// The completion callback blocks the calling thread until it is released
+struct BlockingCallback
+{
+    BlockingCallback()
+        : entered(false)
+        , released(false)
+    {
+    }
+
+    std::atomic<bool> entered;
+    std::atomic<bool> released;
+};
+
+static void MFX_CDECL BlockingCallbackProc(mfxHDL pthis, mfxSyncPoint, mfxStatus)
+{
+    BlockingCallback *pCallback = (BlockingCallback *) pthis;
+
+    pCallback->entered = true;
+    while (!pCallback->released)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+}
+
+TEST_F(SchedulerTest, ReuseThreadsOfIdleScheduler)
+{
+    ASSERT_EQ(MFX_ERR_NONE, Initialize(4));
+
+    TestTask first;
+    EXPECT_EQ(MFX_ERR_NONE, m_pScheduler->Synchronize(AddTask(first), 1000));
+
+    EXPECT_TRUE(m_pScheduler->ReuseThreads(Param(4)));
+
+    TestTask second;
+    EXPECT_EQ(MFX_ERR_NONE, m_pScheduler->Synchronize(AddTask(second), 1000));
+
+    MFX_SCHEDULER_METRICS metrics = {};
+    ASSERT_EQ(MFX_ERR_NONE, m_pScheduler->GetMetrics(&metrics));
+    EXPECT_EQ(1u, metrics.tasksCompleted);
+}
+
+TEST_F(SchedulerTest, ReuseThreadsRefusesOtherParameters)
+{
+    EXPECT_FALSE(m_pScheduler->ReuseThreads(Param(4)));
+
+    ASSERT_EQ(MFX_ERR_NONE, Initialize(4));
+
+    MFX_SCHEDULER_PARAM2 param = Param(4);
+    param.params.Priority = 1;
+    EXPECT_FALSE(m_pScheduler->ReuseThreads(Param(3)));
+    EXPECT_FALSE(m_pScheduler->ReuseThreads(Param(4, MFX_SINGLE_THREAD)));
+    EXPECT_FALSE(m_pScheduler->ReuseThreads(param));
+    EXPECT_TRUE(m_pScheduler->ReuseThreads(Param(4)));
+}
+
+TEST_F(SchedulerTest, ReuseThreadsRefusesTaskInExecution)
+{
+    ASSERT_EQ(MFX_ERR_NONE, Initialize(4));
+
+    TestTask task(MFX_TASK_DONE, false);
+    mfxSyncPoint syncPoint = AddTask(task);
+    EXPECT_FALSE(m_pScheduler->ReuseThreads(Param(4)));
+
+    task.released = true;
+    EXPECT_EQ(MFX_ERR_NONE, m_pScheduler->Synchronize(syncPoint, 1000));
+    EXPECT_TRUE(m_pScheduler->ReuseThreads(Param(4)));
+}
+
+TEST_F(SchedulerTest, ReuseThreadsRefusesRunningCallback)
+{
+    ASSERT_EQ(MFX_ERR_NONE, Initialize(4));
+
+    TestTask task(MFX_TASK_DONE, false);
+    BlockingCallback callback;
+    mfxSyncPoint syncPoint = AddTask(task);
+    ASSERT_EQ(MFX_ERR_NONE, m_pScheduler->SetCompletionCallback(syncPoint, &BlockingCallbackProc, &callback));
+
+    task.released = true;
+    ASSERT_TRUE(WaitFor([&callback] { return (bool) callback.entered; }));
+
+    // the callback is out of the list, but it is still running
+    EXPECT_FALSE(m_pScheduler->ReuseThreads(Param(4)));
+
+    callback.released = true;
+    EXPECT_TRUE(WaitFor([this] { return m_pScheduler->ReuseThreads(Param(4)); }));
+}
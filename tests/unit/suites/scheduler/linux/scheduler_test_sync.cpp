@@ -0,0 +1,180 @@
+// Copyright (c) 2020 Intel Corporation
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "scheduler_test_fixtures.h"
+
+#include <time.h>
+
+// CPU time of the calling thread in milliseconds
+static double ThreadTime()
+{
+    struct timespec time = {};
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &time);
+    return time.tv_sec * 1000.0 + time.tv_nsec / 1000000.0;
+}
+
+TEST_F(SchedulerTest, SynchronizeMultiWaitsForAll)
+{
+    ASSERT_EQ(MFX_ERR_NONE, Initialize(4));
+
+    TestTask tasks[3];
+    mfxSyncPoint syncPoints[3];
+    mfxStatus status[3];
+    for (int i = 0; i < 3; i++)
+        syncPoints[i] = AddTask(tasks[i]);
+
+    EXPECT_EQ(MFX_ERR_NONE, m_pScheduler->SynchronizeMulti(syncPoints, 3, true, 1000, status));
+    for (int i = 0; i < 3; i++)
+    {
+        EXPECT_EQ(MFX_ERR_NONE, status[i]);
+        EXPECT_EQ(1, tasks[i].calls);
+    }
+}
+
+TEST_F(SchedulerTest, SynchronizeMultiWaitsForAny)
+{
+    ASSERT_EQ(MFX_ERR_NONE, Initialize(4));
+
+    TestTask done;
+    TestTask blocked(MFX_TASK_DONE, false);
+    mfxSyncPoint syncPoints[2] = { AddTask(blocked), NULL };
+    mfxStatus status[2];
+
+    // the next task wakes up another thread once the first one is running
+    ASSERT_TRUE(WaitFor([&blocked] { return (bool) blocked.started; }));
+    syncPoints[1] = AddTask(done);
+
+    EXPECT_EQ(MFX_ERR_NONE, m_pScheduler->SynchronizeMulti(syncPoints, 2, false, 1000, status));
+    EXPECT_EQ(MFX_WRN_IN_EXECUTION, status[0]);
+    EXPECT_EQ(MFX_ERR_NONE, status[1]);
+
+    blocked.released = true;
+    EXPECT_EQ(MFX_ERR_NONE, m_pScheduler->SynchronizeMulti(syncPoints, 2, true, 1000, status));
+}
+
+TEST_F(SchedulerTest, SynchronizeMultiReportsFailedTask)
+{
+    ASSERT_EQ(MFX_ERR_NONE, Initialize(4));
+
+    TestTask done;
+    TestTask failed(MFX_ERR_DEVICE_FAILED);
+    mfxSyncPoint syncPoints[2] = { AddTask(done), AddTask(failed) };
+    mfxStatus status[2];
+
+    EXPECT_EQ(MFX_ERR_NONE, m_pScheduler->SynchronizeMulti(syncPoints, 2, true, 1000, status));
+    EXPECT_EQ(MFX_ERR_NONE, status[0]);
+    EXPECT_EQ(MFX_ERR_DEVICE_FAILED, status[1]);
+}
+
+TEST_F(SchedulerTest, SynchronizeMultiTimesOut)
+{
+    ASSERT_EQ(MFX_ERR_NONE, Initialize(4));
+
+    TestTask blocked(MFX_TASK_DONE, false);
+    mfxSyncPoint syncPoint = AddTask(blocked);
+    mfxStatus status = MFX_ERR_NONE;
+
+    auto start = std::chrono::steady_clock::now();
+    EXPECT_EQ(MFX_WRN_IN_EXECUTION, m_pScheduler->SynchronizeMulti(&syncPoint, 1, true, 50, &status));
+    EXPECT_GE(std::chrono::steady_clock::now() - start, std::chrono::milliseconds(50));
+    EXPECT_EQ(MFX_WRN_IN_EXECUTION, status);
+
+    blocked.released = true;
+    EXPECT_EQ(MFX_ERR_NONE, m_pScheduler->SynchronizeMulti(&syncPoint, 1, true, 1000, &status));
+}
+
+TEST_F(SchedulerTest, SynchronizeMultiRefusesInvalidSyncPoints)
+{
+    TestTask task;
+    mfxSyncPoint syncPoints[2] = {};
+    mfxStatus status[2];
+
+    EXPECT_EQ(MFX_ERR_NOT_INITIALIZED, m_pScheduler->SynchronizeMulti(syncPoints, 1, true, 10, status));
+
+    ASSERT_EQ(MFX_ERR_NONE, Initialize(4));
+    syncPoints[0] = AddTask(task);
+
+    EXPECT_EQ(MFX_ERR_NULL_PTR, m_pScheduler->SynchronizeMulti(NULL, 1, true, 10, status));
+    EXPECT_EQ(MFX_ERR_NULL_PTR, m_pScheduler->SynchronizeMulti(syncPoints, 1, true, 10, NULL));
+    EXPECT_EQ(MFX_ERR_NULL_PTR, m_pScheduler->SynchronizeMulti(syncPoints, 2, true, 10, status));
+
+    // a task slot which was never used
+    syncPoints[1] = (mfxSyncPoint) (size_t) (MFX_MAX_NUMBER_TASK - 1);
+    EXPECT_EQ(MFX_ERR_NULL_PTR, m_pScheduler->SynchronizeMulti(syncPoints, 2, true, 10, status));
+
+    EXPECT_EQ(MFX_ERR_NONE, m_pScheduler->SynchronizeMulti(syncPoints, 0, true, 10, status));
+    EXPECT_EQ(MFX_ERR_NONE, m_pScheduler->SynchronizeMulti(syncPoints, 1, true, 1000, status));
+}
+
+TEST_F(SchedulerTest, SingleThreadSynchronizeMultiRunsTasks)
+{
+    ASSERT_EQ(MFX_ERR_NONE, Initialize(1, MFX_SINGLE_THREAD));
+
+    TestTask done[2];
+    TestTask failed(MFX_ERR_DEVICE_FAILED);
+    mfxSyncPoint syncPoints[3] = { AddTask(done[0]), AddTask(failed), AddTask(done[1]) };
+    mfxStatus status[3];
+
+    EXPECT_EQ(MFX_ERR_NONE, m_pScheduler->SynchronizeMulti(syncPoints, 3, true, 1000, status));
+    EXPECT_EQ(MFX_ERR_NONE, status[0]);
+    EXPECT_EQ(MFX_ERR_DEVICE_FAILED, status[1]);
+    EXPECT_EQ(MFX_ERR_NONE, status[2]);
+    EXPECT_EQ(1, done[0].calls);
+    EXPECT_EQ(1, failed.calls);
+    EXPECT_EQ(1, done[1].calls);
+}
+
+TEST_F(SchedulerTest, SingleThreadSynchronizeMultiTimesOut)
+{
+    ASSERT_EQ(MFX_ERR_NONE, Initialize(1, MFX_SINGLE_THREAD));
+
+    TestTask busy(MFX_TASK_BUSY);
+    mfxSyncPoint syncPoint = AddTask(busy);
+    mfxStatus status = MFX_ERR_NONE;
+
+    EXPECT_EQ(MFX_WRN_IN_EXECUTION, m_pScheduler->SynchronizeMulti(&syncPoint, 1, true, 50, &status));
+    EXPECT_EQ(MFX_WRN_IN_EXECUTION, status);
+    EXPECT_LT(0, busy.calls);
+
+    busy.status = MFX_TASK_DONE;
+    EXPECT_EQ(MFX_ERR_NONE, m_pScheduler->SynchronizeMulti(&syncPoint, 1, true, 1000, &status));
+    EXPECT_EQ(MFX_ERR_NONE, status);
+}
+
+TEST_F(SchedulerTest, SingleThreadSynchronizeMultiSleepsWithoutReadyTask)
+{
+    ASSERT_EQ(MFX_ERR_NONE, Initialize(1, MFX_SINGLE_THREAD));
+
+    TestTask blocked(MFX_TASK_DONE, false);
+    mfxSyncPoint syncPoint = AddTask(blocked);
+
+    // another thread runs the task, there is nothing to run meanwhile
+    std::thread runner([this, syncPoint] { m_pScheduler->Synchronize(syncPoint, 10000); });
+    ASSERT_TRUE(WaitFor([&blocked] { return (bool) blocked.started; }));
+
+    mfxStatus status = MFX_ERR_NONE;
+    double start = ThreadTime();
+    EXPECT_EQ(MFX_WRN_IN_EXECUTION, m_pScheduler->SynchronizeMulti(&syncPoint, 1, true, 200, &status));
+    EXPECT_LT(ThreadTime() - start, 100.0);
+
+    blocked.released = true;
+    runner.join();
+    EXPECT_EQ(MFX_ERR_NONE, m_pScheduler->SynchronizeMulti(&syncPoint, 1, true, 1000, &status));
+}
@@ -0,0 +1,270 @@
+// Copyright (c) 2020 Intel Corporation
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "umc_alloc_test_main.h"
+#include "mfx_umc_alloc_wrapper.h"
+
+#include <atomic>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Core with system memory frames, counts the surface locks the allocator does
+class TestCore : public VideoCORE
+{
+public:
+    static const mfxU32 PITCH = 64;
+
+    TestCore(mfxU32 numFrames)
+        : m_memory(numFrames * PITCH * PITCH * 3 / 2)
+        , m_lockUnderflows(0)
+        , m_frameLocks(0)
+    {}
+
+    mfxU8* FrameMemory(mfxMemId mid) { return &m_memory[((size_t)mid - 1) * PITCH * PITCH * 3 / 2]; }
+
+    mfxStatus IncreasePureReference(mfxU16 &locked) override
+    {
+        std::lock_guard<std::mutex> guard(m_mutex);
+        locked++;
+        return MFX_ERR_NONE;
+    }
+
+    mfxStatus DecreasePureReference(mfxU16 &locked) override
+    {
+        std::lock_guard<std::mutex> guard(m_mutex);
+        if (!locked)
+        {
+            m_lockUnderflows++;
+            return MFX_ERR_LOCK_MEMORY;
+        }
+        locked--;
+        return MFX_ERR_NONE;
+    }
+
+    mfxStatus IncreaseReference(mfxFrameData *ptr, bool) override { return IncreasePureReference(ptr->Locked); }
+    mfxStatus DecreaseReference(mfxFrameData *ptr, bool) override { return DecreasePureReference(ptr->Locked); }
+
+    mfxStatus LockFrame(mfxMemId mid, mfxFrameData *ptr) override
+    {
+        m_frameLocks++;
+        ptr->Y = FrameMemory(mid);
+        ptr->UV = ptr->Y + PITCH * PITCH;
+        ptr->PitchHigh = 0;
+        ptr->PitchLow = PITCH;
+        return MFX_ERR_NONE;
+    }
+
+    mfxStatus UnlockFrame(mfxMemId, mfxFrameData *) override
+    {
+        m_frameLocks--;
+        return MFX_ERR_NONE;
+    }
+
+    mfxMemId MapIdx(mfxMemId mid) override { return mid; }
+    void* QueryCoreInterface(const MFX_GUID &) override { return nullptr; }
+    void SetWrapper(void*) override {}
+
+    mfxStatus GetHandle(mfxHandleType, mfxHDL *) override { return MFX_ERR_UNSUPPORTED; }
+    mfxStatus SetHandle(mfxHandleType, mfxHDL) override { return MFX_ERR_UNSUPPORTED; }
+    mfxStatus SetBufferAllocator(mfxBufferAllocator *) override { return MFX_ERR_UNSUPPORTED; }
+    mfxStatus SetFrameAllocator(mfxFrameAllocator *) override { return MFX_ERR_UNSUPPORTED; }
+    mfxStatus AllocBuffer(mfxU32, mfxU16, mfxMemId *) override { return MFX_ERR_UNSUPPORTED; }
+    mfxStatus LockBuffer(mfxMemId, mfxU8 **) override { return MFX_ERR_UNSUPPORTED; }
+    mfxStatus UnlockBuffer(mfxMemId) override { return MFX_ERR_UNSUPPORTED; }
+    mfxStatus FreeBuffer(mfxMemId) override { return MFX_ERR_UNSUPPORTED; }
+    mfxStatus CheckHandle() override { return MFX_ERR_NONE; }
+    mfxStatus GetFrameHDL(mfxMemId, mfxHDL *, bool) override { return MFX_ERR_UNSUPPORTED; }
+    mfxStatus AllocFrames(mfxFrameAllocRequest *, mfxFrameAllocResponse *, bool) override { return MFX_ERR_UNSUPPORTED; }
+    mfxStatus AllocFrames(mfxFrameAllocRequest *, mfxFrameAllocResponse *, mfxFrameSurface1 **, mfxU32) override { return MFX_ERR_UNSUPPORTED; }
+    mfxStatus FreeFrames(mfxFrameAllocResponse *, bool) override { return MFX_ERR_UNSUPPORTED; }
+    mfxStatus LockExternalFrame(mfxMemId, mfxFrameData *, bool) override { return MFX_ERR_UNSUPPORTED; }
+    mfxStatus GetExternalFrameHDL(mfxMemId, mfxHDL *, bool) override { return MFX_ERR_UNSUPPORTED; }
+    mfxStatus UnlockExternalFrame(mfxMemId, mfxFrameData *, bool) override { return MFX_ERR_UNSUPPORTED; }
+    mfxFrameSurface1* GetNativeSurface(mfxFrameSurface1 *, bool) override { return nullptr; }
+    mfxFrameSurface1* GetOpaqSurface(mfxMemId, bool) override { return nullptr; }
+    void GetVA(mfxHDL* phdl, mfxU16) override { *phdl = nullptr; }
+    mfxStatus CreateVA(mfxVideoParam *, mfxFrameAllocRequest *, mfxFrameAllocResponse *, UMC::FrameAllocator *) override { return MFX_ERR_UNSUPPORTED; }
+    mfxU32 GetAdapterNumber(void) override { return 0; }
+    void GetVideoProcessing(mfxHDL* phdl) override { *phdl = nullptr; }
+    mfxStatus CreateVideoProcessing(mfxVideoParam *) override { return MFX_ERR_UNSUPPORTED; }
+    eMFXPlatform GetPlatformType() override { return MFX_PLATFORM_SOFTWARE; }
+    mfxU32 GetNumWorkingThreads(void) override { return 1; }
+    void INeedMoreThreadsInside(const void *) override {}
+    mfxStatus DoFastCopy(mfxFrameSurface1 *, mfxFrameSurface1 *) override { return MFX_ERR_UNSUPPORTED; }
+    mfxStatus DoFastCopyExtended(mfxFrameSurface1 *, mfxFrameSurface1 *) override { return MFX_ERR_UNSUPPORTED; }
+    mfxStatus DoFastCopyWrapper(mfxFrameSurface1 *, mfxU16, mfxFrameSurface1 *, mfxU16) override { return MFX_ERR_UNSUPPORTED; }
+    bool IsFastCopyEnabled(void) override { return false; }
+    bool IsExternalFrameAllocator(void) const override { return false; }
+    eMFXHWType GetHWType() override { return MFX_HW_UNKNOWN; }
+    bool SetCoreId(mfxU32) override { return false; }
+    eMFXVAType GetVAType() const override { return MFX_HW_NO; }
+    mfxStatus CopyFrame(mfxFrameSurface1 *, mfxFrameSurface1 *) override { return MFX_ERR_UNSUPPORTED; }
+    mfxStatus CopyBuffer(mfxU8 *, mfxU32, mfxFrameSurface1 *) override { return MFX_ERR_UNSUPPORTED; }
+    mfxStatus CopyFrameEx(mfxFrameSurface1 *, mfxU16, mfxFrameSurface1 *, mfxU16) override { return MFX_ERR_UNSUPPORTED; }
+    mfxStatus IsGuidSupported(const GUID, mfxVideoParam *, bool) override { return MFX_ERR_UNSUPPORTED; }
+    bool CheckOpaqueRequest(mfxFrameAllocRequest *, mfxFrameSurface1 **, mfxU32, bool) override { return false; }
+    bool IsOpaqSurfacesAlreadyMapped(mfxFrameSurface1 **, mfxU32, mfxFrameAllocResponse *, bool) override { return false; }
+    mfxSession GetSession() override { return nullptr; }
+    mfxU16 GetAutoAsyncDepth() override { return 1; }
+    bool IsCompatibleForOpaq() override { return false; }
+
+    std::vector<mfxU8> m_memory;
+    std::mutex         m_mutex;
+    mfxU32             m_lockUnderflows;
+    std::atomic<int>   m_frameLocks;
+};
+
+class UMCAllocStress : public ::testing::Test
+{
+protected:
+    static const mfxU32 NUM_FRAMES  = 8;
+    static const mfxU32 NUM_THREADS = 4;
+    static const mfxU32 ITERATIONS  = 4000;
+
+    UMCAllocStress()
+        : m_core(NUM_FRAMES)
+        , m_par()
+        , m_request()
+        , m_response()
+        , m_mids(NUM_FRAMES)
+        , m_surfaces(NUM_FRAMES)
+    {
+        m_par.mfx.FrameInfo.FourCC       = MFX_FOURCC_NV12;
+        m_par.mfx.FrameInfo.ChromaFormat = MFX_CHROMAFORMAT_YUV420;
+        m_par.mfx.FrameInfo.Width        = TestCore::PITCH;
+        m_par.mfx.FrameInfo.Height       = TestCore::PITCH;
+        m_par.IOPattern                  = MFX_IOPATTERN_OUT_SYSTEM_MEMORY;
+
+        for (mfxU32 i = 0; i < NUM_FRAMES; i++)
+        {
+            m_mids[i] = (mfxMemId)(size_t)(i + 1);
+            m_surfaces[i].Info = m_par.mfx.FrameInfo;
+        }
+
+        m_request.Info = m_par.mfx.FrameInfo;
+        m_request.Type = MFX_MEMTYPE_INTERNAL_FRAME | MFX_MEMTYPE_SYSTEM_MEMORY;
+        m_response.mids = m_mids.data();
+        m_response.NumFrameActual = NUM_FRAMES;
+    }
+
+    void SetUp() override
+    {
+        ASSERT_EQ(UMC::UMC_OK, m_alloc.InitMfx(0, &m_core, &m_par, &m_request, &m_response, false, true));
+        ASSERT_EQ(UMC::UMC_OK, m_info.Init(TestCore::PITCH, TestCore::PITCH, UMC::NV12, 8));
+    }
+
+    TestCore                      m_core;
+    mfxVideoParam                 m_par;
+    mfxFrameAllocRequest          m_request;
+    mfxFrameAllocResponse         m_response;
+    std::vector<mfxMemId>         m_mids;
+    std::vector<mfxFrameSurface1> m_surfaces;
+    UMC::VideoDataInfo            m_info;
+    mfx_UMC_FrameAllocator        m_alloc;
+};
+
+// Each thread allocates frames and hands one reference of them to the other
+// threads, the owner and the borrower release theirs concurrently and only
+// the last one frees the frame. Meanwhile the output surfaces are looked up.
+TEST_F(UMCAllocStress, ParallelAllocReferencesAndLookups)
+{
+    std::atomic<bool> inUse[NUM_FRAMES];
+    for (auto &used : inUse)
+        used = false;
+
+    std::mutex                    lentMutex;
+    std::deque<UMC::FrameMemID>   lent;
+    std::atomic<mfxU32>           allocs(0);
+
+    auto worker = [&](mfxU32 seed)
+    {
+        std::mt19937 rnd(seed);
+
+        for (mfxU32 i = 0; i < ITERATIONS; i++)
+        {
+            UMC::FrameMemID mid = UMC::FRAME_MID_INVALID;
+            while (m_alloc.Alloc(&mid, &m_info, 0) != UMC::UMC_OK)
+                std::this_thread::yield();
+
+            allocs++;
+            EXPECT_FALSE(inUse[mid].exchange(true)) << "frame " << mid << " allocated twice";
+
+            // references of the owner and of the borrower
+            EXPECT_EQ(UMC::UMC_OK, m_alloc.IncreaseReference(mid));
+            EXPECT_EQ(UMC::UMC_OK, m_alloc.IncreaseReference(mid));
+            EXPECT_EQ(&m_surfaces[mid], m_alloc.GetSurface(mid, &m_surfaces[mid], &m_par));
+
+            UMC::FrameMemID borrowed = UMC::FRAME_MID_INVALID;
+            {
+                std::lock_guard<std::mutex> guard(lentMutex);
+                lent.push_back(mid);
+                if (lent.size() > 1 || rnd() % 2)
+                {
+                    borrowed = lent.front();
+                    lent.pop_front();
+                }
+            }
+
+            for (mfxU32 j = rnd() % 4; j; j--)
+            {
+                mfxU32 k = rnd() % NUM_FRAMES;
+                mfxI32 found = m_alloc.FindSurface(&m_surfaces[k], false);
+                EXPECT_TRUE(found == -1 || found == (mfxI32)k) << "surface " << k << " found at " << found;
+            }
+
+            if (borrowed != UMC::FRAME_MID_INVALID)
+            {
+                const UMC::FrameData* data = m_alloc.Lock(borrowed);
+                EXPECT_TRUE(data && data->GetPlaneMemoryInfo(0)->m_planePtr == m_core.FrameMemory(m_mids[borrowed]));
+                EXPECT_EQ(UMC::UMC_OK, m_alloc.Unlock(borrowed));
+
+                for (mfxU32 j = rnd() % 3; j; j--)
+                {
+                    EXPECT_EQ(UMC::UMC_OK, m_alloc.IncreaseReference(borrowed));
+                    EXPECT_EQ(UMC::UMC_OK, m_alloc.DecreaseReference(borrowed));
+                }
+                EXPECT_EQ(UMC::UMC_OK, m_alloc.DecreaseReference(borrowed));
+            }
+
+            // the frame can be reused once both references are released
+            inUse[mid] = false;
+            EXPECT_EQ(UMC::UMC_OK, m_alloc.DecreaseReference(mid));
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for (mfxU32 t = 0; t < NUM_THREADS; t++)
+        threads.emplace_back(worker, UMC_ALLOC_TEST_SEED + t);
+    for (auto &thread : threads)
+        thread.join();
+
+    for (UMC::FrameMemID mid : lent)
+        EXPECT_EQ(UMC::UMC_OK, m_alloc.DecreaseReference(mid));
+
+    EXPECT_EQ(NUM_THREADS * ITERATIONS, allocs);
+    EXPECT_EQ(0u, m_core.m_lockUnderflows);
+    EXPECT_EQ(0, m_core.m_frameLocks);
+
+    // every frame was freed exactly once per allocation
+    for (mfxU32 i = 0; i < NUM_FRAMES; i++)
+        EXPECT_EQ(0, m_alloc.GetInternalSurface(i)->Data.Locked) << "frame " << i;
+}
@@ -0,0 +1,231 @@
+// Copyright (c) 2020 Intel Corporation
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "vpp_test_main.h"
+#include "mfx_vpp_frame_alloc.h"
+
+#include <vector>
+
+using namespace MfxHwVideoProcessing;
+
+// Core which hands out frame ids, it allocates EXTRA_FRAMES more frames than
+// requested like the real allocators may do and counts the calls
+class TestCore : public VideoCORE
+{
+public:
+    static const mfxU16 EXTRA_FRAMES = 2;
+
+    TestCore()
+        : m_allocCalls(0)
+        , m_freeCalls(0)
+        , m_framesInUse(0)
+    {}
+
+    mfxStatus AllocFrames(mfxFrameAllocRequest *request, mfxFrameAllocResponse *response, bool) override
+    {
+        mfxU16 numFrames = request->NumFrameSuggested + EXTRA_FRAMES;
+
+        m_allocCalls++;
+        m_framesInUse += numFrames;
+
+        response->mids = new mfxMemId[numFrames];
+        for (mfxU16 i = 0; i < numFrames; i++)
+            response->mids[i] = (mfxMemId)(size_t)(i + 1);
+        response->NumFrameActual = numFrames;
+        return MFX_ERR_NONE;
+    }
+
+    mfxStatus FreeFrames(mfxFrameAllocResponse *response, bool) override
+    {
+        m_freeCalls++;
+        m_framesInUse -= response->NumFrameActual;
+
+        delete [] response->mids;
+        response->mids = nullptr;
+        return MFX_ERR_NONE;
+    }
+
+    mfxStatus IncreasePureReference(mfxU16 &) override { return MFX_ERR_UNSUPPORTED; }
+    mfxStatus DecreasePureReference(mfxU16 &) override { return MFX_ERR_UNSUPPORTED; }
+    mfxStatus IncreaseReference(mfxFrameData *, bool) override { return MFX_ERR_UNSUPPORTED; }
+    mfxStatus DecreaseReference(mfxFrameData *, bool) override { return MFX_ERR_UNSUPPORTED; }
+    mfxStatus LockFrame(mfxMemId, mfxFrameData *) override { return MFX_ERR_UNSUPPORTED; }
+    mfxStatus UnlockFrame(mfxMemId, mfxFrameData *) override { return MFX_ERR_UNSUPPORTED; }
+    mfxMemId MapIdx(mfxMemId mid) override { return mid; }
+    void* QueryCoreInterface(const MFX_GUID &) override { return nullptr; }
+    void SetWrapper(void*) override {}
+
+    mfxStatus GetHandle(mfxHandleType, mfxHDL *) override { return MFX_ERR_UNSUPPORTED; }
+    mfxStatus SetHandle(mfxHandleType, mfxHDL) override { return MFX_ERR_UNSUPPORTED; }
+    mfxStatus SetBufferAllocator(mfxBufferAllocator *) override { return MFX_ERR_UNSUPPORTED; }
+    mfxStatus SetFrameAllocator(mfxFrameAllocator *) override { return MFX_ERR_UNSUPPORTED; }
+    mfxStatus AllocBuffer(mfxU32, mfxU16, mfxMemId *) override { return MFX_ERR_UNSUPPORTED; }
+    mfxStatus LockBuffer(mfxMemId, mfxU8 **) override { return MFX_ERR_UNSUPPORTED; }
+    mfxStatus UnlockBuffer(mfxMemId) override { return MFX_ERR_UNSUPPORTED; }
+    mfxStatus FreeBuffer(mfxMemId) override { return MFX_ERR_UNSUPPORTED; }
+    mfxStatus CheckHandle() override { return MFX_ERR_NONE; }
+    mfxStatus GetFrameHDL(mfxMemId, mfxHDL *, bool) override { return MFX_ERR_UNSUPPORTED; }
+    mfxStatus AllocFrames(mfxFrameAllocRequest *, mfxFrameAllocResponse *, mfxFrameSurface1 **, mfxU32) override { return MFX_ERR_UNSUPPORTED; }
+    mfxStatus LockExternalFrame(mfxMemId, mfxFrameData *, bool) override { return MFX_ERR_UNSUPPORTED; }
+    mfxStatus GetExternalFrameHDL(mfxMemId, mfxHDL *, bool) override { return MFX_ERR_UNSUPPORTED; }
+    mfxStatus UnlockExternalFrame(mfxMemId, mfxFrameData *, bool) override { return MFX_ERR_UNSUPPORTED; }
+    mfxFrameSurface1* GetNativeSurface(mfxFrameSurface1 *, bool) override { return nullptr; }
+    mfxFrameSurface1* GetOpaqSurface(mfxMemId, bool) override { return nullptr; }
+    void GetVA(mfxHDL* phdl, mfxU16) override { *phdl = nullptr; }
+    mfxStatus CreateVA(mfxVideoParam *, mfxFrameAllocRequest *, mfxFrameAllocResponse *, UMC::FrameAllocator *) override { return MFX_ERR_UNSUPPORTED; }
+    mfxU32 GetAdapterNumber(void) override { return 0; }
+    void GetVideoProcessing(mfxHDL* phdl) override { *phdl = nullptr; }
+    mfxStatus CreateVideoProcessing(mfxVideoParam *) override { return MFX_ERR_UNSUPPORTED; }
+    eMFXPlatform GetPlatformType() override { return MFX_PLATFORM_SOFTWARE; }
+    mfxU32 GetNumWorkingThreads(void) override { return 1; }
+    void INeedMoreThreadsInside(const void *) override {}
+    mfxStatus DoFastCopy(mfxFrameSurface1 *, mfxFrameSurface1 *) override { return MFX_ERR_UNSUPPORTED; }
+    mfxStatus DoFastCopyExtended(mfxFrameSurface1 *, mfxFrameSurface1 *) override { return MFX_ERR_UNSUPPORTED; }
+    mfxStatus DoFastCopyWrapper(mfxFrameSurface1 *, mfxU16, mfxFrameSurface1 *, mfxU16) override { return MFX_ERR_UNSUPPORTED; }
+    bool IsFastCopyEnabled(void) override { return false; }
+    bool IsExternalFrameAllocator(void) const override { return false; }
+    eMFXHWType GetHWType() override { return MFX_HW_UNKNOWN; }
+    bool SetCoreId(mfxU32) override { return false; }
+    eMFXVAType GetVAType() const override { return MFX_HW_VAAPI; }
+    mfxStatus CopyFrame(mfxFrameSurface1 *, mfxFrameSurface1 *) override { return MFX_ERR_UNSUPPORTED; }
+    mfxStatus CopyBuffer(mfxU8 *, mfxU32, mfxFrameSurface1 *) override { return MFX_ERR_UNSUPPORTED; }
+    mfxStatus CopyFrameEx(mfxFrameSurface1 *, mfxU16, mfxFrameSurface1 *, mfxU16) override { return MFX_ERR_UNSUPPORTED; }
+    mfxStatus IsGuidSupported(const GUID, mfxVideoParam *, bool) override { return MFX_ERR_UNSUPPORTED; }
+    bool CheckOpaqueRequest(mfxFrameAllocRequest *, mfxFrameSurface1 **, mfxU32, bool) override { return false; }
+    bool IsOpaqSurfacesAlreadyMapped(mfxFrameSurface1 **, mfxU32, mfxFrameAllocResponse *, bool) override { return false; }
+    mfxSession GetSession() override { return nullptr; }
+    mfxU16 GetAutoAsyncDepth() override { return 1; }
+    bool IsCompatibleForOpaq() override { return false; }
+
+    int m_allocCalls;
+    int m_freeCalls;
+    int m_framesInUse;
+};
+
+static mfxFrameAllocRequest Request(mfxU16 numFrames, mfxU16 width, mfxU16 height, mfxU32 fourCC = MFX_FOURCC_NV12)
+{
+    mfxFrameAllocRequest request = {};
+    request.Type = MFX_MEMTYPE_FROM_VPPOUT | MFX_MEMTYPE_VIDEO_MEMORY_PROCESSOR_TARGET | MFX_MEMTYPE_INTERNAL_FRAME;
+    request.NumFrameMin = numFrames;
+    request.NumFrameSuggested = numFrames;
+    request.Info.FourCC = fourCC;
+    request.Info.ChromaFormat = MFX_CHROMAFORMAT_YUV420;
+    request.Info.Width = width;
+    request.Info.Height = height;
+    return request;
+}
+
+TEST(VPPFrameAllocResponse, ReallocAllocatesFirstTime)
+{
+    TestCore core;
+    {
+        MfxFrameAllocResponse response;
+        mfxFrameAllocRequest request = Request(4, 1920, 1088);
+
+        ASSERT_EQ(MFX_ERR_NONE, response.Realloc(&core, request));
+        EXPECT_EQ(1, core.m_allocCalls);
+        EXPECT_EQ(4, response.NumFrameActual);
+    }
+    EXPECT_EQ(1, core.m_freeCalls);
+    EXPECT_EQ(0, core.m_framesInUse);
+}
+
+TEST(VPPFrameAllocResponse, ReallocKeepsFittingFrames)
+{
+    TestCore core;
+    MfxFrameAllocResponse response;
+    mfxFrameAllocRequest request = Request(4, 1920, 1088);
+    ASSERT_EQ(MFX_ERR_NONE, response.Realloc(&core, request));
+    mfxMemId *mids = response.mids;
+
+    // smaller frames and the extra frames of the allocator fit
+    mfxFrameAllocRequest smaller = Request(4, 1280, 720);
+    ASSERT_EQ(MFX_ERR_NONE, response.Realloc(&core, smaller));
+    mfxFrameAllocRequest more = Request(4 + TestCore::EXTRA_FRAMES, 1920, 1088);
+    ASSERT_EQ(MFX_ERR_NONE, response.Realloc(&core, more));
+
+    EXPECT_EQ(1, core.m_allocCalls);
+    EXPECT_EQ(0, core.m_freeCalls);
+    EXPECT_EQ(mids, response.mids);
+    EXPECT_EQ(4 + TestCore::EXTRA_FRAMES, response.NumFrameActual);
+    EXPECT_EQ(more.NumFrameMin, more.NumFrameSuggested);
+}
+
+TEST(VPPFrameAllocResponse, ReallocReplacesFramesNotFitting)
+{
+    mfxFrameAllocRequest requests[] =
+    {
+        Request(4, 3840, 1088),
+        Request(4, 1920, 2160),
+        Request(4 + TestCore::EXTRA_FRAMES + 1, 1920, 1088),
+        Request(4, 1920, 1088, MFX_FOURCC_P010),
+        Request(4, 1920, 1088),
+    };
+    requests[4].Type = MFX_MEMTYPE_FROM_VPPIN | MFX_MEMTYPE_SYSTEM_MEMORY | MFX_MEMTYPE_INTERNAL_FRAME;
+
+    for (mfxFrameAllocRequest &request : requests)
+    {
+        TestCore core;
+        {
+            MfxFrameAllocResponse response;
+            mfxFrameAllocRequest first = Request(4, 1920, 1088);
+            ASSERT_EQ(MFX_ERR_NONE, response.Realloc(&core, first));
+
+            ASSERT_EQ(MFX_ERR_NONE, response.Realloc(&core, request));
+            EXPECT_EQ(2, core.m_allocCalls);
+            EXPECT_EQ(1, core.m_freeCalls);
+            EXPECT_EQ(request.NumFrameMin, response.NumFrameActual);
+        }
+        EXPECT_EQ(0, core.m_framesInUse);
+    }
+}
+
+TEST(VPPFrameAllocResponse, ReallocReplacesFramesOfOtherCore)
+{
+    TestCore core;
+    TestCore other;
+    {
+        MfxFrameAllocResponse response;
+        mfxFrameAllocRequest request = Request(4, 1920, 1088);
+        ASSERT_EQ(MFX_ERR_NONE, response.Realloc(&core, request));
+
+        ASSERT_EQ(MFX_ERR_NONE, response.Realloc(&other, request));
+        EXPECT_EQ(1, core.m_freeCalls);
+        EXPECT_EQ(1, other.m_allocCalls);
+    }
+    EXPECT_EQ(0, core.m_framesInUse);
+    EXPECT_EQ(0, other.m_framesInUse);
+}
+
+TEST(VPPFrameAllocResponse, ReallocAllocatesAfterFree)
+{
+    TestCore core;
+    MfxFrameAllocResponse response;
+    mfxFrameAllocRequest request = Request(4, 1920, 1088);
+    ASSERT_EQ(MFX_ERR_NONE, response.Realloc(&core, request));
+
+    ASSERT_EQ(MFX_ERR_NONE, response.Free());
+    EXPECT_EQ(0, core.m_framesInUse);
+
+    // the freed frames are not reused
+    ASSERT_EQ(MFX_ERR_NONE, response.Realloc(&core, request));
+    EXPECT_EQ(2, core.m_allocCalls);
+    EXPECT_NE(nullptr, response.mids);
+}
@@ -0,0 +1,332 @@
+// Copyright (c) 2020 Intel Corporation
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+// Microbenchmark of the EncTools BRC (BRC_EncTool). Drives one or more BRC
+// instances through synthetic GOPs the way an encoder with lookahead does:
+// lookahead hints for a frame arrive 'depth' frames before it is encoded,
+// then every frame goes through SetFrameStruct, ProcessFrame,
+// ReportEncResult and UpdateFrame (with recodes when the BRC asks for them).
+// Frame sizes come from a simple rate model, so only the BRC calls are timed.
+
+#include "mfx_enctools.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <string>
+#include <vector>
+
+typedef std::chrono::steady_clock bench_clock;
+
+#define BENCH_MAX_RECODES 4
+
+struct BenchParams
+{
+    std::vector<int> depths;     // lookahead depths
+    int              frames;
+    int              gopSize;
+    int              refDist;
+    int              sessions;
+    int              kbps;
+};
+
+struct BenchFrame
+{
+    mfxU32 dispOrder;
+    mfxU16 frameType;
+    mfxU16 pyrLayer;
+};
+
+struct BenchResult
+{
+    uint64_t ns;                 // time spent in the BRC calls
+    uint64_t bits;
+    uint64_t qpSum;
+    int      recodes;
+};
+
+static uint64_t ElapsedNs(bench_clock::time_point start)
+{
+    return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(bench_clock::now() - start).count();
+}
+
+// IPPP or IBB..P with closed GOPs, B frames are non-reference at layer 1.
+static void BuildEncodeOrder(int frames, int gopSize, int refDist, std::vector<BenchFrame>& order)
+{
+    int disp = 0;
+
+    order.clear();
+
+    while (disp < frames)
+    {
+        if (disp % gopSize == 0)
+        {
+            order.push_back({ (mfxU32)disp, MFX_FRAMETYPE_I | MFX_FRAMETYPE_IDR | MFX_FRAMETYPE_REF, 0 });
+            disp++;
+            continue;
+        }
+
+        int gopEnd = (disp / gopSize + 1) * gopSize;
+        int last   = std::min(std::min(disp + refDist, gopEnd), frames) - 1;
+
+        order.push_back({ (mfxU32)last, MFX_FRAMETYPE_P | MFX_FRAMETYPE_REF, 0 });
+        for (int b = disp; b < last; b++)
+            order.push_back({ (mfxU32)b, MFX_FRAMETYPE_B, 1 });
+
+        disp = last + 1;
+    }
+}
+
+// Content complexity per display order: a random walk with a cut every few
+// hundred frames.
+static void BuildComplexity(int frames, std::vector<double>& cmplx)
+{
+    uint32_t seed = 0x2468ace1;
+    double   c = 1.0;
+
+    cmplx.resize(frames);
+
+    for (int i = 0; i < frames; i++)
+    {
+        seed = seed * 1103515245 + 12345;
+        if (i % 250 == 249)
+            c = 0.5 + (double)((seed >> 16) & 0xff) / 128.0;
+        else
+            c *= 0.95 + (double)((seed >> 16) & 0xff) / 2560.0;
+        c = std::min(4.0, std::max(0.25, c));
+        cmplx[i] = c;
+    }
+}
+
+static mfxU32 FrameSizeInBytes(double cmplx, mfxU16 frameType, mfxU32 qp)
+{
+    double typeFactor = (frameType & MFX_FRAMETYPE_I) ? 1.0 : (frameType & MFX_FRAMETYPE_P) ? 0.35 : 0.2;
+    double qstep = pow(2.0, ((double)qp - 4.0) / 6.0);
+
+    return (mfxU32)std::max(16.0, cmplx * typeFactor * 300000.0 / qstep);
+}
+
+static void InitCtrl(const BenchParams& params, int depth, mfxEncToolsCtrl& ctrl)
+{
+    ctrl = {};
+    ctrl.CodecId                = MFX_CODEC_AVC;
+    ctrl.FrameInfo.Width        = 1280;
+    ctrl.FrameInfo.Height       = 720;
+    ctrl.FrameInfo.CropW        = 1280;
+    ctrl.FrameInfo.CropH        = 720;
+    ctrl.FrameInfo.FourCC       = MFX_FOURCC_NV12;
+    ctrl.FrameInfo.ChromaFormat = MFX_CHROMAFORMAT_YUV420;
+    ctrl.FrameInfo.PicStruct    = MFX_PICSTRUCT_PROGRESSIVE;
+    ctrl.FrameInfo.FrameRateExtN = 30;
+    ctrl.FrameInfo.FrameRateExtD = 1;
+    ctrl.IOPattern              = MFX_IOPATTERN_IN_SYSTEM_MEMORY;
+    ctrl.MaxDelayInFrames       = (mfxU16)depth;
+    ctrl.MaxGopSize             = (mfxU16)params.gopSize;
+    ctrl.MaxGopRefDist          = (mfxU16)params.refDist;
+    ctrl.MaxIDRDist             = (mfxU16)params.gopSize;
+    ctrl.RateControlMethod      = MFX_RATECONTROL_CBR;
+    ctrl.TargetKbps             = params.kbps;
+    ctrl.MaxKbps                = params.kbps;
+    ctrl.HRDConformance         = MFX_BRC_NO_HRD;
+    ctrl.Accuracy               = 10;
+}
+
+// Runs the BRC instances round-robin frame by frame, as an application with
+// several encoding sessions on one thread would.
+static bool BenchDepth(const BenchParams& params, int depth, const std::vector<BenchFrame>& order,
+                       const std::vector<double>& cmplx, BenchResult& result)
+{
+    mfxEncToolsCtrl ctrl;
+    std::vector<std::unique_ptr<EncToolsBRC::BRC_EncTool>> brc(params.sessions);
+    std::vector<int> hinted(params.sessions, 0);  // display orders with lookahead hints reported
+
+    InitCtrl(params, depth, ctrl);
+
+    for (auto& b : brc)
+    {
+        b.reset(new EncToolsBRC::BRC_EncTool);
+        if (MFX_ERR_NONE != b->Init(ctrl))
+            return false;
+    }
+
+    result = {};
+
+    for (size_t e = 0; e < order.size(); e++)
+    {
+        const BenchFrame& frame = order[e];
+
+        for (int s = 0; s < params.sessions; s++)
+        {
+            EncToolsBRC::BRC_EncTool& tool = *brc[s];
+            mfxU32 qp = 0;
+            mfxU32 size = 0;
+
+            bench_clock::time_point start = bench_clock::now();
+
+            for (; hinted[s] <= std::min((int)frame.dispOrder + depth, params.frames - 1); hinted[s]++)
+            {
+                mfxEncToolsHintPreEncodeGOP gop = {};
+                mfxEncToolsBRCBufferHint    hint = {};
+
+                gop.QPDelta      = MFX_QP_UNDEFINED;
+                gop.QPModulation = MFX_QP_MODULATION_NOT_DEFINED;
+                hint.OptimalFrameSizeInBytes = (mfxU32)(params.kbps * 1000 / 8 / 30 * cmplx[hinted[s]]);
+
+                tool.ReportGopHints(hinted[s], gop);
+                tool.ReportBufferHints(hinted[s], hint);
+            }
+
+            for (int recode = 0; recode <= BENCH_MAX_RECODES; recode++)
+            {
+                mfxEncToolsBRCFrameParams  frameParams = {};
+                mfxEncToolsBRCQuantControl quant = {};
+                mfxEncToolsBRCEncodeResult encRes = {};
+                mfxEncToolsBRCStatus       status = {};
+
+                frameParams.FrameType    = frame.frameType;
+                frameParams.PyramidLayer = frame.pyrLayer;
+                frameParams.EncodeOrder  = (mfxU32)e;
+
+                if (MFX_ERR_NONE != tool.SetFrameStruct(frame.dispOrder, frameParams) ||
+                    MFX_ERR_NONE != tool.ProcessFrame(frame.dispOrder, &quant))
+                    return false;
+
+                qp   = quant.QpY;
+                size = FrameSizeInBytes(cmplx[frame.dispOrder], frame.frameType, qp);
+
+                encRes.QpY            = (mfxU16)qp;
+                encRes.CodedFrameSize = size;
+                encRes.NumRecodesDone = (mfxU16)recode;
+
+                if (MFX_ERR_NONE != tool.ReportEncResult(frame.dispOrder, encRes) ||
+                    MFX_ERR_NONE != tool.UpdateFrame(frame.dispOrder, &status))
+                    return false;
+
+                if (status.FrameStatus.BRCStatus == MFX_BRC_OK)
+                    break;
+                result.recodes++;
+            }
+
+            result.ns    += ElapsedNs(start);
+            result.bits  += (uint64_t)size * 8;
+            result.qpSum += qp;
+        }
+    }
+
+    return true;
+}
+
+static void PrintUsage(const char* app)
+{
+    printf("Usage: %s [options]\n", app);
+    printf("Measures the per-frame cost of the EncTools BRC on synthetic GOPs.\n\n");
+    printf("  -l n[,n...]        lookahead depths (default 1,2,4,8,16,32,64,100)\n");
+    printf("  -n frames          frames per stream (default 3000)\n");
+    printf("  -g size            GOP size (default 256)\n");
+    printf("  -r dist            GOP reference distance, 1 - IPPP (default 4)\n");
+    printf("  -s sessions        BRC instances run round-robin (default 1)\n");
+    printf("  -b kbps            target bitrate of the 720p30 CBR stream (default 3000)\n");
+}
+
+static bool ParseParams(int argc, char* argv[], BenchParams& params)
+{
+    params.frames   = 3000;
+    params.gopSize  = 256;
+    params.refDist  = 4;
+    params.sessions = 1;
+    params.kbps     = 3000;
+
+    for (int i = 1; i < argc; i++)
+    {
+        std::string opt(argv[i]);
+        bool hasValue = i + 1 < argc;
+
+        if (opt == "-l" && hasValue)
+        {
+            std::string list(argv[++i]);
+            size_t pos = 0;
+
+            while (pos < list.size())
+            {
+                size_t end = list.find(',', pos);
+                if (end == std::string::npos)
+                    end = list.size();
+                params.depths.push_back(std::max(1, atoi(list.substr(pos, end - pos).c_str())));
+                pos = end + 1;
+            }
+        }
+        else if (opt == "-n" && hasValue)
+            params.frames = std::max(1, atoi(argv[++i]));
+        else if (opt == "-g" && hasValue)
+            params.gopSize = std::max(1, atoi(argv[++i]));
+        else if (opt == "-r" && hasValue)
+            params.refDist = std::max(1, atoi(argv[++i]));
+        else if (opt == "-s" && hasValue)
+            params.sessions = std::max(1, atoi(argv[++i]));
+        else if (opt == "-b" && hasValue)
+            params.kbps = std::max(1, atoi(argv[++i]));
+        else
+            return false;
+    }
+
+    if (params.depths.empty())
+        params.depths = { 1, 2, 4, 8, 16, 32, 64, 100 };
+
+    return true;
+}
+
+int main(int argc, char* argv[])
+{
+    BenchParams params;
+    std::vector<BenchFrame> order;
+    std::vector<double> cmplx;
+
+    if (!ParseParams(argc, argv, params))
+    {
+        PrintUsage(argv[0]);
+        return 1;
+    }
+
+    BuildEncodeOrder(params.frames, params.gopSize, params.refDist, order);
+    BuildComplexity(params.frames, cmplx);
+
+    printf("%6s %8s %8s %10s %8s %6s %8s\n", "depth", "sessions", "frames", "ns/frame", "kbps", "QP", "recodes");
+
+    for (int depth : params.depths)
+    {
+        BenchResult result;
+
+        if (!BenchDepth(params, depth, order, cmplx, result))
+        {
+            printf("BRC call failed at lookahead depth %d\n", depth);
+            return 1;
+        }
+
+        double frames = (double)params.frames * params.sessions;
+
+        printf("%6d %8d %8d %10.1f %8.1f %6.2f %8d\n", depth, params.sessions, params.frames,
+               result.ns / frames, result.bits * 30.0 / frames / 1000.0, result.qpSum / frames, result.recodes);
+    }
+
+    return 0;
+}
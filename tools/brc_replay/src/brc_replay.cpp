@@ -0,0 +1,1115 @@
+// Copyright (c) 2020 Intel Corporation
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+// Offline replay of a frame size trace through the bitrate controls of the
+// library: EncTools BRC (BRC_EncTool), the ExtBRC of mfx_brc_common and the
+// UMC H.264 and MPEG-2 BRCs. The BRC is driven the way the encoders drive it
+// (QP request, coded size report, recodes, padding and skipped frames), but
+// the coded size comes from a per-frame size model recorded in the trace, so
+// no encoder or GPU is needed and a stream replays in milliseconds.
+//
+// The trace is a text file, one line per frame in encoding order:
+//
+//     <display order> <type> <pyramid layer> <scene change> <complexity> <qp>:<bytes> [<qp>:<bytes> ...]
+//
+// type is one of IDR, I, P, Pn, B, Br (n - non-reference, r - reference),
+// the <qp>:<bytes> points are frame sizes at H.264/HEVC QPs, e.g. from a few
+// CQP encodes of the content. Between the points the size is interpolated
+// in log domain, outside them the closest segment is extended, a single
+// point halves the size every 6 QP. complexity is reported to ExtBRC as
+// FrameCmplx and, relative to the mean of the trace, drives the EncTools
+// lookahead hints. Lines starting with '#' are comments.
+//
+// Every replayed frame is also checked against an HRD leaky bucket kept by
+// the harness, independent of the BRC's own accounting, and against the
+// sliding windows and segments given by -win and -seg.
+
+#include "mfx_enctools.h"
+#include "mfx_brc_common.h"
+#include "umc_h264_brc.h"
+#include "umc_mpeg2_brc.h"
+#include "umc_video_data.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+typedef std::chrono::steady_clock replay_clock;
+
+#define REPLAY_MAX_RECODES      4
+#define REPLAY_SKIP_FRAME_BYTES 64   // coded size of a skipped frame
+#define REPLAY_MPEG2_QP_OFFSET  4.0  // H.264 QP of MPEG-2 quantiser scale value 1
+
+struct ReplayWindow
+{
+    int  frames;
+    int  kbps;      // average over the window
+    bool bSegment;  // restarts every 'frames' frames
+};
+
+struct ReplayParams
+{
+    std::string              traceFile;
+    std::string              writeTrace;
+    std::string              csvFile;
+    std::vector<std::string> backends;
+    std::vector<ReplayWindow> windows;
+    int                      frames;      // synthetic trace only
+    int                      gopSize;
+    int                      refDist;
+    mfxU32                   codecId;
+    mfxU16                   rateControl;
+    mfxU16                   hrd;
+    int                      kbps;
+    int                      maxKbps;
+    int                      bufferKB;
+    int                      delayKB;
+    int                      fpsN;
+    int                      fpsD;
+    int                      width;
+    int                      height;
+    int                      laDepth;
+    int                      loops;
+};
+
+struct ReplayFrame
+{
+    mfxU32              dispOrder;
+    mfxU16              frameType;
+    mfxU16              pyrLayer;
+    mfxU16              sceneChange;
+    mfxU32              cmplx;
+    std::vector<double> qp;        // model points, ascending QP
+    std::vector<double> logBytes;
+};
+
+struct ReplayFrameResult
+{
+    mfxI32 qp;        // in the BRC's own scale
+    double qpH264;    // QP the size model was evaluated at
+    mfxU32 bytes;
+    int    recodes;
+    bool   padded;
+    bool   skipped;
+};
+
+struct ReplayStat
+{
+    uint64_t ns;
+    uint64_t bits;
+    double   qpSum;
+    double   qpMin;
+    double   qpMax;
+    int      recodes;
+    int      padded;
+    int      skipped;
+    int      underflows;
+    int      overflows;
+    double   fullnessMin;  // in % of the buffer
+    double   fullnessMax;
+    int      winOverflows; // frames exceeding a window or segment limit
+    double   winPeak;      // in % of the limit
+};
+
+static uint64_t ElapsedNs(replay_clock::time_point start)
+{
+    return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(replay_clock::now() - start).count();
+}
+
+static double FrameRate(const ReplayParams& params)
+{
+    return (double)params.fpsN / params.fpsD;
+}
+
+static mfxU32 ModelSize(const ReplayFrame& frame, double qp)
+{
+    size_t n = frame.qp.size();
+    double logBytes;
+
+    if (n == 1)
+        logBytes = frame.logBytes[0] - (qp - frame.qp[0]) * log(2.0) / 6.0;
+    else
+    {
+        size_t i = 1;
+        while (i + 1 < n && frame.qp[i] < qp)
+            i++;
+
+        double slope = (frame.logBytes[i] - frame.logBytes[i - 1]) / (frame.qp[i] - frame.qp[i - 1]);
+        logBytes = frame.logBytes[i - 1] + (qp - frame.qp[i - 1]) * slope;
+    }
+
+    return (mfxU32)std::min(1e9, std::max(16.0, exp(logBytes)));
+}
+
+static UMC::FrameType GetUmcFrameType(mfxU16 frameType)
+{
+    return (frameType & MFX_FRAMETYPE_I) ? UMC::I_PICTURE :
+           (frameType & MFX_FRAMETYPE_P) ? UMC::P_PICTURE : UMC::B_PICTURE;
+}
+
+static void InitVideoParam(const ReplayParams& params, mfxVideoParam& par)
+{
+    par = {};
+    par.mfx.CodecId                 = params.codecId;
+    par.mfx.FrameInfo.Width         = (mfxU16)params.width;
+    par.mfx.FrameInfo.Height        = (mfxU16)params.height;
+    par.mfx.FrameInfo.CropW         = (mfxU16)params.width;
+    par.mfx.FrameInfo.CropH         = (mfxU16)params.height;
+    par.mfx.FrameInfo.FourCC        = MFX_FOURCC_NV12;
+    par.mfx.FrameInfo.ChromaFormat  = MFX_CHROMAFORMAT_YUV420;
+    par.mfx.FrameInfo.PicStruct     = MFX_PICSTRUCT_PROGRESSIVE;
+    par.mfx.FrameInfo.FrameRateExtN = (mfxU32)params.fpsN;
+    par.mfx.FrameInfo.FrameRateExtD = (mfxU32)params.fpsD;
+    par.mfx.GopPicSize              = (mfxU16)params.gopSize;
+    par.mfx.GopRefDist              = (mfxU16)params.refDist;
+    par.mfx.IdrInterval             = 0;
+    par.mfx.RateControlMethod       = params.rateControl;
+    par.mfx.BRCParamMultiplier      = 1;
+    par.mfx.TargetKbps              = (mfxU16)std::min(params.kbps, 0xffff);
+    par.mfx.MaxKbps                 = (mfxU16)std::min(params.maxKbps, 0xffff);
+    par.mfx.BufferSizeInKB          = (mfxU16)std::min(params.bufferKB, 0xffff);
+    par.mfx.InitialDelayInKB        = (mfxU16)std::min(params.delayKB, 0xffff);
+}
+
+// Common frame loop of the BRCs. Init gets the whole trace so the backends
+// can precompute their lookahead data.
+class ReplayBrc
+{
+public:
+    virtual ~ReplayBrc() {}
+
+    virtual const char* Name() const = 0;
+    virtual bool Init(const ReplayParams& params, const std::vector<ReplayFrame>& trace) = 0;
+    virtual bool EncodeFrame(const ReplayFrame& frame, mfxU32 encOrder, ReplayFrameResult& res) = 0;
+    virtual void Close() = 0;
+
+    // codec of the HRD parameters the BRC works with
+    virtual mfxU32 GetCodecId(const ReplayParams& params) const { return params.codecId; }
+};
+
+class ReplayEncTools : public ReplayBrc
+{
+public:
+    const char* Name() const { return "enctools"; }
+
+    bool Init(const ReplayParams& params, const std::vector<ReplayFrame>& trace)
+    {
+        mfxEncToolsCtrl ctrl = {};
+        double cmplxSum = 0;
+
+        ctrl.CodecId                = params.codecId;
+        ctrl.FrameInfo.Width        = (mfxU16)params.width;
+        ctrl.FrameInfo.Height       = (mfxU16)params.height;
+        ctrl.FrameInfo.CropW        = (mfxU16)params.width;
+        ctrl.FrameInfo.CropH        = (mfxU16)params.height;
+        ctrl.FrameInfo.FourCC       = MFX_FOURCC_NV12;
+        ctrl.FrameInfo.ChromaFormat = MFX_CHROMAFORMAT_YUV420;
+        ctrl.FrameInfo.PicStruct    = MFX_PICSTRUCT_PROGRESSIVE;
+        ctrl.FrameInfo.FrameRateExtN = (mfxU32)params.fpsN;
+        ctrl.FrameInfo.FrameRateExtD = (mfxU32)params.fpsD;
+        ctrl.IOPattern              = MFX_IOPATTERN_IN_SYSTEM_MEMORY;
+        ctrl.MaxDelayInFrames       = (mfxU16)params.laDepth;
+        ctrl.MaxGopSize             = (mfxU16)params.gopSize;
+        ctrl.MaxGopRefDist          = (mfxU16)params.refDist;
+        ctrl.MaxIDRDist             = (mfxU16)params.gopSize;
+        ctrl.RateControlMethod      = params.rateControl;
+        ctrl.TargetKbps             = (mfxU32)params.kbps;
+        ctrl.MaxKbps                = (mfxU32)params.maxKbps;
+        ctrl.HRDConformance         = params.hrd;
+        ctrl.BufferSizeInKB         = (mfxU32)params.bufferKB;
+        ctrl.InitialDelayInKB       = (mfxU32)params.delayKB;
+        ctrl.Accuracy               = 10;
+
+        m_brc.reset(new EncToolsBRC::BRC_EncTool);
+        if (MFX_ERR_NONE != m_brc->Init(ctrl))
+            return false;
+
+        m_laDepth = params.laDepth;
+        m_hinted  = 0;
+        m_hints.assign(trace.size(), 0);
+
+        for (const ReplayFrame& frame : trace)
+            cmplxSum += frame.cmplx;
+
+        // the lookahead hint of a frame is its share of the rate by complexity
+        for (const ReplayFrame& frame : trace)
+            m_hints[frame.dispOrder] = cmplxSum > 0 ?
+                (mfxU32)(params.kbps * 1000.0 / 8.0 / FrameRate(params) * frame.cmplx * trace.size() / cmplxSum) : 0;
+
+        return true;
+    }
+
+    bool EncodeFrame(const ReplayFrame& frame, mfxU32 encOrder, ReplayFrameResult& res)
+    {
+        EncToolsBRC::BRC_EncTool& tool = *m_brc;
+        mfxEncToolsBRCEncodeResult encRes = {};
+        mfxEncToolsBRCStatus       status = {};
+
+        if (m_laDepth)
+        {
+            for (; m_hinted <= std::min((int)frame.dispOrder + m_laDepth, (int)m_hints.size() - 1); m_hinted++)
+            {
+                mfxEncToolsHintPreEncodeGOP gop = {};
+                mfxEncToolsBRCBufferHint    hint = {};
+
+                gop.QPDelta      = MFX_QP_UNDEFINED;
+                gop.QPModulation = MFX_QP_MODULATION_NOT_DEFINED;
+                hint.OptimalFrameSizeInBytes = m_hints[m_hinted];
+
+                tool.ReportGopHints(m_hinted, gop);
+                if (hint.OptimalFrameSizeInBytes)
+                    tool.ReportBufferHints(m_hinted, hint);
+            }
+        }
+
+        res = {};
+
+        for (;;)
+        {
+            mfxEncToolsBRCFrameParams  frameParams = {};
+            mfxEncToolsBRCQuantControl quant = {};
+
+            frameParams.FrameType    = frame.frameType;
+            frameParams.PyramidLayer = frame.pyrLayer;
+            frameParams.EncodeOrder  = encOrder;
+
+            if (MFX_ERR_NONE != tool.SetFrameStruct(frame.dispOrder, frameParams) ||
+                MFX_ERR_NONE != tool.ProcessFrame(frame.dispOrder, &quant))
+                return false;
+
+            res.qp     = quant.QpY;
+            res.qpH264 = quant.QpY;
+            res.bytes  = ModelSize(frame, res.qpH264);
+
+            encRes.QpY            = quant.QpY;
+            encRes.CodedFrameSize = res.bytes;
+            encRes.NumRecodesDone = (mfxU16)res.recodes;
+
+            if (MFX_ERR_NONE != tool.ReportEncResult(frame.dispOrder, encRes) ||
+                MFX_ERR_NONE != tool.UpdateFrame(frame.dispOrder, &status))
+                return false;
+
+            mfxU16 brcStatus = status.FrameStatus.BRCStatus;
+
+            if (brcStatus == MFX_BRC_OK)
+                return true;
+
+            if (brcStatus == MFX_BRC_PANIC_BIG_FRAME || brcStatus == MFX_BRC_PANIC_SMALL_FRAME)
+            {
+                res.skipped = brcStatus == MFX_BRC_PANIC_BIG_FRAME;
+                res.padded  = !res.skipped;
+                res.bytes   = res.skipped ? REPLAY_SKIP_FRAME_BYTES : std::max(res.bytes, status.FrameStatus.MinFrameSize);
+
+                encRes.CodedFrameSize = res.bytes;
+                encRes.NumRecodesDone = (mfxU16)++res.recodes;
+
+                return MFX_ERR_NONE == tool.ReportEncResult(frame.dispOrder, encRes) &&
+                       MFX_ERR_NONE == tool.UpdateFrame(frame.dispOrder, &status);
+            }
+
+            if (res.recodes == REPLAY_MAX_RECODES)
+                return true;
+            res.recodes++;
+        }
+    }
+
+    void Close()
+    {
+        if (m_brc)
+            m_brc->Close();
+        m_brc.reset();
+    }
+
+protected:
+    std::unique_ptr<EncToolsBRC::BRC_EncTool> m_brc;
+    std::vector<mfxU32>                       m_hints;   // lookahead hints by display order
+    int                                       m_laDepth = 0;
+    int                                       m_hinted = 0;
+};
+
+class ReplayExtBrc : public ReplayBrc
+{
+public:
+    const char* Name() const { return "extbrc"; }
+
+    bool Init(const ReplayParams& params, const std::vector<ReplayFrame>&)
+    {
+        mfxVideoParam       par;
+        mfxExtCodingOption  co = {};
+        mfxExtBuffer*       ext[] = { &co.Header };
+
+        InitVideoParam(params, par);
+
+        co.Header.BufferId      = MFX_EXTBUFF_CODING_OPTION;
+        co.Header.BufferSz      = sizeof(co);
+        co.NalHrdConformance    = (mfxU16)(params.hrd == MFX_BRC_NO_HRD ? MFX_CODINGOPTION_OFF : MFX_CODINGOPTION_ON);
+        co.VuiNalHrdParameters  = (mfxU16)(params.hrd == MFX_BRC_HRD_STRONG ? MFX_CODINGOPTION_ON : MFX_CODINGOPTION_OFF);
+        par.ExtParam            = ext;
+        par.NumExtParam         = 1;
+
+        m_brc.reset(new MfxHwH265EncodeBRC::ExtBRC);
+        return MFX_ERR_NONE == m_brc->Init(&par);
+    }
+
+    bool EncodeFrame(const ReplayFrame& frame, mfxU32 encOrder, ReplayFrameResult& res)
+    {
+        mfxBRCFrameParam  par = {};
+        mfxBRCFrameCtrl   ctrl = {};
+        mfxBRCFrameStatus status = {};
+
+        par.EncodedOrder = encOrder;
+        par.DisplayOrder = frame.dispOrder;
+        par.FrameType    = frame.frameType;
+        par.PyramidLayer = frame.pyrLayer;
+#if (MFX_VERSION >= 1026)
+        par.SceneChange  = frame.sceneChange;
+        par.FrameCmplx   = frame.cmplx;
+#endif
+
+        res = {};
+
+        for (;;)
+        {
+            par.NumRecode = (mfxU16)res.recodes;
+
+            if (MFX_ERR_NONE != m_brc->GetFrameCtrl(&par, &ctrl))
+                return false;
+
+            res.qp     = ctrl.QpY;
+            res.qpH264 = ctrl.QpY;
+            res.bytes  = ModelSize(frame, res.qpH264);
+            par.CodedFrameSize = res.bytes;
+
+            if (MFX_ERR_NONE != m_brc->Update(&par, &ctrl, &status))
+                return false;
+
+            if (status.BRCStatus == MFX_BRC_OK)
+                return true;
+
+            if (status.BRCStatus == MFX_BRC_PANIC_BIG_FRAME || status.BRCStatus == MFX_BRC_PANIC_SMALL_FRAME)
+            {
+                res.skipped = status.BRCStatus == MFX_BRC_PANIC_BIG_FRAME;
+                res.padded  = !res.skipped;
+                res.bytes   = res.skipped ? REPLAY_SKIP_FRAME_BYTES : std::max(res.bytes, status.MinFrameSize);
+
+                par.CodedFrameSize = res.bytes;
+                par.NumRecode      = (mfxU16)++res.recodes;
+
+                return MFX_ERR_NONE == m_brc->Update(&par, &ctrl, &status);
+            }
+
+            if (res.recodes == REPLAY_MAX_RECODES)
+                return true;
+            res.recodes++;
+        }
+    }
+
+    void Close()
+    {
+        if (m_brc)
+            m_brc->Close();
+        m_brc.reset();
+    }
+
+protected:
+    std::unique_ptr<MfxHwH265EncodeBRC::ExtBRC> m_brc;
+};
+
+// UMC BRCs are driven as mfx_h264_encode_hw and mfx_mpeg2_encode_utils_hw do.
+class ReplayUmcBrc : public ReplayBrc
+{
+public:
+    ReplayUmcBrc(bool bMpeg2) : m_bMpeg2(bMpeg2) {}
+
+    const char* Name() const { return m_bMpeg2 ? "umc_mpeg2" : "umc_h264"; }
+
+    mfxU32 GetCodecId(const ReplayParams&) const { return m_bMpeg2 ? MFX_CODEC_MPEG2 : MFX_CODEC_AVC; }
+
+    bool Init(const ReplayParams& params, const std::vector<ReplayFrame>&)
+    {
+        mfxVideoParam       par;
+        UMC::VideoBrcParams brcParams;
+
+        InitVideoParam(params, par);
+        if (MFX_ERR_NONE != ConvertVideoParam_Brc(&par, &brcParams))
+            return false;
+
+        brcParams.info.interlace_type = UMC::PROGRESSIVE;
+        brcParams.profile = m_bMpeg2 ? MFX_PROFILE_MPEG2_MAIN : MFX_PROFILE_AVC_HIGH;
+        brcParams.level   = m_bMpeg2 ? MFX_LEVEL_MPEG2_HIGH : MFX_LEVEL_AVC_51;
+        if (brcParams.HRDBufferSizeBytes == 0)
+            brcParams.HRDBufferSizeBytes = std::min(65535000, brcParams.targetBitrate / 4);
+        if (brcParams.maxBitrate == 0)
+            brcParams.maxBitrate = brcParams.targetBitrate;
+
+        if (m_bMpeg2)
+            m_brc.reset(new UMC::MPEG2BRC);
+        else
+            m_brc.reset(new UMC::H264BRC);
+
+        // second argument: recodes enabled for H.264, full HW encode for MPEG-2
+        return UMC::UMC_OK == m_brc->Init(&brcParams, m_bMpeg2 ? 0 : 1);
+    }
+
+    bool EncodeFrame(const ReplayFrame& frame, mfxU32 encOrder, ReplayFrameResult& res)
+    {
+        UMC::FrameType type = GetUmcFrameType(frame.frameType);
+        mfxI32 recode = UMC::BRC_RECODE_NONE;
+        mfxI32 picStruct = m_bMpeg2 ? (mfxI32)UMC::BRC_FRAME : (mfxI32)UMC::PS_FRAME;
+
+        res = {};
+
+        for (;;)
+        {
+            if (UMC::UMC_OK != m_brc->SetPictureFlags(type, picStruct))
+                return false;
+            if (m_bMpeg2 && UMC::UMC_OK != m_brc->PreEncFrame(type, recode))
+                return false;
+
+            res.qp     = m_brc->GetQP(type);
+            res.qpH264 = m_bMpeg2 ? REPLAY_MPEG2_QP_OFFSET + 6.0 * log2((double)std::max(1, res.qp)) : res.qp;
+            res.bytes  = res.skipped ? REPLAY_SKIP_FRAME_BYTES : ModelSize(frame, res.qpH264);
+
+            UMC::BRCStatus sts = m_brc->PostPackFrame(type, 8 * res.bytes, 0, m_bMpeg2 ? recode : res.recodes, encOrder);
+
+            if (sts == UMC::BRC_ERROR)
+                return false;
+            if (sts == UMC::BRC_OK || res.skipped || res.recodes == REPLAY_MAX_RECODES)
+                return true;
+
+            res.recodes++;
+
+            if ((sts & UMC::BRC_ERR_SMALL_FRAME) && ((sts & UMC::BRC_NOT_ENOUGH_BUFFER) || res.recodes > 2))
+            {
+                int32_t minSize = 0;
+
+                m_brc->GetMinMaxFrameSize(&minSize, 0);
+                res.padded = true;
+                res.bytes  = std::max(res.bytes, (mfxU32)(minSize + 7) / 8);
+                m_brc->PostPackFrame(type, 8 * res.bytes, 0, m_bMpeg2 ? recode : res.recodes, encOrder);
+                return true;
+            }
+
+            if ((sts & UMC::BRC_ERR_BIG_FRAME) && ((sts & UMC::BRC_NOT_ENOUGH_BUFFER) || (!m_bMpeg2 && res.qp == 51)))
+            {
+                res.skipped = true;
+                recode = UMC::BRC_RECODE_EXT_PANIC;
+            }
+            else
+                recode = UMC::BRC_RECODE_QP;
+        }
+    }
+
+    void Close()
+    {
+        if (m_brc)
+            m_brc->Close();
+        m_brc.reset();
+    }
+
+protected:
+    bool                            m_bMpeg2;
+    std::unique_ptr<UMC::CommonBRC> m_brc;
+};
+
+static std::unique_ptr<ReplayBrc> CreateBrc(const std::string& name)
+{
+    std::unique_ptr<ReplayBrc> brc;
+
+    if (name == "enctools")
+        brc.reset(new ReplayEncTools);
+    else if (name == "extbrc")
+        brc.reset(new ReplayExtBrc);
+    else if (name == "umc_h264")
+        brc.reset(new ReplayUmcBrc(false));
+    else if (name == "umc_mpeg2")
+        brc.reset(new ReplayUmcBrc(true));
+
+    return brc;
+}
+
+static bool ParseFrameType(const std::string& type, mfxU16& frameType)
+{
+    if (type == "IDR")
+        frameType = MFX_FRAMETYPE_I | MFX_FRAMETYPE_IDR | MFX_FRAMETYPE_REF;
+    else if (type == "I")
+        frameType = MFX_FRAMETYPE_I | MFX_FRAMETYPE_REF;
+    else if (type == "P")
+        frameType = MFX_FRAMETYPE_P | MFX_FRAMETYPE_REF;
+    else if (type == "Pn")
+        frameType = MFX_FRAMETYPE_P;
+    else if (type == "B")
+        frameType = MFX_FRAMETYPE_B;
+    else if (type == "Br")
+        frameType = MFX_FRAMETYPE_B | MFX_FRAMETYPE_REF;
+    else
+        return false;
+
+    return true;
+}
+
+static const char* FrameTypeName(mfxU16 frameType)
+{
+    if (frameType & MFX_FRAMETYPE_IDR)
+        return "IDR";
+    if (frameType & MFX_FRAMETYPE_I)
+        return "I";
+    if (frameType & MFX_FRAMETYPE_P)
+        return (frameType & MFX_FRAMETYPE_REF) ? "P" : "Pn";
+    return (frameType & MFX_FRAMETYPE_REF) ? "Br" : "B";
+}
+
+static bool ReadTrace(const std::string& fileName, std::vector<ReplayFrame>& trace)
+{
+    FILE* f = fopen(fileName.c_str(), "r");
+    char line[4096];
+    int lineNum = 0;
+
+    if (!f)
+    {
+        printf("can't open %s\n", fileName.c_str());
+        return false;
+    }
+
+    trace.clear();
+
+    while (fgets(line, sizeof(line), f))
+    {
+        char type[8] = {};
+        unsigned disp = 0, layer = 0, sc = 0, cmplx = 0;
+        int pos = 0, len = 0;
+        ReplayFrame frame = {};
+
+        lineNum++;
+        if (line[strspn(line, " \t\r\n")] == '#' || line[strspn(line, " \t\r\n")] == 0)
+            continue;
+
+        if (5 != sscanf(line, "%u %7s %u %u %u%n", &disp, type, &layer, &sc, &cmplx, &pos) ||
+            !ParseFrameType(type, frame.frameType))
+        {
+            printf("%s:%d: bad frame description\n", fileName.c_str(), lineNum);
+            fclose(f);
+            return false;
+        }
+
+        frame.dispOrder   = disp;
+        frame.pyrLayer    = (mfxU16)layer;
+        frame.sceneChange = (mfxU16)sc;
+        frame.cmplx       = cmplx;
+
+        for (;;)
+        {
+            double qp = 0, bytes = 0;
+
+            if (2 != sscanf(line + pos, " %lf:%lf%n", &qp, &bytes, &len))
+                break;
+            if (bytes < 1 || (!frame.qp.empty() && qp <= frame.qp.back()))
+            {
+                printf("%s:%d: size model points must have ascending QPs and non zero sizes\n", fileName.c_str(), lineNum);
+                fclose(f);
+                return false;
+            }
+            frame.qp.push_back(qp);
+            frame.logBytes.push_back(log(bytes));
+            pos += len;
+        }
+
+        if (frame.qp.empty())
+        {
+            printf("%s:%d: no size model points\n", fileName.c_str(), lineNum);
+            fclose(f);
+            return false;
+        }
+
+        trace.push_back(frame);
+    }
+
+    fclose(f);
+
+    // display orders must be a permutation of the encoding order
+    std::vector<bool> seen(trace.size(), false);
+    for (const ReplayFrame& frame : trace)
+    {
+        if (frame.dispOrder >= trace.size() || seen[frame.dispOrder])
+        {
+            printf("%s: display order %u is out of range or repeated\n", fileName.c_str(), frame.dispOrder);
+            return false;
+        }
+        seen[frame.dispOrder] = true;
+    }
+
+    return !trace.empty();
+}
+
+static bool WriteTrace(const std::string& fileName, const std::vector<ReplayFrame>& trace)
+{
+    FILE* f = fopen(fileName.c_str(), "w");
+
+    if (!f)
+    {
+        printf("can't create %s\n", fileName.c_str());
+        return false;
+    }
+
+    fprintf(f, "# display type layer scene_change complexity qp:bytes...\n");
+
+    for (const ReplayFrame& frame : trace)
+    {
+        fprintf(f, "%u %s %u %u %u", frame.dispOrder, FrameTypeName(frame.frameType), frame.pyrLayer, frame.sceneChange, frame.cmplx);
+        for (size_t i = 0; i < frame.qp.size(); i++)
+            fprintf(f, " %g:%u", frame.qp[i], (mfxU32)(exp(frame.logBytes[i]) + 0.5));
+        fprintf(f, "\n");
+    }
+
+    fclose(f);
+    return true;
+}
+
+// IPPP or IBB..P with closed GOPs as brc_bench does, content complexity is a
+// random walk with a cut every few hundred frames. Sizes are given at QP 22
+// and 38, B frames react to QP a bit faster than I frames.
+static void BuildSyntheticTrace(const ReplayParams& params, std::vector<ReplayFrame>& trace)
+{
+    uint32_t seed = 0x2468ace1;
+    double   c = 1.0;
+    std::vector<double> cmplx(params.frames);
+    std::vector<bool>   cut(params.frames, false);
+    int disp = 0;
+
+    for (int i = 0; i < params.frames; i++)
+    {
+        seed = seed * 1103515245 + 12345;
+        cut[i] = (i % 250 == 249);
+        if (cut[i])
+            c = 0.5 + (double)((seed >> 16) & 0xff) / 128.0;
+        else
+            c *= 0.95 + (double)((seed >> 16) & 0xff) / 2560.0;
+        c = std::min(4.0, std::max(0.25, c));
+        cmplx[i] = c;
+    }
+
+    auto addFrame = [&](int d, mfxU16 frameType, mfxU16 layer)
+    {
+        double typeFactor = (frameType & MFX_FRAMETYPE_I) ? 1.0 : (frameType & MFX_FRAMETYPE_P) ? 0.35 : 0.2;
+        double slope = (frameType & MFX_FRAMETYPE_B) ? 5.0 : 6.0;
+        double bytes = cmplx[d] * typeFactor * 300000.0 / pow(2.0, (22.0 - 4.0) / 6.0)
+                     * params.width * params.height / (1280.0 * 720.0);
+        ReplayFrame frame = {};
+
+        frame.dispOrder   = (mfxU32)d;
+        frame.frameType   = frameType;
+        frame.pyrLayer    = layer;
+        frame.sceneChange = cut[d];
+        frame.cmplx       = (mfxU32)(cmplx[d] * 1000);
+        frame.qp          = { 22.0, 38.0 };
+        // whole bytes, so a written trace replays exactly the same
+        frame.logBytes    = { log(floor(bytes + 0.5)), log(floor(bytes * pow(2.0, -16.0 / slope) + 0.5)) };
+        trace.push_back(frame);
+    };
+
+    trace.clear();
+
+    while (disp < params.frames)
+    {
+        if (disp % params.gopSize == 0)
+        {
+            addFrame(disp++, MFX_FRAMETYPE_I | MFX_FRAMETYPE_IDR | MFX_FRAMETYPE_REF, 0);
+            continue;
+        }
+
+        int gopEnd = (disp / params.gopSize + 1) * params.gopSize;
+        int last   = std::min(std::min(disp + params.refDist, gopEnd), params.frames) - 1;
+
+        addFrame(last, MFX_FRAMETYPE_P | MFX_FRAMETYPE_REF, 0);
+        for (int b = disp; b < last; b++)
+            addFrame(b, MFX_FRAMETYPE_B, 1);
+
+        disp = last + 1;
+    }
+}
+
+// Leaky bucket of the HRD: the buffer fills at the peak rate, every frame is
+// removed at its decode time. A frame larger than the buffer fullness is an
+// underflow, in CBR the buffer must not overflow either (VBR stops filling).
+// Rate and sizes are rounded the way the sequence header signals them, the
+// BRCs control the rounded values.
+class ReplayHrd
+{
+public:
+    void Init(const ReplayParams& params, mfxU32 codecId)
+    {
+        mfxU32 bps         = 1000 * (params.rateControl == MFX_RATECONTROL_CBR ? params.kbps : params.maxKbps);
+        mfxU32 bufferBytes = 1000 * params.bufferKB;
+        mfxU32 delayBytes  = 1000 * params.delayKB;
+
+        if (codecId == MFX_CODEC_MPEG2)
+        {
+            // bit_rate in 400 bit/s, vbv_buffer_size in 16 kbit units
+            bps         = (bps + 399) / 400 * 400;
+            bufferBytes = bufferBytes / 2048 * 2048;
+        }
+        else
+        {
+            mfxU32 rateScale = (codecId == MFX_CODEC_AVC) ? h264_bit_rate_scale : hevcBitRateScale(bps);
+            mfxU32 cpbScale  = (codecId == MFX_CODEC_AVC) ? h264_cpb_size_scale : hevcCbpSizeScale(bps);
+
+            bps         = (bps >> (6 + rateScale)) << (6 + rateScale);
+            bufferBytes = (bufferBytes >> (cpbScale + 1)) << (cpbScale + 1);
+            delayBytes  = (delayBytes >> (cpbScale + 1)) << (cpbScale + 1);
+        }
+
+        m_bCbr         = params.rateControl == MFX_RATECONTROL_CBR;
+        m_size         = 8.0 * bufferBytes;
+        m_fullness     = 8.0 * std::min(delayBytes, bufferBytes);
+        m_bitsPerFrame = bps / FrameRate(params);
+    }
+
+    // returns fullness before the frame is removed
+    double Update(mfxU32 bytes, ReplayStat& stat)
+    {
+        double before = m_fullness;
+
+        if (8.0 * bytes > m_fullness)
+        {
+            stat.underflows++;
+            m_fullness = 0;
+        }
+        else
+            m_fullness -= 8.0 * bytes;
+
+        m_fullness += m_bitsPerFrame;
+        if (m_fullness > m_size)
+        {
+            if (m_bCbr)
+                stat.overflows++;
+            m_fullness = m_size;
+        }
+
+        stat.fullnessMin = std::min(stat.fullnessMin, 100.0 * before / m_size);
+        stat.fullnessMax = std::max(stat.fullnessMax, 100.0 * before / m_size);
+
+        return before;
+    }
+
+protected:
+    bool   m_bCbr = true;
+    double m_size = 0;
+    double m_fullness = 0;
+    double m_bitsPerFrame = 0;
+};
+
+static bool Replay(const ReplayParams& params, ReplayBrc& brc, const std::vector<ReplayFrame>& trace,
+                   FILE* csv, ReplayStat& stat)
+{
+    stat = {};
+
+    for (int loop = 0; loop < params.loops; loop++)
+    {
+        ReplayHrd hrd;
+        MultiWindowBitrate win;
+        ReplayStat loopStat = {};
+
+        loopStat.qpMin       = 1e9;
+        loopStat.fullnessMin = 1e9;
+
+        if (!brc.Init(params, trace))
+            return false;
+        hrd.Init(params, brc.GetCodecId(params));
+
+        for (const ReplayWindow& w : params.windows)
+        {
+            mfxU64 maxBits = (mfxU64)(1000.0 * w.kbps * w.frames / FrameRate(params));
+
+            if (w.bSegment)
+                win.AddSegment((mfxU32)w.frames, maxBits);
+            else
+                win.AddWindow((mfxU32)w.frames, maxBits);
+        }
+
+        for (size_t e = 0; e < trace.size(); e++)
+        {
+            ReplayFrameResult res;
+            replay_clock::time_point start = replay_clock::now();
+
+            if (!brc.EncodeFrame(trace[e], (mfxU32)e, res))
+            {
+                brc.Close();
+                return false;
+            }
+
+            loopStat.ns += ElapsedNs(start);
+
+            double fullness = hrd.Update(res.bytes, loopStat);
+            bool   winOverflow = false;
+
+            win.UpdateFrame(8 * res.bytes, (mfxU32)e);
+            for (mfxU32 i = 0; i < win.GetNumWindows(); i++)
+            {
+                winOverflow |= win.GetWindowBits(i) > win.GetWindowLimit(i);
+                loopStat.winPeak = std::max(loopStat.winPeak, 100.0 * win.GetWindowBits(i) / std::max<mfxU64>(win.GetWindowLimit(i), 1));
+            }
+            loopStat.winOverflows += winOverflow;
+
+            loopStat.bits    += 8ull * res.bytes;
+            loopStat.qpSum   += res.qpH264;
+            loopStat.qpMin    = std::min(loopStat.qpMin, res.qpH264);
+            loopStat.qpMax    = std::max(loopStat.qpMax, res.qpH264);
+            loopStat.recodes += res.recodes;
+            loopStat.padded  += res.padded;
+            loopStat.skipped += res.skipped;
+
+            if (csv && loop == 0)
+                fprintf(csv, "%s,%u,%u,%s,%d,%.2f,%u,%d,%d,%d,%.0f\n", brc.Name(), (mfxU32)e, trace[e].dispOrder,
+                        FrameTypeName(trace[e].frameType), res.qp, res.qpH264, res.bytes, res.recodes,
+                        res.padded, res.skipped, fullness);
+        }
+
+        brc.Close();
+
+        // the BRCs are deterministic, only the timing differs between loops
+        loopStat.ns += stat.ns;
+        stat = loopStat;
+    }
+
+    return true;
+}
+
+static void PrintUsage(const char* app)
+{
+    printf("Usage: %s [options]\n", app);
+    printf("Replays a frame size trace through the library BRCs and checks the HRD buffer.\n\n");
+    printf("  -i trace           trace to replay (default - synthetic, see -n -g -r)\n");
+    printf("  -w trace           write the replayed trace\n");
+    printf("  -o file.csv        write per-frame QP, size and buffer fullness\n");
+    printf("  -t brc[,brc...]    enctools, extbrc, umc_h264, umc_mpeg2 (default - all)\n");
+    printf("  -c avc|hevc        codec for enctools and extbrc (default avc)\n");
+    printf("  -rc cbr|vbr        rate control (default cbr)\n");
+    printf("  -hrd none|weak|strong  HRD conformance for enctools and extbrc (default strong)\n");
+    printf("  -b kbps            target bitrate (default 3000)\n");
+    printf("  -m kbps            max bitrate of VBR (default 2 x target)\n");
+    printf("  -buf KB            HRD buffer size (default 1 second at max bitrate)\n");
+    printf("  -delay KB          initial buffer fullness (default half of the buffer)\n");
+    printf("  -f n[/d]           frame rate (default 30)\n");
+    printf("  -s WxH             frame size (default 1280x720)\n");
+    printf("  -g size            GOP size (default 256)\n");
+    printf("  -r dist            GOP reference distance, 1 - IPPP (default 4)\n");
+    printf("  -n frames          frames of the synthetic trace (default 3000)\n");
+    printf("  -la depth          lookahead depth of enctools, 0 - no hints (default 0)\n");
+    printf("  -loop n            replay every BRC n times for timing (default 1)\n");
+    printf("  -win frames:kbps   check a sliding window average, may be repeated\n");
+    printf("  -seg frames:kbps   check the average of segments of the given length, may be repeated\n");
+}
+
+static bool ParseParams(int argc, char* argv[], ReplayParams& params)
+{
+    params.frames      = 3000;
+    params.gopSize     = 256;
+    params.refDist     = 4;
+    params.codecId     = MFX_CODEC_AVC;
+    params.rateControl = MFX_RATECONTROL_CBR;
+    params.hrd         = MFX_BRC_HRD_STRONG;
+    params.kbps        = 3000;
+    params.maxKbps     = 0;
+    params.bufferKB    = 0;
+    params.delayKB     = 0;
+    params.fpsN        = 30;
+    params.fpsD        = 1;
+    params.width       = 1280;
+    params.height      = 720;
+    params.laDepth     = 0;
+    params.loops       = 1;
+
+    for (int i = 1; i < argc; i++)
+    {
+        std::string opt(argv[i]);
+        bool hasValue = i + 1 < argc;
+        std::string value(hasValue ? argv[i + 1] : "");
+
+        if (!hasValue)
+            return false;
+        i++;
+
+        if (opt == "-i")
+            params.traceFile = value;
+        else if (opt == "-w")
+            params.writeTrace = value;
+        else if (opt == "-o")
+            params.csvFile = value;
+        else if (opt == "-t")
+        {
+            size_t pos = 0;
+
+            while (pos < value.size())
+            {
+                size_t end = value.find(',', pos);
+                if (end == std::string::npos)
+                    end = value.size();
+                params.backends.push_back(value.substr(pos, end - pos));
+                pos = end + 1;
+            }
+        }
+        else if (opt == "-c" && (value == "avc" || value == "hevc"))
+            params.codecId = value == "avc" ? MFX_CODEC_AVC : MFX_CODEC_HEVC;
+        else if (opt == "-rc" && (value == "cbr" || value == "vbr"))
+            params.rateControl = value == "cbr" ? MFX_RATECONTROL_CBR : MFX_RATECONTROL_VBR;
+        else if (opt == "-hrd" && (value == "none" || value == "weak" || value == "strong"))
+            params.hrd = value == "none" ? MFX_BRC_NO_HRD : value == "weak" ? MFX_BRC_HRD_WEAK : MFX_BRC_HRD_STRONG;
+        else if (opt == "-b")
+            params.kbps = std::max(1, atoi(value.c_str()));
+        else if (opt == "-m")
+            params.maxKbps = std::max(1, atoi(value.c_str()));
+        else if (opt == "-buf")
+            params.bufferKB = std::max(1, atoi(value.c_str()));
+        else if (opt == "-delay")
+            params.delayKB = std::max(1, atoi(value.c_str()));
+        else if (opt == "-f")
+        {
+            if (sscanf(value.c_str(), "%d/%d", &params.fpsN, &params.fpsD) < 1 || params.fpsN <= 0 || params.fpsD <= 0)
+                return false;
+        }
+        else if (opt == "-s")
+        {
+            if (2 != sscanf(value.c_str(), "%dx%d", &params.width, &params.height) || params.width <= 0 || params.height <= 0)
+                return false;
+        }
+        else if (opt == "-g")
+            params.gopSize = std::max(1, atoi(value.c_str()));
+        else if (opt == "-r")
+            params.refDist = std::max(1, atoi(value.c_str()));
+        else if (opt == "-n")
+            params.frames = std::max(1, atoi(value.c_str()));
+        else if (opt == "-la")
+            params.laDepth = std::max(0, atoi(value.c_str()));
+        else if (opt == "-loop")
+            params.loops = std::max(1, atoi(value.c_str()));
+        else if (opt == "-win" || opt == "-seg")
+        {
+            ReplayWindow w = {};
+
+            w.bSegment = opt == "-seg";
+            if (2 != sscanf(value.c_str(), "%d:%d", &w.frames, &w.kbps) || w.frames <= 0 || w.kbps <= 0)
+                return false;
+            params.windows.push_back(w);
+        }
+        else
+            return false;
+    }
+
+    if (params.backends.empty())
+        params.backends = { "enctools", "extbrc", "umc_h264", "umc_mpeg2" };
+
+    if (params.rateControl == MFX_RATECONTROL_CBR)
+        params.maxKbps = params.kbps;
+    else if (params.maxKbps == 0)
+        params.maxKbps = 2 * params.kbps;
+    params.maxKbps = std::max(params.maxKbps, params.kbps);
+
+    if (params.bufferKB == 0)
+        params.bufferKB = params.maxKbps / 8;
+    if (params.delayKB == 0)
+        params.delayKB = params.bufferKB / 2;
+    params.delayKB = std::min(params.delayKB, params.bufferKB);
+
+    return true;
+}
+
+int main(int argc, char* argv[])
+{
+    ReplayParams params;
+    std::vector<ReplayFrame> trace;
+    FILE* csv = 0;
+    int failed = 0;
+
+    if (!ParseParams(argc, argv, params))
+    {
+        PrintUsage(argv[0]);
+        return 1;
+    }
+
+    if (params.traceFile.empty())
+        BuildSyntheticTrace(params, trace);
+    else if (!ReadTrace(params.traceFile, trace))
+        return 1;
+
+    if (!params.writeTrace.empty() && !WriteTrace(params.writeTrace, trace))
+        return 1;
+
+    if (!params.csvFile.empty())
+    {
+        csv = fopen(params.csvFile.c_str(), "w");
+        if (!csv)
+        {
+            printf("can't create %s\n", params.csvFile.c_str());
+            return 1;
+        }
+        fprintf(csv, "brc,encode_order,display_order,type,qp,qp_h264,bytes,recodes,padded,skipped,fullness_bits\n");
+    }
+
+    printf("%-10s %7s %10s %8s %6s %5s %5s %7s %6s %7s %6s %6s %7s %7s", "brc", "frames", "frames/ms", "kbps",
+           "QP", "QPmin", "QPmax", "recodes", "padded", "skipped", "under", "over", "buf min", "buf max");
+    if (!params.windows.empty())
+        printf(" %8s %8s", "win over", "win peak");
+    printf("\n");
+
+    for (const std::string& name : params.backends)
+    {
+        std::unique_ptr<ReplayBrc> brc = CreateBrc(name);
+        ReplayStat stat;
+
+        if (!brc)
+        {
+            printf("unknown BRC %s\n", name.c_str());
+            failed = 1;
+            continue;
+        }
+
+        if (!Replay(params, *brc, trace, csv, stat))
+        {
+            printf("%-10s BRC call failed\n", name.c_str());
+            failed = 1;
+            continue;
+        }
+
+        double frames = (double)trace.size();
+
+        printf("%-10s %7d %10.1f %8.1f %6.2f %5.1f %5.1f %7d %6d %7d %6d %6d %6.1f%% %6.1f%%", name.c_str(), (int)trace.size(),
+               frames * params.loops / std::max(1e-6, stat.ns / 1e6), stat.bits * FrameRate(params) / frames / 1000.0,
+               stat.qpSum / frames, stat.qpMin, stat.qpMax, stat.recodes, stat.padded, stat.skipped,
+               stat.underflows, stat.overflows, stat.fullnessMin, stat.fullnessMax);
+        if (!params.windows.empty())
+            printf(" %8d %7.1f%%", stat.winOverflows, stat.winPeak);
+        printf("\n");
+
+        // HRD and window violations fail the run, so a parameter sweep in CI can gate on the exit code
+        if ((params.hrd != MFX_BRC_NO_HRD && (stat.underflows || stat.overflows)) || stat.winOverflows)
+            failed = 2;
+    }
+
+    if (csv)
+        fclose(csv);
+
+    return failed;
+}
@@ -0,0 +1,858 @@
+// Copyright (c) 2020 Intel Corporation
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+// Throughput benchmark of the software JPEG codec (CJPEGEncoder/CJPEGDecoder)
+// used by the MJPEG SW fallback. Works on generated pictures and needs no GPU.
+//
+// The codec sources are compiled into this tool with
+// JPEG_ENABLE_STAGE_PROFILING, so every run also reports how the codec time
+// is split between the Huffman, DCT, sampling, color conversion and copy
+// stages.
+
+#include "umc_defs.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "ippi.h"
+#include "jpegbase.h"
+#include "membuffout.h"
+#include "jpegenc.h"
+#include "jpegdec.h"
+
+typedef std::chrono::steady_clock bench_clock;
+
+enum BenchFormat
+{
+    BF_GRAY = 0,
+    BF_420,
+    BF_422,
+    BF_444,
+    BF_RGB,
+    BF_MAX
+};
+
+static const char* g_formatName[BF_MAX] = { "gray", "420", "422", "444", "rgb" };
+
+static const char* g_stageName[JSTAGE_MAX] = { "huff", "dct", "samp", "color", "copy" };
+
+struct BenchParams
+{
+    std::vector<mfxSize>     sizes;
+    std::vector<BenchFormat> formats;
+    std::vector<int>         restarts;   // restart interval in MCU rows
+    std::vector<int>         threads;
+    int                      frames;
+    int                      quality;
+    bool                     encode;
+    bool                     decode;
+    std::string              input;      // external JPEG file, decode only
+};
+
+struct StageTimes
+{
+    uint64_t total;                      // wall clock time of the run, ns
+    uint64_t codec;                      // time spent in the codec calls, ns
+    uint64_t stage[JSTAGE_MAX];          // sum over threads, ns
+};
+
+// Source picture kept in the layout the encoder consumes: one BGRA plane for
+// BF_RGB, 1 or 3 planes with the target chroma sampling otherwise.
+struct BenchPicture
+{
+    mfxSize              size;
+    BenchFormat          format;
+    int                  step[3];
+    mfxSize              planeSize[3];
+    std::vector<uint8_t> plane[3];
+};
+
+static void GetChromaShift(BenchFormat format, int& sx, int& sy)
+{
+    sx = (format == BF_420 || format == BF_422) ? 1 : 0;
+    sy = (format == BF_420) ? 1 : 0;
+}
+
+static JSS GetSampling(BenchFormat format)
+{
+    switch (format)
+    {
+    case BF_420: return JS_420;
+    case BF_422: return JS_422H;
+    default:     return JS_444;
+    }
+}
+
+// Smooth gradients with moving edges and a little noise: enough detail for the
+// entropy coder to be representative of camera content.
+static void GeneratePicture(BenchPicture& pic, mfxSize size, BenchFormat format)
+{
+    int sx, sy;
+    uint32_t seed = 0x12345678;
+
+    GetChromaShift(format, sx, sy);
+
+    pic.size   = size;
+    pic.format = format;
+
+    int nplanes = (format == BF_GRAY || format == BF_RGB) ? 1 : 3;
+
+    for (int c = 0; c < 3; c++)
+    {
+        pic.step[c] = 0;
+        pic.planeSize[c].width = pic.planeSize[c].height = 0;
+        pic.plane[c].clear();
+    }
+
+    for (int c = 0; c < nplanes; c++)
+    {
+        int w = (c == 0) ? size.width  : (size.width  + sx) >> sx;
+        int h = (c == 0) ? size.height : (size.height + sy) >> sy;
+        int channels = (format == BF_RGB) ? 4 : 1;
+
+        pic.planeSize[c].width  = w;
+        pic.planeSize[c].height = h;
+        pic.step[c] = (w * channels + 63) & ~63;
+        pic.plane[c].resize(pic.step[c] * h);
+
+        for (int y = 0; y < h; y++)
+        {
+            uint8_t* row = pic.plane[c].data() + y * pic.step[c];
+
+            for (int x = 0; x < w * channels; x++)
+            {
+                int px  = x / channels;
+                int ch  = x % channels + c;
+                int val = (px * (3 + ch) + y * (5 - ch)) & 0xff;
+
+                if (((px + 2 * y) >> 5) & 1)
+                    val = 255 - val;
+
+                seed = seed * 1103515245 + 12345;
+                val += (int)((seed >> 16) & 0xf) - 8;
+
+                row[x] = (uint8_t)std::min(255, std::max(0, val));
+            }
+        }
+    }
+}
+
+// Encodes the picture the way MJPEGVideoEncoder does: with a restart interval
+// every interval is a separate piece and the pieces are joined with RST
+// markers.
+static JERRCODE EncodePicture(CJPEGEncoder& enc, const BenchPicture& pic, int restartRows, int quality,
+                              std::vector<uint8_t>& stream, int& streamSize)
+{
+    JERRCODE jerr;
+    JSS      jss = GetSampling(pic.format);
+    JCOLOR   color = (BF_RGB == pic.format) ? JC_RGB : (BF_GRAY == pic.format) ? JC_GRAY : JC_YCBCR;
+    int      mcuWidth  = (pic.format == BF_420 || pic.format == BF_422) ? 16 : 8;
+    int      mcuHeight = (pic.format == BF_420) ? 16 : 8;
+    int      numxMCU = (pic.size.width  + mcuWidth  - 1) / mcuWidth;
+    int      numyMCU = (pic.size.height + mcuHeight - 1) / mcuHeight;
+    int      restart = restartRows * numxMCU;
+    int      numPieces = restart ? (numxMCU * numyMCU + restart - 1) / restart : 1;
+
+    streamSize = 0;
+
+    for (int piece = 0; piece < numPieces; piece++)
+    {
+        CMemBuffOutput out;
+
+        jerr = out.Open(stream.data() + streamSize, (int)stream.size() - streamSize);
+        if (JPEG_OK != jerr)
+            return jerr;
+
+        jerr = enc.SetDestination(&out);
+        if (JPEG_OK != jerr)
+            return jerr;
+
+        if (BF_RGB == pic.format)
+        {
+            jerr = enc.SetSource((uint8_t*)pic.plane[0].data(), pic.step[0], pic.size, 4, JC_BGRA, JS_444, 8);
+        }
+        else
+        {
+            uint8_t* pSrc[4] = { (uint8_t*)pic.plane[0].data(), (uint8_t*)pic.plane[1].data(), (uint8_t*)pic.plane[2].data(), 0 };
+            int      step[4] = { pic.step[0], pic.step[1], pic.step[2], 0 };
+            int      channels = (BF_GRAY == pic.format) ? 1 : 3;
+
+            jerr = enc.SetSource(pSrc, step, pic.size, channels, (BF_GRAY == pic.format) ? JC_GRAY : JC_YCBCR, jss, 8);
+        }
+        if (JPEG_OK != jerr)
+            return jerr;
+
+        jerr = enc.SetParams(JPEG_BASELINE, color, jss, restart, 1, numPieces, piece, 0, piece, 0, quality, JT_OLD);
+        if (JPEG_OK != jerr)
+            return jerr;
+
+        jerr = enc.WriteHeader();
+        if (JPEG_OK != jerr)
+            return jerr;
+
+        jerr = enc.WriteData();
+        if (JPEG_OK != jerr)
+            return jerr;
+
+        streamSize += out.GetPosition();
+
+        if (piece != numPieces - 1)
+        {
+            if (streamSize + 2 > (int)stream.size())
+                return JPEG_ERR_BUFF;
+
+            stream[streamSize++] = 0xff;
+            stream[streamSize++] = (uint8_t)(0xd0 + (piece % 8));
+        }
+    }
+
+    return JPEG_OK;
+}
+
+// Decoded picture in the layout the MJPEG decoder writes to its internal
+// frame, plus a second buffer standing in for the output surface.
+struct DecodedPicture
+{
+    int                  step[4];
+    uint8_t*             pDst[4];
+    std::vector<uint8_t> frame;
+    std::vector<uint8_t> surface;
+    mfxSize              planeSize[4];
+    int                  nplanes;
+    JCOLOR               color;
+    JSS                  sampling;
+    int                  channels;
+    std::vector<int16_t> coefs;          // progressive streams only
+};
+
+static JERRCODE PrepareDecodedPicture(DecodedPicture& out, mfxSize size, int channels, JCOLOR color, JSS sampling)
+{
+    int sx = 0, sy = 0;
+
+    out.channels = channels;
+    memset(out.pDst, 0, sizeof(out.pDst));
+    memset(out.step, 0, sizeof(out.step));
+
+    if (JC_RGB == color || JC_BGR == color || JC_CMYK == color || JC_YCCK == color)
+    {
+        // the decoder converts these to BGRA as for RGB32 surfaces
+        out.color    = JC_BGRA;
+        out.sampling = JS_444;
+        out.nplanes  = 1;
+        out.step[0]  = (size.width * 4 + 63) & ~63;
+        out.planeSize[0].width  = size.width * 4;
+        out.planeSize[0].height = size.height;
+    }
+    else if (JC_GRAY == color)
+    {
+        out.color    = JC_GRAY;
+        out.sampling = JS_444;
+        out.nplanes  = 1;
+        out.step[0]  = (size.width + 63) & ~63;
+        out.planeSize[0] = size;
+    }
+    else if (JC_YCBCR == color && JS_420 == sampling)
+    {
+        // NV12, as for the MJPEG decoder with 4:2:0 streams
+        out.color    = JC_NV12;
+        out.sampling = JS_420;
+        out.nplanes  = 2;
+        out.step[0]  = out.step[1] = (size.width + 63) & ~63;
+        out.planeSize[0] = size;
+        out.planeSize[1].width  = size.width;
+        out.planeSize[1].height = (size.height + 1) >> 1;
+    }
+    else if (JC_YCBCR == color && (JS_444 == sampling || JS_422H == sampling || JS_422V == sampling))
+    {
+        sx = (JS_422H == sampling) ? 1 : 0;
+        sy = (JS_422V == sampling) ? 1 : 0;
+
+        out.color    = JC_YCBCR;
+        out.sampling = sampling;
+        out.nplanes  = 3;
+        out.planeSize[0] = size;
+        out.planeSize[1].width  = out.planeSize[2].width  = (size.width  + sx) >> sx;
+        out.planeSize[1].height = out.planeSize[2].height = (size.height + sy) >> sy;
+        out.step[0] = (out.planeSize[0].width + 63) & ~63;
+        out.step[1] = out.step[2] = (out.planeSize[1].width + 63) & ~63;
+    }
+    else
+    {
+        return JPEG_NOT_IMPLEMENTED;
+    }
+
+    size_t total = 0;
+    for (int c = 0; c < out.nplanes; c++)
+        total += (size_t)out.step[c] * out.planeSize[c].height;
+
+    out.frame.resize(total);
+    out.surface.resize(total);
+
+    uint8_t* ptr = out.frame.data();
+    for (int c = 0; c < out.nplanes; c++)
+    {
+        out.pDst[c] = ptr;
+        ptr += (size_t)out.step[c] * out.planeSize[c].height;
+    }
+
+    return JPEG_OK;
+}
+
+// Splits a progressive stream into pieces of one scan each, the way the MJPEG
+// decoder's bitstream parser does. A piece starts with the tables following
+// the previous scan, the first one with the image header.
+static JERRCODE SplitScans(const uint8_t* stream, int streamSize, std::vector<std::pair<int, int> >& scans)
+{
+    int pos   = 2; // SOI
+    int start = 0;
+
+    scans.clear();
+
+    while (pos + 4 <= streamSize)
+    {
+        if (0xff != stream[pos])
+            return JPEG_ERR_BAD_DATA;
+
+        uint8_t marker = stream[pos + 1];
+        if (0xff == marker)
+        {
+            pos += 1; // fill byte
+            continue;
+        }
+        if (JM_EOI == marker)
+            break;
+
+        pos += 2 + ((stream[pos + 2] << 8) | stream[pos + 3]);
+
+        if (JM_SOS == marker)
+        {
+            // entropy coded data ends at a marker other than RSTn
+            while (pos + 1 < streamSize &&
+                   !(0xff == stream[pos] && 0 != stream[pos + 1] && (stream[pos + 1] < JM_RST0 || stream[pos + 1] > JM_RST7)))
+            {
+                pos += 1;
+            }
+
+            scans.push_back(std::make_pair(start, pos - start));
+            start = pos;
+        }
+    }
+
+    return scans.empty() ? JPEG_ERR_BAD_DATA : JPEG_OK;
+}
+
+// Progressive streams go through the scan by scan entry points used by
+// MJPEGVideoDecoderMFX, here with all scans and rows on one thread
+static JERRCODE DecodeProgressive(CJPEGDecoder& dec, const uint8_t* stream, int streamSize, DecodedPicture& out)
+{
+    std::vector<std::pair<int, int> > scans;
+    int      width, height, channels, precision;
+    JCOLOR   color;
+    JSS      sampling;
+    JERRCODE jerr;
+
+    jerr = SplitScans(stream, streamSize, scans);
+    if (JPEG_OK != jerr)
+        return jerr;
+
+    out.coefs.assign((size_t)dec.m_numxMCU * dec.m_numyMCU * dec.m_nblock * DCTSIZE2, 0);
+
+    for (size_t s = 0; s < scans.size(); s++)
+    {
+        // the tables of the scan, the header is parsed again for the first one
+        jerr = dec.SetSource(stream + scans[s].first, scans[s].second);
+        if (JPEG_OK != jerr)
+            return jerr;
+
+        jerr = dec.ReadHeader(&width, &height, &channels, &color, &sampling, &precision);
+        if (JPEG_OK != jerr)
+            return jerr;
+
+        jerr = dec.ReadScanProgressive(out.coefs.data(), 0);
+        if (JPEG_OK != jerr)
+            return jerr;
+    }
+
+    return dec.ReconstructProgressive(out.coefs.data(), 0, dec.m_numyMCU);
+}
+
+static JERRCODE DecodePicture(CJPEGDecoder& dec, const uint8_t* stream, int streamSize, DecodedPicture& out, bool& prepared)
+{
+    int      width, height, channels, precision;
+    JCOLOR   color;
+    JSS      sampling;
+    JERRCODE jerr;
+
+    jerr = dec.SetSource(stream, streamSize);
+    if (JPEG_OK != jerr)
+        return jerr;
+
+    jerr = dec.ReadHeader(&width, &height, &channels, &color, &sampling, &precision);
+    if (JPEG_OK != jerr)
+        return jerr;
+
+    if (precision != 8)
+        return JPEG_NOT_IMPLEMENTED;
+
+    mfxSize size = { width, height };
+
+    if (!prepared)
+    {
+        jerr = PrepareDecodedPicture(out, size, channels, color, sampling);
+        if (JPEG_OK != jerr)
+            return jerr;
+
+        prepared = true;
+    }
+
+    if (1 == out.nplanes)
+        jerr = dec.SetDestination(out.pDst[0], out.step[0], size, (JC_BGRA == out.color) ? 4 : 1, out.color, out.sampling, 8);
+    else
+        jerr = dec.SetDestination(out.pDst, out.step, size, out.channels, out.color, out.sampling, 8);
+    if (JPEG_OK != jerr)
+        return jerr;
+
+    // streams with restart intervals are decoded through the piece entry
+    // point used by MJPEGVideoDecoderMFX, here with all intervals at once
+    int restart = dec.m_curr_scan ? dec.m_curr_scan->jpeg_restart_interval : 0;
+
+    if (JPEG_PROGRESSIVE == dec.Mode())
+    {
+        jerr = DecodeProgressive(dec, stream, streamSize, out);
+    }
+    else if (restart && JPEG_BASELINE == dec.Mode())
+    {
+        uint32_t numRestarts = (dec.m_numxMCU * dec.m_numyMCU + restart - 1) / restart;
+
+        jerr = dec.ReadData(0, numRestarts);
+    }
+    else
+    {
+        jerr = dec.ReadData();
+    }
+    if (JPEG_OK != jerr)
+        return jerr;
+
+    // copy to the output surface, accounted to the copy stage
+    {
+        bench_clock::time_point start = bench_clock::now();
+        size_t offset = 0;
+
+        for (int c = 0; c < out.nplanes; c++)
+        {
+            mfxSize roi = out.planeSize[c];
+            if (JC_NV12 == out.color && 1 == c)
+                roi.width = (roi.width + 1) & ~1;
+
+            mfxiCopy_8u_C1R(out.frame.data() + offset, out.step[c], out.surface.data() + offset, out.step[c], roi);
+            offset += (size_t)out.step[c] * out.planeSize[c].height;
+        }
+
+        dec.m_stage_time[JSTAGE_COPY] += (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(bench_clock::now() - start).count();
+    }
+
+    return JPEG_OK;
+}
+
+static uint64_t ElapsedNs(bench_clock::time_point start)
+{
+    return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(bench_clock::now() - start).count();
+}
+
+// Runs 'frames' iterations of 'work' spread over 'numThreads' threads, each
+// thread owning its own codec object. Returns false if any call failed.
+template <class Codec, class Work>
+static bool RunThreads(int numThreads, int frames, StageTimes& times, Work work)
+{
+    std::vector<std::thread>  pool;
+    std::vector<StageTimes>   threadTimes(numThreads);
+    std::atomic<int>          next(0);
+    std::atomic<bool>         failed(false);
+
+    bench_clock::time_point start = bench_clock::now();
+
+    for (int t = 0; t < numThreads; t++)
+    {
+        pool.emplace_back([&, t]()
+        {
+            Codec      codec;
+            StageTimes& local = threadTimes[t];
+
+            memset(&local, 0, sizeof(local));
+
+            for (int n = next++; n < frames && !failed; n = next++)
+            {
+                bench_clock::time_point callStart = bench_clock::now();
+
+                if (JPEG_OK != work(codec, t))
+                    failed = true;
+
+                local.codec += ElapsedNs(callStart);
+            }
+
+            for (int s = 0; s < JSTAGE_MAX; s++)
+                local.stage[s] = codec.m_stage_time[s];
+        });
+    }
+
+    for (auto& thread : pool)
+        thread.join();
+
+    memset(&times, 0, sizeof(times));
+    times.total = ElapsedNs(start);
+
+    for (auto& local : threadTimes)
+    {
+        times.codec += local.codec;
+        for (int s = 0; s < JSTAGE_MAX; s++)
+            times.stage[s] += local.stage[s];
+    }
+
+    return !failed;
+}
+
+static void PrintHeader()
+{
+    printf("%-4s %-5s %-10s %4s %4s %9s %9s %9s", "op", "fmt", "size", "rst", "thr", "MPix/s", "ms/frame", "KB/frame");
+    for (int s = 0; s < JSTAGE_MAX; s++)
+        printf(" %6s", g_stageName[s]);
+    printf(" %6s\n", "other");
+}
+
+static void PrintResult(const char* op, const char* fmt, mfxSize size, int restart, int threads, int frames,
+                        const StageTimes& times, int streamSize)
+{
+    double seconds = times.total * 1e-9;
+    double mpix    = (double)size.width * size.height * frames / 1e6;
+    char   sizeStr[32];
+    char   rstStr[16];
+
+    snprintf(sizeStr, sizeof(sizeStr), "%dx%d", size.width, size.height);
+    if (restart < 0)
+        snprintf(rstStr, sizeof(rstStr), "-");
+    else
+        snprintf(rstStr, sizeof(rstStr), "%d", restart);
+
+    printf("%-4s %-5s %-10s %4s %4d %9.1f %9.2f %9.1f", op, fmt, sizeStr, rstStr, threads,
+        mpix / seconds, times.total * 1e-6 / frames, streamSize / 1024.0);
+
+    // stage split in percent of the time spent inside the codec
+    uint64_t accounted = 0;
+    for (int s = 0; s < JSTAGE_MAX; s++)
+    {
+        accounted += times.stage[s];
+        printf(" %5.1f%%", times.codec ? 100.0 * times.stage[s] / times.codec : 0.0);
+    }
+    printf(" %5.1f%%\n", times.codec ? 100.0 * (times.codec - std::min(accounted, times.codec)) / times.codec : 0.0);
+}
+
+static bool BenchEncodeDecode(const BenchParams& params, mfxSize size, BenchFormat format, int restart)
+{
+    BenchPicture pic;
+    GeneratePicture(pic, size, format);
+
+    // worst case: uncompressed 4:4:4 plus headers
+    size_t bufSize = (size_t)size.width * size.height * 4 + 65536;
+    std::vector<uint8_t> reference(bufSize);
+    int refSize = 0;
+
+    {
+        CJPEGEncoder enc;
+        if (JPEG_OK != enc.SetDefaultQuantTable((uint16_t)params.quality) ||
+            JPEG_OK != enc.SetDefaultACTable() || JPEG_OK != enc.SetDefaultDCTable() ||
+            JPEG_OK != EncodePicture(enc, pic, restart, params.quality, reference, refSize))
+        {
+            fprintf(stderr, "error: failed to encode %s %dx%d\n", g_formatName[format], size.width, size.height);
+            return false;
+        }
+    }
+
+    for (int threads : params.threads)
+    {
+        StageTimes times;
+
+        if (params.encode)
+        {
+            std::vector<std::vector<uint8_t>> streams(threads, std::vector<uint8_t>(bufSize));
+            std::vector<char> inited(threads, 0);
+            int streamSize = 0;
+
+            bool ok = RunThreads<CJPEGEncoder>(threads, params.frames, times, [&](CJPEGEncoder& enc, int t)
+            {
+                if (!inited[t])
+                {
+                    if (JPEG_OK != enc.SetDefaultQuantTable((uint16_t)params.quality) ||
+                        JPEG_OK != enc.SetDefaultACTable() || JPEG_OK != enc.SetDefaultDCTable())
+                        return JPEG_ERR_INTERNAL;
+                    inited[t] = 1;
+                }
+                int len = 0;
+                JERRCODE jerr = EncodePicture(enc, pic, restart, params.quality, streams[t], len);
+                if (0 == t)
+                    streamSize = len;
+                return jerr;
+            });
+            if (!ok)
+            {
+                fprintf(stderr, "error: encoding failed\n");
+                return false;
+            }
+            PrintResult("enc", g_formatName[format], size, restart, threads, params.frames, times, streamSize);
+        }
+
+        if (params.decode)
+        {
+            std::vector<DecodedPicture> outs(threads);
+            std::vector<char> prepared(threads, 0);
+
+            bool ok = RunThreads<CJPEGDecoder>(threads, params.frames, times, [&](CJPEGDecoder& dec, int t)
+            {
+                bool ready = prepared[t] != 0;
+                JERRCODE jerr = DecodePicture(dec, reference.data(), refSize, outs[t], ready);
+                prepared[t] = ready;
+                return jerr;
+            });
+            if (!ok)
+            {
+                fprintf(stderr, "error: decoding failed\n");
+                return false;
+            }
+            PrintResult("dec", g_formatName[format], size, restart, threads, params.frames, times, refSize);
+        }
+    }
+
+    return true;
+}
+
+static bool BenchFile(const BenchParams& params)
+{
+    std::vector<uint8_t> stream;
+    FILE* f = fopen(params.input.c_str(), "rb");
+
+    if (!f)
+    {
+        fprintf(stderr, "error: can't open %s\n", params.input.c_str());
+        return false;
+    }
+
+    uint8_t chunk[65536];
+    size_t  read;
+    while ((read = fread(chunk, 1, sizeof(chunk), f)) > 0)
+        stream.insert(stream.end(), chunk, chunk + read);
+    fclose(f);
+
+    // probe the stream to report its properties
+    CJPEGDecoder probe;
+    int      width, height, channels, precision;
+    JCOLOR   color;
+    JSS      sampling;
+
+    if (JPEG_OK != probe.SetSource(stream.data(), stream.size()) ||
+        JPEG_OK != probe.ReadHeader(&width, &height, &channels, &color, &sampling, &precision))
+    {
+        fprintf(stderr, "error: %s is not a supported JPEG file\n", params.input.c_str());
+        return false;
+    }
+
+    static const char* modeName[] = { "unknown", "baseline", "extended", "progressive", "lossless" };
+    printf("%s: %s %dx%d, %d components, %d bits\n", params.input.c_str(), modeName[probe.Mode()],
+        width, height, channels, precision);
+
+    PrintHeader();
+
+    mfxSize size = { width, height };
+    const char* fmt = (JPEG_PROGRESSIVE == probe.Mode()) ? "prog" : (JPEG_LOSSLESS == probe.Mode()) ? "lossl" : "file";
+
+    for (int threads : params.threads)
+    {
+        StageTimes times;
+        std::vector<DecodedPicture> outs(threads);
+        std::vector<char> prepared(threads, 0);
+
+        bool ok = RunThreads<CJPEGDecoder>(threads, params.frames, times, [&](CJPEGDecoder& dec, int t)
+        {
+            bool ready = prepared[t] != 0;
+            JERRCODE jerr = DecodePicture(dec, stream.data(), (int)stream.size(), outs[t], ready);
+            prepared[t] = ready;
+            return jerr;
+        });
+        if (!ok)
+        {
+            fprintf(stderr, "error: decoding of %s failed\n", params.input.c_str());
+            return false;
+        }
+        PrintResult("dec", fmt, size, -1, threads, params.frames, times, (int)stream.size());
+    }
+
+    return true;
+}
+
+static void PrintUsage(const char* app)
+{
+    printf("Usage: %s [options]\n", app);
+    printf("Measures encode and decode throughput of the SW JPEG codec on generated pictures.\n\n");
+    printf("  -s WxH[,WxH...]    picture sizes (default 1280x720,1920x1080,3840x2160)\n");
+    printf("  -c fmt[,fmt...]    chroma formats: gray,420,422,444,rgb (default all)\n");
+    printf("  -r n[,n...]        restart interval in MCU rows, 0 - none (default 0,1)\n");
+    printf("  -t n[,n...]        number of threads, each codes whole frames (default 1,<cores>)\n");
+    printf("  -n frames          frames per measurement (default 60)\n");
+    printf("  -q quality         quality 1..100 (default 90)\n");
+    printf("  -enc | -dec        run encoding or decoding only\n");
+    printf("  -i file.jpg        decode the given file instead of generated pictures;\n");
+    printf("                     use it for progressive and lossless streams which the\n");
+    printf("                     encoder can't produce\n\n");
+    printf("Stage columns show the share of the codec time spent in Huffman coding,\n");
+    printf("DCT, chroma up/down sampling, color conversion and copies.\n");
+}
+
+static std::vector<std::string> SplitList(const char* arg)
+{
+    std::vector<std::string> items;
+    std::string s(arg);
+    size_t pos = 0;
+
+    while (pos <= s.size())
+    {
+        size_t end = s.find(',', pos);
+        if (end == std::string::npos)
+            end = s.size();
+        if (end > pos)
+            items.push_back(s.substr(pos, end - pos));
+        pos = end + 1;
+    }
+
+    return items;
+}
+
+static bool ParseParams(int argc, char* argv[], BenchParams& params)
+{
+    params.frames  = 60;
+    params.quality = 90;
+    params.encode  = true;
+    params.decode  = true;
+
+    for (int i = 1; i < argc; i++)
+    {
+        std::string opt(argv[i]);
+        bool hasValue = i + 1 < argc;
+
+        if (opt == "-s" && hasValue)
+        {
+            for (auto& item : SplitList(argv[++i]))
+            {
+                mfxSize size = { 0, 0 };
+                if (2 != sscanf(item.c_str(), "%dx%d", &size.width, &size.height) || size.width <= 0 || size.height <= 0)
+                    return false;
+                params.sizes.push_back(size);
+            }
+        }
+        else if (opt == "-c" && hasValue)
+        {
+            for (auto& item : SplitList(argv[++i]))
+            {
+                int f = 0;
+                while (f < BF_MAX && item != g_formatName[f])
+                    f++;
+                if (f == BF_MAX)
+                    return false;
+                params.formats.push_back((BenchFormat)f);
+            }
+        }
+        else if (opt == "-r" && hasValue)
+        {
+            for (auto& item : SplitList(argv[++i]))
+                params.restarts.push_back(std::max(0, atoi(item.c_str())));
+        }
+        else if (opt == "-t" && hasValue)
+        {
+            for (auto& item : SplitList(argv[++i]))
+                params.threads.push_back(std::max(1, atoi(item.c_str())));
+        }
+        else if (opt == "-n" && hasValue)
+            params.frames = std::max(1, atoi(argv[++i]));
+        else if (opt == "-q" && hasValue)
+            params.quality = std::min(100, std::max(1, atoi(argv[++i])));
+        else if (opt == "-i" && hasValue)
+            params.input = argv[++i];
+        else if (opt == "-enc")
+            params.decode = false;
+        else if (opt == "-dec")
+            params.encode = false;
+        else
+            return false;
+    }
+
+    if (params.sizes.empty())
+    {
+        params.sizes.push_back({ 1280, 720 });
+        params.sizes.push_back({ 1920, 1080 });
+        params.sizes.push_back({ 3840, 2160 });
+    }
+    if (params.formats.empty())
+    {
+        for (int f = 0; f < BF_MAX; f++)
+            params.formats.push_back((BenchFormat)f);
+    }
+    if (params.restarts.empty())
+    {
+        params.restarts.push_back(0);
+        params.restarts.push_back(1);
+    }
+    if (params.threads.empty())
+    {
+        int cores = (int)std::thread::hardware_concurrency();
+        params.threads.push_back(1);
+        if (cores > 1)
+            params.threads.push_back(cores);
+    }
+
+    return true;
+}
+
+int main(int argc, char* argv[])
+{
+    BenchParams params;
+
+    if (!ParseParams(argc, argv, params))
+    {
+        PrintUsage(argv[0]);
+        return 1;
+    }
+
+    if (!params.input.empty())
+        return BenchFile(params) ? 0 : 1;
+
+    PrintHeader();
+
+    for (auto& size : params.sizes)
+        for (auto format : params.formats)
+            for (int restart : params.restarts)
+                if (!BenchEncodeDecode(params, size, format, restart))
+                    return 1;
+
+    return 0;
+}
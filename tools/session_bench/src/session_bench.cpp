@@ -0,0 +1,551 @@
+// Copyright (c) 2020 Intel Corporation
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+// Time to the first decoded frame of a short clip, the way a service which
+// decodes one clip per request sees it. Every run decodes the same stream
+// until the first frame is synchronized:
+//   cold   MFXInitEx, DecodeHeader, DECODE_Init, first frame, DECODE_Close, MFXClose
+//   reset  one session and decoder for all runs: DecodeHeader, DECODE_Reset, first frame
+// An idle session is kept open during the measurement, so the library stays
+// loaded and the cold runs reuse the scheduler threads of the closed sessions.
+
+#include "mfxvideo.h"
+#include "mfxjpeg.h"
+#include "mfxvp8.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if defined(LIBVA_DRM_SUPPORT)
+#include <fcntl.h>
+#include <unistd.h>
+#include <va/va.h>
+#include <va/va_drm.h>
+#endif
+
+typedef std::chrono::steady_clock bench_clock;
+
+#define BENCH_ALIGN32(x) (((x) + 31) & ~31)
+
+struct BenchParams
+{
+    std::string input;
+    std::string device;
+    mfxU32      codecId;
+    int         runs;
+    bool        sw;
+};
+
+// times of one run in microseconds
+struct BenchTimes
+{
+    double session;   // MFXInitEx and SetHandle
+    double init;      // DecodeHeader and DECODE_Init/Reset
+    double frame;     // the first frame is decoded and synchronized
+    double total;
+};
+
+struct BenchContext
+{
+    mfxIMPL                        impl;
+    mfxHDL                         display;
+    std::vector<mfxU8>             stream;
+    std::vector<mfxFrameSurface1>  surfaces;
+    std::vector<std::vector<mfxU8>> buffers;
+};
+
+static const struct
+{
+    const char* name;
+    mfxU32      codecId;
+} g_codecs[] =
+{
+    { "h264",  MFX_CODEC_AVC   },
+    { "h265",  MFX_CODEC_HEVC  },
+    { "mpeg2", MFX_CODEC_MPEG2 },
+    { "vc1",   MFX_CODEC_VC1   },
+    { "mjpeg", MFX_CODEC_JPEG  },
+    { "vp8",   MFX_CODEC_VP8   },
+    { "vp9",   MFX_CODEC_VP9   },
+#if (MFX_VERSION >= 1034)
+    { "av1",   MFX_CODEC_AV1   },
+#endif
+};
+
+static double ElapsedUs(bench_clock::time_point start)
+{
+    return std::chrono::duration<double, std::micro>(bench_clock::now() - start).count();
+}
+
+static bool ReadFile(const std::string& path, std::vector<mfxU8>& data)
+{
+    FILE* f = fopen(path.c_str(), "rb");
+    if (!f)
+        return false;
+
+    mfxU8 chunk[64 * 1024];
+    size_t read;
+    while ((read = fread(chunk, 1, sizeof(chunk), f)) > 0)
+        data.insert(data.end(), chunk, chunk + read);
+
+    fclose(f);
+    return !data.empty();
+}
+
+// system memory surface for the output format of the decoder
+static bool AllocSurface(const mfxFrameInfo& info, mfxFrameSurface1& surface, std::vector<mfxU8>& buffer)
+{
+    mfxU32 width  = BENCH_ALIGN32(info.Width);
+    mfxU32 height = BENCH_ALIGN32(info.Height);
+    mfxU32 pitch;
+
+    memset(&surface, 0, sizeof(surface));
+    surface.Info = info;
+
+    switch (info.FourCC)
+    {
+    case MFX_FOURCC_NV12:
+        pitch = width;
+        buffer.resize(pitch * height * 3 / 2);
+        surface.Data.Y  = buffer.data();
+        surface.Data.UV = surface.Data.Y + pitch * height;
+        break;
+    case MFX_FOURCC_P010:
+        pitch = width * 2;
+        buffer.resize(pitch * height * 3 / 2);
+        surface.Data.Y  = buffer.data();
+        surface.Data.UV = surface.Data.Y + pitch * height;
+        break;
+    case MFX_FOURCC_YUY2:
+        pitch = width * 2;
+        buffer.resize(pitch * height);
+        surface.Data.Y = buffer.data();
+        surface.Data.U = surface.Data.Y + 1;
+        surface.Data.V = surface.Data.Y + 3;
+        break;
+    case MFX_FOURCC_RGB4:
+        pitch = width * 4;
+        buffer.resize(pitch * height);
+        surface.Data.B = buffer.data();
+        surface.Data.G = surface.Data.B + 1;
+        surface.Data.R = surface.Data.B + 2;
+        surface.Data.A = surface.Data.B + 3;
+        break;
+    default:
+        return false;
+    }
+
+    surface.Data.PitchHigh = (mfxU16)(pitch >> 16);
+    surface.Data.PitchLow  = (mfxU16)(pitch & 0xffff);
+    return true;
+}
+
+static mfxStatus InitSession(BenchContext& ctx, mfxSession& session)
+{
+    mfxInitParam par = {};
+    par.Implementation = ctx.impl;
+    par.Version.Major  = MFX_VERSION_MAJOR;
+    par.Version.Minor  = MFX_VERSION_MINOR;
+
+    mfxStatus sts = MFXInitEx(par, &session);
+    if (sts < MFX_ERR_NONE)
+        return sts;
+
+    if (ctx.display)
+    {
+        sts = MFXVideoCORE_SetHandle(session, MFX_HANDLE_VA_DISPLAY, ctx.display);
+        if (sts < MFX_ERR_NONE)
+            MFXClose(session);
+    }
+
+    return sts;
+}
+
+// the surfaces are allocated once for all runs, it is not what is measured
+static mfxStatus PrepareSurfaces(BenchContext& ctx, mfxSession session, mfxVideoParam& par)
+{
+    mfxFrameAllocRequest request = {};
+
+    mfxStatus sts = MFXVideoDECODE_QueryIOSurf(session, &par, &request);
+    if (sts < MFX_ERR_NONE)
+        return sts;
+
+    ctx.surfaces.resize(request.NumFrameSuggested);
+    ctx.buffers.resize(request.NumFrameSuggested);
+    for (size_t i = 0; i < ctx.surfaces.size(); i++)
+    {
+        if (!AllocSurface(request.Info, ctx.surfaces[i], ctx.buffers[i]))
+            return MFX_ERR_UNSUPPORTED;
+    }
+
+    return MFX_ERR_NONE;
+}
+
+static mfxFrameSurface1* GetFreeSurface(BenchContext& ctx)
+{
+    for (auto& surface : ctx.surfaces)
+    {
+        if (!surface.Data.Locked)
+            return &surface;
+    }
+    return NULL;
+}
+
+static mfxStatus DecodeHeader(BenchContext& ctx, mfxSession session, mfxBitstream& bs, mfxVideoParam& par)
+{
+    memset(&bs, 0, sizeof(bs));
+    bs.Data       = ctx.stream.data();
+    bs.DataLength = (mfxU32)ctx.stream.size();
+    bs.MaxLength  = (mfxU32)ctx.stream.size();
+
+    mfxU32 codecId = par.mfx.CodecId;
+    memset(&par, 0, sizeof(par));
+    par.mfx.CodecId = codecId;
+    par.IOPattern   = MFX_IOPATTERN_OUT_SYSTEM_MEMORY;
+    par.AsyncDepth  = 1;
+
+    return MFXVideoDECODE_DecodeHeader(session, &bs, &par);
+}
+
+static mfxStatus DecodeFirstFrame(BenchContext& ctx, mfxSession session, mfxBitstream& bs)
+{
+    mfxBitstream* pBs = &bs;
+
+    for (;;)
+    {
+        mfxFrameSurface1* work = GetFreeSurface(ctx);
+        mfxFrameSurface1* out = NULL;
+        mfxSyncPoint syncp = NULL;
+
+        if (!work)
+            return MFX_ERR_NOT_ENOUGH_BUFFER;
+
+        mfxStatus sts = MFXVideoDECODE_DecodeFrameAsync(session, pBs, work, &out, &syncp);
+
+        if (MFX_WRN_DEVICE_BUSY == sts)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            continue;
+        }
+        if (MFX_ERR_MORE_DATA == sts && pBs)
+        {
+            // drain the decoder, the stream is over
+            pBs = NULL;
+            continue;
+        }
+        if (MFX_ERR_MORE_SURFACE == sts)
+            continue;
+        if (sts < MFX_ERR_NONE)
+            return sts;
+
+        if (syncp)
+            return MFXVideoCORE_SyncOperation(session, syncp, 60000);
+    }
+}
+
+static mfxStatus RunCold(BenchContext& ctx, const BenchParams& params, BenchTimes& times)
+{
+    mfxSession session = NULL;
+    mfxVideoParam par = {};
+    mfxBitstream bs;
+
+    par.mfx.CodecId = params.codecId;
+
+    bench_clock::time_point start = bench_clock::now();
+    mfxStatus sts = InitSession(ctx, session);
+    if (sts < MFX_ERR_NONE)
+        return sts;
+    times.session = ElapsedUs(start);
+
+    bench_clock::time_point init = bench_clock::now();
+    sts = DecodeHeader(ctx, session, bs, par);
+    if (sts >= MFX_ERR_NONE)
+    {
+        if (ctx.surfaces.empty())
+            sts = PrepareSurfaces(ctx, session, par);
+        if (sts >= MFX_ERR_NONE)
+            sts = MFXVideoDECODE_Init(session, &par);
+    }
+    times.init = ElapsedUs(init);
+
+    if (sts >= MFX_ERR_NONE)
+    {
+        bench_clock::time_point frame = bench_clock::now();
+        sts = DecodeFirstFrame(ctx, session, bs);
+        times.frame = ElapsedUs(frame);
+    }
+
+    MFXVideoDECODE_Close(session);
+    MFXClose(session);
+    times.total = ElapsedUs(start);
+
+    return sts;
+}
+
+static mfxStatus RunReset(BenchContext& ctx, const BenchParams& params, mfxSession session, BenchTimes& times)
+{
+    mfxVideoParam par = {};
+    mfxBitstream bs;
+
+    par.mfx.CodecId = params.codecId;
+
+    bench_clock::time_point start = bench_clock::now();
+    times.session = 0;
+
+    mfxStatus sts = DecodeHeader(ctx, session, bs, par);
+    if (sts >= MFX_ERR_NONE)
+        sts = MFXVideoDECODE_Reset(session, &par);
+    if (MFX_ERR_INCOMPATIBLE_VIDEO_PARAM == sts)
+    {
+        // the parameters do not fit, the decoder is initialized again
+        MFXVideoDECODE_Close(session);
+        sts = MFXVideoDECODE_Init(session, &par);
+    }
+    if (sts < MFX_ERR_NONE)
+        return sts;
+    times.init = ElapsedUs(start);
+
+    bench_clock::time_point frame = bench_clock::now();
+    sts = DecodeFirstFrame(ctx, session, bs);
+    times.frame = ElapsedUs(frame);
+    times.total = ElapsedUs(start);
+
+    return sts;
+}
+
+static void PrintHeader()
+{
+    printf("%-6s %-8s %10s %10s %10s %10s %10s %10s\n",
+        "mode", "stage", "avg,us", "min,us", "p50,us", "p90,us", "max,us", "runs");
+}
+
+static void PrintStage(const char* mode, const char* stage, std::vector<double> values)
+{
+    if (values.empty())
+        return;
+
+    std::sort(values.begin(), values.end());
+    double sum = 0;
+    for (double v : values)
+        sum += v;
+
+    printf("%-6s %-8s %10.1f %10.1f %10.1f %10.1f %10.1f %10d\n", mode, stage,
+        sum / values.size(), values.front(), values[values.size() / 2],
+        values[std::min(values.size() - 1, values.size() * 9 / 10)], values.back(), (int)values.size());
+}
+
+static void PrintTimes(const char* mode, const std::vector<BenchTimes>& times, bool withSession)
+{
+    std::vector<double> session, init, frame, total;
+
+    for (auto& t : times)
+    {
+        session.push_back(t.session);
+        init.push_back(t.init);
+        frame.push_back(t.frame);
+        total.push_back(t.total);
+    }
+
+    if (withSession)
+        PrintStage(mode, "session", session);
+    PrintStage(mode, "init", init);
+    PrintStage(mode, "frame", frame);
+    PrintStage(mode, "total", total);
+}
+
+static bool RunBench(BenchContext& ctx, const BenchParams& params)
+{
+    std::vector<BenchTimes> cold, reset;
+    BenchTimes times = {};
+    mfxSession anchor = NULL, session = NULL;
+    mfxStatus sts;
+
+    // keeps the library loaded between the cold runs
+    sts = InitSession(ctx, anchor);
+    if (sts < MFX_ERR_NONE)
+    {
+        fprintf(stderr, "error: MFXInitEx failed, %d\n", sts);
+        return false;
+    }
+
+    // the first run loads the decoder and warms the caches, it is not counted
+    for (int i = 0; i <= params.runs; i++)
+    {
+        sts = RunCold(ctx, params, times);
+        if (sts < MFX_ERR_NONE)
+        {
+            fprintf(stderr, "error: cold run %d failed, %d\n", i, sts);
+            MFXClose(anchor);
+            return false;
+        }
+        if (i)
+            cold.push_back(times);
+    }
+
+    sts = InitSession(ctx, session);
+    if (sts >= MFX_ERR_NONE)
+    {
+        mfxVideoParam par = {};
+        mfxBitstream bs;
+
+        par.mfx.CodecId = params.codecId;
+        sts = DecodeHeader(ctx, session, bs, par);
+        if (sts >= MFX_ERR_NONE)
+            sts = MFXVideoDECODE_Init(session, &par);
+    }
+    for (int i = 0; i <= params.runs && sts >= MFX_ERR_NONE; i++)
+    {
+        sts = RunReset(ctx, params, session, times);
+        if (i)
+            reset.push_back(times);
+    }
+    if (sts < MFX_ERR_NONE)
+        fprintf(stderr, "error: reset run failed, %d\n", sts);
+
+    if (session)
+    {
+        MFXVideoDECODE_Close(session);
+        MFXClose(session);
+    }
+    MFXClose(anchor);
+
+    PrintHeader();
+    PrintTimes("cold", cold, true);
+    PrintTimes("reset", reset, false);
+
+    return sts >= MFX_ERR_NONE;
+}
+
+static void PrintUsage(const char* app)
+{
+    printf("Usage: %s [options] -c codec -i stream\n", app);
+    printf("Measures the time to the first decoded frame with a new session per run\n");
+    printf("(cold) and with one session and decoder reset per run (reset).\n\n");
+    printf("  -c codec           h264, h265, mpeg2, vc1, mjpeg, vp8, vp9");
+#if (MFX_VERSION >= 1034)
+    printf(", av1");
+#endif
+    printf("\n");
+    printf("  -i stream          elementary stream, the first frame of it is decoded\n");
+    printf("  -n runs            runs per mode (default 100)\n");
+    printf("  -sw                use the software implementation\n");
+#if defined(LIBVA_DRM_SUPPORT)
+    printf("  -device path       DRM render node (default /dev/dri/renderD128)\n");
+#endif
+}
+
+static bool ParseParams(int argc, char* argv[], BenchParams& params)
+{
+    params.codecId = 0;
+    params.runs    = 100;
+    params.sw      = false;
+    params.device  = "/dev/dri/renderD128";
+
+    for (int i = 1; i < argc; i++)
+    {
+        std::string opt(argv[i]);
+        bool hasValue = i + 1 < argc;
+
+        if (opt == "-c" && hasValue)
+        {
+            std::string name(argv[++i]);
+            for (auto& codec : g_codecs)
+            {
+                if (name == codec.name)
+                    params.codecId = codec.codecId;
+            }
+            if (!params.codecId)
+                return false;
+        }
+        else if (opt == "-i" && hasValue)
+            params.input = argv[++i];
+        else if (opt == "-n" && hasValue)
+            params.runs = std::max(1, atoi(argv[++i]));
+        else if (opt == "-sw")
+            params.sw = true;
+#if defined(LIBVA_DRM_SUPPORT)
+        else if (opt == "-device" && hasValue)
+            params.device = argv[++i];
+#endif
+        else
+            return false;
+    }
+
+    return params.codecId && !params.input.empty();
+}
+
+int main(int argc, char* argv[])
+{
+    BenchParams params;
+    BenchContext ctx;
+
+    if (!ParseParams(argc, argv, params))
+    {
+        PrintUsage(argv[0]);
+        return 1;
+    }
+
+    if (!ReadFile(params.input, ctx.stream))
+    {
+        fprintf(stderr, "error: can't read %s\n", params.input.c_str());
+        return 1;
+    }
+
+    ctx.impl = params.sw ? MFX_IMPL_SOFTWARE : (MFX_IMPL_HARDWARE_ANY | MFX_IMPL_VIA_VAAPI);
+    ctx.display = NULL;
+
+#if defined(LIBVA_DRM_SUPPORT)
+    int fd = -1;
+    VADisplay display = NULL;
+
+    if (!params.sw)
+    {
+        int major = 0, minor = 0;
+
+        fd = open(params.device.c_str(), O_RDWR);
+        display = (fd >= 0) ? vaGetDisplayDRM(fd) : NULL;
+        if (!display || VA_STATUS_SUCCESS != vaInitialize(display, &major, &minor))
+        {
+            fprintf(stderr, "error: can't initialize VA on %s\n", params.device.c_str());
+            if (fd >= 0)
+                close(fd);
+            return 1;
+        }
+        ctx.display = display;
+    }
+#endif
+
+    bool ok = RunBench(ctx, params);
+
+#if defined(LIBVA_DRM_SUPPORT)
+    if (display)
+        vaTerminate(display);
+    if (fd >= 0)
+        close(fd);
+#endif
+
+    return ok ? 0 : 1;
+}
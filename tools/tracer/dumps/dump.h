@@ -520,6 +520,9 @@ public:
     DEFINE_DUMP_FUNCTION(mfxSyncPoint);
     DEFINE_DUMP_FUNCTION(mfxExtThreadsParam);
     DEFINE_DUMP_FUNCTION(mfxPlatform);
+#if (MFX_VERSION >= MFX_VERSION_NEXT)
+    DEFINE_DUMP_FUNCTION(mfxSessionMetrics);
+#endif
 
     //mfxenc
     DEFINE_DUMP_FUNCTION(mfxENCInput);
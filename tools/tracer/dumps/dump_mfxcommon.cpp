@@ -111,3 +111,24 @@ std::string DumpContext::dump(const std::string structName, const mfxPlatform &p
     str += structName + ".DeviceId=" + ToString(platform.DeviceId) + "\n";
     return str;
 }
+
+#if (MFX_VERSION >= MFX_VERSION_NEXT)
+std::string DumpContext::dump(const std::string structName, const mfxSessionMetrics &_struct)
+{
+    std::string str;
+    str += structName + ".QueueDepth[]=" + DUMP_RESERVED_ARRAY(_struct.QueueDepth) + "\n";
+    DUMP_FIELD(NumThreads);
+    DUMP_FIELD(TasksCompleted);
+    DUMP_FIELD(TaskCalls);
+    DUMP_FIELD(TaskTime);
+    DUMP_FIELD(SurfacesInUse);
+    DUMP_FIELD(SurfacesTotal);
+    DUMP_FIELD(CopyCalls);
+    DUMP_FIELD(CopyTime);
+    str += structName + ".Latencies=" + ToHexFormatString(_struct.Latencies) + "\n";
+    DUMP_FIELD(NumLatencies);
+    DUMP_FIELD(ResetLatencies);
+    DUMP_FIELD_RESERVED(reserved);
+    return str;
+}
+#endif
@@ -31,6 +31,7 @@ class ILog
 public:
     virtual ~ILog(){}
     virtual void WriteLog(const std::string &log) = 0;
+    virtual void Flush() {}
 };
 
 #endif //ILOG_H_
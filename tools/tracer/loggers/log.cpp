@@ -40,6 +40,7 @@ Log::Log()
     _logmap = {
        std::pair<eLogType,ILog*>(LOG_CONSOLE, new LogConsole())
       ,std::pair<eLogType,ILog*>(LOG_FILE, new LogFile())
+      ,std::pair<eLogType,ILog*>(LOG_BINARY, new LogBinary())
 #if defined(_WIN32) || defined(_WIN64)
       ,std::pair<eLogType,ILog*>(LOG_ETW, new LogEtwEvents())
 #else
@@ -102,6 +103,12 @@ void Log::clear()
     }
 }
 
+void Log::Flush()
+{
+    if (_sing_log)
+        _sing_log->_log->Flush();
+}
+
 void Log::WriteLog(const std::string &log)
 {
 
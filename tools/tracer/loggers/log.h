@@ -21,6 +21,7 @@
 #define LOGGER_H_
 
 #include <map>
+#include "log_binary.h"
 #include "log_console.h"
 #include "log_etw_events.h"
 #include "log_file.h"
@@ -34,6 +35,7 @@ enum eLogType{
 #else
     LOG_SYSLOG,
 #endif
+    LOG_BINARY,
 };
 
 enum eLogLevel{
@@ -46,6 +48,7 @@ class Log
 {
 public:
     static void WriteLog(const std::string &log);
+    static void Flush();
     static void SetLogType(eLogType type);
     static void SetFilePath(std::string file_path);
     static void SetLogLevel(eLogLevel level);
@@ -0,0 +1,219 @@
+// Copyright (c) 2020 Intel Corporation
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include "log_binary.h"
+#include "log_file.h"
+
+// drain period when nobody asks for it earlier
+#define BINLOG_DRAIN_PERIOD_MS 10
+#define BINLOG_FILE_BUFFER     (1 << 20)
+
+std::atomic<uint64_t> LogBinary::_instances(0);
+
+LogBinary::LogBinary()
+    : _id(++_instances)
+    , _file_path(LogFile::MakeFilePath("mfxtracer.bin"))
+    , _file(NULL)
+    , _stop(false)
+{
+}
+
+LogBinary::~LogBinary()
+{
+    if (_drain.joinable())
+    {
+        {
+            std::unique_lock<std::mutex> lock(_wake_mutex);
+            _stop = true;
+        }
+        _wake.notify_one();
+        _drain.join();
+    }
+
+    Flush();
+
+    if (_file)
+        fclose(_file);
+}
+
+void LogBinary::Start()
+{
+    _file = fopen(_file_path.c_str(), "wb");
+    if (_file)
+    {
+        setvbuf(_file, NULL, _IOFBF, BINLOG_FILE_BUFFER);
+
+        BinaryLogHeader header = {};
+        memcpy(header.magic, BINLOG_MAGIC, sizeof(header.magic));
+        header.version     = BINLOG_VERSION;
+        header.record_size = sizeof(BinaryLogRecord);
+        header.process_id  = (uint32_t)ThreadInfo::GetProcessId();
+        fwrite(&header, sizeof(header), 1, _file);
+    }
+
+    _drain = std::thread(&LogBinary::DrainThread, this);
+}
+
+LogBinary::Ring &LogBinary::GetRing(uint32_t &thread_id)
+{
+    // a ring lives as long as its thread, or the logger if that is shorter
+    static thread_local ThreadRing t_ring;
+
+    if (t_ring.owner != _id)
+    {
+        if (t_ring.ring)
+            t_ring.ring->closed = true;
+
+        t_ring.ring      = std::make_shared<Ring>();
+        t_ring.owner     = _id;
+        t_ring.thread_id = (uint32_t)ThreadInfo::GetThreadId();
+
+        std::unique_lock<std::mutex> lock(_rings_mutex);
+        _rings.push_back(t_ring.ring);
+    }
+
+    thread_id = t_ring.thread_id;
+    return *t_ring.ring;
+}
+
+void LogBinary::WriteLog(const std::string &log)
+{
+    std::call_once(_started, &LogBinary::Start, this);
+
+    uint32_t thread_id = 0;
+    Ring &ring = GetRing(thread_id);
+
+    const uint64_t timestamp = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+    // same rule LogFile uses to indent the lines
+    const uint16_t type = (log.find("function:") == std::string::npos && log.find(">>") == std::string::npos)
+        ? BINLOG_RECORD_DUMP : BINLOG_RECORD_API;
+
+    const char *data  = log.data();
+    size_t      left  = log.size();
+    uint16_t    flags = BINLOG_FLAG_FIRST;
+    uint32_t    head  = ring.head.load(std::memory_order_relaxed);
+
+    do
+    {
+        while (head - ring.tail.load(std::memory_order_acquire) == RING_SIZE)
+        {
+            // the ring is full, records are never dropped
+            _wake.notify_one();
+            std::this_thread::yield();
+        }
+
+        BinaryLogRecord &rec = ring.records[head & (RING_SIZE - 1)];
+        size_t size = std::min(left, sizeof(rec.payload));
+
+        rec.timestamp = timestamp;
+        rec.thread_id = thread_id;
+        rec.type      = type;
+        rec.size      = (uint16_t)size;
+        memset(rec.reserved, 0, sizeof(rec.reserved));
+        memcpy(rec.payload, data, size);
+
+        data += size;
+        left -= size;
+        if (!left)
+            flags |= BINLOG_FLAG_LAST;
+        rec.flags = flags;
+        flags = 0;
+
+        ring.head.store(++head, std::memory_order_release);
+    } while (left);
+
+    if (head - ring.tail.load(std::memory_order_relaxed) >= RING_SIZE / 2)
+        _wake.notify_one();
+}
+
+void LogBinary::Drain()
+{
+    std::vector<std::shared_ptr<Ring> > rings;
+    {
+        std::unique_lock<std::mutex> lock(_rings_mutex);
+        rings = _rings;
+    }
+
+    bool written = false;
+    std::vector<Ring*> finished;
+
+    for (auto &ring : rings)
+    {
+        // closed is read before head, all records of a finished thread are seen
+        bool     closed = ring->closed.load(std::memory_order_acquire);
+        uint32_t tail   = ring->tail.load(std::memory_order_relaxed);
+        uint32_t head   = ring->head.load(std::memory_order_acquire);
+
+        while (tail != head)
+        {
+            uint32_t pos   = tail & (RING_SIZE - 1);
+            uint32_t count = std::min(head - tail, RING_SIZE - pos);
+
+            if (_file)
+                fwrite(&ring->records[pos], sizeof(BinaryLogRecord), count, _file);
+
+            tail += count;
+            ring->tail.store(tail, std::memory_order_release);
+            written = true;
+        }
+
+        if (closed)
+            finished.push_back(ring.get());
+    }
+
+    if (!finished.empty())
+    {
+        std::unique_lock<std::mutex> lock(_rings_mutex);
+        _rings.erase(std::remove_if(_rings.begin(), _rings.end(),
+            [&finished](const std::shared_ptr<Ring> &ring)
+            {
+                return std::find(finished.begin(), finished.end(), ring.get()) != finished.end();
+            }), _rings.end());
+    }
+
+    if (written && _file)
+        fflush(_file);
+}
+
+void LogBinary::DrainThread()
+{
+    std::unique_lock<std::mutex> lock(_wake_mutex);
+
+    while (!_stop)
+    {
+        _wake.wait_for(lock, std::chrono::milliseconds(BINLOG_DRAIN_PERIOD_MS));
+        lock.unlock();
+        {
+            std::unique_lock<std::mutex> drain(_drain_mutex);
+            Drain();
+        }
+        lock.lock();
+    }
+}
+
+void LogBinary::Flush()
+{
+    std::unique_lock<std::mutex> drain(_drain_mutex);
+    Drain();
+}
@@ -0,0 +1,88 @@
+// Copyright (c) 2020 Intel Corporation
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#ifndef LOG_BINARY_H_
+#define LOG_BINARY_H_
+
+#include "ilog.h"
+#include "log_binary_record.h"
+#include <atomic>
+#include <condition_variable>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Binary logger: every thread appends fixed size records to its own
+// single producer / single consumer ring, no lock is taken on the calling
+// thread. A background thread drains all rings to the file, formatting into
+// the text log is done offline by mfx-tracer-convert.
+class LogBinary : public ILog
+{
+public:
+    LogBinary();
+    virtual ~LogBinary();
+    virtual void WriteLog(const std::string &log);
+    virtual void Flush();
+
+    // records per thread, power of 2
+    static const uint32_t RING_SIZE = 2048;
+
+private:
+    struct Ring
+    {
+        BinaryLogRecord           records[RING_SIZE];
+        std::atomic<uint32_t>     head; // written by the owner thread
+        std::atomic<uint32_t>     tail; // written by the drain
+        std::atomic<bool>         closed;
+        Ring() : head(0), tail(0), closed(false) {}
+    };
+
+    struct ThreadRing
+    {
+        uint64_t              owner = 0;
+        uint32_t              thread_id = 0;
+        std::shared_ptr<Ring> ring;
+        ~ThreadRing() { if (ring) ring->closed = true; }
+    };
+
+    Ring &GetRing(uint32_t &thread_id);
+    void Start();
+    void DrainThread();
+    void Drain();
+
+    uint64_t                            _id;
+    std::string                         _file_path;
+    FILE                               *_file;
+    std::once_flag                      _started;
+    std::thread                         _drain;
+    std::atomic<bool>                   _stop;
+
+    std::mutex                          _rings_mutex; // guards _rings, taken once per new thread
+    std::vector<std::shared_ptr<Ring> > _rings;
+
+    std::mutex                          _drain_mutex; // only one consumer at a time
+    std::mutex                          _wake_mutex;
+    std::condition_variable             _wake;
+
+    static std::atomic<uint64_t>        _instances;
+};
+
+#endif //LOG_BINARY_H_
@@ -0,0 +1,69 @@
+// Copyright (c) 2020 Intel Corporation
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#ifndef LOG_BINARY_RECORD_H_
+#define LOG_BINARY_RECORD_H_
+
+// On-disk format of the binary logger, shared with the mfx-tracer-convert tool.
+// The file is a BinaryLogHeader followed by BinaryLogRecord's. One WriteLog call
+// is stored as one or more records of the same thread, the first one carries
+// BINLOG_FLAG_FIRST, the last one BINLOG_FLAG_LAST. Records of different threads
+// may interleave, records of one thread are always in call order.
+
+#include <stdint.h>
+
+#define BINLOG_MAGIC   "MFXTRBIN"
+#define BINLOG_VERSION 1
+
+enum eBinaryLogRecordType
+{
+    BINLOG_RECORD_API  = 0, // function entry/exit and ">> ... called" lines
+    BINLOG_RECORD_DUMP = 1, // structure dumps and everything else, indented in the text log
+};
+
+enum eBinaryLogRecordFlags
+{
+    BINLOG_FLAG_FIRST = 1 << 0,
+    BINLOG_FLAG_LAST  = 1 << 1,
+};
+
+struct BinaryLogHeader
+{
+    char     magic[8];
+    uint32_t version;
+    uint32_t record_size;
+    uint32_t process_id;
+    uint32_t reserved[3];
+};
+
+struct BinaryLogRecord
+{
+    uint64_t timestamp;  // microseconds since the epoch, system clock
+    uint32_t thread_id;
+    uint16_t type;       // eBinaryLogRecordType
+    uint16_t flags;      // eBinaryLogRecordFlags
+    uint16_t size;       // used bytes of payload
+    uint16_t reserved[3];
+    char     payload[104];
+};
+
+static_assert(sizeof(BinaryLogHeader) == 32, "BinaryLogHeader layout is part of the file format");
+static_assert(sizeof(BinaryLogRecord) == 128, "BinaryLogRecord layout is part of the file format");
+
+#endif // LOG_BINARY_RECORD_H_
@@ -35,25 +35,32 @@ File Name: log_file.cpp
 std::mutex LogFile::_file_write;
 
 LogFile::LogFile()
+    : _file_path(MakeFilePath("mfxtracer.log"))
+{
+}
+
+std::string LogFile::MakeFilePath(const std::string &default_name)
 {
     std::string strproc_id = ToString(ThreadInfo::GetProcessId());
     std::string file_log = Config::GetParam("core", "log");
+    std::string file_path;
     if(!file_log.empty())
-        _file_path = std::string(file_log);
+        file_path = std::string(file_log);
     else
-        _file_path = std::string("mfxtracer.log");
+        file_path = default_name;
 
     if (!Log::useGUI)
     {
         strproc_id = std::string("_") + strproc_id;
-        size_t pos = _file_path.rfind(".");
+        size_t pos = file_path.rfind(".");
         if (pos == std::string::npos)
-            _file_path.insert(_file_path.length(), strproc_id);
-        else if((_file_path.length() - pos) > std::string(".log").length())
-            _file_path.insert(_file_path.length(), strproc_id);
+            file_path.insert(file_path.length(), strproc_id);
+        else if((file_path.length() - pos) > std::string(".log").length())
+            file_path.insert(file_path.length(), strproc_id);
         else
-            _file_path.insert(pos, strproc_id);
+            file_path.insert(pos, strproc_id);
     }
+    return file_path;
 }
 
 LogFile::~LogFile()
@@ -43,6 +43,8 @@ public:
     virtual ~LogFile();
     virtual void WriteLog(const std::string &log);
     void SetFilePath(std::string file_path);
+    // "core.log" or default_name with the process id inserted before the extension
+    static std::string MakeFilePath(const std::string &default_name);
 private:
     std::string _file_path;
     std::ofstream _file;
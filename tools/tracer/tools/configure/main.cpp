@@ -24,10 +24,10 @@
 #include "strfuncs.h"
 
 #if defined(_WIN32) || defined(_WIN64)
-    #define LOG_TYPES "console, file, etw"
+    #define LOG_TYPES "console, file, binary, etw"
     #define HOME string(getenv("HOMEPATH"))
 #else
-    #define LOG_TYPES "console, file, syslog"
+    #define LOG_TYPES "console, file, binary, syslog"
     #define HOME string(getenv("HOME"))
 #endif
 
@@ -54,9 +54,15 @@ int main(int argc, char *argv[])
             "    log       log file to dump trace (if applicable)\n"
             "    level     log level (you can use: " LOG_LEVELS ")\n"
             "\n"
+            "  [sampling]\n"
+            "    every     log every Nth frame level call in full level (1 - every call)\n"
+            "    slow      report the calls slower than N msec even if not logged (0 - off)\n"
+            "    summary   write the per function latency summary every N sec (0 - off)\n"
+            "\n"
             "Examples:\n"
             "  mfx-tracer config --default                                # generate default config file\n"
             "  mfx-tracer config core.type file core.file ~/mfxtracer.log # set trace type and log file\n"
+            "  mfx-tracer config sampling.every 100 sampling.slow 30      # log 1% of the frames and the slow ones\n"
             "\n"
             "Config file: ~/.mfxtracer\n"
             "\n";
@@ -0,0 +1,195 @@
+// Copyright (c) 2020 Intel Corporation
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#include <algorithm>
+#include <cstring>
+#include <ctime>
+#include <exception>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "../../loggers/log_binary_record.h"
+
+using namespace std;
+
+struct Message
+{
+    uint64_t timestamp;
+    uint32_t thread_id;
+    uint16_t type;
+    string   text;
+};
+
+static string GetTimeStamp(uint64_t timestamp)
+{
+    // same format as Timer::GetTimeStamp
+    time_t t = (time_t)(timestamp / 1000000);
+    struct tm *now = localtime(&t);
+    if (!now)
+        return "<time unknown>";
+
+    stringstream ss;
+    ss << (now->tm_year + 1900) << '-' << (now->tm_mon + 1) << '-' << now->tm_mday << " "
+       << now->tm_hour << ":" << now->tm_min << ":" << now->tm_sec;
+#if defined(_WIN32) || defined(_WIN64)
+    ss << ":" << (timestamp / 1000) % 1000;
+#endif
+    return ss.str();
+}
+
+// same layout LogFile::WriteLog produces for one call
+static void WriteMessage(ostream &out, const Message &msg)
+{
+    string timestamp = GetTimeStamp(msg.timestamp);
+    string spase = (msg.type == BINLOG_RECORD_DUMP) ? "    " : "";
+
+    stringstream str_stream;
+    str_stream << msg.text;
+    for(;;) {
+        string logstr;
+        getline(str_stream, logstr);
+        if(logstr.length() > 2) out << msg.thread_id << " " << timestamp << " " << spase << logstr << "\n";
+        else out << logstr << "\n";
+        if(str_stream.eof())
+            break;
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    try {
+        const string help =
+            "\n"
+            "Intel Media SDK Tracer binary log converter v. 1.0 \n"
+            "\n"
+            "Usage: mfx-tracer-convert [options] input.bin [output.log]\n"
+            "\n"
+            "Converts the log written with core.type=binary to the text log format,\n"
+            "the text goes to stdout if the output is not given.\n"
+            "\n"
+            "Options:\n"
+            "  --help, -h   print help\n"
+            "  --unsorted   keep the order the records were drained in, the default\n"
+            "               is to order the calls of all threads by time\n"
+            "\n";
+
+        string input, output;
+        bool sort_by_time = true;
+
+        for (int i = 1; i < argc; i++) {
+            if (string(argv[i]) == string("--help") || string(argv[i]) == string("-h")) {
+                cout << help;
+                return 0;
+            }
+            else if (string(argv[i]) == string("--unsorted"))
+                sort_by_time = false;
+            else if (input.empty())
+                input = argv[i];
+            else if (output.empty())
+                output = argv[i];
+            else {
+                cerr << "error: unexpected argument " << argv[i] << "\n";
+                return -1;
+            }
+        }
+
+        if (input.empty()) {
+            cerr << "error: input file is not specified\n" << help;
+            return -1;
+        }
+
+        ifstream in(input.c_str(), ios::binary);
+        if (!in) {
+            cerr << "error: cannot open " << input << "\n";
+            return -1;
+        }
+
+        BinaryLogHeader header = {};
+        in.read((char*)&header, sizeof(header));
+        if (!in || memcmp(header.magic, BINLOG_MAGIC, sizeof(header.magic))) {
+            cerr << "error: " << input << " is not a binary tracer log\n";
+            return -1;
+        }
+        if (header.version != BINLOG_VERSION || header.record_size != sizeof(BinaryLogRecord)) {
+            cerr << "error: unsupported log version " << header.version << "\n";
+            return -1;
+        }
+
+        ofstream file;
+        if (!output.empty()) {
+            file.open(output.c_str());
+            if (!file) {
+                cerr << "error: cannot create " << output << "\n";
+                return -1;
+            }
+        }
+        ostream &out = output.empty() ? cout : file;
+
+        // records of different threads interleave, a call is complete on its last record
+        map<uint32_t, Message> pending;
+        vector<Message> messages;
+        BinaryLogRecord rec;
+        size_t num_records = 0;
+
+        while (in.read((char*)&rec, sizeof(rec))) {
+            ++num_records;
+            if (rec.size > sizeof(rec.payload)) {
+                cerr << "error: corrupted record " << num_records << "\n";
+                return -1;
+            }
+
+            Message &msg = pending[rec.thread_id];
+            if (rec.flags & BINLOG_FLAG_FIRST) {
+                msg.timestamp = rec.timestamp;
+                msg.thread_id = rec.thread_id;
+                msg.type      = rec.type;
+                msg.text.clear();
+            }
+            msg.text.append(rec.payload, rec.size);
+
+            if (rec.flags & BINLOG_FLAG_LAST) {
+                if (sort_by_time)
+                    messages.push_back(msg);
+                else
+                    WriteMessage(out, msg);
+                pending.erase(rec.thread_id);
+            }
+        }
+
+        if (sort_by_time) {
+            stable_sort(messages.begin(), messages.end(),
+                [](const Message &a, const Message &b) { return a.timestamp < b.timestamp; });
+            for (size_t i = 0; i < messages.size(); i++)
+                WriteMessage(out, messages[i]);
+        }
+
+        if (!pending.empty())
+            cerr << "warning: " << pending.size() << " calls are truncated at the end of the log\n";
+
+        return 0;
+    }
+    catch(exception const &ex){
+        cerr << string("exception: ") + ex.what() + "\n";
+        return -2;
+    }
+}
@@ -126,4 +126,14 @@ FUNCTION(mfxStatus, MFXInitEx, (mfxInitParam par, mfxSession session), (par, ses
 FUNCTION(mfxStatus, MFXVideoENC_GetVideoParam, (mfxSession session, mfxVideoParam *par), (session, par))
 FUNCTION(mfxStatus, MFXVideoPAK_GetVideoParam, (mfxSession session, mfxVideoParam *par), (session, par))
 FUNCTION(mfxStatus, MFXVideoCORE_QueryPlatform, (mfxSession session, mfxPlatform* platform), (session, platform))
-FUNCTION(mfxStatus, MFXVideoUSER_GetPlugin, (mfxSession session, mfxU32 type, mfxPlugin *par), (session, type, par))
\ No newline at end of file
+FUNCTION(mfxStatus, MFXVideoUSER_GetPlugin, (mfxSession session, mfxU32 type, mfxPlugin *par), (session, type, par))
+
+#if (MFX_VERSION >= MFX_VERSION_NEXT)
+/*
+* API version 1.35 functions
+*/
+
+FUNCTION(mfxStatus, MFXVideoCORE_GetMetrics, (mfxSession session, mfxSessionMetrics *metrics), (session, metrics))
+FUNCTION(mfxStatus, MFXVideoCORE_SyncOperationMulti, (mfxSession session, mfxSyncPoint *syncp, mfxU32 count, mfxU16 mode, mfxU32 wait, mfxStatus *status), (session, syncp, count, mode, wait, status))
+FUNCTION(mfxStatus, MFXVideoCORE_SetSyncPointCallback, (mfxSession session, mfxSyncPoint syncp, mfxSyncPointCallback callback, mfxHDL pthis), (session, syncp, callback, pthis))
+#endif
\ No newline at end of file
@@ -0,0 +1,210 @@
+// Copyright (c) 2020 Intel Corporation
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include "../config/config.h"
+#include "sampler.h"
+
+// Latencies are kept in microseconds in log-linear buckets: exact below 8 us,
+// then 8 buckets per power of 2, i.e. the error of a percentile is within 12.5%.
+#define SAMPLER_SUB_BITS    3
+#define SAMPLER_SUB         (1 << SAMPLER_SUB_BITS)
+#define SAMPLER_MAX_EXP     35 // ~9.5 hours, longer calls go to the last bucket
+#define SAMPLER_NUM_BUCKETS ((SAMPLER_MAX_EXP - SAMPLER_SUB_BITS + 2) * SAMPLER_SUB)
+
+namespace
+{
+    // all counters are for the current summary period, except calls
+    struct FunctionStat
+    {
+        std::atomic<uint64_t> calls;
+        std::atomic<uint64_t> logged;
+        std::atomic<uint64_t> reported;
+        std::atomic<uint64_t> errors;
+        std::atomic<uint64_t> max;
+        std::atomic<uint32_t> buckets[SAMPLER_NUM_BUCKETS];
+    };
+
+    // zero initialized as static storage
+    FunctionStat g_stat[eFunctionsNum];
+
+    uint64_t g_every = 1;
+    double   g_slow = 0;
+    int64_t  g_summary_period = 0; // nsec
+    std::atomic<int64_t> g_next_summary(0);
+
+    uint32_t GetBucket(uint64_t value)
+    {
+        if (value < SAMPLER_SUB)
+            return (uint32_t)value;
+
+        uint32_t exp = SAMPLER_SUB_BITS;
+        while (value >> (exp + 1))
+        {
+            if (++exp > SAMPLER_MAX_EXP)
+                return SAMPLER_NUM_BUCKETS - 1;
+        }
+
+        uint32_t sub = (uint32_t)(value >> (exp - SAMPLER_SUB_BITS)) - SAMPLER_SUB;
+        return (exp - SAMPLER_SUB_BITS + 1) * SAMPLER_SUB + sub;
+    }
+
+    uint64_t GetBucketLowerBound(uint32_t bucket)
+    {
+        if (bucket < SAMPLER_SUB)
+            return bucket;
+
+        uint32_t exp = bucket / SAMPLER_SUB - 1 + SAMPLER_SUB_BITS;
+        uint64_t sub = bucket % SAMPLER_SUB;
+        return (SAMPLER_SUB + sub) << (exp - SAMPLER_SUB_BITS);
+    }
+
+    int64_t GetTime()
+    {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    // the statuses a pipeline gets in the normal flow are not failures
+    bool IsError(mfxStatus status)
+    {
+        return status < MFX_ERR_NONE
+            && status != MFX_ERR_MORE_DATA
+            && status != MFX_ERR_MORE_SURFACE
+            && status != MFX_ERR_MORE_BITSTREAM;
+    }
+
+    std::string GetPercentile(const uint32_t *buckets, uint64_t count, uint64_t max, double percentile)
+    {
+        uint64_t rank = (uint64_t)(percentile * count + 0.5);
+        uint64_t sum = 0;
+        uint32_t i = 0;
+
+        if (rank < 1)
+            rank = 1;
+        for (; i < SAMPLER_NUM_BUCKETS - 1; i++)
+        {
+            sum += buckets[i];
+            if (sum >= rank)
+                break;
+        }
+
+        // the upper bound of the bucket, the max is exact
+        uint64_t value = GetBucketLowerBound(i + 1) - 1;
+        if (value > max)
+            value = max;
+        return TimeToString(value / 1000.0);
+    }
+}
+
+bool Sampler::_enabled = false;
+
+void Sampler::Init()
+{
+    std::string every   = Config::GetParam("sampling", "every");
+    std::string slow    = Config::GetParam("sampling", "slow");
+    std::string summary = Config::GetParam("sampling", "summary");
+
+    if (!every.empty() && strtoull(every.c_str(), NULL, 10) > 1)
+        g_every = strtoull(every.c_str(), NULL, 10);
+    if (!slow.empty() && atof(slow.c_str()) > 0)
+        g_slow = atof(slow.c_str());
+    if (!summary.empty() && atof(summary.c_str()) > 0)
+        g_summary_period = (int64_t)(atof(summary.c_str()) * 1000000000);
+
+    _enabled = g_every > 1 || g_slow > 0 || g_summary_period > 0;
+    g_next_summary = GetTime() + g_summary_period;
+}
+
+bool Sampler::LogCall(mfxFunction func)
+{
+    if (g_every <= 1)
+        return true;
+
+    return g_stat[func].calls.fetch_add(1, std::memory_order_relaxed) % g_every == 0;
+}
+
+bool Sampler::Complete(mfxFunction func, double elapsed, mfxStatus status, bool logged)
+{
+    if (!_enabled)
+        return false;
+
+    FunctionStat &stat = g_stat[func];
+    uint64_t value = (uint64_t)(elapsed * 1000);
+    bool report = !logged && (IsError(status) || (g_slow > 0 && elapsed >= g_slow));
+
+    stat.buckets[GetBucket(value)].fetch_add(1, std::memory_order_relaxed);
+    uint64_t max = stat.max.load(std::memory_order_relaxed);
+    while (value > max && !stat.max.compare_exchange_weak(max, value, std::memory_order_relaxed));
+    if (logged)
+        stat.logged.fetch_add(1, std::memory_order_relaxed);
+    if (report)
+        stat.reported.fetch_add(1, std::memory_order_relaxed);
+    if (IsError(status))
+        stat.errors.fetch_add(1, std::memory_order_relaxed);
+
+    if (g_summary_period)
+    {
+        // the thread which moves the deadline writes the summary
+        int64_t now = GetTime();
+        int64_t next = g_next_summary.load(std::memory_order_relaxed);
+        if (now >= next && g_next_summary.compare_exchange_strong(next, now + g_summary_period, std::memory_order_relaxed))
+            WriteSummary();
+    }
+
+    return report;
+}
+
+void Sampler::WriteSummary()
+{
+    std::string summary;
+
+    for (int func = 0; func < eFunctionsNum; func++)
+    {
+        FunctionStat &stat = g_stat[func];
+        uint32_t buckets[SAMPLER_NUM_BUCKETS];
+        uint64_t count = 0;
+
+        // the calls completed meanwhile may go to either summary
+        for (uint32_t i = 0; i < SAMPLER_NUM_BUCKETS; i++)
+        {
+            buckets[i] = stat.buckets[i].exchange(0, std::memory_order_relaxed);
+            count += buckets[i];
+        }
+        if (!count)
+            continue;
+
+        uint64_t max = stat.max.exchange(0, std::memory_order_relaxed);
+        summary += std::string(g_mfxFuncTable[func].name)
+            + ": calls=" + ToString(count)
+            + " logged=" + ToString(stat.logged.exchange(0, std::memory_order_relaxed))
+            + " reported=" + ToString(stat.reported.exchange(0, std::memory_order_relaxed))
+            + " errors=" + ToString(stat.errors.exchange(0, std::memory_order_relaxed))
+            + " p50=" + GetPercentile(buckets, count, max, 0.5)
+            + " p99=" + GetPercentile(buckets, count, max, 0.99)
+            + " p99.9=" + GetPercentile(buckets, count, max, 0.999)
+            + " max=" + TimeToString(max / 1000.0) + "\n";
+    }
+
+    if (!summary.empty())
+        Log::WriteLog("mfx_tracer: summary +\n" + summary + "mfx_tracer: summary - \n\n");
+}
@@ -0,0 +1,54 @@
+// Copyright (c) 2020 Intel Corporation
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#ifndef SAMPLER_H_
+#define SAMPLER_H_
+
+#include "functions_table.h"
+
+// Sampling of the frame level calls (DecodeFrameAsync, EncodeFrameAsync,
+// RunFrameVPPAsync, SyncOperation, ...), configured in the [sampling] section:
+//   every    log every Nth call of a function in full, 1 - every call
+//   slow     report the not logged calls slower than N msec, 0 - off
+//   summary  write the per function summary every N sec, 0 - off
+// The not logged calls which failed are always reported. Other API functions
+// are not sampled and logged as usual.
+class Sampler
+{
+public:
+    static void Init();
+
+    // true if sampling or the summary is configured
+    static bool IsEnabled() { return _enabled; }
+
+    // Decides whether the call is logged in full
+    static bool LogCall(mfxFunction func);
+
+    // Accounts the finished call. Returns true if the call was not logged
+    // but has to be reported: it failed or was slower than the threshold.
+    static bool Complete(mfxFunction func, double elapsed, mfxStatus status, bool logged);
+
+    // Writes the summary of the calls since the last one
+    static void WriteSummary();
+
+private:
+    static bool _enabled;
+};
+
+#endif //SAMPLER_H_
@@ -27,6 +27,8 @@ void tracer_init()
         Log::SetLogType(LOG_CONSOLE);
     } else if (type == std::string("file")) {
         Log::SetLogType(LOG_FILE);
+    } else if (type == std::string("binary")) {
+        Log::SetLogType(LOG_BINARY);
     } else {
         // TODO: what to do with incorrect setting?
         Log::SetLogType(LOG_CONSOLE);
@@ -46,4 +48,6 @@ void tracer_init()
         // TODO
         Log::SetLogLevel(LOG_LEVEL_FULL);
     }
+
+    Sampler::Init();
 }
\ No newline at end of file
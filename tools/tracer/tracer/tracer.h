@@ -32,6 +32,7 @@
 #include "../loggers/log.h"
 #include "../loggers/timer.h"
 #include "functions_table.h"
+#include "sampler.h"
 
 
 void tracer_init();
@@ -59,6 +59,19 @@ void __attribute__ ((constructor)) dll_init(void)
     }
 }
 
+void __attribute__ ((destructor)) dll_fini(void)
+{
+    try {
+        if (Sampler::IsEnabled())
+            Sampler::WriteSummary();
+        // the binary logger keeps the records in memory until drained
+        Log::Flush();
+    }
+    catch (std::exception& e){
+        std::cerr << "Exception: " << e.what() << '\n';
+    }
+}
+
 mfxStatus MFXInit(mfxIMPL impl, mfxVersion *ver, mfxSession *session)
 {
     try{
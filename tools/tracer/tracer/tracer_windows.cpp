@@ -126,6 +126,9 @@ BOOL WINAPI DllMain(HINSTANCE hinstDLL, DWORD fdwReason, LPVOID lpReserved)
                 Log::WriteLog(std::string("function: DLLMain() DLL_PROCESS_DETACH +"));
                 //delete [] g_mfxlib;
                 Log::WriteLog(std::string("function: DLLMain() DLL_PROCESS_DETACH - \n\n"));
+                if (Sampler::IsEnabled())
+                    Sampler::WriteSummary();
+                Log::Flush();
                 stop_shared_memory_server();
                 break;
         }
@@ -33,6 +33,7 @@ File Name: mfx_video_core.cpp
 
 #include "../loggers/timer.h"
 #include "../tracer/functions_table.h"
+#include "../tracer/sampler.h"
 #include "mfx_structures.h"
 
 #if TRACE_CALLBACKS
@@ -410,10 +411,111 @@ mfxStatus MFXVideoCORE_QueryPlatform(mfxSession session, mfxPlatform* platform)
     }
 }
 
+#if (MFX_VERSION >= MFX_VERSION_NEXT)
+mfxStatus MFXVideoCORE_GetMetrics(mfxSession session, mfxSessionMetrics *metrics)
+{
+    try{
+        DumpContext context;
+        context.context = DUMPCONTEXT_MFX;
+        Log::WriteLog("function: MFXVideoCORE_GetMetrics(mfxSession session=" + ToString(session) + ", mfxSessionMetrics* metrics=" + ToString(metrics) + ") +");
+        mfxLoader *loader = (mfxLoader*) session;
+
+        if (!loader) return MFX_ERR_INVALID_HANDLE;
+
+        mfxFunctionPointer proc = loader->table[eMFXVideoCORE_GetMetrics_tracer];
+        if (!proc) return MFX_ERR_INVALID_HANDLE;
+
+        session = loader->session;
+        Log::WriteLog(context.dump("session", session));
+
+        Timer t;
+        mfxStatus status = (*(fMFXVideoCORE_GetMetrics) proc) (session, metrics);
+        std::string elapsed = TimeToString(t.GetTime());
+        Log::WriteLog(">> MFXVideoCORE_GetMetrics called");
+        Log::WriteLog(context.dump("session", session));
+        Log::WriteLog(context.dump("metrics", metrics));
+        Log::WriteLog("function: MFXVideoCORE_GetMetrics(" + elapsed + ", " + context.dump_mfxStatus("status", status) + ") - \n\n");
+        return status;
+    }
+    catch (std::exception& e){
+        std::cerr << "Exception: " << e.what() << '\n';
+        return MFX_ERR_ABORTED;
+    }
+}
+
+mfxStatus MFXVideoCORE_SyncOperationMulti(mfxSession session, mfxSyncPoint *syncp, mfxU32 count, mfxU16 mode, mfxU32 wait, mfxStatus *status)
+{
+    try{
+        DumpContext context;
+        context.context = DUMPCONTEXT_MFX;
+        Log::WriteLog("function: MFXVideoCORE_SyncOperationMulti(mfxSession session=" + ToString(session) + ", mfxSyncPoint* syncp=" + ToString(syncp) + ", mfxU32 count=" + ToString(count) + ", mfxU16 mode=" + ToString(mode) + ", mfxU32 wait=" + ToString(wait) + ", mfxStatus* status=" + ToString(status) + ") +");
+        mfxLoader *loader = (mfxLoader*) session;
+
+        if (!loader) return MFX_ERR_INVALID_HANDLE;
+
+        mfxFunctionPointer proc = loader->table[eMFXVideoCORE_SyncOperationMulti_tracer];
+        if (!proc) return MFX_ERR_INVALID_HANDLE;
+
+        session = loader->session;
+        Log::WriteLog(context.dump("session", session));
+        for (mfxU32 i = 0; syncp && i < count; i++)
+            Log::WriteLog(context.dump("syncp[" + ToString(i) + "]", syncp[i]));
+        Log::WriteLog(context.dump_mfxU32("mode", mode));
+        Log::WriteLog(context.dump_mfxU32("wait", wait));
+
+        Timer t;
+        mfxStatus sts = (*(fMFXVideoCORE_SyncOperationMulti) proc) (session, syncp, count, mode, wait, status);
+        std::string elapsed = TimeToString(t.GetTime());
+        Log::WriteLog(">> MFXVideoCORE_SyncOperationMulti called");
+        Log::WriteLog(context.dump("session", session));
+        for (mfxU32 i = 0; status && i < count; i++)
+            Log::WriteLog(context.dump_mfxStatus("status[" + ToString(i) + "]", status[i]));
+        Log::WriteLog("function: MFXVideoCORE_SyncOperationMulti(" + elapsed + ", " + context.dump_mfxStatus("status", sts) + ") - \n\n");
+        return sts;
+    }
+    catch (std::exception& e){
+        std::cerr << "Exception: " << e.what() << '\n';
+        return MFX_ERR_ABORTED;
+    }
+}
+
+mfxStatus MFXVideoCORE_SetSyncPointCallback(mfxSession session, mfxSyncPoint syncp, mfxSyncPointCallback callback, mfxHDL pthis)
+{
+    try{
+        DumpContext context;
+        context.context = DUMPCONTEXT_MFX;
+        Log::WriteLog("function: MFXVideoCORE_SetSyncPointCallback(mfxSession session=" + ToString(session) + ", mfxSyncPoint syncp=" + ToString(syncp) + ", mfxSyncPointCallback callback=" + ToString((void*)callback) + ", mfxHDL pthis=" + ToString(pthis) + ") +");
+        mfxLoader *loader = (mfxLoader*) session;
+
+        if (!loader) return MFX_ERR_INVALID_HANDLE;
+
+        mfxFunctionPointer proc = loader->table[eMFXVideoCORE_SetSyncPointCallback_tracer];
+        if (!proc) return MFX_ERR_INVALID_HANDLE;
+
+        session = loader->session;
+        Log::WriteLog(context.dump("session", session));
+        Log::WriteLog(context.dump("syncp", syncp));
+
+        Timer t;
+        mfxStatus status = (*(fMFXVideoCORE_SetSyncPointCallback) proc) (session, syncp, callback, pthis);
+        std::string elapsed = TimeToString(t.GetTime());
+        Log::WriteLog(">> MFXVideoCORE_SetSyncPointCallback called");
+        Log::WriteLog(context.dump("session", session));
+        Log::WriteLog(context.dump("syncp", syncp));
+        Log::WriteLog("function: MFXVideoCORE_SetSyncPointCallback(" + elapsed + ", " + context.dump_mfxStatus("status", status) + ") - \n\n");
+        return status;
+    }
+    catch (std::exception& e){
+        std::cerr << "Exception: " << e.what() << '\n';
+        return MFX_ERR_ABORTED;
+    }
+}
+#endif
+
 mfxStatus MFXVideoCORE_SyncOperation(mfxSession session, mfxSyncPoint syncp, mfxU32 wait)
 {
     try{
-        if (Log::GetLogLevel() >= LOG_LEVEL_FULL) //call function with logging
+        if (Log::GetLogLevel() >= LOG_LEVEL_FULL && Sampler::LogCall(eMFXVideoCORE_SyncOperation_tracer)) //call function with logging
         {
             DumpContext context;
             context.context = DUMPCONTEXT_MFX;
@@ -444,7 +546,8 @@ mfxStatus MFXVideoCORE_SyncOperation(mfxSession session, mfxSyncPoint syncp, mfx
 
             Timer t;
             mfxStatus status = (*(fMFXVideoCORE_SyncOperation) proc) (session, sp.syncPoint, wait);
-            std::string elapsed = TimeToString(t.GetTime());
+            double time = t.GetTime();
+            std::string elapsed = TimeToString(time);
 
             Log::WriteLog(">> MFXVideoCORE_SyncOperation called");
             Log::WriteLog(context.dump("session", session));
@@ -452,6 +555,8 @@ mfxStatus MFXVideoCORE_SyncOperation(mfxSession session, mfxSyncPoint syncp, mfx
             Log::WriteLog(context.dump_mfxU32("wait", wait));
             Log::WriteLog("function: MFXVideoCORE_SyncOperation(" + elapsed + ", " + context.dump_mfxStatus("status", status) + ") - \n\n");
 
+            Sampler::Complete(eMFXVideoCORE_SyncOperation_tracer, time, status, true);
+
             return status;
         }
         else // call function without logging
@@ -477,8 +582,25 @@ mfxStatus MFXVideoCORE_SyncOperation(mfxSession session, mfxSyncPoint syncp, mfx
 
             session = loader->session;
 
+            Timer t;
             mfxStatus status = (*(fMFXVideoCORE_SyncOperation) proc) (session, sp.syncPoint, wait);
 
+            if (Sampler::IsEnabled())
+            {
+                double time = t.GetTime();
+                if (Sampler::Complete(eMFXVideoCORE_SyncOperation_tracer, time, status, false))
+                {
+                    // not sampled, but failed or slow
+                    std::string elapsed = TimeToString(time);
+                    Log::WriteLog("function: MFXVideoCORE_SyncOperation(mfxSession session=" + ToString((mfxSession)loader) + ", mfxSyncPoint syncp=" + ToString(syncp) + ", mfxU32 wait=" + ToString(wait) + ") +");
+                    Log::WriteLog(">> MFXVideoCORE_SyncOperation called");
+                    Log::WriteLog(context.dump("session", session));
+                    Log::WriteLog(context.dump("syncp", sp.syncPoint));
+                    Log::WriteLog(context.dump_mfxU32("wait", wait));
+                    Log::WriteLog("function: MFXVideoCORE_SyncOperation(" + elapsed + ", " + context.dump_mfxStatus("status", status) + ") - \n\n");
+                }
+            }
+
             return status;
         }
     }
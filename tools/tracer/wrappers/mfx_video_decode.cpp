@@ -33,6 +33,7 @@ File Name: mfx_video_decode.cpp
 
 #include "../loggers/timer.h"
 #include "../tracer/functions_table.h"
+#include "../tracer/sampler.h"
 #include "mfx_structures.h"
 
 // DECODE interface functions
@@ -365,7 +366,7 @@ mfxStatus MFXVideoDECODE_GetPayload(mfxSession session, mfxU64 *ts, mfxPayload *
 mfxStatus MFXVideoDECODE_DecodeFrameAsync(mfxSession session, mfxBitstream *bs, mfxFrameSurface1 *surface_work, mfxFrameSurface1 **surface_out, mfxSyncPoint *syncp)
 {
     try{
-        if (Log::GetLogLevel() >= LOG_LEVEL_FULL) // call with logging
+        if (Log::GetLogLevel() >= LOG_LEVEL_FULL && Sampler::LogCall(eMFXVideoDECODE_DecodeFrameAsync_tracer)) // call with logging
         {
             DumpContext context;
             context.context = DUMPCONTEXT_MFX;
@@ -391,7 +392,7 @@ mfxStatus MFXVideoDECODE_DecodeFrameAsync(mfxSession session, mfxBitstream *bs,
             session = loader->session;
             Log::WriteLog(context.dump("session", session));
             if(bs) Log::WriteLog(context.dump("bs", *bs));
-            Log::WriteLog(context.dump("surface_work", *surface_work));
+            if(surface_work) Log::WriteLog(context.dump("surface_work", *surface_work));
             if(surface_out) {
                 if (*surface_out)
                     Log::WriteLog(context.dump("surface_out", (**surface_out)));
@@ -402,7 +403,8 @@ mfxStatus MFXVideoDECODE_DecodeFrameAsync(mfxSession session, mfxBitstream *bs,
             Timer t;
             mfxStatus status = (*(fMFXVideoDECODE_DecodeFrameAsync) proc) (session, bs, surface_work, surface_out, syncp);
 
-            std::string elapsed = TimeToString(t.GetTime());
+            double time = t.GetTime();
+            std::string elapsed = TimeToString(time);
 
             if (syncp) {
                 sp.syncPoint = (*syncp);
@@ -414,7 +416,7 @@ mfxStatus MFXVideoDECODE_DecodeFrameAsync(mfxSession session, mfxBitstream *bs,
             Log::WriteLog(">> MFXVideoDECODE_DecodeFrameAsync called");
             Log::WriteLog(context.dump("session", session));
             if(bs) Log::WriteLog(context.dump("bs", *bs));
-            Log::WriteLog(context.dump("surface_work", *surface_work));
+            if(surface_work) Log::WriteLog(context.dump("surface_work", *surface_work));
             if(surface_out) {
                if (*surface_out)
                 Log::WriteLog(context.dump("surface_out", (**surface_out)));
@@ -422,6 +424,8 @@ mfxStatus MFXVideoDECODE_DecodeFrameAsync(mfxSession session, mfxBitstream *bs,
             Log::WriteLog(context.dump("syncp", sp.syncPoint));
             Log::WriteLog("function: MFXVideoDECODE_DecodeFrameAsync(" + elapsed + ", " + context.dump_mfxStatus("status", status) + ") - \n\n");
 
+            Sampler::Complete(eMFXVideoDECODE_DecodeFrameAsync_tracer, time, status, true);
+
             return status;
         }
         else // call without logging
@@ -438,8 +442,30 @@ mfxStatus MFXVideoDECODE_DecodeFrameAsync(mfxSession session, mfxBitstream *bs,
 
             session = loader->session;
 
+            Timer t;
             mfxStatus status = (*(fMFXVideoDECODE_DecodeFrameAsync) proc) (session, bs, surface_work, surface_out, syncp);
 
+            if (Sampler::IsEnabled())
+            {
+                double time = t.GetTime();
+                if (Sampler::Complete(eMFXVideoDECODE_DecodeFrameAsync_tracer, time, status, false))
+                {
+                    // not sampled, but failed or slow
+                    std::string elapsed = TimeToString(time);
+                    Log::WriteLog("function: MFXVideoDECODE_DecodeFrameAsync(mfxSession session=" + ToString((mfxSession)loader) + ", mfxBitstream *bs=" + ToString(bs) + ", mfxFrameSurface1 *surface_work=" + ToString(surface_work) + ", mfxFrameSurface1 **surface_out=" + ToString(surface_out) + ", mfxSyncPoint *syncp=" + ToString(syncp) + ") +");
+                    Log::WriteLog(">> MFXVideoDECODE_DecodeFrameAsync called");
+                    Log::WriteLog(context.dump("session", session));
+                    if(bs) Log::WriteLog(context.dump("bs", *bs));
+                    if(surface_work) Log::WriteLog(context.dump("surface_work", *surface_work));
+                    if(surface_out) {
+                       if (*surface_out)
+                        Log::WriteLog(context.dump("surface_out", (**surface_out)));
+                    }
+                    Log::WriteLog(context.dump("syncp", (syncp ? *syncp : NULL)));
+                    Log::WriteLog("function: MFXVideoDECODE_DecodeFrameAsync(" + elapsed + ", " + context.dump_mfxStatus("status", status) + ") - \n\n");
+                }
+            }
+
             return status;
         }
 
@@ -33,6 +33,7 @@ File Name: mfx_video_enc.cpp
 
 #include "../loggers/timer.h"
 #include "../tracer/functions_table.h"
+#include "../tracer/sampler.h"
 #include "mfx_structures.h"
 
 mfxStatus MFXVideoENC_Query(mfxSession session, mfxVideoParam *in, mfxVideoParam *out)
@@ -215,7 +216,7 @@ mfxStatus MFXVideoENC_Close(mfxSession session)
 mfxStatus MFXVideoENC_ProcessFrameAsync(mfxSession session, mfxENCInput *in, mfxENCOutput *out, mfxSyncPoint *syncp)
 {
     try {
-        if (Log::GetLogLevel() >= LOG_LEVEL_FULL) // call with logging
+        if (Log::GetLogLevel() >= LOG_LEVEL_FULL && Sampler::LogCall(eMFXVideoENC_ProcessFrameAsync_tracer)) // call with logging
         {
             DumpContext context;
             context.context = DUMPCONTEXT_MFX;
@@ -246,7 +247,8 @@ mfxStatus MFXVideoENC_ProcessFrameAsync(mfxSession session, mfxENCInput *in, mfx
 
             Timer t;
             mfxStatus status = (*(fMFXVideoENC_ProcessFrameAsync) proc)(session, in, out, syncp);
-            std::string elapsed = TimeToString(t.GetTime());
+            double time = t.GetTime();
+            std::string elapsed = TimeToString(time);
 
             if (syncp) {
                 sp.syncPoint = (*syncp);
@@ -263,6 +265,8 @@ mfxStatus MFXVideoENC_ProcessFrameAsync(mfxSession session, mfxENCInput *in, mfx
 
             Log::WriteLog("function: MFXVideoENC_ProcessFrameAsync(" + elapsed + ", " + context.dump_mfxStatus("status", status) + ") - \n\n");
 
+            Sampler::Complete(eMFXVideoENC_ProcessFrameAsync_tracer, time, status, true);
+
             return status;
         }
         else // call without logging
@@ -279,8 +283,28 @@ mfxStatus MFXVideoENC_ProcessFrameAsync(mfxSession session, mfxENCInput *in, mfx
 
             session = loader->session;
             
+            Timer t;
             mfxStatus status = (*(fMFXVideoENC_ProcessFrameAsync) proc)(session, in, out, syncp);
-            
+
+            if (Sampler::IsEnabled())
+            {
+                double time = t.GetTime();
+                if (Sampler::Complete(eMFXVideoENC_ProcessFrameAsync_tracer, time, status, false))
+                {
+                    // not sampled, but failed or slow
+                    std::string elapsed = TimeToString(time);
+                    Log::WriteLog("function: MFXVideoENC_ProcessFrameAsync(mfxSession session, mfxENCInput *in, mfxENCOutput *out, mfxSyncPoint *syncp) +");
+                    Log::WriteLog(">> MFXVideoENC_ProcessFrameAsync called");
+
+                    Log::WriteLog(context.dump("session", session));
+                    if (in) Log::WriteLog(context.dump("in", *in));
+                    if (out) Log::WriteLog(context.dump("out", *out));
+                    Log::WriteLog(context.dump("syncp", (syncp ? *syncp : NULL)));
+
+                    Log::WriteLog("function: MFXVideoENC_ProcessFrameAsync(" + elapsed + ", " + context.dump_mfxStatus("status", status) + ") - \n\n");
+                }
+            }
+
             return status;
         }
     }
@@ -33,6 +33,7 @@ File Name: mfx_video_encode.cpp
 
 #include "../loggers/timer.h"
 #include "../tracer/functions_table.h"
+#include "../tracer/sampler.h"
 #include "mfx_structures.h"
 #include <vector>
 
@@ -505,7 +506,7 @@ mfxStatus MFXVideoENCODE_GetEncodeStat(mfxSession session, mfxEncodeStat *stat)
 mfxStatus MFXVideoENCODE_EncodeFrameAsync(mfxSession session, mfxEncodeCtrl *ctrl, mfxFrameSurface1 *surface, mfxBitstream *bs, mfxSyncPoint *syncp)
 {
     try{
-        if (Log::GetLogLevel() >= LOG_LEVEL_FULL) // call with logging
+        if (Log::GetLogLevel() >= LOG_LEVEL_FULL && Sampler::LogCall(eMFXVideoENCODE_EncodeFrameAsync_tracer)) // call with logging
         {
             DumpContext context;
             context.context = DUMPCONTEXT_MFX;
@@ -536,7 +537,8 @@ mfxStatus MFXVideoENCODE_EncodeFrameAsync(mfxSession session, mfxEncodeCtrl *ctr
             Timer t;
             mfxStatus status = (*(fMFXVideoENCODE_EncodeFrameAsync) proc) (session, ctrl, surface, bs, syncp);
 
-            std::string elapsed = TimeToString(t.GetTime());
+            double time = t.GetTime();
+            std::string elapsed = TimeToString(time);
 
             if (syncp) {
                 sp.syncPoint = (*syncp);
@@ -553,6 +555,8 @@ mfxStatus MFXVideoENCODE_EncodeFrameAsync(mfxSession session, mfxEncodeCtrl *ctr
             Log::WriteLog(context.dump("syncp", sp.syncPoint));
             Log::WriteLog("function: MFXVideoENCODE_EncodeFrameAsync(" + elapsed + ", " + context.dump_mfxStatus("status", status) + ") - \n\n");
 
+            Sampler::Complete(eMFXVideoENCODE_EncodeFrameAsync_tracer, time, status, true);
+
             return status;
         }
         else // call without loging
@@ -569,8 +573,27 @@ mfxStatus MFXVideoENCODE_EncodeFrameAsync(mfxSession session, mfxEncodeCtrl *ctr
 
             session = loader->session;
 
+            Timer t;
             mfxStatus status = (*(fMFXVideoENCODE_EncodeFrameAsync) proc) (session, ctrl, surface, bs, syncp);
 
+            if (Sampler::IsEnabled())
+            {
+                double time = t.GetTime();
+                if (Sampler::Complete(eMFXVideoENCODE_EncodeFrameAsync_tracer, time, status, false))
+                {
+                    // not sampled, but failed or slow
+                    std::string elapsed = TimeToString(time);
+                    Log::WriteLog("function: MFXVideoENCODE_EncodeFrameAsync(mfxSession session=" + ToString((mfxSession)loader) + ", mfxEncodeCtrl *ctrl=" + ToString(ctrl) + ", mfxFrameSurface1 *surface=" + ToString(surface) + ", mfxBitstream *bs=" + ToString(bs) + ", mfxSyncPoint *syncp=" + ToString(syncp) + ") +");
+                    Log::WriteLog(">> MFXVideoENCODE_EncodeFrameAsync called");
+                    Log::WriteLog(context.dump("session", session));
+                    if(ctrl) Log::WriteLog(context.dump("ctrl", *ctrl));
+                    if(surface) Log::WriteLog(context.dump("surface", *surface));
+                    if(bs) Log::WriteLog(context.dump("bs", *bs));
+                    Log::WriteLog(context.dump("syncp", (syncp ? *syncp : NULL)));
+                    Log::WriteLog("function: MFXVideoENCODE_EncodeFrameAsync(" + elapsed + ", " + context.dump_mfxStatus("status", status) + ") - \n\n");
+                }
+            }
+
             return status;
         }
     }
@@ -33,6 +33,7 @@ File Name: mfx_video_fei.cpp
 
 #include "../loggers/timer.h"
 #include "../tracer/functions_table.h"
+#include "../tracer/sampler.h"
 #include "mfx_structures.h"
 
 
@@ -216,7 +217,7 @@ mfxStatus MFXVideoPAK_Close(mfxSession session)
 mfxStatus MFXVideoPAK_ProcessFrameAsync(mfxSession session, mfxPAKInput *in, mfxPAKOutput *out, mfxSyncPoint *syncp)
 {
     try {
-        if (Log::GetLogLevel() >= LOG_LEVEL_FULL) //call with logging
+        if (Log::GetLogLevel() >= LOG_LEVEL_FULL && Sampler::LogCall(eMFXVideoPAK_ProcessFrameAsync_tracer)) //call with logging
         {
             DumpContext context;
             context.context = DUMPCONTEXT_MFX;
@@ -244,7 +245,8 @@ mfxStatus MFXVideoPAK_ProcessFrameAsync(mfxSession session, mfxPAKInput *in, mfx
 
             Timer t;
             mfxStatus status = (*(fMFXVideoPAK_ProcessFrameAsync)proc)(session, in, out, syncp);
-            std::string elapsed = TimeToString(t.GetTime());
+            double time = t.GetTime();
+            std::string elapsed = TimeToString(time);
 
             if (syncp) {
                 sp.syncPoint = (*syncp);
@@ -261,6 +263,8 @@ mfxStatus MFXVideoPAK_ProcessFrameAsync(mfxSession session, mfxPAKInput *in, mfx
 
             Log::WriteLog("function: MFXVideoPAK_ProcessFrameAsync(" + elapsed + ", " + context.dump_mfxStatus("status", status) + ") - \n\n");
 
+            Sampler::Complete(eMFXVideoPAK_ProcessFrameAsync_tracer, time, status, true);
+
             return status;
         }
         else // call witout loging
@@ -277,8 +281,28 @@ mfxStatus MFXVideoPAK_ProcessFrameAsync(mfxSession session, mfxPAKInput *in, mfx
 
             session = loader->session;
             
+            Timer t;
             mfxStatus status = (*(fMFXVideoPAK_ProcessFrameAsync)proc)(session, in, out, syncp);
 
+            if (Sampler::IsEnabled())
+            {
+                double time = t.GetTime();
+                if (Sampler::Complete(eMFXVideoPAK_ProcessFrameAsync_tracer, time, status, false))
+                {
+                    // not sampled, but failed or slow
+                    std::string elapsed = TimeToString(time);
+                    Log::WriteLog("function: MFXVideoPAK_ProcessFrameAsync(mfxSession session, mfxENCInput *in, mfxENCOutput *out, mfxSyncPoint *syncp) +");
+                    Log::WriteLog(">> MFXVideoPAK_ProcessFrameAsync called");
+
+                    Log::WriteLog(context.dump("session", session));
+                    if (in) Log::WriteLog(context.dump("in", *in));
+                    if (out) Log::WriteLog(context.dump("out", *out));
+                    Log::WriteLog(context.dump("syncp", (syncp ? *syncp : NULL)));
+
+                    Log::WriteLog("function: MFXVideoPAK_ProcessFrameAsync(" + elapsed + ", " + context.dump_mfxStatus("status", status) + ") - \n\n");
+                }
+            }
+
             return status;
         }
     }
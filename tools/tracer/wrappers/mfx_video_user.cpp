@@ -33,6 +33,7 @@ File Name: mfx_video_user.cpp
 
 #include "../loggers/timer.h"
 #include "../tracer/functions_table.h"
+#include "../tracer/sampler.h"
 #include "mfx_structures.h"
 
 #if TRACE_CALLBACKS
@@ -1355,7 +1356,7 @@ mfxStatus MFXVideoUSER_Unregister(mfxSession session, mfxU32 type)
 mfxStatus MFXVideoUSER_ProcessFrameAsync(mfxSession session, const mfxHDL *in, mfxU32 in_num, const mfxHDL *out, mfxU32 out_num, mfxSyncPoint *syncp)
 {
     try {
-        if (Log::GetLogLevel() >= LOG_LEVEL_FULL) // call with logging
+        if (Log::GetLogLevel() >= LOG_LEVEL_FULL && Sampler::LogCall(eMFXVideoUSER_ProcessFrameAsync_tracer)) // call with logging
         {
             DumpContext context;
             context.context = DUMPCONTEXT_MFX;
@@ -1385,7 +1386,8 @@ mfxStatus MFXVideoUSER_ProcessFrameAsync(mfxSession session, const mfxHDL *in, m
 
             Timer t;
             mfxStatus status = (*(fMFXVideoUSER_ProcessFrameAsync) proc) (session, in, in_num, out, out_num, syncp);
-            std::string elapsed = TimeToString(t.GetTime());
+            double time = t.GetTime();
+            std::string elapsed = TimeToString(time);
             if (syncp) {
                 sp.syncPoint = (*syncp);
             }
@@ -1403,6 +1405,8 @@ mfxStatus MFXVideoUSER_ProcessFrameAsync(mfxSession session, const mfxHDL *in, m
 
             Log::WriteLog("function: MFXVideoUSER_ProcessFrameAsync(" + elapsed + ", " + context.dump_mfxStatus("status", status) + ") - \n\n");
 
+            Sampler::Complete(eMFXVideoUSER_ProcessFrameAsync_tracer, time, status, true);
+
             return status;
         }
         else // call without logging
@@ -1419,8 +1423,30 @@ mfxStatus MFXVideoUSER_ProcessFrameAsync(mfxSession session, const mfxHDL *in, m
 
             session = loader->session;
             
+            Timer t;
             mfxStatus status = (*(fMFXVideoUSER_ProcessFrameAsync) proc) (session, in, in_num, out, out_num, syncp);
 
+            if (Sampler::IsEnabled())
+            {
+                double time = t.GetTime();
+                if (Sampler::Complete(eMFXVideoUSER_ProcessFrameAsync_tracer, time, status, false))
+                {
+                    // not sampled, but failed or slow
+                    std::string elapsed = TimeToString(time);
+                    Log::WriteLog("function: MFXVideoUSER_ProcessFrameAsync(mfxSession session=, const mfxHDL *in, mfxU32 in_num, const mfxHDL *out, mfxU32 out_num, mfxSyncPoint *syncp) +");
+                    Log::WriteLog(">> MFXVideoUSER_ProcessFrameAsync called");
+
+                    Log::WriteLog(context.dump("session", session));
+                    Log::WriteLog(context.dump_mfxHDL("in", in));
+                    Log::WriteLog(context.dump_mfxU32("in_num", in_num));
+                    Log::WriteLog(context.dump_mfxHDL("out", out));
+                    Log::WriteLog(context.dump_mfxU32("out_num", out_num));
+                    Log::WriteLog(context.dump("syncp", (syncp ? *syncp : NULL)));
+
+                    Log::WriteLog("function: MFXVideoUSER_ProcessFrameAsync(" + elapsed + ", " + context.dump_mfxStatus("status", status) + ") - \n\n");
+                }
+            }
+
             return status;
         }
     }
@@ -33,6 +33,7 @@ File Name: mfx_video_vpp.cpp
 
 #include "../loggers/timer.h"
 #include "../tracer/functions_table.h"
+#include "../tracer/sampler.h"
 #include "mfx_structures.h"
 
 // VPP interface functions
@@ -265,7 +266,7 @@ mfxStatus MFXVideoVPP_GetVPPStat(mfxSession session, mfxVPPStat *stat)
 mfxStatus MFXVideoVPP_RunFrameVPPAsync(mfxSession session, mfxFrameSurface1 *in, mfxFrameSurface1 *out, mfxExtVppAuxData *aux, mfxSyncPoint *syncp)
 {
     try{
-        if (Log::GetLogLevel() >= LOG_LEVEL_FULL) // call with logging
+        if (Log::GetLogLevel() >= LOG_LEVEL_FULL && Sampler::LogCall(eMFXVideoVPP_RunFrameVPPAsync_tracer)) // call with logging
         {
             DumpContext context;
             context.context = DUMPCONTEXT_VPP;
@@ -297,7 +298,8 @@ mfxStatus MFXVideoVPP_RunFrameVPPAsync(mfxSession session, mfxFrameSurface1 *in,
             Timer t;
             mfxStatus status = (*(fMFXVideoVPP_RunFrameVPPAsync) proc) (session, in, out, aux, syncp);
 
-            std::string elapsed = TimeToString(t.GetTime());
+            double time = t.GetTime();
+            std::string elapsed = TimeToString(time);
 
             if (syncp) {
                 sp.syncPoint = (*syncp);
@@ -314,6 +316,8 @@ mfxStatus MFXVideoVPP_RunFrameVPPAsync(mfxSession session, mfxFrameSurface1 *in,
             Log::WriteLog(context.dump("syncp", sp.syncPoint));
             Log::WriteLog("function: MFXVideoVPP_RunFrameVPPAsync(" + elapsed + ", " + context.dump_mfxStatus("status", status) + ") - \n\n");
 
+            Sampler::Complete(eMFXVideoVPP_RunFrameVPPAsync_tracer, time, status, true);
+
             return status;
         }
         else // call withot logging
@@ -330,8 +334,27 @@ mfxStatus MFXVideoVPP_RunFrameVPPAsync(mfxSession session, mfxFrameSurface1 *in,
 
             session = loader->session;
 
+            Timer t;
             mfxStatus status = (*(fMFXVideoVPP_RunFrameVPPAsync) proc) (session, in, out, aux, syncp);
 
+            if (Sampler::IsEnabled())
+            {
+                double time = t.GetTime();
+                if (Sampler::Complete(eMFXVideoVPP_RunFrameVPPAsync_tracer, time, status, false))
+                {
+                    // not sampled, but failed or slow
+                    std::string elapsed = TimeToString(time);
+                    Log::WriteLog("function: MFXVideoVPP_RunFrameVPPAsync(mfxSession session=" + ToString((mfxSession)loader) + ", mfxFrameSurface1 *in, mfxFrameSurface1 *out, mfxExtVppAuxData *aux, mfxSyncPoint *syncp) +");
+                    Log::WriteLog(">> MFXVideoVPP_RunFrameVPPAsync called");
+                    Log::WriteLog(context.dump("session", session));
+                    if(in) Log::WriteLog(context.dump("in", *in));
+                    if(out) Log::WriteLog(context.dump("out", *out));
+                    if(aux) Log::WriteLog(context.dump("aux", *aux));
+                    Log::WriteLog(context.dump("syncp", (syncp ? *syncp : NULL)));
+                    Log::WriteLog("function: MFXVideoVPP_RunFrameVPPAsync(" + elapsed + ", " + context.dump_mfxStatus("status", status) + ") - \n\n");
+                }
+            }
+
             return status;
         }
     }
@@ -344,7 +367,7 @@ mfxStatus MFXVideoVPP_RunFrameVPPAsync(mfxSession session, mfxFrameSurface1 *in,
 mfxStatus MFXVideoVPP_RunFrameVPPAsyncEx(mfxSession session, mfxFrameSurface1 *in, mfxFrameSurface1 *work, mfxFrameSurface1 **out, mfxSyncPoint *syncp)
 {
     try{
-        if (Log::GetLogLevel() >= LOG_LEVEL_FULL) // call with logging
+        if (Log::GetLogLevel() >= LOG_LEVEL_FULL && Sampler::LogCall(eMFXVideoVPP_RunFrameVPPAsyncEx_tracer)) // call with logging
         {
             DumpContext context;
             context.context = DUMPCONTEXT_VPP;
@@ -378,7 +401,8 @@ mfxStatus MFXVideoVPP_RunFrameVPPAsyncEx(mfxSession session, mfxFrameSurface1 *i
             Timer t;
             mfxStatus status = (*(fMFXVideoVPP_RunFrameVPPAsyncEx) proc) (session, in, work, out, syncp);
 
-            std::string elapsed = TimeToString(t.GetTime());
+            double time = t.GetTime();
+            std::string elapsed = TimeToString(time);
 
             if (syncp) {
                 sp.syncPoint = (*syncp);
@@ -398,6 +422,8 @@ mfxStatus MFXVideoVPP_RunFrameVPPAsyncEx(mfxSession session, mfxFrameSurface1 *i
             Log::WriteLog(context.dump("syncp", sp.syncPoint));
             Log::WriteLog("function: MFXVideoVPP_RunFrameVPPAsyncEx(" + elapsed + ", " + context.dump_mfxStatus("status", status) + ") - \n\n");
 
+            Sampler::Complete(eMFXVideoVPP_RunFrameVPPAsyncEx_tracer, time, status, true);
+
             return status;
         }
         else //call without logging
@@ -414,8 +440,30 @@ mfxStatus MFXVideoVPP_RunFrameVPPAsyncEx(mfxSession session, mfxFrameSurface1 *i
 
             session = loader->session;
 
+            Timer t;
             mfxStatus status = (*(fMFXVideoVPP_RunFrameVPPAsyncEx) proc) (session, in, work, out, syncp);
 
+            if (Sampler::IsEnabled())
+            {
+                double time = t.GetTime();
+                if (Sampler::Complete(eMFXVideoVPP_RunFrameVPPAsyncEx_tracer, time, status, false))
+                {
+                    // not sampled, but failed or slow
+                    std::string elapsed = TimeToString(time);
+                    Log::WriteLog("function: MFXVideoVPP_RunFrameVPPAsyncEx(mfxSession session=" + ToString((mfxSession)loader) + ", mfxFrameSurface1 *in, mfxFrameSurface1 *work, mfxExtVppAuxData *aux, mfxSyncPoint *syncp) +");
+                    Log::WriteLog(">> MFXVideoVPP_RunFrameVPPAsyncEx called");
+                    Log::WriteLog(context.dump("session", session));
+                    if(in) Log::WriteLog(context.dump("in", *in));
+                    if(work) Log::WriteLog(context.dump("work", *work));
+                    if (out) {
+                        if (*out)
+                            Log::WriteLog(context.dump("out", **out));
+                    }
+                    Log::WriteLog(context.dump("syncp", (syncp ? *syncp : NULL)));
+                    Log::WriteLog("function: MFXVideoVPP_RunFrameVPPAsyncEx(" + elapsed + ", " + context.dump_mfxStatus("status", status) + ") - \n\n");
+                }
+            }
+
             return status;
         }
     }